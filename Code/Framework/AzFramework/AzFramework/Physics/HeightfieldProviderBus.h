@@ -12,6 +12,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/functional.h>
 #include <AzFramework/Physics/Material.h>
 
 namespace Physics
@@ -46,6 +47,10 @@ namespace Physics
         uint16_t m_padding{ 0 }; //!< available for future use.
     };
 
+    //! Callback that receives a single heightfield sample, along with its location in the heightfield grid.
+    using UpdateHeightfieldSampleFunction =
+        AZStd::function<void(size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)>;
+
     //! An interface to provide heightfield values.
     class HeightfieldProviderRequests
         : public AZ::ComponentBus
@@ -104,6 +109,27 @@ namespace Physics
         //! Returns the list of heights and materials used by the height field.
         //! @return the rows*columns vector of the heights and materials.
         virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const = 0;
+
+        //! Returns the range of heightfield grid points that are covered by a region.
+        //! @param region the world space region to find the grid points for.
+        //! @param startColumn contains the first column in the range.
+        //! @param startRow contains the first row in the range.
+        //! @param numColumns contains the number of columns in the range, or 0 if the region doesn't overlap the heightfield.
+        //! @param numRows contains the number of rows in the range, or 0 if the region doesn't overlap the heightfield.
+        virtual void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const = 0;
+
+        //! Generates the heights and materials for a sub-rectangle of the heightfield grid.
+        //! This lets listeners refresh just the part of the heightfield that changed instead of requesting all of it again.
+        //! The callback can get called from multiple threads at once, but only once for each grid point in the sub-rectangle.
+        //! @param updateHeightsMaterialsCallback the callback that receives each generated height and material.
+        //! @param startColumn the first column of the sub-rectangle.
+        //! @param startRow the first row of the sub-rectangle.
+        //! @param numColumns the number of columns in the sub-rectangle.
+        //! @param numRows the number of rows in the sub-rectangle.
+        virtual void UpdateHeightsAndMaterials(
+            const UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const = 0;
     };
 
     using HeightfieldProviderRequestsBus = AZ::EBus<HeightfieldProviderRequests>;
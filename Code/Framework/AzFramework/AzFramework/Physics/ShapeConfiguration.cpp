@@ -418,6 +418,16 @@ namespace Physics
         m_samples = samples;
     }
 
+    void HeightfieldShapeConfiguration::ModifySample(size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+    {
+        const size_t index = (row * m_numColumns) + column;
+        AZ_Assert(index < m_samples.size(), "Heightfield sample (%zu, %zu) is out of range.", column, row);
+        if (index < m_samples.size())
+        {
+            m_samples[index] = point;
+        }
+    }
+
     float HeightfieldShapeConfiguration::GetMinHeightBounds() const
     {
         return m_minHeightBounds;
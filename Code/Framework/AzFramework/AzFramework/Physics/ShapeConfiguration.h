@@ -229,6 +229,8 @@ namespace Physics
         void SetNumRows(int32_t numRows);
         const AZStd::vector<Physics::HeightMaterialPoint>& GetSamples() const;
         void SetSamples(const AZStd::vector<Physics::HeightMaterialPoint>& samples);
+        //! Replaces a single sample in the grid. Different samples can be modified from multiple threads at once.
+        void ModifySample(size_t column, size_t row, const Physics::HeightMaterialPoint& point);
         float GetMinHeightBounds() const;
         void SetMinHeightBounds(float minBounds);
         float GetMaxHeightBounds() const;
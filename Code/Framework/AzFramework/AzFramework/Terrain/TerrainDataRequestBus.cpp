@@ -78,6 +78,8 @@ namespace AzFramework::Terrain
                     &AzFramework::Terrain::TerrainDataRequestBus::Events::BehaviorContextGetSurfaceWeightsFromVector2)
                 ->Event("GetIsHole", &AzFramework::Terrain::TerrainDataRequestBus::Events::GetIsHole)
                 ->Event("GetIsHoleFromFloats", &AzFramework::Terrain::TerrainDataRequestBus::Events::GetIsHoleFromFloats)
+                ->Event("GetIsLoaded", &AzFramework::Terrain::TerrainDataRequestBus::Events::GetIsLoaded)
+                ->Event("GetIsLoadedFromFloats", &AzFramework::Terrain::TerrainDataRequestBus::Events::GetIsLoadedFromFloats)
                 ->Event("GetSurfacePoint", &AzFramework::Terrain::TerrainDataRequestBus::Events::BehaviorContextGetSurfacePoint)
                 ->Event(
                     "GetSurfacePointFromVector2",
@@ -73,6 +73,12 @@ namespace AzFramework
             virtual bool GetIsHoleFromVector2(const AZ::Vector2& position, Sampler sampleFilter = Sampler::BILINEAR) const = 0;
             virtual bool GetIsHoleFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR) const = 0;
 
+            //! Returns true if the terrain data at location x,y is resident in memory.
+            //! Terrain systems that stream their data in around observers return false for locations that haven't been
+            //! streamed in yet, and report that no terrain exists at those locations until they are.
+            virtual bool GetIsLoaded(const AZ::Vector3& position) const = 0;
+            virtual bool GetIsLoadedFromFloats(float x, float y) const = 0;
+
             // Given an XY coordinate, return the surface normal.
             //! @terrainExists: Can be nullptr. If != nullptr then, if there's no terrain at location x,y or location x,y is inside a
             //! terrain HOLE then *terrainExistsPtr will be set to false, otherwise *terrainExistsPtr will be set to true.
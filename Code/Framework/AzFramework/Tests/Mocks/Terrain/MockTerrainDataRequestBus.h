@@ -59,6 +59,8 @@ namespace UnitTest
         MOCK_CONST_METHOD2(GetIsHole, bool(const AZ::Vector3&, Sampler));
         MOCK_CONST_METHOD2(GetIsHoleFromVector2, bool(const AZ::Vector2&, Sampler));
         MOCK_CONST_METHOD3(GetIsHoleFromFloats, bool(float, float, Sampler));
+        MOCK_CONST_METHOD1(GetIsLoaded, bool(const AZ::Vector3&));
+        MOCK_CONST_METHOD2(GetIsLoadedFromFloats, bool(float, float));
         MOCK_CONST_METHOD3(GetNormal, AZ::Vector3(const AZ::Vector3&, Sampler, bool*));
         MOCK_CONST_METHOD3(GetNormalFromVector2, AZ::Vector3(const AZ::Vector2&, Sampler, bool*));
         MOCK_CONST_METHOD4(GetNormalFromFloats, AZ::Vector3(float, float, Sampler, bool*));
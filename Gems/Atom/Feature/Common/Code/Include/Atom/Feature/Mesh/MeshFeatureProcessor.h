@@ -19,6 +19,9 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
 
 #include <AzCore/Component/TickBus.h>
@@ -29,6 +32,7 @@ namespace AZ
     {
         class TransformServiceFeatureProcessor;
         class RayTracingFeatureProcessor;
+        class MeshFeatureProcessor;
 
         class ModelDataInstance
         {
@@ -85,7 +89,11 @@ namespace AZ
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
+            uint8_t GetStencilRef(bool materialRequiresForwardPassIblSpecular) const;
+            void SetUseForwardPassIblSpecular(bool useForwardPassIblSpecular);
             void SetVisible(bool isVisible);
+            //! Queues this mesh to be updated by the next MeshFeatureProcessor::Simulate(), which only visits queued meshes.
+            void QueueForUpdate();
 
             using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
 
@@ -103,8 +111,17 @@ namespace AZ
             AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgList;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
+            MeshFeatureProcessor* m_featureProcessor = nullptr;
             RHI::DrawItemSortKey m_sortKey;
 
+            static constexpr size_t InvalidUpdateQueueIndex = AZStd::numeric_limits<size_t>::max();
+
+            //! The index of this mesh in MeshFeatureProcessor::m_meshesToUpdate, or InvalidUpdateQueueIndex if it isn't queued.
+            size_t m_updateQueueIndex = InvalidUpdateQueueIndex;
+
+            //! The materials of the draw packets, which MeshFeatureProcessor watches for changes on behalf of this mesh.
+            AZStd::vector<const RPI::Material*> m_trackedMaterials;
+
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
 
             Aabb m_aabb = Aabb::CreateNull();
@@ -121,6 +138,8 @@ namespace AZ
         class MeshFeatureProcessor final
             : public MeshFeatureProcessorInterface
         {
+            friend class ModelDataInstance;
+
         public:
 
             AZ_RTTI(AZ::Render::MeshFeatureProcessor, "{6E3DFA1D-22C7-4738-A3AE-1E10AB88B29B}", MeshFeatureProcessorInterface);
@@ -195,13 +214,49 @@ namespace AZ
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
-                        
+
+            void QueueMeshForUpdate(ModelDataInstance& meshData);
+            void QueueMeshForUpdateNoLock(ModelDataInstance& meshData);
+            void RemoveMeshFromUpdateQueue(ModelDataInstance& meshData);
+
+            //! Starts or stops watching the materials used by the draw packets of a mesh.
+            void TrackMaterials(ModelDataInstance& meshData);
+            void UntrackMaterials(ModelDataInstance& meshData);
+
+            //! Queues the meshes of every material that changed since its meshes were last updated.
+            void QueueMeshesWithChangedMaterials();
+
+            //! The meshes whose draw packets use a material.
+            struct MaterialUsage
+            {
+                Data::Instance<RPI::Material> m_material;
+                //! The change id of the material when its meshes were last queued, see RPI::Material::GetCurrentChangeId().
+                RPI::Material::ChangeId m_changeId = RPI::Material::DEFAULT_CHANGE_ID;
+                AZStd::unordered_set<ModelDataInstance*> m_meshes;
+            };
+
+            //! The number of queued meshes that each job of Simulate() updates.
+            static constexpr size_t MeshesPerSimulateJob = 128;
+
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             bool m_forceRebuildDrawPackets = false;
+
+            //! Guards m_meshesToUpdate and m_materialUsages, since meshes are modified from outside of Simulate().
+            AZStd::mutex m_meshesToUpdateMutex;
+
+            //! The meshes whose transform, material, draw packets or visibility changed since the last Simulate().
+            AZStd::vector<ModelDataInstance*> m_meshesToUpdate;
+
+            //! The meshes being updated by the current Simulate(), kept to reuse its memory.
+            AZStd::vector<ModelDataInstance*> m_meshesBeingUpdated;
+
+            //! Material changes aren't reported to the meshes, so their change ids are checked once per material
+            //! instead of once per draw packet.
+            AZStd::unordered_map<const RPI::Material*, MaterialUsage> m_materialUsages;
         };
     } // namespace Render
 } // namespace AZ
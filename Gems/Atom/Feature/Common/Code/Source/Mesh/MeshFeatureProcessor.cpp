@@ -80,45 +80,67 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
-            const auto iteratorRanges = m_modelData.GetParallelRanges();
+            if (m_forceRebuildDrawPackets)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+                for (ModelDataInstance& meshData : m_modelData)
+                {
+                    QueueMeshForUpdateNoLock(meshData);
+                }
+            }
+
+            QueueMeshesWithChangedMaterials();
+
+            // Only the meshes whose transform, material, draw packets or visibility changed since the last frame are visited.
+            // Nothing else is submitted while Simulate() runs, so this is also where the draw packets are patched.
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+                AZStd::swap(m_meshesToUpdate, m_meshesBeingUpdated);
+                for (ModelDataInstance* meshData : m_meshesBeingUpdated)
+                {
+                    meshData->m_updateQueueIndex = ModelDataInstance::InvalidUpdateQueueIndex;
+                }
+            }
+
             AZ::JobCompletion jobCompletion;
-            for (const auto& iteratorRange : iteratorRanges)
+            for (size_t rangeStart = 0; rangeStart < m_meshesBeingUpdated.size(); rangeStart += MeshesPerSimulateJob)
             {
-                const auto jobLambda = [&]() -> void
+                const size_t rangeEnd = AZStd::min(rangeStart + MeshesPerSimulateJob, m_meshesBeingUpdated.size());
+                const auto jobLambda = [this, rangeStart, rangeEnd]() -> void
                 {
                     AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Job");
 
-                    for (auto meshDataIter = iteratorRange.first; meshDataIter != iteratorRange.second; ++meshDataIter)
+                    for (size_t meshIndex = rangeStart; meshIndex < rangeEnd; ++meshIndex)
                     {
-                        if (!meshDataIter->m_model)
+                        ModelDataInstance* meshData = m_meshesBeingUpdated[meshIndex];
+                        if (!meshData->m_model)
                         {
-                            continue;   // model not loaded yet
+                            continue;   // model not loaded yet, Init() queues the mesh again
                         }
 
-                        if (!meshDataIter->m_visible)
+                        if (!meshData->m_visible)
                         {
-                            continue;
+                            continue;   // SetVisible() queues the mesh again
                         }
 
-                        if (meshDataIter->m_objectSrgNeedsUpdate)
+                        if (meshData->m_objectSrgNeedsUpdate)
                         {
-                            meshDataIter->UpdateObjectSrg();
+                            meshData->UpdateObjectSrg();
                         }
 
-                        // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                        // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                        // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                        // to check every one.
-                        meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
+                        // Material properties can impact which actual shader is used, which impacts the SRG in the draw packet,
+                        // so meshes are queued when one of their materials changes. Unchanged draw packets early out, and draw
+                        // packets which only need a different shader variant or draw item state are patched in place.
+                        meshData->UpdateDrawPackets(m_forceRebuildDrawPackets);
 
-                        if (meshDataIter->m_cullableNeedsRebuild)
+                        if (meshData->m_cullableNeedsRebuild)
                         {
-                            meshDataIter->BuildCullable();
+                            meshData->BuildCullable();
                         }
 
-                        if (meshDataIter->m_cullBoundsNeedsUpdate)
+                        if (meshData->m_cullBoundsNeedsUpdate)
                         {
-                            meshDataIter->UpdateCullBounds(m_transformService);
+                            meshData->UpdateCullBounds(m_transformService);
                         }
                     }
                 };
@@ -145,6 +167,7 @@ namespace AZ
                 }
             }
 
+            m_meshesBeingUpdated.clear();
             m_forceRebuildDrawPackets = false;
         }
 
@@ -169,6 +192,7 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_featureProcessor = this;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -194,6 +218,7 @@ namespace AZ
             {
                 meshHandle->m_meshLoader.reset();
                 meshHandle->DeInit();
+                RemoveMeshFromUpdateQueue(*meshHandle);
                 m_transformService->ReleaseObjectId(meshHandle->m_objectId);
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
@@ -240,6 +265,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                meshHandle->QueueForUpdate();
             }
         }
 
@@ -269,6 +295,7 @@ namespace AZ
                 }
 
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                meshHandle->QueueForUpdate();
             }
         }
 
@@ -292,6 +319,7 @@ namespace AZ
                 ModelDataInstance& modelData = *meshHandle;
                 modelData.m_cullBoundsNeedsUpdate = true;
                 modelData.m_objectSrgNeedsUpdate = true;
+                modelData.QueueForUpdate();
 
                 m_transformService->SetTransformForId(meshHandle->m_objectId, transform, nonUniformScale);
 
@@ -311,6 +339,7 @@ namespace AZ
                 modelData.m_aabb = localAabb;
                 modelData.m_cullBoundsNeedsUpdate = true;
                 modelData.m_objectSrgNeedsUpdate = true;
+                modelData.QueueForUpdate();
             }
         };
 
@@ -461,17 +490,7 @@ namespace AZ
         {
             if (meshHandle.IsValid())
             {
-                meshHandle->m_descriptor.m_useForwardPassIblSpecular = useForwardPassIblSpecular;
-                meshHandle->m_objectSrgNeedsUpdate = true;
-
-                if (meshHandle->m_model)
-                {
-                    const size_t modelLodCount = meshHandle->m_model->GetLodCount();
-                    for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
-                    {
-                        meshHandle->BuildDrawPacketList(modelLodIndex);
-                    }
-                }
+                meshHandle->SetUseForwardPassIblSpecular(useForwardPassIblSpecular);
             }
         }
 
@@ -498,6 +517,111 @@ namespace AZ
                 if (meshInstance.m_descriptor.m_useForwardPassIblSpecular)
                 {
                     meshInstance.m_objectSrgNeedsUpdate = true;
+                    meshInstance.QueueForUpdate();
+                }
+            }
+        }
+
+        void MeshFeatureProcessor::QueueMeshForUpdate(ModelDataInstance& meshData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+            QueueMeshForUpdateNoLock(meshData);
+        }
+
+        void MeshFeatureProcessor::QueueMeshForUpdateNoLock(ModelDataInstance& meshData)
+        {
+            if (meshData.m_updateQueueIndex == ModelDataInstance::InvalidUpdateQueueIndex)
+            {
+                meshData.m_updateQueueIndex = m_meshesToUpdate.size();
+                m_meshesToUpdate.push_back(&meshData);
+            }
+        }
+
+        void MeshFeatureProcessor::RemoveMeshFromUpdateQueue(ModelDataInstance& meshData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+            const size_t queueIndex = meshData.m_updateQueueIndex;
+            if (queueIndex == ModelDataInstance::InvalidUpdateQueueIndex)
+            {
+                return;
+            }
+
+            ModelDataInstance* lastMeshData = m_meshesToUpdate.back();
+            m_meshesToUpdate[queueIndex] = lastMeshData;
+            lastMeshData->m_updateQueueIndex = queueIndex;
+            m_meshesToUpdate.pop_back();
+            meshData.m_updateQueueIndex = ModelDataInstance::InvalidUpdateQueueIndex;
+        }
+
+        void MeshFeatureProcessor::TrackMaterials(ModelDataInstance& meshData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+            for (auto& drawPacketList : meshData.m_drawPacketListsByLod)
+            {
+                for (auto& drawPacket : drawPacketList)
+                {
+                    Data::Instance<RPI::Material> material = drawPacket.GetMaterial();
+                    if (!material)
+                    {
+                        continue;
+                    }
+
+                    // New materials start out with DEFAULT_CHANGE_ID, so their meshes are visited until the material is compiled.
+                    MaterialUsage& usage = m_materialUsages[material.get()];
+                    if (!usage.m_material)
+                    {
+                        usage.m_material = material;
+                    }
+
+                    if (usage.m_meshes.insert(&meshData).second)
+                    {
+                        meshData.m_trackedMaterials.push_back(material.get());
+                    }
+                }
+            }
+        }
+
+        void MeshFeatureProcessor::UntrackMaterials(ModelDataInstance& meshData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+            for (const RPI::Material* material : meshData.m_trackedMaterials)
+            {
+                auto usageIter = m_materialUsages.find(material);
+                if (usageIter != m_materialUsages.end())
+                {
+                    usageIter->second.m_meshes.erase(&meshData);
+                    if (usageIter->second.m_meshes.empty())
+                    {
+                        m_materialUsages.erase(usageIter);
+                    }
+                }
+            }
+            meshData.m_trackedMaterials.clear();
+        }
+
+        void MeshFeatureProcessor::QueueMeshesWithChangedMaterials()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: QueueMeshesWithChangedMaterials");
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_meshesToUpdateMutex);
+            for (auto& [material, usage] : m_materialUsages)
+            {
+                const RPI::Material::ChangeId changeId = usage.m_material->GetCurrentChangeId();
+                if (changeId == usage.m_changeId)
+                {
+                    continue;
+                }
+
+                for (ModelDataInstance* meshData : usage.m_meshes)
+                {
+                    QueueMeshForUpdateNoLock(*meshData);
+                }
+
+                // The draw packets only pick up the change once the material is compiled, so its meshes are queued again
+                // every frame until then.
+                if (!usage.m_material->NeedsCompile())
+                {
+                    usage.m_changeId = changeId;
                 }
             }
         }
@@ -635,6 +759,8 @@ namespace AZ
 
             RemoveRayTracingData();
 
+            m_featureProcessor->UntrackMaterials(*this);
+
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
             m_objectSrgList = {};
@@ -645,9 +771,11 @@ namespace AZ
         {
             m_model = model;
             const size_t modelLodCount = m_model->GetLodCount();
-            m_drawPacketListsByLod.resize(modelLodCount);
+            // fixed_vector::resize() copies the new elements, which MeshDrawPacket doesn't allow
+            m_drawPacketListsByLod.clear();
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
             {
+                m_drawPacketListsByLod.emplace_back();
                 BuildDrawPacketList(modelLodIndex);
             }
 
@@ -669,6 +797,9 @@ namespace AZ
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
+
+            m_featureProcessor->TrackMaterials(*this);
+            QueueForUpdate();
         }
 
         void ModelDataInstance::BuildDrawPacketList(size_t modelLodIndex)
@@ -748,11 +879,7 @@ namespace AZ
                 // track whether any materials in this mesh require ForwardPassIblSpecular, we need this information when the ObjectSrg is updated
                 m_hasForwardPassIblSpecularMaterial |= materialRequiresForwardPassIblSpecular;
 
-                // stencil bits
-                uint8_t stencilRef = m_descriptor.m_useForwardPassIblSpecular || materialRequiresForwardPassIblSpecular ? Render::StencilRefs::None : Render::StencilRefs::UseIBLSpecularPass;
-                stencilRef |= Render::StencilRefs::UseDiffuseGIPass;
-
-                drawPacket.SetStencilRef(stencilRef);
+                drawPacket.SetStencilRef(GetStencilRef(materialRequiresForwardPassIblSpecular));
                 drawPacket.SetSortKey(m_sortKey);
                 drawPacket.Update(*m_scene, false);
                 drawPacketListOut.emplace_back(AZStd::move(drawPacket));
@@ -1046,6 +1173,7 @@ namespace AZ
                     drawPacket.SetSortKey(sortKey);
                 }
             }
+            QueueForUpdate();
         }
 
         RHI::DrawItemSortKey ModelDataInstance::GetSortKey() const
@@ -1271,10 +1399,51 @@ namespace AZ
             return false;
         }
 
+        uint8_t ModelDataInstance::GetStencilRef(bool materialRequiresForwardPassIblSpecular) const
+        {
+            // stencil bits
+            uint8_t stencilRef = m_descriptor.m_useForwardPassIblSpecular || materialRequiresForwardPassIblSpecular ? Render::StencilRefs::None : Render::StencilRefs::UseIBLSpecularPass;
+            stencilRef |= Render::StencilRefs::UseDiffuseGIPass;
+            return stencilRef;
+        }
+
+        void ModelDataInstance::SetUseForwardPassIblSpecular(bool useForwardPassIblSpecular)
+        {
+            m_descriptor.m_useForwardPassIblSpecular = useForwardPassIblSpecular;
+            m_objectSrgNeedsUpdate = true;
+
+            // The existing draw packets are patched rather than rebuilt. The stencil ref and the shader option,
+            // which selects the new shader variant, are both applied on the next UpdateDrawPackets().
+            for (auto& drawPacketList : m_drawPacketListsByLod)
+            {
+                for (auto& drawPacket : drawPacketList)
+                {
+                    if (!drawPacket.SetShaderOption(AZ::Name("o_meshUseForwardPassIBLSpecular"), AZ::RPI::ShaderOptionValue{ useForwardPassIblSpecular }))
+                    {
+                        AZ_Warning("MeshDrawPacket", false, "Failed to set o_meshUseForwardPassIBLSpecular on mesh draw packet");
+                    }
+
+                    drawPacket.SetStencilRef(GetStencilRef(MaterialRequiresForwardPassIblSpecular(drawPacket.GetMaterial())));
+                }
+            }
+            QueueForUpdate();
+        }
+
         void ModelDataInstance::SetVisible(bool isVisible)
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+
+            // Hidden meshes are skipped by Simulate(), so they have to catch up on the changes they missed.
+            if (isVisible)
+            {
+                QueueForUpdate();
+            }
+        }
+
+        void ModelDataInstance::QueueForUpdate()
+        {
+            m_featureProcessor->QueueMeshForUpdate(*this);
         }
     } // namespace Render
 } // namespace AZ
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        //! Describes a single pipeline state which was compiled in a previous run of the application.
+        //!
+        //! Shader byte code and pipeline layouts are shared by many pipeline states and are already stored
+        //! in the shader assets, so they are referenced by hash rather than duplicated. At load time, the
+        //! owner of the database resolves the hashes against the currently loaded shader data. Any entry
+        //! referencing data which no longer exists (i.e. the shader was rebuilt) is considered stale.
+        struct PipelineStateCacheDatabaseEntry
+        {
+            AZ_TYPE_INFO(PipelineStateCacheDatabaseEntry, "{3F0E2F8D-56C4-4B35-8A53-3C8B4E0B4D61}");
+            static void Reflect(ReflectContext* context);
+
+            //! The PipelineStateType of the described pipeline state.
+            uint32_t m_type = 0;
+
+            //! The hash of the full pipeline state descriptor. Used to validate the rebuilt descriptor.
+            uint64_t m_pipelineStateHash = 0;
+
+            //! The hash of the pipeline layout descriptor.
+            uint64_t m_pipelineLayoutHash = 0;
+
+            //! Hashes of the shader stage functions, indexed by ShaderStage. Zero means no function is bound.
+            AZStd::vector<uint64_t> m_functionHashes;
+
+            //! Fixed-function state. Only relevant for draw pipeline states.
+            InputStreamLayout m_inputStreamLayout;
+            RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            RenderStates m_renderStates;
+        };
+
+        //! A versioned, serializable record of the pipeline states held by a PipelineStateCache library.
+        //!
+        //! Unlike PipelineLibraryData, which is an opaque, driver-specific blob that only speeds up compilation,
+        //! this database records *which* pipeline states were compiled. This allows the owner of a library to
+        //! pre-warm the cache on a background thread at startup, before the pipeline states are first requested
+        //! by the renderer.
+        //!
+        //! The validation key is provided by the owner (e.g. a hash of the shader asset build) and is compared
+        //! at load time to discard the database when the source data has changed.
+        class PipelineStateCacheDatabase final
+            : public AZStd::intrusive_base
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PipelineStateCacheDatabase, SystemAllocator, 0);
+            AZ_TYPE_INFO(PipelineStateCacheDatabase, "{0C9C0B4B-8A57-4B77-A4C1-4E8AFC3B2E0F}");
+
+            static void Reflect(ReflectContext* context);
+
+            static ConstPtr<PipelineStateCacheDatabase> Create(uint64_t validationKey, AZStd::vector<PipelineStateCacheDatabaseEntry>&& entries);
+
+            //! Returns the key provided by the owner when the database was created.
+            uint64_t GetValidationKey() const;
+
+            //! Returns true if the database was generated with the provided validation key.
+            bool IsValid(uint64_t validationKey) const;
+
+            AZStd::span<const PipelineStateCacheDatabaseEntry> GetEntries() const;
+
+        private:
+            PipelineStateCacheDatabase() = default;
+
+            AZ_SERIALIZE_FRIEND();
+
+            uint64_t m_validationKey = 0;
+            AZStd::vector<PipelineStateCacheDatabaseEntry> m_entries;
+        };
+    }
+}
@@ -58,6 +58,20 @@ namespace AZ
             //! Returns the draw filter mask which applied to all the draw items.
             DrawFilterMask GetDrawFilterMask() const;
 
+            //! The following functions patch the packet in place, without reallocating it. They allow an owner which
+            //! retains a packet across frames to update the few fields that change frequently instead of rebuilding it.
+            //! Draw lists reference the draw items of submitted packets until the frame's command lists are recorded, so these
+            //! must only be called where the packet isn't part of any draw list, e.g. from FeatureProcessor::Simulate().
+
+            //! Sets the stencil reference value of all the draw items.
+            void SetStencilRef(uint8_t stencilRef);
+
+            //! Sets the sort key of all the draw items.
+            void SetSortKey(DrawItemSortKey sortKey);
+
+            //! Replaces the pipeline state of the draw item associated with the provided index.
+            void SetPipelineState(size_t index, const PipelineState* pipelineState);
+
             //! Overloaded operator delete for freeing a draw packet.
             void operator delete(void* p, size_t size);
 
@@ -86,10 +100,10 @@ namespace AZ
             uint8_t m_viewportsCount = 0;
 
             // List of draw items.
-            const DrawItem* m_drawItems = nullptr;
+            DrawItem* m_drawItems = nullptr;
 
             // List of draw item sort keys associated with the draw item index.
-            const DrawItemSortKey* m_drawItemSortKeys = nullptr;
+            DrawItemSortKey* m_drawItemSortKeys = nullptr;
 
             // List of draw list tags associated with the draw item index.
             const DrawListTag* m_drawListTags = nullptr;
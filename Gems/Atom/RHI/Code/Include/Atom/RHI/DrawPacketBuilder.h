@@ -72,7 +72,7 @@ namespace AZ
 
             void AddDrawItem(const DrawRequest& request);
 
-            const DrawPacket* End();
+            DrawPacket* End();
 
         private:
             void ClearData();
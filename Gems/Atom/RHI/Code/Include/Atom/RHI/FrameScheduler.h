@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI.Reflect/MemoryStatistics.h>
 #include <Atom/RHI/FrameGraphBuilder.h>
 #include <Atom/RHI/FrameGraphExecuter.h>
@@ -105,6 +106,7 @@ namespace AZ
         //!      platforms (like mobile) do not have a way to extract exact GPU timings. Thus, they may instead represent
         //!      approximations.
         //!   3) GPU memory usage across the RHI associated with the device.
+        //!   4) The number of ShaderResourceGroups compiled, and the CPU time spent compiling them.
         //!
         //! The platform may or may not publish this information. If not, the method will return a null pointer.
         //!
@@ -170,6 +172,12 @@ namespace AZ
             //! Returns current CPU frame to frame time in milliseconds.
             double GetCpuFrameTime() const;
 
+            //! Returns the number of ShaderResourceGroups compiled during the previous frame.
+            uint32_t GetShaderResourceGroupCompileCount() const;
+
+            //! Returns the CPU time spent compiling ShaderResourceGroups during the previous frame, in milliseconds.
+            double GetShaderResourceGroupCompileTime() const;
+
             //! Returns memory statistics for the previous frame.
             const MemoryStatistics* GetMemoryStatistics() const;
 
@@ -194,6 +202,7 @@ namespace AZ
             void PrepareProducers();
             void CompileProducers();
             void CompileShaderResourceGroups();
+            void BuildShaderResourceGroupCompileBatches(uint32_t compilesPerBatch);
             void BuildRayTracingShaderTables();
 
             ScopeProducer* FindScopeProducer(const ScopeId& scopeId);
@@ -233,6 +242,19 @@ namespace AZ
             AZStd::vector<RHI::Ptr<RayTracingShaderTable>> m_rayTracingShaderTablesToBuild;
 
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+
+            //! A range of queued groups in a pool, compiled as part of a batch.
+            struct ShaderResourceGroupCompileChunk
+            {
+                ShaderResourceGroupPool* m_pool = nullptr;
+                Interval m_interval;
+            };
+
+            // SRG pools with queued groups for the current frame, and the chunks of those groups compiled by each job.
+            // Batch N compiles the chunks [m_shaderResourceGroupCompileBatchOffsets[N], m_shaderResourceGroupCompileBatchOffsets[N + 1]).
+            AZStd::vector<ShaderResourceGroupPool*> m_shaderResourceGroupPoolsToCompile;
+            AZStd::vector<ShaderResourceGroupCompileChunk> m_shaderResourceGroupCompileChunks;
+            AZStd::vector<uint32_t> m_shaderResourceGroupCompileBatchOffsets;
         };
     }
 }
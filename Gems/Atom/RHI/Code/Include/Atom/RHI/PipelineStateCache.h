@@ -10,6 +10,7 @@
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
+#include <Atom/RHI.Reflect/PipelineStateCacheDatabase.h>
 #include <AzCore/std/containers/bitset.h>
 #include <AzCore/Utils/TypeHash.h>
 
@@ -128,6 +129,23 @@ namespace AZ
             //! The merged library can be used to write out the serialized data.
             Ptr<PipelineLibrary> GetMergedLibrary(PipelineLibraryHandle handle) const;
 
+            //! Returns a database describing every pipeline state currently held by the library. The database can be
+            //! saved to disk at shutdown and passed to PrewarmLibrary in a subsequent run. Like GetMergedLibrary, this
+            //! takes an exclusive lock on the cache and is not intended to be called every frame.
+            ConstPtr<PipelineStateCacheDatabase> GetDatabase(PipelineLibraryHandle handle, uint64_t validationKey) const;
+
+            //! Acquires every pipeline state recorded in the database, compiling them on the calling thread. This is
+            //! intended to be called from a background job at startup so that pipeline states are ready before the
+            //! renderer first requests them. Shader functions and pipeline layouts referenced by the database are
+            //! resolved by hash against the provided sets. Entries which cannot be resolved, or whose rebuilt
+            //! descriptor hash does not match the recorded hash, are stale and skipped.
+            //! Returns the number of pipeline states acquired.
+            uint32_t PrewarmLibrary(
+                PipelineLibraryHandle handle,
+                const PipelineStateCacheDatabase& database,
+                AZStd::span<const ConstPtr<ShaderStageFunction>> functions,
+                AZStd::span<const ConstPtr<PipelineLayoutDescriptor>> pipelineLayouts);
+
             //! Acquires a pipeline state (either draw or dispatch variants) from the cache. Pipeline states are associated
             //! to a specific library handle. Successive calls with the same pipeline state descriptor hash will return the same
             //! pipeline state, even across threads. If the library handle is invalid or the acquire operation fails, a null pointer
@@ -232,6 +250,9 @@ namespace AZ
             //! Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
 
+            //! Records the descriptor of a cached pipeline state into a database entry.
+            static PipelineStateCacheDatabaseEntry MakeDatabaseEntry(const PipelineStateEntry& pipelineStateEntry);
+
             Ptr<Device> m_device;
 
             /// Each thread owns a set of ThreadLibraryEntry elements. RHI::PipelineLibraryHandle is an
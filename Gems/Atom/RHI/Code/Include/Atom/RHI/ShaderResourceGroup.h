@@ -10,6 +10,8 @@
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ
 {
     namespace RHI
@@ -65,7 +67,10 @@ namespace AZ
             uint32_t m_bindingSlot = (uint32_t)-1;
 
             // Gates the Compile() function so that the SRG is only queued once.
-            bool m_isQueuedForCompile = false;
+            AZStd::atomic_bool m_isQueuedForCompile{ false };
+
+            // The position of the SRG in the compile queue of its pool. Only valid while m_isQueuedForCompile is set.
+            uint32_t m_compileQueueIndex = 0;
         };
     }
 }
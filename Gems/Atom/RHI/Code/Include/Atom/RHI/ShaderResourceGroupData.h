@@ -219,6 +219,12 @@ namespace AZ
             //! Enable compilation for a resourceType specified by resourceType/resourceTypeMask
             void EnableResourceTypeCompilation(ResourceTypeMask resourceTypeMask, ResourceType resourceType);
 
+            //! Copies the data of another ShaderResourceGroupData, along with its compilation state. If this data was
+            //! last copied from the same source, only the resource types enabled for compilation in the source are copied;
+            //! the others have not changed since, so copying them again (and touching the view reference counts) is skipped.
+            //! Otherwise everything is copied.
+            void CopyUpdatedResourceTypes(const ShaderResourceGroupData& source);
+
         private:
             static const ConstPtr<ImageView> s_nullImageView;
             static const ConstPtr<BufferView> s_nullBufferView;
@@ -232,8 +238,30 @@ namespace AZ
             template<typename TShaderInput, typename TShaderInputDescriptor>
             bool ValidateBufferViewAccess(TShaderInput inputIndex, const BufferView* bufferView, uint32_t arrayIndex) const;
 
+            //! Identifies the contents of a ShaderResourceGroupData. Copying, moving or assigning the data replaces
+            //! its contents wholesale, so the id is renewed; only the setters (which flag their updates) keep it.
+            class ContentId
+            {
+            public:
+                ContentId();
+                ContentId(const ContentId&);
+                ContentId(ContentId&&);
+                ContentId& operator=(const ContentId&);
+                ContentId& operator=(ContentId&&);
+
+                uint64_t GetValue() const;
+
+            private:
+                uint64_t m_value = 0;
+            };
+
             ConstPtr<ShaderResourceGroupLayout> m_shaderResourceGroupLayout;
 
+            ContentId m_contentId;
+
+            //! The content id of the data this was last copied from by CopyUpdatedResourceTypes.
+            uint64_t m_copySourceContentId = 0;
+
             //! The backing data store of bound resources for the shader resource group.
             AZStd::vector<ConstPtr<ImageView>> m_imageViews;
             AZStd::vector<ConstPtr<BufferView>> m_bufferViews;
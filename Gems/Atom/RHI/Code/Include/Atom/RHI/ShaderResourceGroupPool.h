@@ -13,7 +13,10 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 namespace AZ
 {
@@ -56,11 +59,15 @@ namespace AZ
             //! Compiles an interval [min, max) of groups.
             void CompileGroupsForInterval(Interval interval);
 
-            //! Returns the total number of groups that need to be compiled.
+            //! Returns the total number of groups that need to be compiled. Groups which were
+            //! un-queued after being queued still count, but are skipped by CompileGroupsForInterval.
             uint32_t GetGroupsToCompileCount() const;
 
             //////////////////////////////////////////////////////////////////////////
 
+            //! Returns the number of groups compiled by the last CompileGroups{Begin, End} region.
+            uint32_t GetCompiledGroupsCount() const;
+
             //! Returns whether layout in this pool has constants.
             bool HasConstants() const;
 
@@ -83,16 +90,17 @@ namespace AZ
             //////////////////////////////////////////////////////////////////////////
 
         private:
-            // Queues the shader resource group for compile and provides a new data packet (takes a lock).
+            // Queues the shader resource group for compile and provides a new data packet (takes a shared lock).
             void QueueForCompile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Takes a lock.
+            // Queues the shader resource group for compile. Legal to call on a queued group. Takes a shared lock.
             void QueueForCompile(ShaderResourceGroup& group);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock.
+            // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock,
+            // the caller must hold at least a shared lock on m_groupsToCompileMutex.
             void QueueForCompileNoLock(ShaderResourceGroup& group);
 
-            // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes a lock.
+            // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes an exclusive lock.
             void UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup);
 
             // Compiles an SRG synchronously. 
@@ -125,8 +133,14 @@ namespace AZ
             bool m_hasSamplerGroup = false;
             bool m_isCompiling = false;
 
+            // Queuing and un-queuing groups only takes a shared lock, so any number of threads can queue groups
+            // concurrently through the lock free vector. Compilation takes the exclusive lock.
             mutable AZStd::shared_mutex m_groupsToCompileMutex;
-            AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
+
+            // Un-queued groups leave a null entry behind, so that un-queuing doesn't need to search and shift the queue.
+            AZStd::concurrent_vector<ShaderResourceGroup*> m_groupsToCompile;
+
+            AZStd::atomic_uint32_t m_compiledGroupsCount{ 0 };
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RHI.Reflect/PipelineStateCacheDatabase.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        void PipelineStateCacheDatabaseEntry::Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateCacheDatabaseEntry>()
+                    ->Version(1)
+                    ->Field("m_type", &PipelineStateCacheDatabaseEntry::m_type)
+                    ->Field("m_pipelineStateHash", &PipelineStateCacheDatabaseEntry::m_pipelineStateHash)
+                    ->Field("m_pipelineLayoutHash", &PipelineStateCacheDatabaseEntry::m_pipelineLayoutHash)
+                    ->Field("m_functionHashes", &PipelineStateCacheDatabaseEntry::m_functionHashes)
+                    ->Field("m_inputStreamLayout", &PipelineStateCacheDatabaseEntry::m_inputStreamLayout)
+                    ->Field("m_renderAttachmentConfiguration", &PipelineStateCacheDatabaseEntry::m_renderAttachmentConfiguration)
+                    ->Field("m_renderStates", &PipelineStateCacheDatabaseEntry::m_renderStates);
+            }
+        }
+
+        void PipelineStateCacheDatabase::Reflect(ReflectContext* context)
+        {
+            PipelineStateCacheDatabaseEntry::Reflect(context);
+
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateCacheDatabase>()
+                    ->Version(1)
+                    ->Field("m_validationKey", &PipelineStateCacheDatabase::m_validationKey)
+                    ->Field("m_entries", &PipelineStateCacheDatabase::m_entries);
+            }
+        }
+
+        ConstPtr<PipelineStateCacheDatabase> PipelineStateCacheDatabase::Create(uint64_t validationKey, AZStd::vector<PipelineStateCacheDatabaseEntry>&& entries)
+        {
+            PipelineStateCacheDatabase* database = aznew PipelineStateCacheDatabase();
+            database->m_validationKey = validationKey;
+            database->m_entries = AZStd::move(entries);
+            return database;
+        }
+
+        uint64_t PipelineStateCacheDatabase::GetValidationKey() const
+        {
+            return m_validationKey;
+        }
+
+        bool PipelineStateCacheDatabase::IsValid(uint64_t validationKey) const
+        {
+            return m_validationKey == validationKey;
+        }
+
+        AZStd::span<const PipelineStateCacheDatabaseEntry> PipelineStateCacheDatabase::GetEntries() const
+        {
+            return m_entries;
+        }
+    }
+}
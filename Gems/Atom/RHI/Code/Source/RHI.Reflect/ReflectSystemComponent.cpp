@@ -24,6 +24,7 @@
 #include <Atom/RHI.Reflect/RenderStates.h>
 #include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
 #include <Atom/RHI.Reflect/PipelineLibraryData.h>
+#include <Atom/RHI.Reflect/PipelineStateCacheDatabase.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
 #include <Atom/RHI.Reflect/ResolveScopeAttachmentDescriptor.h>
@@ -66,6 +67,7 @@ namespace AZ
             MultisampleState::Reflect(context);
             RenderStates::Reflect(context);
             PipelineLibraryData::Reflect(context);
+            PipelineStateCacheDatabase::Reflect(context);
             ReflectRenderStateEnums(context);
             ReflectSamplerStateEnums(context);
             //////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,29 @@ namespace AZ
             return m_drawListMask;
         }
 
+        void DrawPacket::SetStencilRef(uint8_t stencilRef)
+        {
+            for (size_t i = 0; i < m_drawItemCount; ++i)
+            {
+                m_drawItems[i].m_stencilRef = stencilRef;
+            }
+        }
+
+        void DrawPacket::SetSortKey(DrawItemSortKey sortKey)
+        {
+            for (size_t i = 0; i < m_drawItemCount; ++i)
+            {
+                m_drawItemSortKeys[i] = sortKey;
+            }
+        }
+
+        void DrawPacket::SetPipelineState(size_t index, const PipelineState* pipelineState)
+        {
+            AZ_Assert(index < GetDrawItemCount(), "Out of bounds array access!");
+            AZ_Assert(pipelineState, "Draw items require a valid pipeline state.");
+            m_drawItems[index].m_pipelineState = pipelineState;
+        }
+
         void DrawPacket::operator delete(void* p, [[maybe_unused]] size_t size)
         {
             reinterpret_cast<const DrawPacket*>(p)->m_allocator->DeAllocate(p);
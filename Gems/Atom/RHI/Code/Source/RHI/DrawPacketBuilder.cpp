@@ -97,7 +97,7 @@ namespace AZ
             }
         }
 
-        const DrawPacket* DrawPacketBuilder::End()
+        DrawPacket* DrawPacketBuilder::End()
         {
             if (m_drawRequests.empty())
             {
@@ -36,6 +36,10 @@ namespace AZ
     {
         static constexpr const char* frameTimeMetricName = "Frame to Frame Time";
         static constexpr AZ::Crc32 frameTimeMetricId = AZ_CRC_CE(frameTimeMetricName);
+        static constexpr const char* srgCompileCountMetricName = "SRG Compile Count";
+        static constexpr AZ::Crc32 srgCompileCountMetricId = AZ_CRC_CE(srgCompileCountMetricName);
+        static constexpr const char* srgCompileTimeMetricName = "SRG Compile Time";
+        static constexpr AZ::Crc32 srgCompileTimeMetricId = AZ_CRC_CE(srgCompileTimeMetricName);
 
         ResultCode FrameScheduler::Init(Device& device, const FrameSchedulerDescriptor& descriptor)
         {
@@ -89,6 +93,8 @@ namespace AZ
 
                 auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
                 rhiMetrics.GetStatsManager().AddStatistic(frameTimeMetricId, frameTimeMetricName, /*units=*/"clocks", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgCompileCountMetricId, srgCompileCountMetricName, /*units=*/"srgs", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgCompileTimeMetricId, srgCompileTimeMetricName, /*units=*/"clocks", /*failIfExist=*/false);
             }
 
             m_lastFrameEndTime = AZStd::GetTimeNowTicks();
@@ -262,6 +268,8 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RHI, "FrameScheduler: CompileShaderResourceGroups");
 
+            const AZStd::sys_time_t compileStartTicks = AZStd::GetTimeNowTicks();
+
             // Execute all queued resource invalidations, which will mark SRG's for compilation.
             {
                 ResourceInvalidateBus::ExecuteQueuedEvents();
@@ -269,111 +277,104 @@ namespace AZ
 
             const ResourcePoolDatabase& resourcePoolDatabase = m_device->GetResourcePoolDatabase();
 
+            // Begin compilation on every pool, and keep the ones with queued groups. Most pools have nothing to compile
+            // on a given frame, so they are closed right away instead of costing a job each.
+            m_shaderResourceGroupPoolsToCompile.clear();
+            const auto compileGroupsBeginFunction = [this](ShaderResourceGroupPool* srgPool)
+            {
+                srgPool->CompileGroupsBegin();
+                if (srgPool->GetGroupsToCompileCount() > 0)
+                {
+                    m_shaderResourceGroupPoolsToCompile.push_back(srgPool);
+                }
+                else
+                {
+                    srgPool->CompileGroupsEnd();
+                }
+            };
+
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
+
             if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
             {
-                // Iterate over each SRG pool and fork jobs to compile SRGs.
-                const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
-                if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
+                BuildShaderResourceGroupCompileBatches(AZStd::max(m_compileRequest.m_shaderResourceGroupCompilesPerJob, 1u));
+
+                const auto compileBatchFunction = [this](uint32_t batchIndex)
                 {
-                    AZ::TaskGraph taskGraph;
+                    AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
+                    const uint32_t chunkBegin = m_shaderResourceGroupCompileBatchOffsets[batchIndex];
+                    const uint32_t chunkEnd = m_shaderResourceGroupCompileBatchOffsets[batchIndex + 1];
+                    for (uint32_t chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex)
+                    {
+                        const ShaderResourceGroupCompileChunk& chunk = m_shaderResourceGroupCompileChunks[chunkIndex];
+                        chunk.m_pool->CompileGroupsForInterval(chunk.m_interval);
+                    }
+                };
 
-                    const auto compileIntervalsFunction = [compilesPerJob, &taskGraph](ShaderResourceGroupPool* srgPool)
+                const uint32_t batchCount = aznumeric_caster(m_shaderResourceGroupCompileBatchOffsets.size() - 1);
+                if (batchCount == 1)
+                {
+                    // Not worth the dispatch overhead.
+                    compileBatchFunction(0);
+                }
+                else if (batchCount > 1)
+                {
+                    if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
                     {
-                        srgPool->CompileGroupsBegin();
-                        const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
-                        const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
+                        AZ::TaskGraph taskGraph;
                         AZ::TaskDescriptor srgCompileDesc{"SrgCompile", "Graphics"};
-                        AZ::TaskDescriptor srgCompileEndDesc{"SrgCompileEnd", "Graphics"};
-
-                        auto srgCompileEndTask = taskGraph.AddTask(
-                            srgCompileEndDesc,
-                            [srgPool]()
-                            {
-                                srgPool->CompileGroupsEnd();
-                            });
-
-                        for (uint32_t i = 0; i < jobCount; ++i)
+                        for (uint32_t batchIndex = 0; batchIndex < batchCount; ++batchIndex)
                         {
-                            Interval interval;
-                            interval.m_min = i * compilesPerJob;
-                            interval.m_max = AZStd::min(interval.m_min + compilesPerJob, compilesInPool);
-
-                            auto compileTask = taskGraph.AddTask(
+                            taskGraph.AddTask(
                                 srgCompileDesc,
-                                [srgPool, interval]()
+                                [&compileBatchFunction, batchIndex]()
                                 {
-                                AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
-                                    srgPool->CompileGroupsForInterval(interval);
+                                    compileBatchFunction(batchIndex);
                                 });
-                                compileTask.Precedes(srgCompileEndTask);
                         }
-                    };
 
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
-                    if (!taskGraph.IsEmpty())
-                    {
                         AZ::TaskGraphEvent finishedEvent;
                         taskGraph.Submit(&finishedEvent);
                         finishedEvent.Wait();
                     }
-                }
-                else // use Job system
-                {
-                    const auto compileGroupsBeginFunction = [](ShaderResourceGroupPool* srgPool)
-                    {
-                        srgPool->CompileGroupsBegin();
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
-
-                    // Iterate over each SRG pool and fork jobs to compile SRGs.
-                    AZ::JobCompletion jobCompletion;
-
-                    const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](ShaderResourceGroupPool* srgPool)
+                    else // use Job system
                     {
-                        const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
-                        const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
-
-                        for (uint32_t i = 0; i < jobCount; ++i)
+                        AZ::JobCompletion jobCompletion;
+                        for (uint32_t batchIndex = 0; batchIndex < batchCount; ++batchIndex)
                         {
-                            Interval interval;
-                            interval.m_min = i * compilesPerJob;
-                            interval.m_max = AZStd::min(interval.m_min + compilesPerJob, compilesInPool);
-
-                            const auto compileGroupsForIntervalLambda = [srgPool, interval]()
+                            const auto compileGroupsForIntervalLambda = [&compileBatchFunction, batchIndex]()
                             {
-                                AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
-                                srgPool->CompileGroupsForInterval(interval);
+                                compileBatchFunction(batchIndex);
                             };
 
                             AZ::Job* executeGroupJob = AZ::CreateJobFunction(AZStd::move(compileGroupsForIntervalLambda), true, nullptr);
                             executeGroupJob->SetDependent(&jobCompletion);
                             executeGroupJob->Start();
                         }
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
-
-                    jobCompletion.StartAndWaitForCompletion();
-
-                    const auto compileGroupsEndFunction = [](ShaderResourceGroupPool* srgPool)
-                    {
-                        srgPool->CompileGroupsEnd();
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
+                        jobCompletion.StartAndWaitForCompletion();
+                    }
                 }
             }
             else
             {
-                const auto compileAllLambda = [](ShaderResourceGroupPool* srgPool)
+                for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
                 {
-                    srgPool->CompileGroupsBegin();
                     srgPool->CompileGroupsForInterval(Interval(0, srgPool->GetGroupsToCompileCount()));
-                    srgPool->CompileGroupsEnd();
-                };
+                }
+            }
+
+            uint32_t compiledGroupsCount = 0;
+            for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
+            {
+                srgPool->CompileGroupsEnd();
+                compiledGroupsCount += srgPool->GetCompiledGroupsCount();
+            }
 
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                statsProfiler->PushSample(rhiMetricsId, srgCompileCountMetricId, static_cast<double>(compiledGroupsCount));
+                statsProfiler->PushSample(
+                    rhiMetricsId, srgCompileTimeMetricId, static_cast<double>(AZStd::GetTimeNowTicks() - compileStartTicks));
             }
 
             //It is possible for certain back ends to run out of SRG memory (due to fragmentation) in which case
@@ -382,6 +383,40 @@ namespace AZ
             AZ_Assert(resultCode == RHI::ResultCode::Success, "SRG compaction failed and this can lead to a gpu crash.");
         }
 
+        void FrameScheduler::BuildShaderResourceGroupCompileBatches(uint32_t compilesPerBatch)
+        {
+            // Groups from all pools are packed into batches of compilesPerBatch groups. A batch can span several pools,
+            // so that the many pools holding a handful of groups don't each pay for a job of their own.
+            m_shaderResourceGroupCompileChunks.clear();
+            m_shaderResourceGroupCompileBatchOffsets.clear();
+            m_shaderResourceGroupCompileBatchOffsets.push_back(0);
+
+            uint32_t batchSize = 0;
+            for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
+            {
+                const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                uint32_t offset = 0;
+                while (offset < compilesInPool)
+                {
+                    const uint32_t compileCount = AZStd::min(compilesInPool - offset, compilesPerBatch - batchSize);
+                    m_shaderResourceGroupCompileChunks.push_back({ srgPool, Interval(offset, offset + compileCount) });
+                    offset += compileCount;
+                    batchSize += compileCount;
+
+                    if (batchSize == compilesPerBatch)
+                    {
+                        m_shaderResourceGroupCompileBatchOffsets.push_back(aznumeric_caster(m_shaderResourceGroupCompileChunks.size()));
+                        batchSize = 0;
+                    }
+                }
+            }
+
+            if (batchSize > 0)
+            {
+                m_shaderResourceGroupCompileBatchOffsets.push_back(aznumeric_caster(m_shaderResourceGroupCompileChunks.size()));
+            }
+        }
+
         void FrameScheduler::BuildRayTracingShaderTables()
         {
             AZ_PROFILE_SCOPE(RHI, "FrameScheduler: BuildRayTracingShaderTables");
@@ -586,6 +621,28 @@ namespace AZ
             return nullptr;
         }
 
+        uint32_t FrameScheduler::GetShaderResourceGroupCompileCount() const
+        {
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                const auto* compileCountStat = rhiMetrics.GetStatistic(srgCompileCountMetricId);
+                return aznumeric_cast<uint32_t>(compileCountStat->GetMostRecentSample());
+            }
+            return 0;
+        }
+
+        double FrameScheduler::GetShaderResourceGroupCompileTime() const
+        {
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                const auto* compileTimeStat = rhiMetrics.GetStatistic(srgCompileTimeMetricId);
+                return (compileTimeStat->GetMostRecentSample() * 1000) / aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond());
+            }
+            return 0;
+        }
+
         const MemoryStatistics* FrameScheduler::GetMemoryStatistics() const
         {
             return
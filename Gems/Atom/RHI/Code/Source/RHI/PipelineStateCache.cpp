@@ -10,6 +10,7 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -215,6 +216,197 @@ namespace AZ
             return nullptr;
         }
 
+        ConstPtr<PipelineStateCacheDatabase> PipelineStateCache::GetDatabase(PipelineLibraryHandle handle, uint64_t validationKey) const
+        {
+            if (handle.IsNull())
+            {
+                return nullptr;
+            }
+
+            // The exclusive lock guarantees no acquire calls are in flight, so the pending cache is stable.
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
+
+            AZStd::vector<PipelineStateCacheDatabaseEntry> databaseEntries;
+            databaseEntries.reserve(entry.m_readOnlyCache.size() + entry.m_pendingCache.size());
+
+            for (const PipelineStateEntry& pipelineStateEntry : entry.m_readOnlyCache)
+            {
+                databaseEntries.push_back(MakeDatabaseEntry(pipelineStateEntry));
+            }
+
+            for (const PipelineStateEntry& pipelineStateEntry : entry.m_pendingCache)
+            {
+                databaseEntries.push_back(MakeDatabaseEntry(pipelineStateEntry));
+            }
+
+            return PipelineStateCacheDatabase::Create(validationKey, AZStd::move(databaseEntries));
+        }
+
+        PipelineStateCacheDatabaseEntry PipelineStateCache::MakeDatabaseEntry(const PipelineStateEntry& pipelineStateEntry)
+        {
+            PipelineStateCacheDatabaseEntry databaseEntry;
+            databaseEntry.m_pipelineStateHash = static_cast<uint64_t>(pipelineStateEntry.m_hash);
+            databaseEntry.m_functionHashes.resize(ShaderStageCount, 0);
+
+            auto recordFunction = [&databaseEntry](ShaderStage shaderStage, const ConstPtr<ShaderStageFunction>& function)
+            {
+                if (function)
+                {
+                    databaseEntry.m_functionHashes[static_cast<uint32_t>(shaderStage)] = static_cast<uint64_t>(function->GetHash());
+                }
+            };
+
+            auto recordLayout = [&databaseEntry](const PipelineStateDescriptor& descriptor)
+            {
+                databaseEntry.m_type = static_cast<uint32_t>(descriptor.GetType());
+                databaseEntry.m_pipelineLayoutHash = static_cast<uint64_t>(descriptor.m_pipelineLayoutDescriptor->GetHash());
+            };
+
+            if (const auto* descriptorForDraw = AZStd::get_if<PipelineStateDescriptorForDraw>(&pipelineStateEntry.m_pipelineStateDescriptorVariant))
+            {
+                recordLayout(*descriptorForDraw);
+                recordFunction(ShaderStage::Vertex, descriptorForDraw->m_vertexFunction);
+                recordFunction(ShaderStage::Tessellation, descriptorForDraw->m_tessellationFunction);
+                recordFunction(ShaderStage::Fragment, descriptorForDraw->m_fragmentFunction);
+                databaseEntry.m_inputStreamLayout = descriptorForDraw->m_inputStreamLayout;
+                databaseEntry.m_renderAttachmentConfiguration = descriptorForDraw->m_renderAttachmentConfiguration;
+                databaseEntry.m_renderStates = descriptorForDraw->m_renderStates;
+            }
+            else if (const auto* descriptorForDispatch = AZStd::get_if<PipelineStateDescriptorForDispatch>(&pipelineStateEntry.m_pipelineStateDescriptorVariant))
+            {
+                recordLayout(*descriptorForDispatch);
+                recordFunction(ShaderStage::Compute, descriptorForDispatch->m_computeFunction);
+            }
+            else if (const auto* descriptorForRayTracing = AZStd::get_if<PipelineStateDescriptorForRayTracing>(&pipelineStateEntry.m_pipelineStateDescriptorVariant))
+            {
+                recordLayout(*descriptorForRayTracing);
+                recordFunction(ShaderStage::RayTracing, descriptorForRayTracing->m_rayTracingFunction);
+            }
+
+            return databaseEntry;
+        }
+
+        uint32_t PipelineStateCache::PrewarmLibrary(
+            PipelineLibraryHandle handle,
+            const PipelineStateCacheDatabase& database,
+            AZStd::span<const ConstPtr<ShaderStageFunction>> functions,
+            AZStd::span<const ConstPtr<PipelineLayoutDescriptor>> pipelineLayouts)
+        {
+            AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: PrewarmLibrary");
+
+            if (handle.IsNull())
+            {
+                return 0;
+            }
+
+            AZStd::unordered_map<uint64_t, ConstPtr<ShaderStageFunction>> functionsByHash;
+            for (const ConstPtr<ShaderStageFunction>& function : functions)
+            {
+                if (function)
+                {
+                    functionsByHash.emplace(static_cast<uint64_t>(function->GetHash()), function);
+                }
+            }
+
+            AZStd::unordered_map<uint64_t, ConstPtr<PipelineLayoutDescriptor>> pipelineLayoutsByHash;
+            for (const ConstPtr<PipelineLayoutDescriptor>& pipelineLayout : pipelineLayouts)
+            {
+                if (pipelineLayout)
+                {
+                    pipelineLayoutsByHash.emplace(static_cast<uint64_t>(pipelineLayout->GetHash()), pipelineLayout);
+                }
+            }
+
+            // Returns false if a function is recorded but is no longer available.
+            auto resolveFunction = [&functionsByHash](const PipelineStateCacheDatabaseEntry& entry, ShaderStage shaderStage, ConstPtr<ShaderStageFunction>& function)
+            {
+                const uint32_t stageIndex = static_cast<uint32_t>(shaderStage);
+                const uint64_t functionHash = stageIndex < entry.m_functionHashes.size() ? entry.m_functionHashes[stageIndex] : 0;
+                if (functionHash == 0)
+                {
+                    return true;
+                }
+
+                auto functionIt = functionsByHash.find(functionHash);
+                if (functionIt == functionsByHash.end())
+                {
+                    return false;
+                }
+                function = functionIt->second;
+                return true;
+            };
+
+            // Stale entries are expected, the database also records the pipeline states of variants that aren't passed in.
+            uint32_t acquiredCount = 0;
+
+            for (const PipelineStateCacheDatabaseEntry& entry : database.GetEntries())
+            {
+                auto pipelineLayoutIt = pipelineLayoutsByHash.find(entry.m_pipelineLayoutHash);
+                if (pipelineLayoutIt == pipelineLayoutsByHash.end())
+                {
+                    continue;
+                }
+
+                const PipelineState* pipelineState = nullptr;
+                switch (static_cast<PipelineStateType>(entry.m_type))
+                {
+                case PipelineStateType::Draw:
+                {
+                    PipelineStateDescriptorForDraw descriptor;
+                    descriptor.m_pipelineLayoutDescriptor = pipelineLayoutIt->second;
+                    descriptor.m_inputStreamLayout = entry.m_inputStreamLayout;
+                    descriptor.m_renderAttachmentConfiguration = entry.m_renderAttachmentConfiguration;
+                    descriptor.m_renderStates = entry.m_renderStates;
+                    if (resolveFunction(entry, ShaderStage::Vertex, descriptor.m_vertexFunction) &&
+                        resolveFunction(entry, ShaderStage::Tessellation, descriptor.m_tessellationFunction) &&
+                        resolveFunction(entry, ShaderStage::Fragment, descriptor.m_fragmentFunction) &&
+                        static_cast<uint64_t>(descriptor.GetHash()) == entry.m_pipelineStateHash)
+                    {
+                        pipelineState = AcquirePipelineState(handle, descriptor);
+                    }
+                    break;
+                }
+
+                case PipelineStateType::Dispatch:
+                {
+                    PipelineStateDescriptorForDispatch descriptor;
+                    descriptor.m_pipelineLayoutDescriptor = pipelineLayoutIt->second;
+                    if (resolveFunction(entry, ShaderStage::Compute, descriptor.m_computeFunction) &&
+                        descriptor.m_computeFunction &&
+                        static_cast<uint64_t>(descriptor.GetHash()) == entry.m_pipelineStateHash)
+                    {
+                        pipelineState = AcquirePipelineState(handle, descriptor);
+                    }
+                    break;
+                }
+
+                case PipelineStateType::RayTracing:
+                {
+                    PipelineStateDescriptorForRayTracing descriptor;
+                    descriptor.m_pipelineLayoutDescriptor = pipelineLayoutIt->second;
+                    if (resolveFunction(entry, ShaderStage::RayTracing, descriptor.m_rayTracingFunction) &&
+                        descriptor.m_rayTracingFunction &&
+                        static_cast<uint64_t>(descriptor.GetHash()) == entry.m_pipelineStateHash)
+                    {
+                        pipelineState = AcquirePipelineState(handle, descriptor);
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+                }
+
+                if (pipelineState)
+                {
+                    ++acquiredCount;
+                }
+            }
+
+            return acquiredCount;
+        }
+
         void PipelineStateCache::Compact()
         {
             AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: Compact");
@@ -57,7 +57,7 @@ namespace AZ
 
         void ShaderResourceGroup::SetData(const ShaderResourceGroupData& data)
         {
-            m_data = data;
+            m_data.CopyUpdatedResourceTypes(data);
         }
 
         void ShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
@@ -9,6 +9,8 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI.Reflect/Bits.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ
 {
     namespace RHI
@@ -17,6 +19,44 @@ namespace AZ
         const ConstPtr<BufferView> ShaderResourceGroupData::s_nullBufferView;
         const SamplerState ShaderResourceGroupData::s_nullSamplerState{};
 
+        namespace
+        {
+            uint64_t GetNextContentId()
+            {
+                static AZStd::atomic<uint64_t> s_nextContentId{ 1 };
+                return s_nextContentId.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+        }
+
+        ShaderResourceGroupData::ContentId::ContentId()
+            : m_value(GetNextContentId())
+        {}
+
+        ShaderResourceGroupData::ContentId::ContentId(const ContentId&)
+            : m_value(GetNextContentId())
+        {}
+
+        ShaderResourceGroupData::ContentId::ContentId(ContentId&&)
+            : m_value(GetNextContentId())
+        {}
+
+        ShaderResourceGroupData::ContentId& ShaderResourceGroupData::ContentId::operator=(const ContentId&)
+        {
+            m_value = GetNextContentId();
+            return *this;
+        }
+
+        ShaderResourceGroupData::ContentId& ShaderResourceGroupData::ContentId::operator=(ContentId&&)
+        {
+            m_value = GetNextContentId();
+            return *this;
+        }
+
+        uint64_t ShaderResourceGroupData::ContentId::GetValue() const
+        {
+            return m_value;
+        }
+
         ShaderResourceGroupData::ShaderResourceGroupData() = default;
         ShaderResourceGroupData::~ShaderResourceGroupData() = default;
 
@@ -366,6 +406,11 @@ namespace AZ
             m_bufferViews.assign(m_bufferViews.size(), nullptr);
             m_imageViewsUnboundedArray.assign(m_imageViewsUnboundedArray.size(), nullptr);
             m_bufferViewsUnboundedArray.assign(m_bufferViewsUnboundedArray.size(), nullptr);
+
+            EnableResourceTypeCompilation(ResourceTypeMask::ImageViewMask, ResourceType::ImageView);
+            EnableResourceTypeCompilation(ResourceTypeMask::BufferViewMask, ResourceType::BufferView);
+            EnableResourceTypeCompilation(ResourceTypeMask::ImageViewUnboundedArrayMask, ResourceType::ImageViewUnboundedArray);
+            EnableResourceTypeCompilation(ResourceTypeMask::BufferViewUnboundedArrayMask, ResourceType::BufferViewUnboundedArray);
         }
 
         AZStd::span<const uint8_t> ShaderResourceGroupData::GetConstantData() const
@@ -406,5 +451,50 @@ namespace AZ
                 m_resourceTypeIteration[i]++;
             }
         }
+
+        void ShaderResourceGroupData::CopyUpdatedResourceTypes(const ShaderResourceGroupData& source)
+        {
+            // Resource types that aren't flagged in the source can only be skipped if this data already holds them,
+            // which is the case when it was last copied from the very same contents.
+            if (m_shaderResourceGroupLayout != source.m_shaderResourceGroupLayout ||
+                m_copySourceContentId != source.m_contentId.GetValue())
+            {
+                *this = source;
+                m_copySourceContentId = source.m_contentId.GetValue();
+                return;
+            }
+
+            if (source.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::ConstantDataMask)))
+            {
+                m_constantsData = source.m_constantsData;
+            }
+            if (source.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::ImageViewMask)))
+            {
+                m_imageViews = source.m_imageViews;
+            }
+            if (source.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::BufferViewMask)))
+            {
+                m_bufferViews = source.m_bufferViews;
+            }
+            if (source.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::ImageViewUnboundedArrayMask)))
+            {
+                m_imageViewsUnboundedArray = source.m_imageViewsUnboundedArray;
+            }
+            if (source.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::BufferViewUnboundedArrayMask)))
+            {
+                m_bufferViewsUnboundedArray = source.m_bufferViewsUnboundedArray;
+            }
+            if (source.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::SamplerMask)))
+            {
+                m_samplers = source.m_samplers;
+            }
+
+            m_updateMask = source.m_updateMask;
+            for (uint32_t i = 0; i < static_cast<uint32_t>(ResourceType::Count); i++)
+            {
+                m_resourceTypeIteration[i] = source.m_resourceTypeIteration[i];
+            }
+            m_updateMaskResetLatency = source.m_updateMaskResetLatency;
+        }
     } // namespace RHI
 } // namespace AZ
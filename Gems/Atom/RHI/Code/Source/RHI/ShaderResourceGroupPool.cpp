@@ -107,12 +107,14 @@ namespace AZ
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
 
-            bool isQueuedForCompile = shaderResourceGroup.IsQueuedForCompile();
+            // Other threads may queue the same group under the shared lock, so the group is claimed atomically
+            // before its data is set; only the thread that claims it writes the data and pushes it to the queue.
+            bool isQueuedForCompile = shaderResourceGroup.m_isQueuedForCompile.exchange(true);
             AZ_Warning(
                 "ShaderResourceGroupPool", !isQueuedForCompile,
-                "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");            
+                "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");
 
             if (!isQueuedForCompile)
             {
@@ -120,32 +122,32 @@ namespace AZ
 
                 shaderResourceGroup.SetData(groupData);
 
-                QueueForCompileNoLock(shaderResourceGroup);
+                shaderResourceGroup.m_compileQueueIndex = m_groupsToCompile.push_back(&shaderResourceGroup);
             }
         }
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
             QueueForCompileNoLock(group);
         }
 
         void ShaderResourceGroupPool::QueueForCompileNoLock(ShaderResourceGroup& group)
         {
-            if (!group.m_isQueuedForCompile)
+            if (!group.m_isQueuedForCompile.exchange(true))
             {
-                group.m_isQueuedForCompile = true;
-                m_groupsToCompile.emplace_back(&group);
+                group.m_compileQueueIndex = m_groupsToCompile.push_back(&group);
             }
         }
 
         void ShaderResourceGroupPool::UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup)
         {
+            // Queuing claims the group before it writes the queue index, both under the shared lock.
+            // The exclusive lock waits for those writes, so the index read here belongs to this group.
             AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-            if (shaderResourceGroup.m_isQueuedForCompile)
+            if (shaderResourceGroup.m_isQueuedForCompile.exchange(false))
             {
-                shaderResourceGroup.m_isQueuedForCompile = false;
-                m_groupsToCompile.erase(AZStd::find(m_groupsToCompile.begin(), m_groupsToCompile.end(), &shaderResourceGroup));
+                m_groupsToCompile[shaderResourceGroup.m_compileQueueIndex] = nullptr;
             }
         }
 
@@ -158,8 +160,17 @@ namespace AZ
 
         void ShaderResourceGroupPool::CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
         {
+            // Views which are not enabled for compilation haven't changed since the last compile (and won't be copied),
+            // so there is nothing to diff for them.
+            const bool hasImageDiffs = HasImageGroup() &&
+                (groupData.GetLayout() != shaderResourceGroup.GetData().GetLayout() ||
+                 groupData.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ImageViewMask)));
+            const bool hasBufferDiffs = HasBufferGroup() &&
+                (groupData.GetLayout() != shaderResourceGroup.GetData().GetLayout() ||
+                 groupData.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::BufferViewMask)));
+
             // Calculate diffs for updating the resource registry.
-            if (HasImageGroup() || HasBufferGroup())
+            if (hasImageDiffs || hasBufferDiffs)
             {
                 /**
                  * SRG's hold references to views, and views references to resources. Resources can become invalid, either
@@ -200,7 +211,7 @@ namespace AZ
                 AZStd::lock_guard<AZStd::mutex> registryLock(m_invalidateRegistryMutex);
 
                 // Generate diffs for image views.
-                if (HasImageGroup())
+                if (hasImageDiffs)
                 {
                     AZStd::span<const ConstPtr<ImageView>> viewGroupOld = shaderResourceGroup.GetData().GetImageGroup();
                     AZStd::span<const ConstPtr<ImageView>> viewGroupNew = groupData.GetImageGroup();
@@ -212,7 +223,7 @@ namespace AZ
                 }
 
                 // Generate diffs for buffer views.
-                if (HasBufferGroup())
+                if (hasBufferDiffs)
                 {
                     AZStd::span<const ConstPtr<BufferView>> viewGroupOld = shaderResourceGroup.GetData().GetBufferGroup();
                     AZStd::span<const ConstPtr<BufferView>> viewGroupNew = groupData.GetBufferGroup();
@@ -230,6 +241,7 @@ namespace AZ
             AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
             m_groupsToCompileMutex.lock();
             m_isCompiling = true;
+            m_compiledGroupsCount = 0;
         }
 
         void ShaderResourceGroupPool::CompileGroupsEnd()
@@ -254,14 +266,28 @@ namespace AZ
                 interval.m_max <= static_cast<uint32_t>(m_groupsToCompile.size()),
                 "You must specify a valid interval for compilation");
 
+            uint32_t compiledGroupsCount = 0;
             for (uint32_t i = interval.m_min; i < interval.m_max; ++i)
             {
                 ShaderResourceGroup* group = m_groupsToCompile[i];
+                if (!group)
+                {
+                    // The group was un-queued after being queued.
+                    continue;
+                }
+
                 AZ_PROFILE_SCOPE(RHI, "CompileGroupsForInterval %s", group->GetName().GetCStr());
 
                 CompileGroupInternal(*group, group->GetData());
                 group->m_isQueuedForCompile = false;
+                ++compiledGroupsCount;
             }
+            m_compiledGroupsCount += compiledGroupsCount;
+        }
+
+        uint32_t ShaderResourceGroupPool::GetCompiledGroupsCount() const
+        {
+            return m_compiledGroupsCount;
         }
 
         ResultCode ShaderResourceGroupPool::InitInternal(Device&, const ShaderResourceGroupPoolDescriptor&)
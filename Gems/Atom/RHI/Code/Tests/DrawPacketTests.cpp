@@ -105,7 +105,7 @@ namespace UnitTest
             EXPECT_EQ(drawItem->m_indexBufferView->GetHash(), m_indexBufferView.GetHash());
         }
 
-        const RHI::DrawPacket* Build(RHI::DrawPacketBuilder& builder)
+        RHI::DrawPacket* Build(RHI::DrawPacketBuilder& builder)
         {
             builder.Begin(nullptr);
 
@@ -133,7 +133,7 @@ namespace UnitTest
                 builder.AddDrawItem(drawRequest);
             }
 
-            const RHI::DrawPacket* drawPacket = builder.End();
+            RHI::DrawPacket* drawPacket = builder.End();
 
             EXPECT_NE(drawPacket, nullptr);
             EXPECT_EQ(drawPacket->GetDrawListMask(), drawListMask);
@@ -326,6 +326,39 @@ namespace UnitTest
         delete drawPacket;
     }
 
+    TEST_F(DrawPacketTest, DrawPacketPatchInPlace)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        DrawPacketData drawPacketData(random);
+
+        RHI::DrawPacketBuilder builder;
+        RHI::DrawPacket* drawPacket = drawPacketData.Build(builder);
+
+        const RHI::DrawItemSortKey sortKey = random.GetRandom();
+        const uint8_t stencilRef = static_cast<uint8_t>(random.GetRandom());
+        RHI::ConstPtr<RHI::PipelineState> pipelineState = RHI::Factory::Get().CreatePipelineState();
+        const size_t patchedIndex = drawPacket->GetDrawItemCount() / 2;
+
+        drawPacket->SetSortKey(sortKey);
+        drawPacket->SetStencilRef(stencilRef);
+        drawPacket->SetPipelineState(patchedIndex, pipelineState.get());
+
+        for (size_t i = 0; i < drawPacketData.m_drawItemDatas.size(); ++i)
+        {
+            DrawItemData expectedData = drawPacketData.m_drawItemDatas[i];
+            expectedData.m_sortKey = sortKey;
+            expectedData.m_stencilRef = stencilRef;
+            if (i == patchedIndex)
+            {
+                expectedData.m_pipelineState = pipelineState.get();
+            }
+
+            drawPacketData.ValidateDrawItem(expectedData, drawPacket->GetDrawItem(i));
+        }
+
+        delete drawPacket;
+    }
+
     TEST_F(DrawPacketTest, DrawPacketBuildClearBuildNull)
     {
         AZ::SimpleLcgRandom random(s_randomSeed);
@@ -362,4 +362,51 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_Database_Prewarm_Test)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+
+        static const size_t PipelineStateCountMax = 32;
+        static const uint64_t ValidationKey = 1234;
+
+        AZStd::vector<RHI::PipelineStateDescriptorForDraw> descriptors;
+        for (size_t i = 0; i < PipelineStateCountMax; ++i)
+        {
+            descriptors.push_back(CreatePipelineStateDescriptor(static_cast<uint32_t>(i)));
+        }
+
+        // Record a database from a library populated the usual way.
+        RHI::PipelineLibraryHandle sourceHandle = pipelineStateCache->CreateLibrary(nullptr);
+        for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+        {
+            EXPECT_NE(pipelineStateCache->AcquirePipelineState(sourceHandle, descriptor), nullptr);
+        }
+
+        RHI::ConstPtr<RHI::PipelineStateCacheDatabase> database = pipelineStateCache->GetDatabase(sourceHandle, ValidationKey);
+        ASSERT_NE(database, nullptr);
+        EXPECT_TRUE(database->IsValid(ValidationKey));
+        EXPECT_FALSE(database->IsValid(ValidationKey + 1));
+        EXPECT_EQ(database->GetEntries().size(), PipelineStateCountMax);
+
+        // Pre-warm a fresh library, which should compile every recorded pipeline state.
+        RHI::PipelineLibraryHandle prewarmHandle = pipelineStateCache->CreateLibrary(nullptr);
+        AZStd::vector<RHI::ConstPtr<RHI::PipelineLayoutDescriptor>> pipelineLayouts = { m_pipelineLayout };
+        EXPECT_EQ(pipelineStateCache->PrewarmLibrary(prewarmHandle, *database, {}, pipelineLayouts), PipelineStateCountMax);
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+
+        RHI::ConstPtr<RHI::PipelineStateCacheDatabase> prewarmedDatabase = pipelineStateCache->GetDatabase(prewarmHandle, ValidationKey);
+        EXPECT_EQ(prewarmedDatabase->GetEntries().size(), PipelineStateCountMax);
+
+        // Entries referencing a pipeline layout which no longer exists are stale and skipped.
+        RHI::PipelineLibraryHandle staleHandle = pipelineStateCache->CreateLibrary(nullptr);
+        EXPECT_EQ(pipelineStateCache->PrewarmLibrary(staleHandle, *database, {}, {}), 0u);
+
+        pipelineStateCache->ReleaseLibrary(sourceHandle);
+        pipelineStateCache->ReleaseLibrary(prewarmHandle);
+        pipelineStateCache->ReleaseLibrary(staleHandle);
+    }
 }
@@ -10,6 +10,7 @@
 #include <Tests/ShaderResourceGroup.h>
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
+#include <Tests/ThreadTester.h>
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -697,6 +698,137 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGDataCopyUpdatedResourceTypes_SkipsUnchangedConstants)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ShaderInputConstantIndex floatIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+
+        RHI::ShaderResourceGroupData source(srgLayout.get());
+        EXPECT_TRUE(source.SetConstant(floatIndex, 1.0f));
+
+        RHI::ShaderResourceGroupData destination(srgLayout.get());
+        destination.CopyUpdatedResourceTypes(source);
+        EXPECT_EQ(destination.GetConstant<float>(floatIndex), 1.0f);
+        EXPECT_TRUE(destination.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(RHI::ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)));
+
+        // Compile the source until the constants are no longer flagged as updated.
+        while (source.IsAnyResourceTypeUpdated())
+        {
+            source.DisableCompilationForAllResourceTypes();
+        }
+
+        // Unchanged constants are not copied again to data that was last copied from the same source, only the compilation state is.
+        destination.SetConstant(floatIndex, 2.0f);
+        destination.CopyUpdatedResourceTypes(source);
+        EXPECT_EQ(destination.GetConstant<float>(floatIndex), 2.0f);
+        EXPECT_FALSE(destination.IsAnyResourceTypeUpdated());
+
+        // Data that wasn't copied from the source before is copied in full, even if nothing is flagged as updated.
+        RHI::ShaderResourceGroupData freshDestination(srgLayout.get());
+        freshDestination.CopyUpdatedResourceTypes(source);
+        EXPECT_EQ(freshDestination.GetConstant<float>(floatIndex), 1.0f);
+        EXPECT_FALSE(freshDestination.IsAnyResourceTypeUpdated());
+
+        // Replacing the contents of the source, even with the same layout, makes the next copy a full one.
+        source = RHI::ShaderResourceGroupData(srgLayout.get());
+        destination.CopyUpdatedResourceTypes(source);
+        EXPECT_EQ(destination.GetConstant<float>(floatIndex), 0.0f);
+
+        // Data using a different layout is always copied in full.
+        RHI::ShaderResourceGroupData emptyDestination;
+        emptyDestination.CopyUpdatedResourceTypes(source);
+        EXPECT_EQ(emptyDestination.GetLayout(), srgLayout.get());
+        EXPECT_EQ(emptyDestination.GetConstant<float>(floatIndex), 1.0f);
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGPoolCompileGroups_CountsCompiledGroups)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srgA = RHI::Factory::Get().CreateShaderResourceGroup();
+        RHI::Ptr<RHI::ShaderResourceGroup> srgB = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srgA);
+        srgPool->InitGroup(*srgB);
+
+        RHI::ShaderResourceGroupData data(srgLayout.get());
+        data.SetConstant(srgLayout->FindShaderInputConstantIndex(Name("m_floatValue")), 2.0f);
+        srgA->Compile(data);
+        srgB->Compile(data);
+        EXPECT_TRUE(srgA->IsQueuedForCompile());
+        EXPECT_TRUE(srgB->IsQueuedForCompile());
+
+        srgPool->CompileGroupsBegin();
+        EXPECT_EQ(srgPool->GetGroupsToCompileCount(), 2);
+        srgPool->CompileGroupsForInterval(RHI::Interval(0, 1));
+        srgPool->CompileGroupsForInterval(RHI::Interval(1, 2));
+        srgPool->CompileGroupsEnd();
+
+        EXPECT_EQ(srgPool->GetCompiledGroupsCount(), 2);
+        EXPECT_FALSE(srgA->IsQueuedForCompile());
+        EXPECT_FALSE(srgB->IsQueuedForCompile());
+        EXPECT_EQ(srgA->GetData().GetConstant<float>(srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"))), 2.0f);
+
+        srgPool->CompileGroupsBegin();
+        EXPECT_EQ(srgPool->GetGroupsToCompileCount(), 0);
+        srgPool->CompileGroupsEnd();
+        EXPECT_EQ(srgPool->GetCompiledGroupsCount(), 0);
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGPoolCompileGroups_ConcurrentQueueAndShutdown_CompilesRemainingGroups)
+    {
+        static const size_t ThreadCountMax = 8;
+        static const size_t GroupCountPerThread = 64;
+
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroup>> srgs(ThreadCountMax * GroupCountPerThread);
+        for (RHI::Ptr<RHI::ShaderResourceGroup>& srg : srgs)
+        {
+            srg = RHI::Factory::Get().CreateShaderResourceGroup();
+            srgPool->InitGroup(*srg);
+        }
+
+        RHI::ShaderResourceGroupData data(srgLayout.get());
+        data.SetConstant(srgLayout->FindShaderInputConstantIndex(Name("m_floatValue")), 2.0f);
+
+        // Every other group is shut down right after it was queued, which unqueues it while the other threads keep queuing.
+        ThreadTester::Dispatch(ThreadCountMax, [&](size_t threadIndex)
+        {
+            for (size_t i = 0; i < GroupCountPerThread; ++i)
+            {
+                RHI::ShaderResourceGroup& srg = *srgs[threadIndex * GroupCountPerThread + i];
+                srg.Compile(data);
+                if (i % 2)
+                {
+                    srg.Shutdown();
+                }
+            }
+        });
+
+        srgPool->CompileGroupsBegin();
+        srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+        srgPool->CompileGroupsEnd();
+
+        EXPECT_EQ(srgPool->GetCompiledGroupsCount(), ThreadCountMax * GroupCountPerThread / 2);
+        for (size_t i = 0; i < srgs.size(); ++i)
+        {
+            EXPECT_FALSE(srgs[i]->IsQueuedForCompile());
+            EXPECT_EQ(srgs[i]->IsInitialized(), (i % 2) == 0);
+        }
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
@@ -52,6 +52,7 @@ namespace AZ
 
             bool EndInternal(Data::Asset<ShaderVariantTreeAsset>& result);
             bool BuildTree(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId);
+            bool BuildLookupTable(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId);
 
             const RPI::ShaderOptionGroupLayout* m_shaderOptionGroupLayout;
             AZStd::vector<ShaderVariantListSourceData::VariantInfo> m_variantInfos;
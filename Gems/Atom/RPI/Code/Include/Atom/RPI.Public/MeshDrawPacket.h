@@ -15,6 +15,7 @@
 #include <Atom/RHI/DrawPacketBuilder.h>
 
 #include <AzCore/Math/Obb.h>
+#include <AzCore/std/limits.h>
 
 
 namespace AZ
@@ -37,15 +38,26 @@ namespace AZ
                 Data::Instance<ShaderResourceGroup> objectSrg,
                 const MaterialModelUvOverrideMap& materialModelUvMap = {});
 
-            AZ_DEFAULT_COPY(MeshDrawPacket);
-            AZ_DEFAULT_MOVE(MeshDrawPacket);
+            // Copies would share the RHI::DrawPacket that Update() patches in place, so only moves are allowed.
+            AZ_DISABLE_COPY(MeshDrawPacket);
 
+            //! Brings the draw packet up to date with the material and the shader options, stencil ref and sort key set on this MeshDrawPacket.
+            //! When possible, the existing RHI::DrawPacket is patched in place (e.g. a material property change only
+            //! selected a different shader variant). Otherwise it is rebuilt.
+            //! This is the only function that modifies the RHI::DrawPacket, so it must be called where the packet isn't part of any
+            //! draw list, e.g. from FeatureProcessor::Simulate().
+            //! @param forceUpdate  Always rebuild the RHI::DrawPacket.
+            //! @return true if the RHI::DrawPacket was rebuilt, meaning GetRHIDrawPacket() returns a new object.
             bool Update(const Scene& parentScene, bool forceUpdate = false);
 
             const RHI::DrawPacket* GetRHIDrawPacket() const;
 
-            void SetStencilRef(uint8_t stencilRef) { m_stencilRef = stencilRef; }
-            void SetSortKey(RHI::DrawItemSortKey sortKey) { m_sortKey = sortKey; };
+            //! The stencil ref and sort key are applied on the next call to Update(), so that a packet which was already
+            //! submitted to draw lists isn't changed.
+            void SetStencilRef(uint8_t stencilRef);
+            void SetSortKey(RHI::DrawItemSortKey sortKey);
+
+            //! The shader option is applied on the next call to Update().
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
 
             Data::Instance<Material> GetMaterial();
@@ -53,7 +65,35 @@ namespace AZ
         private:
             bool DoUpdate(const Scene& parentScene);
 
-            ConstPtr<RHI::DrawPacket> m_drawPacket;
+            //! Patches the pipeline states of the existing m_drawPacket to match the current shader variants.
+            //! Returns false if the draw packet needs to be rebuilt instead.
+            bool PatchDrawPacket(const Scene& parentScene);
+
+            //! Returns the shader options used to select the variant for a shader item of the material.
+            ShaderOptionGroup GetShaderOptions(const ShaderCollection::Item& shaderItem, const Shader& shader) const;
+
+            static constexpr size_t InvalidDrawItemIndex = AZStd::numeric_limits<size_t>::max();
+
+            //! Records how an enabled shader item of the material was turned into a draw item, so material and
+            //! shader option changes can be patched into m_drawPacket without rebuilding it.
+            struct ShaderItemRecord
+            {
+                Data::AssetId m_shaderAssetId;
+                RHI::DrawListTag m_drawListTagOverride;
+
+                //! The index of the draw item in m_drawPacket and m_activeShaders,
+                //! or InvalidDrawItemIndex if the shader item isn't drawn in the scene.
+                size_t m_drawItemIndex = InvalidDrawItemIndex;
+
+                RHI::DrawListTag m_drawListTag;
+                ShaderVariantId m_shaderVariantId;
+                ShaderVariantStableId m_shaderVariantStableId;
+                HashValue64 m_renderStatesOverlayHash = HashValue64{ 0 };
+                RHI::InputStreamLayout m_inputStreamLayout;
+                Data::Instance<ShaderResourceGroup> m_drawSrg;
+            };
+
+            RHI::Ptr<RHI::DrawPacket> m_drawPacket;
 
             // Note, many of the following items are held locally in the MeshDrawPacket solely to keep them resident in memory as long as they are needed
             // for the m_drawPacket. RHI::DrawPacket uses raw pointers only, but we use smart pointers here to hold on to the data.
@@ -74,7 +114,8 @@ namespace AZ
             // does not allow public access to its Instance<RPI::ShaderResourceGroup>.
             ConstPtr<RHI::ShaderResourceGroup> m_materialSrg;
 
-            AZStd::fixed_vector<Data::Instance<ShaderResourceGroup>, RHI::DrawPacketBuilder::DrawItemCountMax> m_perDrawSrgs;
+            // One record per enabled shader item of m_material, in shader collection order. Also holds the per-draw SRGs.
+            AZStd::vector<ShaderItemRecord> m_shaderItemRecords;
 
             // A reference to the material, used to rebuild the DrawPacket if needed
             Data::Instance<Material> m_material;
@@ -95,6 +136,12 @@ namespace AZ
             typedef AZStd::pair<Name, RPI::ShaderOptionValue> ShaderOptionPair;
             typedef AZStd::vector<ShaderOptionPair> ShaderOptionVector;
             ShaderOptionVector m_shaderOptions;
+
+            //! Set when m_shaderOptions changed since the draw packet was last updated.
+            bool m_shaderOptionsDirty = false;
+
+            //! Set when m_stencilRef or m_sortKey changed since the draw packet was last updated.
+            bool m_drawItemStatesDirty = false;
         };
     } // namespace RPI
 } // namespace AZ
@@ -20,6 +20,7 @@
 #include <AtomCore/Instance/InstanceData.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Jobs/JobCompletion.h>
 
 namespace AZ
 {
@@ -148,6 +149,15 @@ namespace AZ
 
             ConstPtr<RHI::PipelineLibraryData> LoadPipelineLibrary() const;
             void SavePipelineLibrary() const;
+
+            //! Loads the pipeline state database saved by a previous run and compiles the recorded pipeline states
+            //! on a background job, so they are ready before the first frame requests them.
+            void PrewarmPipelineStates();
+            void WaitForPrewarmPipelineStates();
+            void SavePipelineStateDatabase() const;
+
+            //! Returns the key used to validate the pipeline state database against the current shader asset build.
+            uint64_t GetPipelineStateDatabaseKey() const;
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
@@ -194,6 +204,12 @@ namespace AZ
             //! PipelineLibrary file name
             char m_pipelineLibraryPath[AZ_MAX_PATH_LEN] = { 0 };
 
+            //! PipelineStateCacheDatabase file name
+            char m_pipelineStateDatabasePath[AZ_MAX_PATH_LEN] = { 0 };
+
+            //! Completion of the background job that pre-warms the pipeline library. Null when no job is in flight.
+            AZ::JobCompletion* m_prewarmCompletion = nullptr;
+
             //! During OnAssetReloaded, the internal references to ShaderVariantAsset inside
             //! ShaderAsset are not updated correctly. We store here a reference to the root ShaderVariantAsset
             //! when it got reloaded, later when We get OnAssetReloaded for the ShaderAsset We update its internal
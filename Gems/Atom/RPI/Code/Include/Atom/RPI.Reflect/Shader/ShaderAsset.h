@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/EBus/Event.h>
 
@@ -225,6 +227,10 @@ namespace AZ
             // So some other class must update the reference and that's why Shader() is the best class to do it.
             void UpdateRootShaderVariantAsset(SupervariantIndex SupervariantIndex, Data::Asset<ShaderVariantAsset> newRootVariant);
 
+            //! Searches m_shaderVariantTree, going through the variant search cache first.
+            //! The caller must hold m_variantTreeMutex and m_shaderVariantTree must be valid.
+            ShaderVariantSearchResult FindVariantStableIdCached(const ShaderVariantId& shaderVariantId);
+
             //! A Supervariant represents a set of static shader compilation parameters.
             //! Those parameters can be predefined c-preprocessor macros or specific arguments
             //! for AZSLc.
@@ -316,6 +322,21 @@ namespace AZ
             mutable AZStd::shared_mutex m_variantTreeMutex;
 
             bool m_shaderVariantTreeLoadWasRequested = false;
+
+            //! A small direct-mapped cache of recent FindVariantStableId() results. Material parameter changes tend to toggle
+            //! between a handful of option combinations, so most searches are answered here without touching the variant tree.
+            //! The cache is cleared whenever m_shaderVariantTree changes.
+            struct VariantSearchCacheEntry
+            {
+                ShaderVariantId m_shaderVariantId;
+                ShaderVariantSearchResult m_searchResult{ RootShaderVariantStableId, 0 };
+                bool m_isValid = false;
+            };
+            static constexpr size_t VariantSearchCacheSize = 64;
+            AZStd::array<VariantSearchCacheEntry, VariantSearchCacheSize> m_variantSearchCache;
+
+            //! Guards m_variantSearchCache, which is updated while only a shared lock is held on m_variantTreeMutex.
+            AZStd::mutex m_variantSearchCacheMutex;
         };
 
         class ShaderAssetHandler final
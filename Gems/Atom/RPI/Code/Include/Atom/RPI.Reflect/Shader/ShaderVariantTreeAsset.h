@@ -20,6 +20,7 @@ namespace AZ
         class ShaderOptionGroupLayout;
         struct ShaderVariantId;
         struct ShaderVariantTreeNode;
+        struct ShaderVariantTreeLookupEntry;
 
 
         //! The shader variant tree is a data structure to perform lookups of shader variants that have the best runtime performance on the GPU.
@@ -33,6 +34,10 @@ namespace AZ
         //! The variant searched using the tree has a key that matches the requested key, but some values can be undefined.
         //! For example, requesting a key equal to "00101" could return a variant with ID "0?10?", in which ? stands for undefined values.
         //! The undefined values must be provided to the fallback constant buffer. (See Shader::FindFallbackShaderResourceGroupAsset).
+        //!
+        //! Alongside the tree, the asset stores a flat table, sorted by ShaderVariantId, of the search results for every variant
+        //! declared in the tree. Requests which exactly match a declared variant (the common case, as material code usually
+        //! fully specifies its options) are answered with a binary search instead of a tree walk.
         class ShaderVariantTreeAsset final
             : public Data::AssetData
         {
@@ -73,6 +78,13 @@ namespace AZ
             //! - Search the best match from those results.
             ShaderVariantSearchResult FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const;
 
+            //! Same as FindVariantStableId() but always walks the tree, bypassing the flat lookup table.
+            //! Exposed for validation and benchmarking of the lookup table.
+            ShaderVariantSearchResult FindVariantStableIdInTree(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const;
+
+            //! Returns the number of entries in the flat lookup table.
+            size_t GetLookupTableSize() const;
+
         private:
 
             static constexpr uint32_t UnspecifiedIndex = std::numeric_limits<uint32_t>::max();
@@ -86,6 +98,9 @@ namespace AZ
             //! Build a list of values from the specified shader variant ID.
             static AZStd::vector<uint32_t> ConvertToValueChain(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId);
 
+            //! Returns the key used by the lookup table for the provided ShaderVariantId. Bits outside of the mask are cleared.
+            static ShaderVariantId GetLookupKey(const ShaderVariantId& shaderVariantId);
+
             //! Called by asset creators to assign the asset to a ready state.
             void SetReady();
             bool FinalizeAfterLoad();
@@ -95,6 +110,9 @@ namespace AZ
             //! .shadervariantlist file.
             AZ::u64 m_shaderHash = 0;
             AZStd::vector<ShaderVariantTreeNode> m_nodes;
+
+            //! Search results for every variant declared in the tree, sorted by ShaderVariantId.
+            AZStd::vector<ShaderVariantTreeLookupEntry> m_lookupTable;
         };
 
         class ShaderVariantTreeAssetHandler final
@@ -134,6 +152,19 @@ namespace AZ
             uint32_t m_offset;
         };
 
+        //! Entry of the flat lookup table of the ShaderVariantTreeAsset.
+        //! Stores the pre-computed tree search result for a ShaderVariantId declared in the tree.
+        struct ShaderVariantTreeLookupEntry final
+        {
+            AZ_TYPE_INFO(ShaderVariantTreeLookupEntry, "{8E1F3B52-6C0D-4D84-9D7B-5B7B0D8B2E19}");
+
+            static void Reflect(ReflectContext* context);
+
+            ShaderVariantId m_shaderVariantId;
+            ShaderVariantStableId m_stableId;
+            uint32_t m_dynamicOptionCount = 0;
+        };
+
     } // namespace RPI
 
 } // namespace AZ
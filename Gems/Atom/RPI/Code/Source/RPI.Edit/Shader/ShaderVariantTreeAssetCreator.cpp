@@ -10,6 +10,9 @@
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
 namespace AZ
 {
     namespace RPI
@@ -175,7 +178,7 @@ namespace AZ
                 shaderVariantIds.push_back({optionGroup.GetShaderVariantId(), ShaderVariantStableId{variantInfo.m_stableId}});
             }
 
-            return BuildTree(shaderVariantIds);
+            return BuildTree(shaderVariantIds) && BuildLookupTable(shaderVariantIds);
         }
 
         bool ShaderVariantTreeAssetCreator::BuildTree(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId)
@@ -297,5 +300,36 @@ namespace AZ
             return true;
         }
 
+        bool ShaderVariantTreeAssetCreator::BuildLookupTable(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId)
+        {
+            AZStd::vector<ShaderVariantTreeLookupEntry> lookupTable;
+            lookupTable.reserve(shaderVariantIdsWithStableId.size());
+
+            // Store the result of the tree search rather than the declared StableId, so the table always agrees
+            // with the tree (e.g. when two declared variants share the same ShaderVariantId).
+            for (const ShaderVariantIdWithStableId& shaderVariantIdWithStableId : shaderVariantIdsWithStableId)
+            {
+                const ShaderVariantId lookupKey = ShaderVariantTreeAsset::GetLookupKey(shaderVariantIdWithStableId.m_shaderVariantId);
+                const ShaderVariantSearchResult searchResult = m_asset->FindVariantStableIdInTree(m_shaderOptionGroupLayout, lookupKey);
+                lookupTable.push_back({ lookupKey, searchResult.GetStableId(), searchResult.GetDynamicOptionCount() });
+            }
+
+            AZStd::sort(lookupTable.begin(), lookupTable.end(),
+                [](const ShaderVariantTreeLookupEntry& lhs, const ShaderVariantTreeLookupEntry& rhs)
+                {
+                    return ShaderVariantIdComparator::Compare(lhs.m_shaderVariantId, rhs.m_shaderVariantId) < 0;
+                });
+
+            auto uniqueEnd = AZStd::unique(lookupTable.begin(), lookupTable.end(),
+                [](const ShaderVariantTreeLookupEntry& lhs, const ShaderVariantTreeLookupEntry& rhs)
+                {
+                    return lhs.m_shaderVariantId == rhs.m_shaderVariantId;
+                });
+            lookupTable.erase(uniqueEnd, lookupTable.end());
+
+            m_asset->m_lookupTable = AZStd::move(lookupTable);
+            return true;
+        }
+
     } // namespace RPI
 } // namespace AZ
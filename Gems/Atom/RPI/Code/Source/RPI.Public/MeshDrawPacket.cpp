@@ -81,14 +81,16 @@ namespace AZ
                         return entry.first == shaderOptionName;
                     });
 
-                    // store the option name and value, they will be used in DoUpdate() to select the appropriate shader variant
+                    // store the option name and value, they will be used in Update() to select the appropriate shader variant
                     if (itEntry == m_shaderOptions.end())
                     {
                         m_shaderOptions.push_back({ shaderOptionName, value });
+                        m_shaderOptionsDirty = true;
                     }
-                    else
+                    else if (itEntry->second != value)
                     {
                         itEntry->second = value;
+                        m_shaderOptionsDirty = true;
                     }
                 }
             }
@@ -112,14 +114,180 @@ namespace AZ
             //      - MeshDrawPacket::Update() is called. But since the GetCurrentChangeId() hasn't changed since last time, DoUpdate() is not called.
             //      - The mesh continues rendering with only the "foo" change applied, indefinitely.
 
-            if (forceUpdate || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId()))
+            // The stencil ref and sort key are patched in here rather than in their setters, since this is called at a point
+            // where the draw packet isn't part of any draw list. A rebuilt draw packet picks them up as well.
+            if (m_drawItemStatesDirty && m_drawPacket)
+            {
+                m_drawPacket->SetStencilRef(m_stencilRef);
+                m_drawPacket->SetSortKey(m_sortKey);
+            }
+            m_drawItemStatesDirty = false;
+
+            const bool materialChanged = !m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId();
+            if (!forceUpdate && !materialChanged && !m_shaderOptionsDirty)
+            {
+                return false;
+            }
+
+            if (forceUpdate || materialChanged)
             {
-                DoUpdate(parentScene);
                 m_materialChangeId = m_material->GetCurrentChangeId();
-                return true;
             }
+            m_shaderOptionsDirty = false;
+
+            // Most runtime changes (material properties, per-mesh shader options) only select a different shader variant,
+            // which can be patched into the existing draw packet without reallocating it or rebuilding the cullable.
+            if (!forceUpdate && PatchDrawPacket(parentScene))
+            {
+                return false;
+            }
+
+            DoUpdate(parentScene);
+            return true;
+        }
+
+        void MeshDrawPacket::SetStencilRef(uint8_t stencilRef)
+        {
+            m_drawItemStatesDirty = m_drawItemStatesDirty || (m_stencilRef != stencilRef);
+            m_stencilRef = stencilRef;
+        }
+
+        void MeshDrawPacket::SetSortKey(RHI::DrawItemSortKey sortKey)
+        {
+            m_drawItemStatesDirty = m_drawItemStatesDirty || (m_sortKey != sortKey);
+            m_sortKey = sortKey;
+        }
+
+        ShaderOptionGroup MeshDrawPacket::GetShaderOptions(const ShaderCollection::Item& shaderItem, const Shader& shader) const
+        {
+            // Set all unspecified shader options to default values, so that we get the most specialized variant possible.
+            // (because FindVariantStableId treats unspecified options as a request specifically for a variant that doesn't specify those options)
+            // [GFX TODO][ATOM-3883] We should consider updating the FindVariantStableId algorithm to handle default values for us, and remove this step here.
+            RPI::ShaderOptionGroup shaderOptions = *shaderItem.GetShaderOptions();
+            shaderOptions.SetUnspecifiedToDefaultValues();
+
+            // [GFX_TODO][ATOM-14476]: according to this usage, we should make the shader input contract uniform across all shader variants.
+            m_modelLod->CheckOptionalStreams(
+                shaderOptions,
+                shader.GetInputContract(),
+                m_modelLodMeshIndex,
+                m_materialModelUvMap,
+                m_material->GetAsset()->GetMaterialTypeAsset()->GetUvNameMap());
+
+            // apply shader options from this draw packet to the ShaderItem
+            for (const auto& meshShaderOption : m_shaderOptions)
+            {
+                const Name& name = meshShaderOption.first;
+                const RPI::ShaderOptionValue& value = meshShaderOption.second;
+
+                ShaderOptionIndex index = shaderOptions.FindShaderOptionIndex(name);
+                if (index.IsValid())
+                {
+                    shaderOptions.SetValue(name, value);
+                }
+            }
+
+            return shaderOptions;
+        }
+
+        bool MeshDrawPacket::PatchDrawPacket(const Scene& parentScene)
+        {
+            if (!m_drawPacket || !m_material)
+            {
+                return false;
+            }
+
+            // Material::Init() creates a new material SRG, so a different SRG means the material was reinitialized
+            // (e.g. after a shader reload). The shader collection and stream layouts can't be trusted anymore.
+            const RHI::ShaderResourceGroup* materialSrg = m_material->GetRHIShaderResourceGroup();
+            if (!materialSrg || materialSrg != m_materialSrg)
+            {
+                return false;
+            }
+
+            // Check the set of shaders first, so nothing is patched in a packet that has to be rebuilt anyway.
+            const ShaderCollection& shaderCollection = m_material->GetShaderCollection();
+            size_t recordIndex = 0;
+            for (const auto& shaderItem : shaderCollection)
+            {
+                if (!shaderItem.IsEnabled())
+                {
+                    continue;
+                }
+
+                if (recordIndex == m_shaderItemRecords.size())
+                {
+                    return false;
+                }
+
+                const ShaderItemRecord& record = m_shaderItemRecords[recordIndex++];
+                if (record.m_shaderAssetId != shaderItem.GetShaderAsset().GetId() ||
+                    record.m_drawListTagOverride != shaderItem.GetDrawListTagOverride())
+                {
+                    return false;
+                }
+            }
+
+            if (recordIndex != m_shaderItemRecords.size())
+            {
+                return false;
+            }
+
+            recordIndex = 0;
+            for (const auto& shaderItem : shaderCollection)
+            {
+                if (!shaderItem.IsEnabled())
+                {
+                    continue;
+                }
+
+                ShaderItemRecord& record = m_shaderItemRecords[recordIndex++];
+                if (record.m_drawItemIndex == InvalidDrawItemIndex)
+                {
+                    continue;
+                }
 
-            return false;
+                const Data::Instance<Shader>& shader = m_activeShaders[record.m_drawItemIndex];
+                const RPI::ShaderOptionGroup shaderOptions = GetShaderOptions(shaderItem, *shader);
+                const ShaderVariantId finalVariantId = shaderOptions.GetShaderVariantId();
+                const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(finalVariantId);
+                const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
+                const HashValue64 renderStatesOverlayHash = renderStatesOverlay.GetHash();
+
+                // The stable id changes when the requested variant finishes loading, even if the requested id is the same.
+                if (record.m_shaderVariantId == finalVariantId &&
+                    record.m_shaderVariantStableId == variant.GetStableId() &&
+                    record.m_renderStatesOverlayHash == renderStatesOverlayHash)
+                {
+                    continue;
+                }
+
+                RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
+                variant.ConfigurePipelineState(pipelineStateDescriptor);
+                RHI::MergeStateInto(renderStatesOverlay, pipelineStateDescriptor.m_renderStates);
+                pipelineStateDescriptor.m_inputStreamLayout = record.m_inputStreamLayout;
+                parentScene.ConfigurePipelineState(record.m_drawListTag, pipelineStateDescriptor);
+
+                const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                if (!pipelineState)
+                {
+                    return false;
+                }
+
+                if (record.m_drawSrg && !variant.IsFullyBaked() && record.m_drawSrg->HasShaderVariantKeyFallbackEntry())
+                {
+                    record.m_drawSrg->SetShaderVariantKeyFallbackValue(shaderOptions.GetShaderVariantKeyFallbackValue());
+                    record.m_drawSrg->Compile();
+                }
+
+                m_drawPacket->SetPipelineState(record.m_drawItemIndex, pipelineState);
+
+                record.m_shaderVariantId = finalVariantId;
+                record.m_shaderVariantStableId = variant.GetStableId();
+                record.m_renderStatesOverlayHash = renderStatesOverlayHash;
+            }
+
+            return true;
         }
 
         bool MeshDrawPacket::DoUpdate(const Scene& parentScene)
@@ -150,9 +318,9 @@ namespace AZ
             // that the memory won't be relocated when new entries are added.
             AZStd::fixed_vector<ModelLod::StreamBufferViewList, RHI::DrawPacketBuilder::DrawItemCountMax> streamBufferViewsPerShader;
 
-            m_perDrawSrgs.clear();
+            AZStd::vector<ShaderItemRecord> shaderItemRecords;
 
-            auto appendShader = [&](const ShaderCollection::Item& shaderItem)
+            auto appendShader = [&](const ShaderCollection::Item& shaderItem, ShaderItemRecord& record)
             {
                 // Skip the shader item without creating the shader instance
                 // if the mesh is not going to be rendered based on the draw tag
@@ -194,33 +362,7 @@ namespace AZ
                     return false;
                 }
 
-                // Set all unspecified shader options to default values, so that we get the most specialized variant possible.
-                // (because FindVariantStableId treats unspecified options as a request specifically for a variant that doesn't specify those options)
-                // [GFX TODO][ATOM-3883] We should consider updating the FindVariantStableId algorithm to handle default values for us, and remove this step here.
-                RPI::ShaderOptionGroup shaderOptions = *shaderItem.GetShaderOptions();
-                shaderOptions.SetUnspecifiedToDefaultValues();
-
-                // [GFX_TODO][ATOM-14476]: according to this usage, we should make the shader input contract uniform across all shader variants.
-                m_modelLod->CheckOptionalStreams(
-                    shaderOptions,
-                    shader->GetInputContract(),
-                    m_modelLodMeshIndex,
-                    m_materialModelUvMap,
-                    m_material->GetAsset()->GetMaterialTypeAsset()->GetUvNameMap());
-
-                // apply shader options from this draw packet to the ShaderItem
-                for (auto& meshShaderOption : m_shaderOptions)
-                {
-                    Name& name = meshShaderOption.first;
-                    RPI::ShaderOptionValue& value = meshShaderOption.second;
-
-                    ShaderOptionIndex index = shaderOptions.FindShaderOptionIndex(name);
-                    if (index.IsValid())
-                    {
-                        shaderOptions.SetValue(name, value);
-                    }
-                }
-
+                const RPI::ShaderOptionGroup shaderOptions = GetShaderOptions(shaderItem, *shader);
                 const ShaderVariantId finalVariantId = shaderOptions.GetShaderVariantId();
                 const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(finalVariantId);
 
@@ -275,6 +417,9 @@ namespace AZ
                     drawSrg->Compile();
                 }
 
+                // Recorded before the scene configures the descriptor, so PatchDrawPacket() can rebuild it from the same inputs.
+                const RHI::InputStreamLayout inputStreamLayout = pipelineStateDescriptor.m_inputStreamLayout;
+
                 parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
 
                 const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
@@ -293,10 +438,17 @@ namespace AZ
                 if (drawSrg)
                 {
                     drawRequest.m_uniqueShaderResourceGroup = drawSrg->GetRHIShaderResourceGroup();
-                    m_perDrawSrgs.push_back(drawSrg);
                 }
                 drawPacketBuilder.AddDrawItem(drawRequest);
 
+                record.m_drawItemIndex = shaderList.size();
+                record.m_drawListTag = drawListTag;
+                record.m_shaderVariantId = finalVariantId;
+                record.m_shaderVariantStableId = variant.GetStableId();
+                record.m_renderStatesOverlayHash = renderStatesOverlay.GetHash();
+                record.m_inputStreamLayout = inputStreamLayout;
+                record.m_drawSrg = AZStd::move(drawSrg);
+
                 shaderList.emplace_back(AZStd::move(shader));
 
                 return true;
@@ -325,11 +477,16 @@ namespace AZ
                         return false;
                     }
 
-                    appendShader(shaderItem);
+                    ShaderItemRecord& record = shaderItemRecords.emplace_back();
+                    record.m_shaderAssetId = shaderItem.GetShaderAsset().GetId();
+                    record.m_drawListTagOverride = shaderItem.GetDrawListTagOverride();
+
+                    appendShader(shaderItem, record);
                 }
             }
 
             m_drawPacket = drawPacketBuilder.End();
+            m_shaderItemRecords = AZStd::move(shaderItemRecords);
 
             if (m_drawPacket)
             {
@@ -16,6 +16,9 @@
 #include <AzCore/Interface/Interface.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/Utils/TypeHash.h>
 
 #define PSOCacheVersion 0 // Bump this if you want to reset PSO cache for everyone
 
@@ -87,7 +90,7 @@ namespace AZ
             Shutdown();
         }
 
-        static bool GetPipelineLibraryPath(char* pipelineLibraryPath, size_t pipelineLibraryPathLength, const ShaderAsset& shaderAsset)
+        static bool GetPipelineLibraryPath(char* pipelineLibraryPath, size_t pipelineLibraryPathLength, const ShaderAsset& shaderAsset, const char* extension = "bin")
         {
             if (auto* fileIOBase = IO::FileIOBase::GetInstance())
             {
@@ -104,12 +107,13 @@ namespace AZ
 
                 char pipelineLibraryPathTemp[AZ_MAX_PATH_LEN];
                 azsnprintf(
-                    pipelineLibraryPathTemp, AZ_MAX_PATH_LEN, "@user@/Atom/PipelineStateCache_%s_%u_%u_Ver_%i/%s/%s_%s_%d.bin",
+                    pipelineLibraryPathTemp, AZ_MAX_PATH_LEN, "@user@/Atom/PipelineStateCache_%s_%u_%u_Ver_%i/%s/%s_%s_%d.%s",
                     ToString(physicalDeviceDesc.m_vendorId).data(), physicalDeviceDesc.m_deviceId, physicalDeviceDesc.m_driverVersion, PSOCacheVersion,
                     platformName.GetCStr(),
                     shaderName.GetCStr(),
                     uuidString.data(),
-                    assetId.m_subId);
+                    assetId.m_subId,
+                    extension);
 
                 fileIOBase->ResolvePath(pipelineLibraryPathTemp, pipelineLibraryPath, pipelineLibraryPathLength);
                 return true;
@@ -129,6 +133,7 @@ namespace AZ
             m_pipelineStateType = shaderAsset.GetPipelineStateType();
 
             GetPipelineLibraryPath(m_pipelineLibraryPath, AZ_MAX_PATH_LEN, *m_asset);
+            GetPipelineLibraryPath(m_pipelineStateDatabasePath, AZ_MAX_PATH_LEN, *m_asset, "psodb");
 
             {
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
@@ -156,6 +161,8 @@ namespace AZ
 
                 m_pipelineLibraryHandle = pipelineLibraryHandle;
                 m_pipelineStateCache = pipelineStateCache;
+
+                PrewarmPipelineStates();
             }
 
             const Name& drawListName = shaderAsset.GetDrawListName();
@@ -182,7 +189,10 @@ namespace AZ
 
             if (m_pipelineLibraryHandle.IsValid())
             {
+                WaitForPrewarmPipelineStates();
+
                 SavePipelineLibrary();
+                SavePipelineStateDatabase();
 
                 m_pipelineStateCache->ReleaseLibrary(m_pipelineLibraryHandle);
                 m_pipelineStateCache = nullptr;
@@ -359,6 +369,77 @@ namespace AZ
             }
         }
         
+        uint64_t Shader::GetPipelineStateDatabaseKey() const
+        {
+            // Pipeline states also validate the byte code and layouts they reference by hash, but a rebuilt shader asset
+            // invalidates the whole database so stale entries don't accumulate across builds.
+            HashValue64 key = TypeHash64(m_asset->GetBuildTimestamp());
+            key = TypeHash64(m_supervariantIndex.GetIndex(), key);
+            return static_cast<uint64_t>(key);
+        }
+
+        void Shader::PrewarmPipelineStates()
+        {
+            if (m_pipelineStateDatabasePath[0] == 0 || !IO::SystemFile::Exists(m_pipelineStateDatabasePath))
+            {
+                return;
+            }
+
+            ConstPtr<RHI::PipelineStateCacheDatabase> database = Utils::LoadObjectFromFile<RHI::PipelineStateCacheDatabase>(m_pipelineStateDatabasePath);
+            if (!database || !database->IsValid(GetPipelineStateDatabaseKey()))
+            {
+                AZ_TracePrintf("Shader", "Discarded the outdated pipeline state database %s.\n", m_pipelineStateDatabasePath);
+                return;
+            }
+
+            // Only the root variant is guaranteed to be loaded at this point. Pipeline states recorded for other variants
+            // are skipped and get compiled on demand, as they would without a database.
+            const Data::Asset<ShaderVariantAsset>& rootVariantAsset = m_rootVariant.GetShaderVariantAsset();
+            AZStd::vector<RHI::ConstPtr<RHI::ShaderStageFunction>> functions;
+            for (uint32_t stageIndex = 0; stageIndex < RHI::ShaderStageCount; ++stageIndex)
+            {
+                functions.push_back(rootVariantAsset->GetShaderStageFunction(static_cast<RHI::ShaderStage>(stageIndex)));
+            }
+
+            AZStd::vector<RHI::ConstPtr<RHI::PipelineLayoutDescriptor>> pipelineLayouts;
+            pipelineLayouts.push_back(m_asset->GetPipelineLayoutDescriptor(m_supervariantIndex));
+
+            m_prewarmCompletion = aznew AZ::JobCompletion();
+            const auto prewarmLambda = [this, database, functions = AZStd::move(functions), pipelineLayouts = AZStd::move(pipelineLayouts)]()
+            {
+                m_pipelineStateCache->PrewarmLibrary(m_pipelineLibraryHandle, *database, functions, pipelineLayouts);
+            };
+
+            AZ::Job* prewarmJob = AZ::CreateJobFunction(prewarmLambda, true, nullptr); // auto-deletes
+            prewarmJob->SetDependent(m_prewarmCompletion);
+            prewarmJob->Start();
+        }
+
+        void Shader::WaitForPrewarmPipelineStates()
+        {
+            if (m_prewarmCompletion)
+            {
+                m_prewarmCompletion->StartAndWaitForCompletion();
+                delete m_prewarmCompletion;
+                m_prewarmCompletion = nullptr;
+            }
+        }
+
+        void Shader::SavePipelineStateDatabase() const
+        {
+            if (m_pipelineStateDatabasePath[0] != 0)
+            {
+                RHI::ConstPtr<RHI::PipelineStateCacheDatabase> database =
+                    m_pipelineStateCache->GetDatabase(m_pipelineLibraryHandle, GetPipelineStateDatabaseKey());
+                if (database && !database->GetEntries().empty())
+                {
+                    [[maybe_unused]] bool result = Utils::SaveObjectToFile<RHI::PipelineStateCacheDatabase>(
+                        m_pipelineStateDatabasePath, DataStream::ST_BINARY, database.get());
+                    AZ_Error("Shader", result, "Pipeline state database %s was not saved", m_pipelineStateDatabasePath);
+                }
+            }
+        }
+
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
         {
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
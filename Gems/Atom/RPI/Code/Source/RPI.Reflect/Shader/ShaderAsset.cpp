@@ -203,7 +203,7 @@ namespace AZ
                 AZStd::shared_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
                 if (m_shaderVariantTree)
                 {
-                    return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+                    return FindVariantStableIdCached(shaderVariantId);
                 }
             }
 
@@ -223,7 +223,32 @@ namespace AZ
                     return variantSearchResult;
                 }
             }
-            return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+            return FindVariantStableIdCached(shaderVariantId);
+        }
+
+        ShaderVariantSearchResult ShaderAsset::FindVariantStableIdCached(const ShaderVariantId& shaderVariantId)
+        {
+            const HashValue64 hash = TypeHash64(shaderVariantId.m_key, TypeHash64(shaderVariantId.m_mask));
+            VariantSearchCacheEntry& cacheEntry = m_variantSearchCache[static_cast<uint64_t>(hash) % VariantSearchCacheSize];
+
+            {
+                AZStd::lock_guard<AZStd::mutex> cacheLock(m_variantSearchCacheMutex);
+                if (cacheEntry.m_isValid && cacheEntry.m_shaderVariantId == shaderVariantId)
+                {
+                    return cacheEntry.m_searchResult;
+                }
+            }
+
+            const ShaderVariantSearchResult searchResult = m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> cacheLock(m_variantSearchCacheMutex);
+                cacheEntry.m_shaderVariantId = shaderVariantId;
+                cacheEntry.m_searchResult = searchResult;
+                cacheEntry.m_isValid = true;
+            }
+
+            return searchResult;
         }
 
         Data::Asset<ShaderVariantAsset> ShaderAsset::GetVariant(
@@ -587,6 +612,10 @@ namespace AZ
             ShaderReloadDebugTracker::ScopedSection reloadSection("{%p}->ShaderAsset::OnShaderVariantTreeAssetReady %s", this, shaderVariantTreeAsset.GetHint().c_str());
 
             AZStd::unique_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
+
+            // Results cached from the previous tree (or from no tree at all) are no longer valid.
+            m_variantSearchCache = {};
+
             if (isError)
             {
                 m_shaderVariantTree = {}; //This will force to attempt to reload later.
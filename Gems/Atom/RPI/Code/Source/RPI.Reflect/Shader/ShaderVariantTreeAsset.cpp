@@ -25,13 +25,15 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<ShaderVariantTreeAsset, AZ::Data::AssetData>()
-                    ->Version(1)
+                    ->Version(2) // Added the flat lookup table
                     ->Field("ShaderHash", &ShaderVariantTreeAsset::m_shaderHash)
                     ->Field("Nodes", &ShaderVariantTreeAsset::m_nodes)
+                    ->Field("LookupTable", &ShaderVariantTreeAsset::m_lookupTable)
                     ;
             }
 
             ShaderVariantTreeNode::Reflect(context);
+            ShaderVariantTreeLookupEntry::Reflect(context);
         }
 
         Data::AssetId ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(const Data::AssetId& shaderAssetId)
@@ -70,7 +72,42 @@ namespace AZ
             return m_nodes.size();
         }
 
+        size_t ShaderVariantTreeAsset::GetLookupTableSize() const
+        {
+            return m_lookupTable.size();
+        }
+
+        ShaderVariantId ShaderVariantTreeAsset::GetLookupKey(const ShaderVariantId& shaderVariantId)
+        {
+            ShaderVariantId lookupKey;
+            lookupKey.m_mask = shaderVariantId.m_mask;
+            lookupKey.m_key = shaderVariantId.m_key & shaderVariantId.m_mask;
+            return lookupKey;
+        }
+
         ShaderVariantSearchResult ShaderVariantTreeAsset::FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const
+        {
+            // A request which exactly matches a declared variant can't find a better fit in the tree, since every specified
+            // option is a static branch. The table holds the tree's answer for those requests.
+            if (!m_lookupTable.empty())
+            {
+                const ShaderVariantId lookupKey = GetLookupKey(shaderVariantId);
+                auto entryIt = AZStd::lower_bound(m_lookupTable.begin(), m_lookupTable.end(), lookupKey,
+                    [](const ShaderVariantTreeLookupEntry& entry, const ShaderVariantId& key)
+                    {
+                        return ShaderVariantIdComparator::Compare(entry.m_shaderVariantId, key) < 0;
+                    });
+
+                if (entryIt != m_lookupTable.end() && entryIt->m_shaderVariantId == lookupKey)
+                {
+                    return ShaderVariantSearchResult{ entryIt->m_stableId, entryIt->m_dynamicOptionCount };
+                }
+            }
+
+            return FindVariantStableIdInTree(shaderOptionGroupLayout, shaderVariantId);
+        }
+
+        ShaderVariantSearchResult ShaderVariantTreeAsset::FindVariantStableIdInTree(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const
         {
             struct NodeToVisit
             {
@@ -259,6 +296,19 @@ namespace AZ
             }
         }
 
+        void ShaderVariantTreeLookupEntry::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantTreeLookupEntry>()
+                    ->Version(0)
+                    ->Field("ShaderVariantId", &ShaderVariantTreeLookupEntry::m_shaderVariantId)
+                    ->Field("StableId", &ShaderVariantTreeLookupEntry::m_stableId)
+                    ->Field("DynamicOptionCount", &ShaderVariantTreeLookupEntry::m_dynamicOptionCount)
+                    ;
+            }
+        }
+
         ShaderVariantTreeNode::ShaderVariantTreeNode()
             : m_stableId(ShaderVariantStableId{ ShaderVariantTreeAsset::UnspecifiedIndex })
             , m_offset(0)
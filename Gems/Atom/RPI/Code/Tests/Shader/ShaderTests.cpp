@@ -1807,6 +1807,52 @@ namespace UnitTest
         EXPECT_EQ(resultG.GetStableId().GetIndex(), stableId5);
     }
 
+    TEST_F(ShaderTests, ShaderVariantTreeAsset_LookupTableMatchesTreeSearch)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        auto shaderAsset = CreateShaderAsset();
+        auto shaderVariantTreeAsset = CreateShaderVariantTreeAssetForSearch(shaderAsset);
+        ASSERT_TRUE(shaderVariantTreeAsset);
+
+        // Every declared variant has an entry in the lookup table.
+        EXPECT_EQ(shaderVariantTreeAsset->GetLookupTableSize(), 7u);
+
+        auto validateSearch = [&](const ShaderOptionGroup& shaderOptionGroup)
+        {
+            const ShaderVariantId shaderVariantId = shaderOptionGroup.GetShaderVariantId();
+            const auto treeResult = shaderVariantTreeAsset->FindVariantStableIdInTree(shaderAsset->GetShaderOptionGroupLayout(), shaderVariantId);
+            const auto tableResult = shaderVariantTreeAsset->FindVariantStableId(shaderAsset->GetShaderOptionGroupLayout(), shaderVariantId);
+            EXPECT_EQ(tableResult.GetStableId(), treeResult.GetStableId());
+            EXPECT_EQ(tableResult.GetDynamicOptionCount(), treeResult.GetDynamicOptionCount());
+        };
+
+        ShaderOptionGroup shaderOptionGroup(m_shaderOptionGroupLayoutForVariants);
+
+        // Declared variants are answered by the lookup table.
+        validateSearch(shaderOptionGroup);
+        shaderOptionGroup.SetValue(Name("Color"), Name("Fuchsia"));
+        validateSearch(shaderOptionGroup);
+        shaderOptionGroup.SetValue(Name("Quality"), Name("Quality::Auto"));
+        validateSearch(shaderOptionGroup);
+        shaderOptionGroup.SetValue(Name("NumberSamples"), Name("50"));
+        validateSearch(shaderOptionGroup);
+        shaderOptionGroup.SetValue(Name("Raytracing"), Name("On"));
+        validateSearch(shaderOptionGroup);
+
+        // Undeclared variants fall back to the tree search and resolve to their closest parent.
+        shaderOptionGroup.SetValue(Name("NumberSamples"), Name("100"));
+        validateSearch(shaderOptionGroup);
+        shaderOptionGroup.Clear();
+        shaderOptionGroup.SetValue(Name("Color"), Name("Teal"));
+        shaderOptionGroup.SetValue(Name("Quality"), Name("Quality::Poor"));
+        validateSearch(shaderOptionGroup);
+        shaderOptionGroup.Clear();
+        shaderOptionGroup.SetValue(Name("Raytracing"), Name("Off"));
+        validateSearch(shaderOptionGroup);
+    }
+
 
     TEST_F(ShaderTests, ShaderVariantAsset_IsFullyBaked)
     {
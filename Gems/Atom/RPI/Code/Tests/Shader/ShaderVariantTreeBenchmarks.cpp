@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <Atom/RPI.Edit/Shader/ShaderVariantListSourceData.h>
+#include <Atom/RPI.Edit/Shader/ShaderVariantTreeAssetCreator.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroupLayout.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class ShaderVariantTreeBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+            Data::AssetManager::Create(Data::AssetManager::Descriptor());
+            NameDictionary::Create();
+
+            const uint32_t optionCount = aznumeric_cast<uint32_t>(state.range(0));
+            CreateShaderOptionGroupLayout(optionCount);
+            CreateShaderVariantTree(optionCount);
+            CreateQueries(optionCount);
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            m_queries = {};
+            m_shaderVariantTreeAsset.Reset();
+            m_shaderOptionGroupLayout = nullptr;
+
+            NameDictionary::Destroy();
+            Data::AssetManager::Destroy();
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void CreateShaderOptionGroupLayout(uint32_t optionCount)
+        {
+            m_shaderOptionGroupLayout = RPI::ShaderOptionGroupLayout::Create();
+            const RPI::ShaderOptionValues boolValues = RPI::CreateBoolShaderOptionValues();
+            for (uint32_t optionIndex = 0; optionIndex < optionCount; ++optionIndex)
+            {
+                m_shaderOptionGroupLayout->AddShaderOption(RPI::ShaderOptionDescriptor{
+                    Name(AZStd::string::format("o_option%u", optionIndex)), RPI::ShaderOptionType::Boolean, optionIndex, optionIndex,
+                    boolValues, Name("False") });
+            }
+            m_shaderOptionGroupLayout->Finalize();
+        }
+
+        //! Declares every fully specified combination of the options, i.e. 2^optionCount variants.
+        void CreateShaderVariantTree(uint32_t optionCount)
+        {
+            const uint32_t variantCount = 1u << optionCount;
+            const auto& shaderOptions = m_shaderOptionGroupLayout->GetShaderOptions();
+
+            AZStd::vector<RPI::ShaderVariantListSourceData::VariantInfo> variantInfos;
+            variantInfos.reserve(variantCount);
+            for (uint32_t variantIndex = 0; variantIndex < variantCount; ++variantIndex)
+            {
+                RPI::ShaderVariantListSourceData::VariantInfo variantInfo;
+                variantInfo.m_stableId = variantIndex + 1;
+                for (uint32_t optionIndex = 0; optionIndex < optionCount; ++optionIndex)
+                {
+                    variantInfo.m_options[shaderOptions[optionIndex].GetName().GetCStr()] =
+                        (variantIndex & (1u << optionIndex)) ? "True" : "False";
+                }
+                variantInfos.push_back(AZStd::move(variantInfo));
+            }
+
+            RPI::ShaderVariantTreeAssetCreator creator;
+            creator.Begin(Uuid::CreateRandom());
+            creator.SetShaderOptionGroupLayout(*m_shaderOptionGroupLayout);
+            creator.SetVariantInfos(variantInfos);
+            creator.End(m_shaderVariantTreeAsset);
+        }
+
+        //! Builds random, fully specified requests, which is what materials produce when all their options are driven by properties.
+        void CreateQueries(uint32_t optionCount)
+        {
+            constexpr size_t QueryCount = 1024;
+            SimpleLcgRandom random;
+            const auto& shaderOptions = m_shaderOptionGroupLayout->GetShaderOptions();
+
+            m_queries.reserve(QueryCount);
+            for (size_t queryIndex = 0; queryIndex < QueryCount; ++queryIndex)
+            {
+                RPI::ShaderOptionGroup shaderOptionGroup(m_shaderOptionGroupLayout);
+                for (uint32_t optionIndex = 0; optionIndex < optionCount; ++optionIndex)
+                {
+                    shaderOptions[optionIndex].Set(shaderOptionGroup, RPI::ShaderOptionValue{ random.GetRandom() & 1 });
+                }
+                m_queries.push_back(shaderOptionGroup.GetShaderVariantId());
+            }
+        }
+
+        RPI::Ptr<RPI::ShaderOptionGroupLayout> m_shaderOptionGroupLayout;
+        Data::Asset<RPI::ShaderVariantTreeAsset> m_shaderVariantTreeAsset;
+        AZStd::vector<RPI::ShaderVariantId> m_queries;
+    };
+
+    BENCHMARK_DEFINE_F(ShaderVariantTreeBenchmarkFixture, BM_FindVariantStableId_LookupTable)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const RPI::ShaderVariantId& query : m_queries)
+            {
+                benchmark::DoNotOptimize(m_shaderVariantTreeAsset->FindVariantStableId(m_shaderOptionGroupLayout.get(), query));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_queries.size());
+    }
+
+    BENCHMARK_DEFINE_F(ShaderVariantTreeBenchmarkFixture, BM_FindVariantStableId_TreeSearch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const RPI::ShaderVariantId& query : m_queries)
+            {
+                benchmark::DoNotOptimize(m_shaderVariantTreeAsset->FindVariantStableIdInTree(m_shaderOptionGroupLayout.get(), query));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_queries.size());
+    }
+
+    // The argument is the number of boolean options, so 12 options declare 4096 variants.
+    BENCHMARK_REGISTER_F(ShaderVariantTreeBenchmarkFixture, BM_FindVariantStableId_LookupTable)
+        ->Arg(8)
+        ->Arg(12)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(ShaderVariantTreeBenchmarkFixture, BM_FindVariantStableId_TreeSearch)
+        ->Arg(8)
+        ->Arg(12)
+        ->Unit(::benchmark::kMicrosecond);
+}
+
+#endif
@@ -43,6 +43,7 @@ set(FILES
     Tests/Model/ModelTests.cpp
     Tests/Pass/PassTests.cpp
     Tests/Shader/ShaderTests.cpp
+    Tests/Shader/ShaderVariantTreeBenchmarks.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupConstantBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupImageTests.cpp
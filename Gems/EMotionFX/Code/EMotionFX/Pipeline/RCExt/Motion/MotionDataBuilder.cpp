@@ -25,6 +25,7 @@
 
 #include <EMotionFX/Source/Motion.h>
 #include <EMotionFX/Source/MotionManager.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
@@ -501,6 +502,24 @@ namespace EMotionFX
                 InitAndOptimizeMotionData(finalMotionData, motionData, sampleRate, samplingRule.get(), rootJoints);
             }
 
+            // Report how far the compressed data deviates from the source animation.
+            if (const CompressedMotionData* compressedData = azrtti_cast<const CompressedMotionData*>(finalMotionData))
+            {
+                const CompressedMotionData::ErrorReport report = compressedData->CalculateErrorReport(*motionData);
+                const auto getJointName = [compressedData](size_t jointIndex)
+                {
+                    return (jointIndex != InvalidIndex) ? compressedData->GetJointName(jointIndex).c_str() : "";
+                };
+                AZ_TracePrintf("EMotionFX", "Compressed motion data error report for '%s':", motionGroup.GetName().c_str());
+                AZ_TracePrintf("EMotionFX", "   + Max position error = %f (joint '%s')", report.m_maxPosError, getJointName(report.m_maxPosErrorJoint));
+                AZ_TracePrintf("EMotionFX", "   + Max rotation error = %f degrees (joint '%s')", report.m_maxRotError, getJointName(report.m_maxRotErrorJoint));
+                AZ_TracePrintf("EMotionFX", "   + Max scale error    = %f (joint '%s')", report.m_maxScaleError, getJointName(report.m_maxScaleErrorJoint));
+                AZ_TracePrintf("EMotionFX", "   + Max morph error    = %f", report.m_maxMorphError);
+                AZ_TracePrintf("EMotionFX", "   + Max float error    = %f", report.m_maxFloatError);
+                AZ_TracePrintf("EMotionFX", "   + Keys               = %zu of %zu", report.m_numKeys, report.m_numUncompressedKeys);
+                AZ_TracePrintf("EMotionFX", "   + Estimated size     = %zu bytes", compressedData->CalcStreamSaveSizeInBytes(MotionData::SaveSettings()));
+            }
+
             if (!finalMotionData->VerifyIntegrity())
             {
                 AZ_Error(SceneUtil::ErrorWindow, false, "Data integrity issue in the final animation for '%s'.", motionGroup.GetName().c_str());
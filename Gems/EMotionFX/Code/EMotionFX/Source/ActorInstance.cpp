@@ -77,6 +77,7 @@ namespace EMotionFX
         SetFlag(BOOL_USEDFORVISUALIZATION, false);
         SetFlag(BOOL_ENABLED, true);
         SetFlag(BOOL_MOTIONEXTRACTION, true);
+        SetFlag(BOOL_EXPENSIVENODES, true);
 
 #if defined(EMFX_DEVELOPMENT_BUILD)
         SetFlag(BOOL_OWNEDBYRUNTIME, false);
@@ -1388,6 +1389,16 @@ namespace EMotionFX
         return (m_boolFlags & BOOL_MOTIONEXTRACTION) != 0;
     }
 
+    void ActorInstance::SetExpensiveNodesEnabled(bool enabled)
+    {
+        SetFlag(BOOL_EXPENSIVENODES, enabled);
+    }
+
+    bool ActorInstance::GetExpensiveNodesEnabled() const
+    {
+        return (m_boolFlags & BOOL_EXPENSIVENODES) != 0;
+    }
+
     // update the static based aabb dimensions
     void ActorInstance::UpdateStaticBasedAabbDimensions()
     {
@@ -1724,17 +1735,17 @@ namespace EMotionFX
         m_selfAttachment = selfAttachment;
     }
 
-    void ActorInstance::EnableFlag(uint8 flag)
+    void ActorInstance::EnableFlag(uint16 flag)
     {
         m_boolFlags |= flag;
     }
 
-    void ActorInstance::DisableFlag(uint8 flag)
+    void ActorInstance::DisableFlag(uint16 flag)
     {
         m_boolFlags &= ~flag;
     }
 
-    void ActorInstance::SetFlag(uint8 flag, bool enabled)
+    void ActorInstance::SetFlag(uint16 flag, bool enabled)
     {
         if (enabled)
         {
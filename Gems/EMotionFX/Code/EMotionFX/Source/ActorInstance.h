@@ -845,6 +845,14 @@ namespace EMotionFX
         void SetMotionExtractionEnabled(bool enabled);
         bool GetMotionExtractionEnabled() const;
 
+        /**
+         * Enable or disable the expensive anim graph nodes, like the IK, ragdoll and simulated object nodes.
+         * Disabled nodes pass their input pose through. Schedulers use this to reduce the cost of actor instances that are far away or small on screen.
+         * @param enabled Set to false to skip the expensive nodes. This is enabled by default.
+         */
+        void SetExpensiveNodesEnabled(bool enabled);
+        bool GetExpensiveNodesEnabled() const;
+
         void SetTrajectoryDeltaTransform(const Transform& transform);
         const Transform& GetTrajectoryDeltaTransform() const;
 
@@ -900,7 +908,7 @@ namespace EMotionFX
         EBoundsType             m_boundsUpdateType;      /**< The bounds update type (node based, mesh based or collision mesh based). */
         float m_boundsExpandBy = 0.25f; /**< Expand bounding box by normalized percentage. (Default: 25% greater than the calculated bounding box) */
         uint8                   m_numAttachmentRefs;     /**< Specifies how many actor instances use this actor instance as attachment. */
-        uint8                   m_boolFlags;             /**< Boolean flags. */
+        uint16                  m_boolFlags;             /**< Boolean flags. */
 
         /**
          * Boolean masks, as replacement for having several bools as members.
@@ -916,8 +924,9 @@ namespace EMotionFX
             BOOL_MOTIONEXTRACTION       = 1 << 6,   /**< Enabled when motion extraction should be active on this actor instance. This still requires the Actor to have a valid motion extraction node setup, and individual motion instances having motion extraction enabled as well. */
 
 #if defined(EMFX_DEVELOPMENT_BUILD)
-            BOOL_OWNEDBYRUNTIME         = 1 << 7    /**< Set if the actor instance is used/owned by the engine runtime. */
+            BOOL_OWNEDBYRUNTIME         = 1 << 7,   /**< Set if the actor instance is used/owned by the engine runtime. */
 #endif // EMFX_DEVELOPMENT_BUILD
+            BOOL_EXPENSIVENODES         = 1 << 8    /**< Enabled when expensive anim graph nodes, like IK, ragdolls and simulated objects, should be processed. */
         };
 
         /**
@@ -979,20 +988,20 @@ namespace EMotionFX
          * Enable boolean flags.
          * @param flag The flags to enable.
          */
-        void EnableFlag(uint8 flag);
+        void EnableFlag(uint16 flag);
 
         /**
          * Disable boolean flags.
          * @param flag The flags to disable.
          */
-        void DisableFlag(uint8 flag);
+        void DisableFlag(uint16 flag);
 
         /**
          * Enable or disable specific flags.
          * @param flag The flags to modify.
          * @param enabled Set to true to enable the flags, or false to disable them.
          */
-        void SetFlag(uint8 flag, bool enabled);
+        void SetFlag(uint16 flag, bool enabled);
 
         /**
          * Set the skeletal detail level node flags and enable or disable the nodes accordingly.
@@ -231,7 +231,8 @@ namespace EMotionFX
         /**
          * Set the scheduler to use.
          * EMotion FX provides two different scheduler implementations:
-         * A single threaded scheduler (SingleThreadScheduler) and a multithreaded scheduler (MultiThreadScheduler, the default).
+         * A single threaded scheduler (SingleThreadScheduler), a multithreaded scheduler (MultiThreadScheduler, the default)
+         * and a multithreaded scheduler that samples less significant actor instances at a lower rate (SignificanceScheduler).
          * The current scheduler will automatically be deleted at application shutdown.
          * The schedulers are responsible for figuring out the update order.
          * @param scheduler The new scheduler to use.
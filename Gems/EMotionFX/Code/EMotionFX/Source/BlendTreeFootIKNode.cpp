@@ -848,7 +848,7 @@ namespace EMotionFX
         }
 
         // If the weight is near zero or if this node is disabled or if the node is enable for server optimization, we can skip all calculations and just output the input pose.
-        if (weight < MCore::Math::epsilon || m_disabled || GetEMotionFX().GetEnableServerOptimization())
+        if (weight < MCore::Math::epsilon || m_disabled || GetEMotionFX().GetEnableServerOptimization() || !animGraphInstance->GetActorInstance()->GetExpensiveNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
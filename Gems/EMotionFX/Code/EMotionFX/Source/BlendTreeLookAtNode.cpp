@@ -131,7 +131,7 @@ namespace EMotionFX
         }
 
         // if the weight is near zero, we can skip all calculations and act like a pass-trough node
-        if (weight < MCore::Math::epsilon || m_disabled)
+        if (weight < MCore::Math::epsilon || m_disabled || !animGraphInstance->GetActorInstance()->GetExpensiveNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             RequestPoses(animGraphInstance);
@@ -207,7 +207,7 @@ namespace EMotionFX
         }
 
         // As we already forwarded the target pose at this point, we can just return in case the node is disabled.
-        if (m_disabled)
+        if (m_disabled || !actorInstance->GetExpensiveNodesEnabled())
         {
             return;
         }
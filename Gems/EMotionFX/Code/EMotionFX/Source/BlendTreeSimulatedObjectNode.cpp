@@ -230,7 +230,7 @@ namespace EMotionFX
         }
 
         // If we're not active or if this node is disabled or it is optimized for server, we can skip all calculations and just output the input pose.
-        if (!isActive || m_disabled || GetEMotionFX().GetEnableServerOptimization())
+        if (!isActive || m_disabled || GetEMotionFX().GetEnableServerOptimization() || !animGraphInstance->GetActorInstance()->GetExpensiveNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
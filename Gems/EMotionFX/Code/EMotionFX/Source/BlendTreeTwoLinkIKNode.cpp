@@ -229,7 +229,7 @@ namespace EMotionFX
         }
 
         // if the IK weight is near zero, we can skip all calculations and act like a pass-trough node
-        if (weight < MCore::Math::epsilon || m_disabled)
+        if (weight < MCore::Math::epsilon || m_disabled || !animGraphInstance->GetActorInstance()->GetExpensiveNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
@@ -0,0 +1,1656 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/TransformKernels.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // The smallest three components of a unit quaternion are within this range, as the largest component is at least as large as each of them.
+        constexpr float s_smallestThreeRange = 0.70710678f;
+        constexpr float s_maxQuantizedRotationValue = static_cast<float>((1 << 15) - 1);
+        constexpr float s_maxQuantizedValue = static_cast<float>((1 << 16) - 1);
+        constexpr size_t s_maxNumSamples = (1 << 16);
+
+        AZ::u16 Quantize(float normalizedValue, float maxQuantizedValue)
+        {
+            return static_cast<AZ::u16>(AZ::GetClamp(normalizedValue, 0.0f, 1.0f) * maxQuantizedValue + 0.5f);
+        }
+
+        float CalculateError(const AZ::Vector3& a, const AZ::Vector3& b)
+        {
+            return (a - b).GetAbs().GetMaxElement();
+        }
+
+        // The largest component difference, the same measure as the NonUniformMotionData key reduction. Both hemispheres represent the same rotation.
+        float CalculateError(const AZ::Quaternion& a, const AZ::Quaternion& b)
+        {
+            const float sameHemisphereError = AZ::GetMax(
+                AZ::GetMax(AZ::GetAbs(a.GetX() - b.GetX()), AZ::GetAbs(a.GetY() - b.GetY())),
+                AZ::GetMax(AZ::GetAbs(a.GetZ() - b.GetZ()), AZ::GetAbs(a.GetW() - b.GetW())));
+            const float oppositeHemisphereError = AZ::GetMax(
+                AZ::GetMax(AZ::GetAbs(a.GetX() + b.GetX()), AZ::GetAbs(a.GetY() + b.GetY())),
+                AZ::GetMax(AZ::GetAbs(a.GetZ() + b.GetZ()), AZ::GetAbs(a.GetW() + b.GetW())));
+            return AZ::GetMin(sameHemisphereError, oppositeHemisphereError);
+        }
+
+        float CalculateError(float a, float b)
+        {
+            return AZ::GetAbs(a - b);
+        }
+
+        AZ::Vector3 Interpolate(const AZ::Vector3& a, const AZ::Vector3& b, float t)
+        {
+            return a.Lerp(b, t);
+        }
+
+        AZ::Quaternion Interpolate(const AZ::Quaternion& a, const AZ::Quaternion& b, float t)
+        {
+            return MCore::NLerp(a, b, t);
+        }
+
+        float Interpolate(float a, float b, float t)
+        {
+            return AZ::Lerp(a, b, t);
+        }
+
+        // Greedily extend every segment to the furthest key for which linearly interpolating between the segment end points
+        // reproduces all skipped keys within the maximum error.
+        template <class ValueType>
+        void FindKeysToKeep(const AZStd::vector<AZ::u16>& frames, const AZStd::vector<ValueType>& values, float maxError, AZStd::vector<size_t>& outKeepIndices)
+        {
+            outKeepIndices.clear();
+            const size_t numKeys = frames.size();
+            if (numKeys == 0)
+            {
+                return;
+            }
+
+            outKeepIndices.emplace_back(0);
+            size_t first = 0;
+            while (first < numKeys - 1)
+            {
+                size_t last = first + 1;
+                for (size_t candidate = first + 2; candidate < numKeys && (frames[candidate] - frames[first]) <= CompressedMotionData::s_maxKeySpacing; ++candidate)
+                {
+                    const float invFrameSpacing = 1.0f / static_cast<float>(frames[candidate] - frames[first]);
+                    bool withinError = true;
+                    for (size_t i = first + 1; i < candidate; ++i)
+                    {
+                        const float t = static_cast<float>(frames[i] - frames[first]) * invFrameSpacing;
+                        if (CalculateError(Interpolate(values[first], values[candidate], t), values[i]) > maxError)
+                        {
+                            withinError = false;
+                            break;
+                        }
+                    }
+
+                    if (!withinError)
+                    {
+                        break;
+                    }
+                    last = candidate;
+                }
+
+                outKeepIndices.emplace_back(last);
+                first = last;
+            }
+        }
+
+        // Append the keys of a track that are needed to stay within the maximum error to outKeys.
+        // Returns the number of appended keys, which is zero when the whole track is within the maximum error of the static value.
+        template <class KeyType, class ValueType, class UnpackFunction>
+        AZ::u32 ReduceKeys(const KeyType* keys, size_t numKeys, const ValueType& staticValue, float maxError, AZStd::vector<KeyType>& outKeys, const UnpackFunction& unpack)
+        {
+            AZStd::vector<AZ::u16> frames(numKeys);
+            AZStd::vector<ValueType> values(numKeys);
+            bool isStatic = true;
+            for (size_t i = 0; i < numKeys; ++i)
+            {
+                frames[i] = keys[i].m_frame;
+                values[i] = unpack(keys[i]);
+                isStatic &= (CalculateError(values[i], staticValue) <= maxError);
+            }
+
+            if (isStatic)
+            {
+                return 0;
+            }
+
+            AZStd::vector<size_t> keepIndices;
+            FindKeysToKeep(frames, values, maxError, keepIndices);
+            for (const size_t keyIndex : keepIndices)
+            {
+                outKeys.emplace_back(keys[keyIndex]);
+            }
+            return static_cast<AZ::u32>(keepIndices.size());
+        }
+
+        template <class KeyType>
+        bool WriteKeys(MCore::Stream* stream, const KeyType* keys, size_t numKeys, MCore::Endian::EEndianType targetEndianType)
+        {
+            if (numKeys == 0)
+            {
+                return true;
+            }
+
+            AZStd::vector<KeyType> convertedKeys(keys, keys + numKeys);
+            const AZ::u32 numValues = static_cast<AZ::u32>(numKeys * sizeof(KeyType) / sizeof(AZ::u16));
+            MCore::Endian::ConvertUnsignedInt16To(reinterpret_cast<AZ::u16*>(convertedKeys.data()), targetEndianType, numValues);
+            return stream->Write(convertedKeys.data(), numKeys * sizeof(KeyType)) != 0;
+        }
+
+        template <class KeyType>
+        bool ReadKeys(MCore::Stream* stream, AZStd::vector<KeyType>& keys, AZ::u32 numKeys, MCore::Endian::EEndianType sourceEndianType, AZ::u32& outKeyOffset)
+        {
+            outKeyOffset = static_cast<AZ::u32>(keys.size());
+            if (numKeys == 0)
+            {
+                return true;
+            }
+
+            keys.resize(keys.size() + numKeys);
+            KeyType* firstKey = &keys[outKeyOffset];
+            if (stream->Read(firstKey, numKeys * sizeof(KeyType)) == 0)
+            {
+                return false;
+            }
+
+            const AZ::u32 numValues = static_cast<AZ::u32>(numKeys * sizeof(KeyType) / sizeof(AZ::u16));
+            MCore::Endian::ConvertUnsignedInt16(reinterpret_cast<AZ::u16*>(firstKey), sourceEndianType, numValues);
+            return true;
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, quantized)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        // Keys store their frame in 16 bits, lower the sample rate for very long motions.
+        if (numSamples > s_maxNumSamples)
+        {
+            AZ_Warning("EMotionFX", false, "Motion needs %zu samples at %.2f samples per second, which is more than the %zu supported by compressed motion data. Lowering the sample rate.",
+                numSamples, sampleRate, s_maxNumSamples);
+            sampleRate = static_cast<float>(s_maxNumSamples - 1) / motionData->GetDuration();
+            MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+        }
+
+        CompressedMotionData::InitSettings initSettings;
+        initSettings.m_numJoints = motionData->GetNumJoints();
+        initSettings.m_numMorphs = motionData->GetNumMorphs();
+        initSettings.m_numFloats = motionData->GetNumFloats();
+        initSettings.m_sampleRate = sampleRate;
+        initSettings.m_numSamples = numSamples;
+        Init(initSettings);
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+
+        // Joints.
+        AZStd::vector<AZ::Vector3> positions(m_numSamples);
+        AZStd::vector<AZ::Quaternion> rotations(m_numSamples);
+        AZStd::vector<AZ::Vector3> scales(m_numSamples);
+        for (size_t i = 0; i < initSettings.m_numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                positions[s] = transform.m_position;
+                rotations[s] = transform.m_rotation.GetNormalized();
+                EMFX_SCALECODE
+                (
+                    scales[s] = transform.m_scale;
+                )
+            }
+
+            if (motionData->IsJointPositionAnimated(i))
+            {
+                SetJointPositionSamples(i, positions);
+            }
+            if (motionData->IsJointRotationAnimated(i))
+            {
+                SetJointRotationSamples(i, rotations);
+            }
+            EMFX_SCALECODE
+            (
+                if (motionData->IsJointScaleAnimated(i))
+                {
+                    SetJointScaleSamples(i, scales);
+                }
+            )
+        }
+
+        // Morphs.
+        AZStd::vector<float> values(m_numSamples);
+        for (size_t i = 0; i < initSettings.m_numMorphs; ++i)
+        {
+            if (!motionData->IsMorphAnimated(i))
+            {
+                continue;
+            }
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleMorph(s * sampleSpacing, i);
+            }
+            SetMorphSamples(i, values);
+        }
+
+        // Floats.
+        for (size_t i = 0; i < initSettings.m_numFloats; ++i)
+        {
+            if (!motionData->IsFloatAnimated(i))
+            {
+                continue;
+            }
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleFloat(s * sampleSpacing, i);
+            }
+            SetFloatSamples(i, values);
+        }
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // The reduction only removes keys, the kept keys keep their quantized values. The key buffers are rebuilt in joint order.
+        AZStd::vector<PackedKey> rotationKeys;
+        AZStd::vector<PackedKey> vectorKeys;
+        AZStd::vector<PackedFloatKey> morphKeys;
+        AZStd::vector<PackedFloatKey> floatKeys;
+        rotationKeys.reserve(m_rotationKeys.size());
+        vectorKeys.reserve(m_vectorKeys.size());
+
+        const auto reduceVector3Track = [this, &vectorKeys](Vector3Track& track, const AZ::Vector3& staticValue, float maxError)
+        {
+            const AZ::u32 keyOffset = static_cast<AZ::u32>(vectorKeys.size());
+            track.m_numKeys = ReduceKeys(m_vectorKeys.data() + track.m_keyOffset, track.m_numKeys, staticValue, maxError, vectorKeys,
+                [&track](const PackedKey& key) { return UnpackVector3(key, track); });
+            track.m_keyOffset = keyOffset;
+        };
+
+        const auto reduceFloatTrack = [](FloatTrack& track, const AZStd::vector<PackedFloatKey>& keys, float staticValue, float maxError, AZStd::vector<PackedFloatKey>& outKeys)
+        {
+            const AZ::u32 keyOffset = static_cast<AZ::u32>(outKeys.size());
+            track.m_numKeys = ReduceKeys(keys.data() + track.m_keyOffset, track.m_numKeys, staticValue, maxError, outKeys,
+                [&track](const PackedFloatKey& key) { return UnpackFloat(key, track); });
+            track.m_keyOffset = keyOffset;
+        };
+
+        // Joints.
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            float maxPosError = settings.m_maxPosError;
+            float maxRotError = settings.m_maxRotError;
+            [[maybe_unused]] float maxScaleError = settings.m_maxScaleError;
+            if (AZStd::find(settings.m_jointIgnoreList.begin(), settings.m_jointIgnoreList.end(), i) != settings.m_jointIgnoreList.end())
+            {
+                maxPosError = 0.00001f;
+                maxRotError = 0.00001f;
+                maxScaleError = 0.00001f;
+            }
+
+            JointData& jointData = m_jointData[i];
+            const Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+            reduceVector3Track(jointData.m_position, staticTransform.m_position, maxPosError);
+
+            RotationTrack& rotationTrack = jointData.m_rotation;
+            const AZ::u32 rotationKeyOffset = static_cast<AZ::u32>(rotationKeys.size());
+            rotationTrack.m_numKeys = ReduceKeys(m_rotationKeys.data() + rotationTrack.m_keyOffset, rotationTrack.m_numKeys, staticTransform.m_rotation, maxRotError, rotationKeys,
+                [](const PackedKey& key) { return UnpackRotation(key); });
+            rotationTrack.m_keyOffset = rotationKeyOffset;
+
+            EMFX_SCALECODE
+            (
+                reduceVector3Track(jointData.m_scale, staticTransform.m_scale, maxScaleError);
+            )
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            const bool ignore = AZStd::find(settings.m_morphIgnoreList.begin(), settings.m_morphIgnoreList.end(), i) != settings.m_morphIgnoreList.end();
+            reduceFloatTrack(m_morphData[i], m_morphKeys, m_staticMorphData[i].m_staticValue, ignore ? 0.0f : settings.m_maxMorphError, morphKeys);
+        }
+
+        // Floats.
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            const bool ignore = AZStd::find(settings.m_floatIgnoreList.begin(), settings.m_floatIgnoreList.end(), i) != settings.m_floatIgnoreList.end();
+            reduceFloatTrack(m_floatData[i], m_floatKeys, m_staticFloatData[i].m_staticValue, ignore ? 0.0f : settings.m_maxFloatError, floatKeys);
+        }
+
+        rotationKeys.shrink_to_fit();
+        vectorKeys.shrink_to_fit();
+        m_rotationKeys = AZStd::move(rotationKeys);
+        m_vectorKeys = AZStd::move(vectorKeys);
+        m_morphKeys = AZStd::move(morphKeys);
+        m_floatKeys = AZStd::move(floatKeys);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    CompressedMotionData::PackedKey CompressedMotionData::PackRotation(AZ::u16 frame, const AZ::Quaternion& rotation)
+    {
+        const AZ::Quaternion normalized = rotation.GetNormalized();
+        const float components[4] = { normalized.GetX(), normalized.GetY(), normalized.GetZ(), normalized.GetW() };
+        AZ::u16 largestIndex = 0;
+        for (AZ::u16 i = 1; i < 4; ++i)
+        {
+            if (AZ::GetAbs(components[i]) > AZ::GetAbs(components[largestIndex]))
+            {
+                largestIndex = i;
+            }
+        }
+
+        // Flip the quaternion so that the largest component is positive, which lets us rebuild it from the other three.
+        const float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+        PackedKey key;
+        key.m_frame = frame;
+        size_t valueIndex = 0;
+        for (AZ::u16 i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                const float normalizedValue = (components[i] * sign / s_smallestThreeRange) * 0.5f + 0.5f;
+                key.m_value[valueIndex++] = Quantize(normalizedValue, s_maxQuantizedRotationValue);
+            }
+        }
+
+        // Store the index of the largest component in the top bits of the first two values.
+        key.m_value[0] |= static_cast<AZ::u16>((largestIndex & 1) << 15);
+        key.m_value[1] |= static_cast<AZ::u16>((largestIndex >> 1) << 15);
+        return key;
+    }
+
+    AZ::Quaternion CompressedMotionData::UnpackRotation(const PackedKey& key)
+    {
+        const AZ::u16 largestIndex = static_cast<AZ::u16>((key.m_value[0] >> 15) | ((key.m_value[1] >> 15) << 1));
+        float components[4];
+        float sumOfSquares = 0.0f;
+        size_t valueIndex = 0;
+        for (AZ::u16 i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                const float normalizedValue = static_cast<float>(key.m_value[valueIndex++] & 0x7FFF) / s_maxQuantizedRotationValue;
+                components[i] = (normalizedValue * 2.0f - 1.0f) * s_smallestThreeRange;
+                sumOfSquares += components[i] * components[i];
+            }
+        }
+        components[largestIndex] = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - sumOfSquares));
+        return AZ::Quaternion(components[0], components[1], components[2], components[3]);
+    }
+
+    CompressedMotionData::PackedKey CompressedMotionData::PackVector3(AZ::u16 frame, const AZ::Vector3& value, const Vector3Track& track)
+    {
+        PackedKey key;
+        key.m_frame = frame;
+        for (int i = 0; i < 3; ++i)
+        {
+            const float extent = track.m_rangeExtent.GetElement(i);
+            const float normalizedValue = (extent > 0.0f) ? (value.GetElement(i) - track.m_rangeMin.GetElement(i)) / extent : 0.0f;
+            key.m_value[i] = Quantize(normalizedValue, s_maxQuantizedValue);
+        }
+        return key;
+    }
+
+    AZ::Vector3 CompressedMotionData::UnpackVector3(const PackedKey& key, const Vector3Track& track)
+    {
+        const AZ::Vector3 normalizedValue(
+            static_cast<float>(key.m_value[0]),
+            static_cast<float>(key.m_value[1]),
+            static_cast<float>(key.m_value[2]));
+        return track.m_rangeMin + track.m_rangeExtent * normalizedValue * (1.0f / s_maxQuantizedValue);
+    }
+
+    CompressedMotionData::PackedFloatKey CompressedMotionData::PackFloat(AZ::u16 frame, float value, const FloatTrack& track)
+    {
+        const float normalizedValue = (track.m_rangeExtent > 0.0f) ? (value - track.m_rangeMin) / track.m_rangeExtent : 0.0f;
+        return { frame, Quantize(normalizedValue, s_maxQuantizedValue) };
+    }
+
+    float CompressedMotionData::UnpackFloat(const PackedFloatKey& key, const FloatTrack& track)
+    {
+        return track.m_rangeMin + track.m_rangeExtent * (static_cast<float>(key.m_value) / s_maxQuantizedValue);
+    }
+
+    template <class KeyType>
+    CompressedMotionData::KeyPair CompressedMotionData::FindKeys(const KeyType* keys, size_t numKeys, size_t sampleIndex, float t)
+    {
+        // Find the first key after the sample. The first key of a track is always at frame zero.
+        const KeyType* keyB = AZStd::upper_bound(keys, keys + numKeys, sampleIndex,
+            [](size_t frame, const KeyType& key)
+            {
+                return frame < key.m_frame;
+            });
+
+        if (keyB == keys + numKeys)
+        {
+            return { numKeys - 1, numKeys - 1, 0.0f };
+        }
+
+        const KeyType* keyA = (keyB != keys) ? keyB - 1 : keyB;
+        const float frameA = static_cast<float>(keyA->m_frame);
+        const float frameB = static_cast<float>(keyB->m_frame);
+        const float keyT = (frameB > frameA) ? (static_cast<float>(sampleIndex) + t - frameA) / (frameB - frameA) : 0.0f;
+        return { static_cast<size_t>(keyA - keys), static_cast<size_t>(keyB - keys), keyT };
+    }
+
+    void CompressedMotionData::CalculateInterpolationIndices(float sampleTime, size_t& sampleIndex, float& t) const
+    {
+        size_t nextSampleIndex;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, sampleIndex, nextSampleIndex, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleVector3Track(const Vector3Track& track, size_t sampleIndex, float t, const AZ::Vector3& staticValue) const
+    {
+        if (track.m_numKeys == 0)
+        {
+            return staticValue;
+        }
+
+        const PackedKey* keys = &m_vectorKeys[track.m_keyOffset];
+        const KeyPair keyPair = FindKeys(keys, track.m_numKeys, sampleIndex, t);
+        return UnpackVector3(keys[keyPair.m_keyA], track).Lerp(UnpackVector3(keys[keyPair.m_keyB], track), keyPair.m_t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleRotationTrack(const RotationTrack& track, size_t sampleIndex, float t, const AZ::Quaternion& staticValue) const
+    {
+        if (track.m_numKeys == 0)
+        {
+            return staticValue;
+        }
+
+        const PackedKey* keys = &m_rotationKeys[track.m_keyOffset];
+        const KeyPair keyPair = FindKeys(keys, track.m_numKeys, sampleIndex, t);
+        return MCore::NLerp(UnpackRotation(keys[keyPair.m_keyA]), UnpackRotation(keys[keyPair.m_keyB]), keyPair.m_t);
+    }
+
+    float CompressedMotionData::SampleFloatTrack(const FloatTrack& track, const AZStd::vector<PackedFloatKey>& keys, size_t sampleIndex, float t, float staticValue) const
+    {
+        if (track.m_numKeys == 0)
+        {
+            return staticValue;
+        }
+
+        const PackedFloatKey* trackKeys = &keys[track.m_keyOffset];
+        const KeyPair keyPair = FindKeys(trackKeys, track.m_numKeys, sampleIndex, t);
+        return AZ::Lerp(UnpackFloat(trackKeys[keyPair.m_keyA], track), UnpackFloat(trackKeys[keyPair.m_keyB], track), keyPair.m_t);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(settings.m_sampleTime, sampleIndex, t);
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex && !inPlace)
+        {
+            const Transform& staticTransform = m_staticJointData[transformDataIndex].m_staticTransform;
+            const JointData& jointData = m_jointData[transformDataIndex];
+            result.m_position = SampleVector3Track(jointData.m_position, sampleIndex, t, staticTransform.m_position);
+            result.m_rotation = SampleRotationTrack(jointData.m_rotation, sampleIndex, t, staticTransform.m_rotation);
+#ifndef EMFX_SCALE_DISABLED
+            result.m_scale = SampleVector3Track(jointData.m_scale, sampleIndex, t, staticTransform.m_scale);
+#endif
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(settings.m_sampleTime, sampleIndex, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+
+        // The joints are sampled in chunks, so that the rotations of the animated joints in a chunk can be interpolated together.
+        // Each rotation has its own interpolation weight, as the keys around the sample time differ per track.
+        constexpr size_t chunkSize = 64;
+        Transform results[chunkSize];
+        AZ::Quaternion rotationsA[chunkSize];
+        AZ::Quaternion rotationsB[chunkSize];
+        float rotationWeights[chunkSize];
+        size_t rotationResultIndices[chunkSize];
+        for (size_t chunkStart = 0; chunkStart < numNodes; chunkStart += chunkSize)
+        {
+            const size_t chunkEnd = AZStd::min(chunkStart + chunkSize, numNodes);
+            size_t numRotations = 0;
+            for (size_t i = chunkStart; i < chunkEnd; ++i)
+            {
+                const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+                const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+                // Sample the interpolated data.
+                Transform& result = results[i - chunkStart];
+                const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+                if (jointDataIndex != InvalidIndex && !inPlace)
+                {
+                    const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+                    const JointData& jointData = m_jointData[jointDataIndex];
+                    result.m_position = SampleVector3Track(jointData.m_position, sampleIndex, t, staticTransform.m_position);
+
+                    const RotationTrack& rotationTrack = jointData.m_rotation;
+                    if (rotationTrack.m_numKeys > 0)
+                    {
+                        const PackedKey* keys = &m_rotationKeys[rotationTrack.m_keyOffset];
+                        const KeyPair keyPair = FindKeys(keys, rotationTrack.m_numKeys, sampleIndex, t);
+                        rotationsA[numRotations] = UnpackRotation(keys[keyPair.m_keyA]);
+                        rotationsB[numRotations] = UnpackRotation(keys[keyPair.m_keyB]);
+                        rotationWeights[numRotations] = keyPair.m_t;
+                        rotationResultIndices[numRotations] = i - chunkStart;
+                        ++numRotations;
+                    }
+                    else
+                    {
+                        result.m_rotation = staticTransform.m_rotation;
+                    }
+
+#ifndef EMFX_SCALE_DISABLED
+                    result.m_scale = SampleVector3Track(jointData.m_scale, sampleIndex, t, staticTransform.m_scale);
+#endif
+                }
+                else
+                {
+                    if (m_additive && jointDataIndex == InvalidIndex)
+                    {
+                        result = Transform::CreateIdentity();
+                    }
+                    else
+                    {
+                        if (settings.m_inputPose && !inPlace)
+                        {
+                            result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                        }
+                        else
+                        {
+                            result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                        }
+                    }
+                }
+            }
+
+            TransformKernels::NLerp(rotationsA, rotationsB, rotationWeights, rotationsA, numRotations);
+            for (size_t r = 0; r < numRotations; ++r)
+            {
+                results[rotationResultIndices[r]].m_rotation = rotationsA[r];
+            }
+
+            for (size_t i = chunkStart; i < chunkEnd; ++i)
+            {
+                const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+                Transform& result = results[i - chunkStart];
+
+                // Apply retargeting.
+                if (settings.m_retarget)
+                {
+                    BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+                }
+
+                outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+            }
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                outputPose->SetMorphWeight(i, SampleFloatTrack(m_morphData[realIndex], m_morphKeys, sampleIndex, t, m_staticMorphData[realIndex].m_staticValue));
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(sampleTime, sampleIndex, t);
+        return SampleFloatTrack(m_morphData[morphDataIndex], m_morphKeys, sampleIndex, t, m_staticMorphData[morphDataIndex].m_staticValue);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(sampleTime, sampleIndex, t);
+        return SampleFloatTrack(m_floatData[floatDataIndex], m_floatKeys, sampleIndex, t, m_staticFloatData[floatDataIndex].m_staticValue);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(sampleTime, sampleIndex, t);
+        return SampleVector3Track(m_jointData[jointDataIndex].m_position, sampleIndex, t, m_staticJointData[jointDataIndex].m_staticTransform.m_position);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(sampleTime, sampleIndex, t);
+        return SampleRotationTrack(m_jointData[jointDataIndex].m_rotation, sampleIndex, t, m_staticJointData[jointDataIndex].m_staticTransform.m_rotation);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(sampleTime, sampleIndex, t);
+        return SampleVector3Track(m_jointData[jointDataIndex].m_scale, sampleIndex, t, m_staticJointData[jointDataIndex].m_staticTransform.m_scale);
+    }
+#endif
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        size_t sampleIndex;
+        float t;
+        CalculateInterpolationIndices(sampleTime, sampleIndex, t);
+
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        return Transform
+        (
+            SampleVector3Track(jointData.m_position, sampleIndex, t, staticTransform.m_position),
+            SampleRotationTrack(jointData.m_rotation, sampleIndex, t, staticTransform.m_rotation)
+#ifndef EMFX_SCALE_DISABLED
+            ,SampleVector3Track(jointData.m_scale, sampleIndex, t, staticTransform.m_scale)
+#endif
+        );
+    }
+
+    CompressedMotionData::ErrorReport CompressedMotionData::CalculateErrorReport(const MotionData& referenceData) const
+    {
+        AZ_Assert(referenceData.GetNumJoints() == GetNumJoints() && referenceData.GetNumMorphs() == GetNumMorphs() && referenceData.GetNumFloats() == GetNumFloats(),
+            "Expected the reference motion data to contain the same joints, morphs and floats.");
+
+        ErrorReport report;
+        const size_t numJoints = AZStd::min(GetNumJoints(), referenceData.GetNumJoints());
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            report.m_numKeys += jointData.m_position.m_numKeys + jointData.m_rotation.m_numKeys;
+            report.m_numUncompressedKeys += (IsJointPositionAnimated(i) ? m_numSamples : 0) + (IsJointRotationAnimated(i) ? m_numSamples : 0);
+            EMFX_SCALECODE
+            (
+                report.m_numKeys += jointData.m_scale.m_numKeys;
+                report.m_numUncompressedKeys += IsJointScaleAnimated(i) ? m_numSamples : 0;
+            )
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float sampleTime = AZStd::min(s * m_sampleSpacing, m_duration);
+                const Transform transform = SampleJointTransform(sampleTime, i);
+                const Transform referenceTransform = referenceData.SampleJointTransform(sampleTime, i);
+
+                const float posError = (transform.m_position - referenceTransform.m_position).GetLength();
+                if (posError > report.m_maxPosError)
+                {
+                    report.m_maxPosError = posError;
+                    report.m_maxPosErrorJoint = i;
+                }
+
+                const float cosHalfAngle = AZ::GetMin(AZ::GetAbs(transform.m_rotation.GetNormalized().Dot(referenceTransform.m_rotation.GetNormalized())), 1.0f);
+                const float rotError = AZ::RadToDeg(2.0f * AZ::Acos(cosHalfAngle));
+                if (rotError > report.m_maxRotError)
+                {
+                    report.m_maxRotError = rotError;
+                    report.m_maxRotErrorJoint = i;
+                }
+
+                EMFX_SCALECODE
+                (
+                    const float scaleError = (transform.m_scale - referenceTransform.m_scale).GetLength();
+                    if (scaleError > report.m_maxScaleError)
+                    {
+                        report.m_maxScaleError = scaleError;
+                        report.m_maxScaleErrorJoint = i;
+                    }
+                )
+            }
+        }
+
+        const size_t numMorphs = AZStd::min(GetNumMorphs(), referenceData.GetNumMorphs());
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            report.m_numKeys += m_morphData[i].m_numKeys;
+            report.m_numUncompressedKeys += IsMorphAnimated(i) ? m_numSamples : 0;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float sampleTime = AZStd::min(s * m_sampleSpacing, m_duration);
+                report.m_maxMorphError = AZ::GetMax(report.m_maxMorphError, AZ::GetAbs(SampleMorph(sampleTime, i) - referenceData.SampleMorph(sampleTime, i)));
+            }
+        }
+
+        const size_t numFloats = AZStd::min(GetNumFloats(), referenceData.GetNumFloats());
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            report.m_numKeys += m_floatData[i].m_numKeys;
+            report.m_numUncompressedKeys += IsFloatAnimated(i) ? m_numSamples : 0;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float sampleTime = AZStd::min(s * m_sampleSpacing, m_duration);
+                report.m_maxFloatError = AZ::GetMax(report.m_maxFloatError, AZ::GetAbs(SampleFloat(sampleTime, i) - referenceData.SampleFloat(sampleTime, i)));
+            }
+        }
+
+        return report;
+    }
+
+    void CompressedMotionData::Init(const InitSettings& settings)
+    {
+        if (settings.m_numSamples > 0)
+        {
+            AZ_Error("EMotionFX", settings.m_sampleRate > 0.0f, "Sample rate should be larger than zero.");
+        }
+        AZ_Error("EMotionFX", settings.m_numSamples <= s_maxNumSamples, "Compressed motion data supports up to %zu samples, %zu requested.", s_maxNumSamples, settings.m_numSamples);
+        Clear();
+        Resize(settings.m_numJoints, settings.m_numMorphs, settings.m_numFloats);
+        m_numSamples = AZStd::min(settings.m_numSamples, s_maxNumSamples);
+        SetSampleRate(settings.m_sampleRate);
+        UpdateDuration();
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::SetVector3Samples(Vector3Track& track, const AZStd::vector<AZ::Vector3>& values)
+    {
+        AZ_Error("EMotionFX", values.size() == m_numSamples, "Expecting the values vector to be of size %zu instead of %zu.", m_numSamples, values.size());
+        if (values.size() != m_numSamples || values.empty())
+        {
+            return;
+        }
+
+        AZ::Vector3 rangeMin = values[0];
+        AZ::Vector3 rangeMax = values[0];
+        for (const AZ::Vector3& value : values)
+        {
+            rangeMin = rangeMin.GetMin(value);
+            rangeMax = rangeMax.GetMax(value);
+        }
+        track.m_rangeMin = rangeMin;
+        track.m_rangeExtent = rangeMax - rangeMin;
+
+        // Keys that are replaced stay unused in the buffer until the next Optimize().
+        track.m_keyOffset = static_cast<AZ::u32>(m_vectorKeys.size());
+        track.m_numKeys = static_cast<AZ::u32>(values.size());
+        for (size_t s = 0; s < values.size(); ++s)
+        {
+            m_vectorKeys.emplace_back(PackVector3(static_cast<AZ::u16>(s), values[s], track));
+        }
+    }
+
+    void CompressedMotionData::SetRotationSamples(RotationTrack& track, const AZStd::vector<AZ::Quaternion>& values)
+    {
+        AZ_Error("EMotionFX", values.size() == m_numSamples, "Expecting the values vector to be of size %zu instead of %zu.", m_numSamples, values.size());
+        if (values.size() != m_numSamples || values.empty())
+        {
+            return;
+        }
+
+        track.m_keyOffset = static_cast<AZ::u32>(m_rotationKeys.size());
+        track.m_numKeys = static_cast<AZ::u32>(values.size());
+        for (size_t s = 0; s < values.size(); ++s)
+        {
+            m_rotationKeys.emplace_back(PackRotation(static_cast<AZ::u16>(s), values[s]));
+        }
+    }
+
+    void CompressedMotionData::SetFloatSamples(FloatTrack& track, AZStd::vector<PackedFloatKey>& keys, const AZStd::vector<float>& values)
+    {
+        AZ_Error("EMotionFX", values.size() == m_numSamples, "Expecting the values vector to be of size %zu instead of %zu.", m_numSamples, values.size());
+        if (values.size() != m_numSamples || values.empty())
+        {
+            return;
+        }
+
+        const auto [minValue, maxValue] = AZStd::minmax_element(values.begin(), values.end());
+        track.m_rangeMin = *minValue;
+        track.m_rangeExtent = *maxValue - *minValue;
+        track.m_keyOffset = static_cast<AZ::u32>(keys.size());
+        track.m_numKeys = static_cast<AZ::u32>(values.size());
+        for (size_t s = 0; s < values.size(); ++s)
+        {
+            keys.emplace_back(PackFloat(static_cast<AZ::u16>(s), values[s], track));
+        }
+    }
+
+    void CompressedMotionData::SetJointPositionSamples(size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& positions)
+    {
+        SetVector3Samples(m_jointData[jointDataIndex].m_position, positions);
+    }
+
+    void CompressedMotionData::SetJointRotationSamples(size_t jointDataIndex, const AZStd::vector<AZ::Quaternion>& rotations)
+    {
+        SetRotationSamples(m_jointData[jointDataIndex].m_rotation, rotations);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::SetJointScaleSamples(size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& scales)
+    {
+        SetVector3Samples(m_jointData[jointDataIndex].m_scale, scales);
+    }
+#endif
+
+    void CompressedMotionData::SetMorphSamples(size_t morphDataIndex, const AZStd::vector<float>& values)
+    {
+        SetFloatSamples(m_morphData[morphDataIndex], m_morphKeys, values);
+    }
+
+    void CompressedMotionData::SetFloatSamples(size_t floatDataIndex, const AZStd::vector<float>& values)
+    {
+        SetFloatSamples(m_floatData[floatDataIndex], m_floatKeys, values);
+    }
+
+    size_t CompressedMotionData::GetNumJointPositionKeys(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_numKeys;
+    }
+
+    size_t CompressedMotionData::GetNumJointRotationKeys(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_numKeys;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    size_t CompressedMotionData::GetNumJointScaleKeys(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.m_numKeys;
+    }
+#endif
+
+    size_t CompressedMotionData::GetNumMorphKeys(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_numKeys;
+    }
+
+    size_t CompressedMotionData::GetNumFloatKeys(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_numKeys;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_numKeys > 0;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_numKeys > 0;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.m_numKeys > 0;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return (IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex));
+#else
+        return (IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex));
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_numKeys > 0;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_numKeys > 0;
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointData& data : m_jointData)
+        {
+            data = JointData();
+        }
+        m_rotationKeys.clear();
+        m_vectorKeys.clear();
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (FloatTrack& track : m_morphData)
+        {
+            track = FloatTrack();
+        }
+        m_morphKeys.clear();
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (FloatTrack& track : m_floatData)
+        {
+            track = FloatTrack();
+        }
+        m_floatKeys.clear();
+    }
+
+    // Clearing a single track leaves its keys unused in the buffer until the next Optimize().
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_position.m_numKeys = 0;
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_rotation.m_numKeys = 0;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_scale.m_numKeys = 0;
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        ClearJointPositionSamples(jointDataIndex);
+        ClearJointRotationSamples(jointDataIndex);
+#ifndef EMFX_SCALE_DISABLED
+        ClearJointScaleSamples(jointDataIndex);
+#endif
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex].m_numKeys = 0;
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex].m_numKeys = 0;
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_rotationKeys.clear();
+        m_rotationKeys.shrink_to_fit();
+        m_vectorKeys.clear();
+        m_vectorKeys.shrink_to_fit();
+        m_morphKeys.clear();
+        m_morphKeys.shrink_to_fit();
+        m_floatKeys.clear();
+        m_floatKeys.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the quantization range scales every key of the track.
+        for (JointData& jointData : m_jointData)
+        {
+            jointData.m_position.m_rangeMin *= scaleFactor;
+            jointData.m_position.m_rangeExtent *= scaleFactor;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        FileFormat::FileVector3         m_posRangeMin { 0.0f, 0.0f, 0.0f };      // Quantization range of the position keys.
+        FileFormat::FileVector3         m_posRangeExtent { 0.0f, 0.0f, 0.0f };
+        FileFormat::FileVector3         m_scaleRangeMin { 0.0f, 0.0f, 0.0f };    // Quantization range of the scale keys.
+        FileFormat::FileVector3         m_scaleRangeExtent { 0.0f, 0.0f, 0.0f };
+        AZ::u32                         m_numPosKeys = 0;
+        AZ::u32                         m_numRotKeys = 0;
+        AZ::u32                         m_numScaleKeys = 0;
+
+        // Followed by:
+        // string : The name of the joint.
+        // AZ::u16[4][m_numPosKeys]   : Frame index and quantized position.
+        // AZ::u16[4][m_numRotKeys]   : Frame index and smallest three rotation.
+        // AZ::u16[4][m_numScaleKeys] : Frame index and quantized scale.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+        float m_rangeMin = 0.0f;    // Quantization range of the keys.
+        float m_rangeExtent = 0.0f;
+        AZ::u32 m_numKeys = 0;
+
+        // Followed by:
+        // String: The name of the channel.
+        // AZ::u16[2][m_numKeys] : Frame index and quantized value.
+    };
+
+    //---------------------------------------------------------------------------------------
+
+    bool CompressedMotionData::SaveJoint(MCore::Stream* stream, size_t jointDataIndex, const SaveSettings& saveSettings) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        File_CompressedMotionData_Joint jointChunk;
+        ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(jointDataIndex)));
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(GetJointStaticRotation(jointDataIndex)));
+        ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(jointDataIndex)));
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(GetJointBindPoseRotation(jointDataIndex)));
+        ExporterLib::CopyVector(jointChunk.m_posRangeMin, AZ::PackedVector3f(jointData.m_position.m_rangeMin));
+        ExporterLib::CopyVector(jointChunk.m_posRangeExtent, AZ::PackedVector3f(jointData.m_position.m_rangeExtent));
+        jointChunk.m_numPosKeys = jointData.m_position.m_numKeys;
+        jointChunk.m_numRotKeys = jointData.m_rotation.m_numKeys;
+#ifndef EMFX_SCALE_DISABLED
+        ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(jointDataIndex)));
+        ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(jointDataIndex)));
+        ExporterLib::CopyVector(jointChunk.m_scaleRangeMin, AZ::PackedVector3f(jointData.m_scale.m_rangeMin));
+        ExporterLib::CopyVector(jointChunk.m_scaleRangeExtent, AZ::PackedVector3f(jointData.m_scale.m_rangeExtent));
+        jointChunk.m_numScaleKeys = jointData.m_scale.m_numKeys;
+#endif
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(jointDataIndex).c_str());
+            MCore::LogDetailedInfo("   + Position Keys:     %d", jointChunk.m_numPosKeys);
+            MCore::LogDetailedInfo("   + Rotation Keys:     %d", jointChunk.m_numRotKeys);
+            MCore::LogDetailedInfo("   + Scale Keys:        %d", jointChunk.m_numScaleKeys);
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_posRangeMin, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_posRangeExtent, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_scaleRangeMin, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_scaleRangeExtent, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_numPosKeys, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_numRotKeys, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_numScaleKeys, targetEndianType);
+        if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joint name.
+        ExporterLib::SaveString(GetJointName(jointDataIndex), stream, targetEndianType);
+
+        // Write the keys.
+        if (!WriteKeys(stream, m_vectorKeys.data() + jointData.m_position.m_keyOffset, jointData.m_position.m_numKeys, targetEndianType) ||
+            !WriteKeys(stream, m_rotationKeys.data() + jointData.m_rotation.m_keyOffset, jointData.m_rotation.m_numKeys, targetEndianType))
+        {
+            return false;
+        }
+
+#ifndef EMFX_SCALE_DISABLED
+        if (!WriteKeys(stream, m_vectorKeys.data() + jointData.m_scale.m_keyOffset, jointData.m_scale.m_numKeys, targetEndianType))
+        {
+            return false;
+        }
+#endif
+
+        return true;
+    }
+
+    bool CompressedMotionData::SaveFloatTrack(MCore::Stream* stream, const FloatTrack& track, const AZStd::vector<PackedFloatKey>& keys, const AZStd::string& name, float staticValue, const SaveSettings& saveSettings) const
+    {
+        if (name.empty())
+        {
+            MCore::LogError("Cannot save float channel with empty name.");
+            return false;
+        }
+
+        File_CompressedMotionData_Float floatChunk;
+        floatChunk.m_staticValue = staticValue;
+        floatChunk.m_rangeMin = track.m_rangeMin;
+        floatChunk.m_rangeExtent = track.m_rangeExtent;
+        floatChunk.m_numKeys = track.m_numKeys;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("    - Channel: '%s'", name.c_str());
+            MCore::LogDetailedInfo("       + Static Weight = %f", floatChunk.m_staticValue);
+            MCore::LogDetailedInfo("       + Keys          = %d", floatChunk.m_numKeys);
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+        ExporterLib::ConvertFloat(&floatChunk.m_rangeMin, targetEndianType);
+        ExporterLib::ConvertFloat(&floatChunk.m_rangeExtent, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&floatChunk.m_numKeys, targetEndianType);
+        if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+        {
+            return false;
+        }
+
+        ExporterLib::SaveString(name, stream, targetEndianType);
+        return WriteKeys(stream, keys.data() + track.m_keyOffset, track.m_numKeys, targetEndianType);
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        // Add the joints to the size.
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+            numBytes += (jointData.m_position.m_numKeys + jointData.m_rotation.m_numKeys) * sizeof(PackedKey);
+            EMFX_SCALECODE
+            (
+                numBytes += jointData.m_scale.m_numKeys * sizeof(PackedKey);
+            )
+        }
+
+        // Add the morphs channels to the size.
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += m_morphData[i].m_numKeys * sizeof(PackedFloatKey);
+        }
+
+        // Add the float channels to the size.
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += m_floatData[i].m_numKeys * sizeof(PackedFloatKey);
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_sampleRate = GetSampleRate();
+
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints channels.
+        for (size_t i = 0; i < GetNumJoints(); i++)
+        {
+            if (!SaveJoint(stream, i, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph channels.
+        for (size_t i = 0; i < GetNumMorphs(); i++)
+        {
+            if (!SaveFloatTrack(stream, m_morphData[i], m_morphKeys, GetMorphName(i), GetMorphStaticValue(i), saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the float channels.
+        for (size_t i = 0; i < GetNumFloats(); i++)
+        {
+            if (!SaveFloatTrack(stream, m_floatData[i], m_floatKeys, GetFloatName(i), GetFloatStaticValue(i), saveSettings))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        CompressedMotionData::InitSettings initSettings;
+        initSettings.m_numJoints = info.m_numJoints;
+        initSettings.m_numMorphs = info.m_numMorphs;
+        initSettings.m_numFloats = info.m_numFloats;
+        initSettings.m_numSamples = info.m_numSamples;
+        initSettings.m_sampleRate = info.m_sampleRate;
+        Init(initSettings);
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            AZ::Vector3 posRangeMin(jointInfo.m_posRangeMin.m_x, jointInfo.m_posRangeMin.m_y, jointInfo.m_posRangeMin.m_z);
+            AZ::Vector3 posRangeExtent(jointInfo.m_posRangeExtent.m_x, jointInfo.m_posRangeExtent.m_y, jointInfo.m_posRangeExtent.m_z);
+            AZ::Vector3 scaleRangeMin(jointInfo.m_scaleRangeMin.m_x, jointInfo.m_scaleRangeMin.m_y, jointInfo.m_scaleRangeMin.m_z);
+            AZ::Vector3 scaleRangeExtent(jointInfo.m_scaleRangeExtent.m_x, jointInfo.m_scaleRangeExtent.m_y, jointInfo.m_scaleRangeExtent.m_z);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&posRangeMin, sourceEndianType);
+            MCore::Endian::ConvertVector3(&posRangeExtent, sourceEndianType);
+            MCore::Endian::ConvertVector3(&scaleRangeMin, sourceEndianType);
+            MCore::Endian::ConvertVector3(&scaleRangeExtent, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_numPosKeys, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_numRotKeys, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_numScaleKeys, sourceEndianType);
+
+            // Update the values.
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            // Read the name.
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - Position Keys = %d", jointInfo.m_numPosKeys);
+                MCore::LogDetailedInfo("    - Rotation Keys = %d", jointInfo.m_numRotKeys);
+                MCore::LogDetailedInfo("    - Scale Keys    = %d", jointInfo.m_numScaleKeys);
+            }
+
+            // Read the keys.
+            JointData& jointData = m_jointData[i];
+            jointData.m_position.m_rangeMin = posRangeMin;
+            jointData.m_position.m_rangeExtent = posRangeExtent;
+            jointData.m_position.m_numKeys = jointInfo.m_numPosKeys;
+            jointData.m_rotation.m_numKeys = jointInfo.m_numRotKeys;
+            if (!ReadKeys(stream, m_vectorKeys, jointInfo.m_numPosKeys, sourceEndianType, jointData.m_position.m_keyOffset) ||
+                !ReadKeys(stream, m_rotationKeys, jointInfo.m_numRotKeys, sourceEndianType, jointData.m_rotation.m_keyOffset))
+            {
+                return false;
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            jointData.m_scale.m_rangeMin = scaleRangeMin;
+            jointData.m_scale.m_rangeExtent = scaleRangeExtent;
+            jointData.m_scale.m_numKeys = jointInfo.m_numScaleKeys;
+            if (!ReadKeys(stream, m_vectorKeys, jointInfo.m_numScaleKeys, sourceEndianType, jointData.m_scale.m_keyOffset))
+            {
+                return false;
+            }
+#else
+            // Skip the scale keys.
+            AZStd::vector<PackedKey> scaleKeys;
+            AZ::u32 scaleKeyOffset;
+            if (!ReadKeys(stream, scaleKeys, jointInfo.m_numScaleKeys, sourceEndianType, scaleKeyOffset))
+            {
+                return false;
+            }
+#endif
+        } // For all joints.
+
+        // Read the morphs and floats.
+        const auto readFloatTrack = [stream, sourceEndianType, &readSettings, &name](FloatTrack& track, AZStd::vector<PackedFloatKey>& keys, float& outStaticValue) -> bool
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            MCore::Endian::ConvertFloat(&floatInfo.m_rangeMin, sourceEndianType);
+            MCore::Endian::ConvertFloat(&floatInfo.m_rangeExtent, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_numKeys, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + Channel: '%s'", name.c_str());
+                MCore::LogDetailedInfo("       + Keys         = %d", floatInfo.m_numKeys);
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+
+            outStaticValue = floatInfo.m_staticValue;
+            track.m_rangeMin = floatInfo.m_rangeMin;
+            track.m_rangeExtent = floatInfo.m_rangeExtent;
+            track.m_numKeys = floatInfo.m_numKeys;
+            return ReadKeys(stream, keys, floatInfo.m_numKeys, sourceEndianType, track.m_keyOffset);
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            float staticValue = 0.0f;
+            if (!readFloatTrack(m_morphData[i], m_morphKeys, staticValue))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            float staticValue = 0.0f;
+            if (!readFloatTrack(m_floatData[i], m_floatKeys, staticValue))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
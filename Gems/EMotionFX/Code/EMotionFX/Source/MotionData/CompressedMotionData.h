@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    /**
+     * Motion data that stores its keys on a uniform sample grid, but only keeps the keys that are needed to stay within the optimize settings error.
+     * Rotations are stored as smallest three quaternions in 48 bits, positions, scales, morphs and floats are quantized to 16 bits per component
+     * within the value range of their track. Each key stores its frame index next to its value, and the keys of a track are stored after each other
+     * in joint order, so that sampling a pose walks through the key buffers in a single direction.
+     * InitFromNonUniformData() keeps a key for every sample, the key reduction happens in Optimize().
+     */
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{5C0C2B4E-7C1D-4E55-9C33-0B9D3E8B6A71}", MotionData)
+
+        // The maximum number of frames between two keys. This limits the cost of the key reduction on long, slowly changing tracks.
+        static constexpr size_t s_maxKeySpacing = 255;
+
+        struct EMFX_API InitSettings
+        {
+            size_t m_numJoints = 0;
+            size_t m_numMorphs = 0;
+            size_t m_numFloats = 0;
+            size_t m_numSamples = 0;
+            float m_sampleRate = 30.0f;
+        };
+
+        // The difference between this motion data and a reference motion data, sampled at every frame.
+        struct EMFX_API ErrorReport
+        {
+            float m_maxPosError = 0.0f;     // In units.
+            float m_maxRotError = 0.0f;     // In degrees.
+            float m_maxScaleError = 0.0f;   // In scale factor.
+            float m_maxMorphError = 0.0f;   // Morph difference.
+            float m_maxFloatError = 0.0f;   // Float difference.
+            size_t m_maxPosErrorJoint = InvalidIndex;
+            size_t m_maxRotErrorJoint = InvalidIndex;
+            size_t m_maxScaleErrorJoint = InvalidIndex;
+            size_t m_numKeys = 0;           // The number of keys stored in all animated tracks.
+            size_t m_numUncompressedKeys = 0; // The number of keys the animated tracks would store with a key for every sample.
+        };
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void Init(const InitSettings& settings);
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+        // Replace the keys of a track with a key for every sample. The vectors need to contain GetNumSamples() values.
+        void SetJointPositionSamples(size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& positions);
+        void SetJointRotationSamples(size_t jointDataIndex, const AZStd::vector<AZ::Quaternion>& rotations);
+        void SetMorphSamples(size_t morphDataIndex, const AZStd::vector<float>& values);
+        void SetFloatSamples(size_t floatDataIndex, const AZStd::vector<float>& values);
+
+        size_t GetNumJointPositionKeys(size_t jointDataIndex) const;
+        size_t GetNumJointRotationKeys(size_t jointDataIndex) const;
+        size_t GetNumMorphKeys(size_t morphDataIndex) const;
+        size_t GetNumFloatKeys(size_t floatDataIndex) const;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        void SetJointScaleSamples(size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& scales);
+        size_t GetNumJointScaleKeys(size_t jointDataIndex) const;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        /**
+         * Compare this motion data against another motion data with the same joints, morphs and floats, for example the source data it has been built from.
+         * Both are sampled at every frame of this motion data.
+         * @param referenceData The motion data to compare against.
+         * @result The largest errors and the key counts of this motion data.
+         */
+        ErrorReport CalculateErrorReport(const MotionData& referenceData) const;
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        // A 16 bit frame index followed by three 16 bit components. Used for smallest three rotations as well as for quantized vectors.
+        struct EMFX_API PackedKey
+        {
+            AZ::u16 m_frame;
+            AZ::u16 m_value[3];
+        };
+
+        struct EMFX_API PackedFloatKey
+        {
+            AZ::u16 m_frame;
+            AZ::u16 m_value;
+        };
+
+        struct EMFX_API RotationTrack
+        {
+            AZ::u32 m_keyOffset = 0;    // The index of the first key in m_rotationKeys.
+            AZ::u32 m_numKeys = 0;
+        };
+
+        struct EMFX_API Vector3Track
+        {
+            AZ::u32 m_keyOffset = 0;    // The index of the first key in m_vectorKeys.
+            AZ::u32 m_numKeys = 0;
+            AZ::Vector3 m_rangeMin = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_rangeExtent = AZ::Vector3::CreateZero();
+        };
+
+        struct EMFX_API FloatTrack
+        {
+            AZ::u32 m_keyOffset = 0;    // The index of the first key in m_morphKeys or m_floatKeys.
+            AZ::u32 m_numKeys = 0;
+            float m_rangeMin = 0.0f;
+            float m_rangeExtent = 0.0f;
+        };
+
+        struct EMFX_API JointData
+        {
+            Vector3Track m_position;
+            RotationTrack m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            Vector3Track m_scale;
+#endif
+        };
+
+        // The keys to interpolate between for a given sample, as indices into a key buffer.
+        struct EMFX_API KeyPair
+        {
+            size_t m_keyA;
+            size_t m_keyB;
+            float m_t;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+
+        static PackedKey PackRotation(AZ::u16 frame, const AZ::Quaternion& rotation);
+        static AZ::Quaternion UnpackRotation(const PackedKey& key);
+        static PackedKey PackVector3(AZ::u16 frame, const AZ::Vector3& value, const Vector3Track& track);
+        static AZ::Vector3 UnpackVector3(const PackedKey& key, const Vector3Track& track);
+        static PackedFloatKey PackFloat(AZ::u16 frame, float value, const FloatTrack& track);
+        static float UnpackFloat(const PackedFloatKey& key, const FloatTrack& track);
+
+        template <class KeyType>
+        static KeyPair FindKeys(const KeyType* keys, size_t numKeys, size_t sampleIndex, float t);
+
+        void CalculateInterpolationIndices(float sampleTime, size_t& sampleIndex, float& t) const;
+        AZ::Vector3 SampleVector3Track(const Vector3Track& track, size_t sampleIndex, float t, const AZ::Vector3& staticValue) const;
+        AZ::Quaternion SampleRotationTrack(const RotationTrack& track, size_t sampleIndex, float t, const AZ::Quaternion& staticValue) const;
+        float SampleFloatTrack(const FloatTrack& track, const AZStd::vector<PackedFloatKey>& keys, size_t sampleIndex, float t, float staticValue) const;
+
+        void SetVector3Samples(Vector3Track& track, const AZStd::vector<AZ::Vector3>& values);
+        void SetRotationSamples(RotationTrack& track, const AZStd::vector<AZ::Quaternion>& values);
+        void SetFloatSamples(FloatTrack& track, AZStd::vector<PackedFloatKey>& keys, const AZStd::vector<float>& values);
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+        bool SaveJoint(MCore::Stream* stream, size_t jointDataIndex, const SaveSettings& saveSettings) const;
+        bool SaveFloatTrack(MCore::Stream* stream, const FloatTrack& track, const AZStd::vector<PackedFloatKey>& keys, const AZStd::string& name, float staticValue, const SaveSettings& saveSettings) const;
+
+    private:
+        void ScaleData(float scaleFactor) override;
+        void UpdateSampleSpacing();
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<FloatTrack> m_morphData;
+        AZStd::vector<FloatTrack> m_floatData;
+        AZStd::vector<PackedKey> m_rotationKeys;        // The keys of all rotation tracks, in joint order.
+        AZStd::vector<PackedKey> m_vectorKeys;          // The keys of all position and scale tracks, in joint order.
+        AZStd::vector<PackedFloatKey> m_morphKeys;      // The keys of all morph tracks.
+        AZStd::vector<PackedFloatKey> m_floatKeys;      // The keys of all float tracks.
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
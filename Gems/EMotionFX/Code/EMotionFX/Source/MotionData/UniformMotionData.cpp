@@ -19,6 +19,7 @@
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Skeleton.h>
 #include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/TransformKernels.h>
 
 #include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
 #include <EMotionFX/Source/Importer/MotionFileFormat.h>
@@ -211,51 +212,85 @@ namespace EMotionFX
         const ActorInstance* actorInstance = settings.m_actorInstance;
         const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
         const size_t numNodes = actorInstance->GetNumEnabledNodes();
-        for (size_t i = 0; i < numNodes; ++i)
-        {
-            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
-            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
 
-            // Sample the interpolated data.
-            Transform result;
-            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
-            if (jointDataIndex != InvalidIndex && !inPlace)
+        // The joints are sampled in chunks, so that the rotations of the animated joints in a chunk can be interpolated together.
+        constexpr size_t chunkSize = 64;
+        Transform results[chunkSize];
+        AZ::Quaternion rotationsA[chunkSize];
+        AZ::Quaternion rotationsB[chunkSize];
+        size_t rotationResultIndices[chunkSize];
+        for (size_t chunkStart = 0; chunkStart < numNodes; chunkStart += chunkSize)
+        {
+            const size_t chunkEnd = AZStd::min(chunkStart + chunkSize, numNodes);
+            size_t numRotations = 0;
+            for (size_t i = chunkStart; i < chunkEnd; ++i)
             {
-                const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
-                const JointData& jointData = m_jointData[jointDataIndex];
-                result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
-                result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
+                const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+                const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+                // Sample the interpolated data.
+                Transform& result = results[i - chunkStart];
+                const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+                if (jointDataIndex != InvalidIndex && !inPlace)
+                {
+                    const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+                    const JointData& jointData = m_jointData[jointDataIndex];
+                    result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
+                    if (!jointData.m_rotations.empty())
+                    {
+                        rotationsA[numRotations] = jointData.m_rotations[indexA].ToQuaternion();
+                        rotationsB[numRotations] = jointData.m_rotations[indexB].ToQuaternion();
+                        rotationResultIndices[numRotations] = i - chunkStart;
+                        ++numRotations;
+                    }
+                    else
+                    {
+                        result.m_rotation = staticJointData.m_staticTransform.m_rotation;
+                    }
 
 #ifndef EMFX_SCALE_DISABLED
-                result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
+                    result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
 #endif
-            }
-            else
-            {
-                if (m_additive && jointDataIndex == InvalidIndex)
-                {
-                    result = Transform::CreateIdentity();
                 }
                 else
                 {
-                    if (settings.m_inputPose && !inPlace)
+                    if (m_additive && jointDataIndex == InvalidIndex)
                     {
-                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                        result = Transform::CreateIdentity();
                     }
                     else
                     {
-                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                        if (settings.m_inputPose && !inPlace)
+                        {
+                            result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                        }
+                        else
+                        {
+                            result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                        }
                     }
                 }
             }
 
-            // Apply retargeting.
-            if (settings.m_retarget)
+            TransformKernels::NLerp(rotationsA, rotationsB, t, rotationsA, numRotations);
+            for (size_t r = 0; r < numRotations; ++r)
             {
-                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+                results[rotationResultIndices[r]].m_rotation = rotationsA[r];
             }
 
-            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+            for (size_t i = chunkStart; i < chunkEnd; ++i)
+            {
+                const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+                Transform& result = results[i - chunkStart];
+
+                // Apply retargeting.
+                if (settings.m_retarget)
+                {
+                    BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+                }
+
+                outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+            }
         }
 
         // Apply runtime motion mirroring.
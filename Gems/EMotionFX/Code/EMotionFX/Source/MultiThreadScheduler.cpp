@@ -20,6 +20,8 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/sort.h>
 
 
 namespace EMotionFX
@@ -32,6 +34,9 @@ namespace EMotionFX
     {
         m_cleanTimer     = 0.0f; // time passed since last schedule cleanup, in seconds
         m_steps.reserve(1000);
+
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        m_useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
     }
 
 
@@ -53,6 +58,7 @@ namespace EMotionFX
     {
         Lock();
         m_steps.clear();
+        m_scheduleChanged = true;
         Unlock();
     }
 
@@ -100,6 +106,7 @@ namespace EMotionFX
             else
             {
                 m_steps.erase(AZStd::next(begin(m_steps), s));
+                m_scheduleChanged = true;
             }
         }
     }
@@ -110,8 +117,7 @@ namespace EMotionFX
     {
         MCore::LockGuardRecursive guard(m_mutex);
 
-        size_t numSteps = m_steps.size();
-        if (numSteps == 0)
+        if (m_steps.empty())
         {
             return;
         }
@@ -122,7 +128,6 @@ namespace EMotionFX
         {
             m_cleanTimer = 0.0f;
             RemoveEmptySteps();
-            numSteps = m_steps.size();
         }
 
         //-----------------------------------------------------------
@@ -141,67 +146,249 @@ namespace EMotionFX
             rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
         }
 
+        ExecuteSchedule(timePassedInSeconds);
+    }
+
+
+    void MultiThreadScheduler::ExecuteSchedule(float timePassedInSeconds)
+    {
         // reset stats
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
-        for (const ScheduleStep& currentStep : m_steps)
+        if (m_scheduleChanged)
+        {
+            RebuildChunks();
+        }
+
+        const size_t numSteps = m_steps.size();
+        for (size_t s = 0; s < numSteps; ++s)
+        {
+            BalanceChunks(s);
+        }
+
+        m_timePassedInSeconds = timePassedInSeconds;
+        if (m_useTaskGraph)
+        {
+            if (!m_taskGraph.IsEmpty())
+            {
+                AZ::TaskGraphEvent finishedEvent;
+                m_taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
+            }
+            return;
+        }
+
+        for (size_t s = 0; s < numSteps; ++s)
         {
-            if (currentStep.m_actorInstances.empty())
+            const size_t firstChunk = m_stepChunkOffsets[s];
+            const size_t numChunks = m_stepChunkOffsets[s + 1] - firstChunk;
+            if (numChunks == 0)
             {
                 continue;
             }
 
-            // process the actor instances in the current step in parallel
+            // process the chunks of the current step in parallel
             AZ::JobCompletion jobCompletion;
-            for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+            for (size_t c = 0; c < numChunks; ++c)
             {
-                if (actorInstance->GetIsEnabled() == false)
+                if (m_chunks[firstChunk + c].m_actorInstances.empty())
                 {
                     continue;
                 }
 
+                const size_t chunkIndex = firstChunk + c;
+                const AZ::u32 threadIndex = aznumeric_cast<AZ::u32>(c);
                 AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+                AZ::Job* job = AZ::CreateJobFunction([this, chunkIndex, threadIndex]()
                 {
-                    AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+                    ExecuteChunk(chunkIndex, threadIndex);
+                }, true, jobContext);
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        m_numVisible.Increment();
-                    }
+            jobCompletion.StartAndWaitForCompletion();
+        } // for all steps
+    }
+
+
+    void MultiThreadScheduler::ExecuteChunk(size_t chunkIndex, AZ::u32 threadIndex)
+    {
+        AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::ExecuteChunk");
+
+        const float timePassedInSeconds = m_timePassedInSeconds;
+        for (ActorInstance* actorInstance : m_chunks[chunkIndex].m_actorInstances)
+        {
+            // Chunks of the same step never share a thread index, so they never share the per thread data either.
+            actorInstance->SetThreadIndex(threadIndex);
+            UpdateActorInstance(actorInstance, timePassedInSeconds);
+        }
+    }
+
+
+    void MultiThreadScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+    }
+
+
+    float MultiThreadScheduler::EstimateUpdateCost(const ActorInstance* actorInstance) const
+    {
+        // The cost mostly scales with the number of joints that get sampled, blended and, when visible, turned into skinning matrices.
+        const float numEnabledJoints = aznumeric_cast<float>(actorInstance->GetNumEnabledNodes());
+        return 1.0f + (actorInstance->GetIsVisible() ? numEnabledJoints : numEnabledJoints * 0.5f);
+    }
+
+
+    size_t MultiThreadScheduler::GetNumWorkChunks(size_t stepIndex) const
+    {
+        if (stepIndex + 1 >= m_stepChunkOffsets.size())
+        {
+            return 0;
+        }
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        return m_stepChunkOffsets[stepIndex + 1] - m_stepChunkOffsets[stepIndex];
+    }
+
+
+    void MultiThreadScheduler::RebuildChunks()
+    {
+        m_scheduleChanged = false;
+
+        // Use at most one chunk per thread, so that the chunk index within a step can be used as thread index.
+        const size_t maxNumChunks = AZStd::max<size_t>(GetEMotionFX().GetNumThreads(), 1);
+        const size_t numSteps = m_steps.size();
+        m_stepChunkOffsets.resize(numSteps + 1);
+        size_t numChunks = 0;
+        for (size_t s = 0; s < numSteps; ++s)
+        {
+            m_stepChunkOffsets[s] = numChunks;
+            numChunks += AZStd::min(m_steps[s].m_actorInstances.size(), maxNumChunks);
+        }
+        m_stepChunkOffsets[numSteps] = numChunks;
+        m_chunks.resize(numChunks);
+
+        if (!m_useTaskGraph)
+        {
+            return;
+        }
+
+        // The task graph only depends on the number of chunks per step, so it can be retained until the schedule changes.
+        m_taskGraph.Reset();
+        AZStd::vector<AZ::TaskToken> previousTokens;
+        AZStd::vector<AZ::TaskToken> currentTokens;
+        for (size_t s = 0; s < numSteps; ++s)
+        {
+            const size_t firstChunk = m_stepChunkOffsets[s];
+            const size_t numStepChunks = m_stepChunkOffsets[s + 1] - firstChunk;
+            if (numStepChunks == 0)
+            {
+                continue;
+            }
+
+            currentTokens.clear();
+            for (size_t c = 0; c < numStepChunks; ++c)
+            {
+                const size_t chunkIndex = firstChunk + c;
+                const AZ::u32 threadIndex = aznumeric_cast<AZ::u32>(c);
+                AZ::TaskDescriptor taskDescriptor{"MultiThreadSchedulerChunk", "Animation"};
+                currentTokens.emplace_back(m_taskGraph.AddTask(
+                    taskDescriptor,
+                    [this, chunkIndex, threadIndex]()
                     {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
+                        ExecuteChunk(chunkIndex, threadIndex);
+                    }));
+            }
 
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
+            // Attachments are in later steps than the actor instances they are attached to, so a step may only start once the previous one finished.
+            if (!previousTokens.empty())
+            {
+                AZ::TaskDescriptor barrierDescriptor{"MultiThreadSchedulerStepBarrier", "Animation"};
+                AZ::TaskToken barrier = m_taskGraph.AddTask(barrierDescriptor, []() {});
+                for (AZ::TaskToken& token : previousTokens)
+                {
+                    token.Precedes(barrier);
+                }
+                for (AZ::TaskToken& token : currentTokens)
+                {
+                    barrier.Precedes(token);
+                }
+            }
 
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
-                }, true, jobContext);
+            previousTokens.swap(currentTokens);
+        }
+    }
 
-                job->SetDependent(&jobCompletion);               
-                job->Start();
 
-                m_numUpdated.Increment();
+    void MultiThreadScheduler::BalanceChunks(size_t stepIndex)
+    {
+        const size_t firstChunk = m_stepChunkOffsets[stepIndex];
+        const size_t numChunks = m_stepChunkOffsets[stepIndex + 1] - firstChunk;
+        for (size_t c = 0; c < numChunks; ++c)
+        {
+            m_chunks[firstChunk + c].m_actorInstances.clear();
+            m_chunks[firstChunk + c].m_cost = 0.0f;
+        }
+
+        m_sortedActorInstances.clear();
+        for (ActorInstance* actorInstance : m_steps[stepIndex].m_actorInstances)
+        {
+            if (actorInstance->GetIsEnabled())
+            {
+                m_sortedActorInstances.emplace_back(EstimateUpdateCost(actorInstance), actorInstance);
             }
+        }
 
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+        if (numChunks == 0 || m_sortedActorInstances.empty())
+        {
+            return;
+        }
+
+        AZStd::sort(m_sortedActorInstances.begin(), m_sortedActorInstances.end(),
+            [](const AZStd::pair<float, ActorInstance*>& a, const AZStd::pair<float, ActorInstance*>& b)
+            {
+                return a.first > b.first;
+            });
+
+        for (const AZStd::pair<float, ActorInstance*>& costAndInstance : m_sortedActorInstances)
+        {
+            WorkChunk* leastLoadedChunk = &m_chunks[firstChunk];
+            for (size_t c = 1; c < numChunks; ++c)
+            {
+                if (m_chunks[firstChunk + c].m_cost < leastLoadedChunk->m_cost)
+                {
+                    leastLoadedChunk = &m_chunks[firstChunk + c];
+                }
+            }
+
+            leastLoadedChunk->m_actorInstances.emplace_back(costAndInstance.second);
+            leastLoadedChunk->m_cost += costAndInstance.first;
+            m_numUpdated.Increment();
+        }
     }
 
 
@@ -246,6 +433,7 @@ namespace EMotionFX
     {
         MCore::LockGuardRecursive guard(m_mutex);
         AZ_Assert(!HasActorInstanceInSteps(instance), "Expected the actor instance not being part of another step already.");
+        m_scheduleChanged = true;
 
         // find the first free location that doesn't conflict
         size_t outStep = startStep;
@@ -304,6 +492,8 @@ namespace EMotionFX
             // and if so, reconstruct the dependencies of this step
             if (step.m_actorInstances.size() < numActorInstancesPreRemove)
             {
+                m_scheduleChanged = true;
+
                 // clear the dependencies (but don't delete the memory)
                 step.m_dependencies.clear();
 
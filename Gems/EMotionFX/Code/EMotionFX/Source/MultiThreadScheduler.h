@@ -13,6 +13,8 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/utils.h>
 
 namespace EMotionFX
 {
@@ -28,6 +30,8 @@ namespace EMotionFX
      * If however you wish to let EMotion FX only use one single CPU, or if the target system ahs only one CPU, it is recommended
      * to use the SingleThreadScheduler class instead, as that will be faster in that specific case.
      * Significant performance gains can be achieved by using this scheduler on multi-processor or multi-core systems though.
+     * The actor instances of each step are distributed over at most one work chunk per thread, balanced by their estimated update cost.
+     * The chunks are executed on a task graph that is only rebuilt when the schedule changes.
      */
     class EMFX_API MultiThreadScheduler
         : public ActorUpdateScheduler
@@ -122,10 +126,73 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(size_t index) const { return m_steps[index]; }
         size_t GetNumScheduleSteps() const { return m_steps.size(); }
 
+        /**
+         * Get the number of work chunks the actor instances of a given step are distributed over.
+         * This is only valid after the schedule has been executed.
+         * @param stepIndex The schedule step index.
+         * @result The number of work chunks, which is never larger than the number of threads.
+         */
+        size_t GetNumWorkChunks(size_t stepIndex) const;
+
     protected:
+        /**
+         * A batch of actor instances that is updated sequentially by a single task.
+         */
+        struct WorkChunk
+        {
+            AZStd::vector<ActorInstance*>   m_actorInstances;   /**< The actor instances to update this frame. */
+            float                           m_cost = 0.0f;      /**< The summed estimated update cost of the actor instances. */
+        };
+
         AZStd::vector< ScheduleStep >    m_steps;         /**< An array of update steps, that together form the schedule. */
         float                           m_cleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           m_mutex;
+        AZStd::vector<WorkChunk>        m_chunks;               /**< The work chunks of all steps. */
+        AZStd::vector<size_t>           m_stepChunkOffsets;     /**< The index of the first work chunk of each step, with an extra entry holding the total number of chunks. */
+        AZStd::vector<AZStd::pair<float, ActorInstance*>> m_sortedActorInstances; /**< Scratch buffer used to sort the actor instances of a step by cost. */
+        AZ::TaskGraph                   m_taskGraph;            /**< Executes the work chunks, with a barrier between the steps. Retained across frames. */
+        float                           m_timePassedInSeconds = 0.0f; /**< The time passed as given to the current Execute() call, read by the tasks. */
+        bool                            m_scheduleChanged = true;     /**< Do the work chunks and the task graph have to be rebuilt? */
+        bool                            m_useTaskGraph = true;
+
+        /**
+         * Update a single actor instance. This is called from the worker threads.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        virtual void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds);
+
+        /**
+         * Estimate the relative cost of updating an actor instance, used to balance the work chunks.
+         * @param actorInstance The actor instance to estimate the cost for.
+         * @result The estimated cost, in arbitrary units.
+         */
+        virtual float EstimateUpdateCost(const ActorInstance* actorInstance) const;
+
+        /**
+         * Distribute the enabled actor instances over the work chunks and update them, step by step.
+         * This expects the visibility of the attachments to be propagated already.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteSchedule(float timePassedInSeconds);
+
+        /**
+         * Update the actor instances in a given work chunk.
+         * @param chunkIndex The index of the work chunk.
+         * @param threadIndex The thread index to use for the actor instances. This is unique within a step.
+         */
+        void ExecuteChunk(size_t chunkIndex, AZ::u32 threadIndex);
+
+        /**
+         * Recreate the work chunks for all steps and rebuild the task graph.
+         */
+        void RebuildChunks();
+
+        /**
+         * Fill the work chunks of a step, greedily assigning the most expensive actor instances to the least loaded chunk.
+         * @param stepIndex The schedule step index.
+         */
+        void BalanceChunks(size_t stepIndex);
 
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
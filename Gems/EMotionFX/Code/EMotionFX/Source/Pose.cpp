@@ -15,6 +15,7 @@
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/TransformKernels.h>
 
 namespace EMotionFX
 {
@@ -440,7 +441,7 @@ namespace EMotionFX
     }
 
 
-    void Pose::UpdateAllLocalSpaceTranforms()
+    void Pose::UpdateAllLocalSpaceTranforms() const
     {
         Skeleton* skeleton = m_actor->GetSkeleton();
         const size_t numNodes = skeleton->GetNumNodes();
@@ -833,13 +834,10 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const AZStd::span<const uint16> enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(enabledNodes);
+            destPose->UpdateLocalSpaceTransforms(enabledNodes);
+            TransformKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), enabledNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -859,11 +857,9 @@ namespace EMotionFX
         else
         {
             const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            UpdateAllLocalSpaceTranforms();
+            destPose->UpdateAllLocalSpaceTranforms();
+            TransformKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), numNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -1090,16 +1086,14 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const TransformData* transformData = m_actorInstance->GetTransformData();
-            Pose* bindPose = transformData->GetBindPose();
-            Transform result;
+            const Pose* bindPose = transformData->GetBindPose();
 
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                BlendTransformAdditiveUsingBindPose(bindPose->GetLocalSpaceTransform(nodeNr), GetLocalSpaceTransform(nodeNr), destPose->GetLocalSpaceTransform(nodeNr), weight, &result);
-                SetLocalSpaceTransform(nodeNr, result, false);
-            }
+            const AZStd::span<const uint16> enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(enabledNodes);
+            destPose->UpdateLocalSpaceTransforms(enabledNodes);
+            bindPose->UpdateLocalSpaceTransforms(enabledNodes);
+            TransformKernels::BlendAdditive(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(),
+                bindPose->m_localSpaceTransforms.data(), enabledNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -1137,6 +1131,17 @@ namespace EMotionFX
     }
 
 
+    // blend the transforms of a subset of the nodes
+    void Pose::BlendLocalSpaceTransforms(const Pose* destPose, AZStd::span<const size_t> nodeIndices, float weight)
+    {
+        UpdateLocalSpaceTransforms(nodeIndices);
+        destPose->UpdateLocalSpaceTransforms(nodeIndices);
+        TransformKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), nodeIndices, weight);
+
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
     // blend a transformation with weight check optimization
     void Pose::BlendTransformWithWeightCheck(const Transform& source, const Transform& dest, float weight, Transform* outTransform)
     {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -54,7 +55,7 @@ namespace EMotionFX
         void ApplyMorphWeightsToActorInstance();
         void ZeroMorphWeights();
 
-        void UpdateAllLocalSpaceTranforms();
+        void UpdateAllLocalSpaceTranforms() const;
         void UpdateAllModelSpaceTranforms();
         void ForceUpdateFullLocalSpacePose();
         void ForceUpdateFullModelSpacePose();
@@ -138,6 +139,15 @@ namespace EMotionFX
          */
         void BlendAdditiveUsingBindPose(const Pose* destPose, float weight);
 
+        /**
+         * Blend the local space transforms of the given nodes only, for example the nodes inside a mask.
+         * The other transforms, the morph weights and the pose datas are left untouched.
+         * @param destPose The destination pose to blend into.
+         * @param nodeIndices The indices of the nodes to blend.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         */
+        void BlendLocalSpaceTransforms(const Pose* destPose, AZStd::span<const size_t> nodeIndices, float weight);
+
         /**
          * Blend this pose into a specified destination pose.
          * @param destPose The destination pose to blend into.
@@ -208,6 +218,19 @@ namespace EMotionFX
 
         void RecursiveInvalidateModelSpaceTransforms(const Actor* actor, size_t nodeIndex);
 
+        /**
+         * Make sure the local space transforms of the given nodes are up to date, so that they can be processed in bulk.
+         * @param nodeIndices The indices of the nodes to update.
+         */
+        template <typename IndexType>
+        void UpdateLocalSpaceTransforms(AZStd::span<const IndexType> nodeIndices) const
+        {
+            for (const IndexType nodeIndex : nodeIndices)
+            {
+                UpdateLocalSpaceTransform(nodeIndex);
+            }
+        }
+
         /**
          * Perform a non-mixed blend into the specified destination pose.
          * @param destPose The destination pose to blend into.
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "SignificanceScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include "TransformData.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(SignificanceScheduler, ActorUpdateAllocator, 0)
+
+    // constructor
+    SignificanceScheduler::SignificanceScheduler()
+        : MultiThreadScheduler()
+    {
+    }
+
+
+    // destructor
+    SignificanceScheduler::~SignificanceScheduler()
+    {
+    }
+
+
+    // create
+    SignificanceScheduler* SignificanceScheduler::Create()
+    {
+        return aznew SignificanceScheduler();
+    }
+
+
+    // clear the schedule
+    void SignificanceScheduler::Clear()
+    {
+        Lock();
+        MultiThreadScheduler::Clear();
+        m_states.clear();
+        Unlock();
+    }
+
+
+    void SignificanceScheduler::SetViewpoint(const AZ::Vector3& position, float verticalFieldOfView)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_viewpointPosition = position;
+        m_tanHalfFieldOfView = AZ::GetMax(tanf(verticalFieldOfView * 0.5f), AZ::Constants::FloatEpsilon);
+        m_hasViewpoint = true;
+    }
+
+
+    void SignificanceScheduler::ClearViewpoint()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_hasViewpoint = false;
+    }
+
+
+    void SignificanceScheduler::SetSettings(const Settings& settings)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_settings = settings;
+    }
+
+
+    size_t SignificanceScheduler::GetTier(const ActorInstance* actorInstance) const
+    {
+        const auto iterator = m_states.find(actorInstance);
+        return (iterator != m_states.end()) ? iterator->second.m_tier : 0;
+    }
+
+
+    // log it, for debugging purposes
+    void SignificanceScheduler::Print()
+    {
+        MultiThreadScheduler::Print();
+
+        AZStd::array<size_t, s_numTiers> numActorInstancesPerTier = {};
+        for (const auto& state : m_states)
+        {
+            numActorInstancesPerTier[state.second.m_tier]++;
+        }
+
+        for (size_t i = 0; i < s_numTiers; ++i)
+        {
+            AZ_Printf("EMotionFX", "TIER %zu (every %u frames) - %zu", i, m_settings.m_tiers[i].m_updateInterval, numActorInstancesPerTier[i]);
+        }
+    }
+
+
+    // remove the actor instance from the schedule (excluding attachments)
+    size_t SignificanceScheduler::RemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_states.erase(actorInstance);
+        return MultiThreadScheduler::RemoveActorInstance(actorInstance, startStep);
+    }
+
+
+    size_t SignificanceScheduler::CalculateTier(const ActorInstance* actorInstance) const
+    {
+        if (!m_hasViewpoint)
+        {
+            return 0;
+        }
+
+        const AZ::Aabb& aabb = actorInstance->GetAabb();
+        const bool hasBounds = aabb.IsValid();
+        const AZ::Vector3 center = hasBounds ? aabb.GetCenter() : actorInstance->GetWorldSpaceTransform().m_position;
+        const float radius = hasBounds ? aabb.GetExtents().GetLength() * 0.5f : 0.0f;
+        const float distance = center.GetDistance(m_viewpointPosition);
+
+        // The radius relative to half the screen height. Being inside the bounds counts as filling the screen.
+        const float screenSize = (distance > radius) ? radius / (distance * m_tanHalfFieldOfView) : 1.0f;
+
+        for (size_t i = 0; i < s_numTiers - 1; ++i)
+        {
+            const float threshold = m_settings.m_tiers[i].m_threshold;
+            const bool passesThreshold = (m_settings.m_metric == SignificanceMetric::ScreenSize) ? (screenSize >= threshold) : (distance <= threshold);
+            if (passesThreshold)
+            {
+                return i;
+            }
+        }
+
+        return s_numTiers - 1;
+    }
+
+
+    void SignificanceScheduler::RecursiveAssignTier(ActorInstance* actorInstance, size_t tier, AZ::u32 phase)
+    {
+        ActorInstanceState& state = m_states[actorInstance];
+        state.m_tier = tier;
+        state.m_phase = phase;
+        actorInstance->SetExpensiveNodesEnabled(m_settings.m_tiers[tier].m_expensiveNodesEnabled);
+
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveAssignTier(attachment, tier, phase);
+            }
+        }
+    }
+
+
+    void SignificanceScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const auto iterator = m_states.find(actorInstance);
+        if (iterator == m_states.end())
+        {
+            MultiThreadScheduler::UpdateActorInstance(actorInstance, timePassedInSeconds);
+            return;
+        }
+
+        UpdateThrottledActorInstance(actorInstance, iterator->second, timePassedInSeconds);
+    }
+
+
+    float SignificanceScheduler::EstimateUpdateCost(const ActorInstance* actorInstance) const
+    {
+        // Actor instances that don't sample their motions this frame only blend two poses.
+        const float cost = MultiThreadScheduler::EstimateUpdateCost(actorInstance);
+        const auto iterator = m_states.find(actorInstance);
+        if (iterator == m_states.end())
+        {
+            return cost;
+        }
+
+        const ActorInstanceState& state = iterator->second;
+        const AZ::u32 updateInterval = AZ::GetMax(m_settings.m_tiers[state.m_tier].m_updateInterval, 1u);
+        const bool isSampleFrame = !state.m_hasPoses || ((m_frameCounter + state.m_phase) % updateInterval) == 0;
+        return isSampleFrame ? cost : cost * 0.25f;
+    }
+
+
+    void SignificanceScheduler::UpdateThrottledActorInstance(ActorInstance* actorInstance, ActorInstanceState& state, float timePassedInSeconds)
+    {
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // Skin attachments copy their pose from the actor instance they are attached to, so there is nothing to interpolate.
+        const AZ::u32 updateInterval = AZ::GetMax(m_settings.m_tiers[state.m_tier].m_updateInterval, 1u);
+        const Attachment* selfAttachment = actorInstance->GetSelfAttachment();
+        const bool interpolate = m_settings.m_interpolateSkippedFrames && updateInterval > 1 && isVisible &&
+            (!selfAttachment || !selfAttachment->GetIsInfluencedByMultipleJoints());
+
+        // check if the tier allows sampling motions this frame, interpolating requires two sampled poses first
+        const bool isSampleFrame = (updateInterval == 1) || (interpolate && !state.m_hasPoses) || ((m_frameCounter + state.m_phase) % updateInterval) == 0;
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (isSampleFrame && actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        if (!interpolate)
+        {
+            state.m_hasPoses = false;
+            actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+            return;
+        }
+
+        Pose* currentPose = actorInstance->GetTransformData()->GetCurrentPose();
+        if (!sampleMotions)
+        {
+            // Write the interpolated pose before the update, so that the skinning and attachments use it.
+            state.m_framesSinceSample++;
+            const float weight = AZ::GetMin(static_cast<float>(state.m_framesSinceSample) / static_cast<float>(updateInterval), 1.0f);
+            *currentPose = state.m_fromPose;
+            currentPose->Blend(&state.m_toPose, weight);
+            actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, false);
+            return;
+        }
+
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, true);
+        state.m_framesSinceSample = 0;
+        if (!state.m_hasPoses)
+        {
+            state.m_fromPose.LinkToActorInstance(actorInstance);
+            state.m_toPose.LinkToActorInstance(actorInstance);
+            state.m_fromPose = *currentPose;
+            state.m_toPose = *currentPose;
+            state.m_hasPoses = true;
+            return;
+        }
+
+        // Start interpolating from the previously sampled pose towards the new one, which requires updating the skinning again.
+        state.m_fromPose = state.m_toPose;
+        state.m_toPose = *currentPose;
+        *currentPose = state.m_fromPose;
+        currentPose->ApplyMorphWeightsToActorInstance();
+        actorInstance->ApplyMorphSetup();
+        actorInstance->UpdateSkinningMatrices();
+        actorInstance->UpdateAttachments();
+    }
+
+
+    // execute the schedule
+    void SignificanceScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_steps.empty())
+        {
+            return;
+        }
+
+        // check if we need to cleanup the schedule
+        m_cleanTimer += timePassedInSeconds;
+        if (m_cleanTimer >= 1.0f)
+        {
+            m_cleanTimer = 0.0f;
+            RemoveEmptySteps();
+        }
+
+        //-----------------------------------------------------------
+
+        // propagate root actor instance visibility to their attachments and sort them into tiers
+        m_frameCounter++;
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+            RecursiveAssignTier(rootInstance, CalculateTier(rootInstance), rootInstance->GetID());
+        }
+
+        // the states are all created above, so the worker threads only have to look them up
+        ExecuteSchedule(timePassedInSeconds);
+    }
+}   // namespace EMotionFX
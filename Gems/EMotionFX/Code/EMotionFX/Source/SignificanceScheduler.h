@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "MultiThreadScheduler.h"
+#include "Pose.h"
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The significance based scheduler.
+     * This scheduler processes the actor instances in parallel, just like the MultiThreadScheduler, but it only samples the motions and anim graphs
+     * of less significant actor instances every second or fourth frame. The significance is based on the size on screen or the distance to the viewpoint,
+     * which has to be provided each frame using SetViewpoint(). Without a viewpoint all actor instances are updated at full rate.
+     * Anim graphs are still updated every frame, so that motion extraction, events and state machines keep running at full rate.
+     * On frames where the motions are not sampled, the pose is interpolated between the two most recently sampled poses. This delays
+     * the animation of throttled actor instances by one update interval, but keeps their movement smooth.
+     * Attachments use the significance of the actor instance they are attached to.
+     */
+    class EMFX_API SignificanceScheduler
+        : public MultiThreadScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * The metric used to sort actor instances into update tiers.
+         */
+        enum class SignificanceMetric : AZ::u8
+        {
+            ScreenSize,     /**< The radius of the bounding box, relative to half the screen height. */
+            Distance        /**< The distance between the viewpoint and the actor instance. */
+        };
+
+        /**
+         * The update settings for actor instances in a given tier.
+         */
+        struct EMFX_API TierSettings
+        {
+            float   m_threshold;                /**< The minimum screen size, or the maximum distance when using the distance metric, to be part of this tier. */
+            AZ::u32 m_updateInterval;           /**< Sample the motions every this many frames. */
+            bool    m_expensiveNodesEnabled;    /**< Process expensive anim graph nodes, like IK, ragdolls and simulated objects? */
+        };
+
+        static constexpr size_t s_numTiers = 3;
+
+        struct EMFX_API Settings
+        {
+            SignificanceMetric m_metric = SignificanceMetric::ScreenSize;
+
+            /**
+             * The tiers, from the most to the least significant one. Actor instances are put in the first tier whose threshold they pass,
+             * or in the last tier when they pass none.
+             */
+            AZStd::array<TierSettings, s_numTiers> m_tiers =
+            {{
+                { 0.2f, 1, true },
+                { 0.05f, 2, false },
+                { 0.0f, 4, false }
+            }};
+
+            bool m_interpolateSkippedFrames = true; /**< Interpolate the poses on frames where the motions are not sampled, rather than holding the last sampled pose. */
+        };
+
+        /**
+         * The constructor.
+         */
+        static SignificanceScheduler* Create();
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override        { return "SignificanceScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        /**
+         * Execute the schedule, sampling the motions of each actor instance at the rate of its tier.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * LOG the schedule and the number of actor instances in each tier.
+         */
+        void Print() override;
+
+        /**
+         * Clear the schedule.
+         */
+        void Clear() override;
+
+        /**
+         * Remove a single actor instance from the schedule. This will not remove its attachments.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep An offset in the schedule where to start trying to remove from.
+         * @result Returns the offset in the schedule where the actor instance was removed.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Set the viewpoint the significance of the actor instances is calculated for. Call this once per frame, before the actor manager update.
+         * @param position The world space position of the camera.
+         * @param verticalFieldOfView The vertical field of view of the camera, in radians. Used by the screen size metric.
+         */
+        void SetViewpoint(const AZ::Vector3& position, float verticalFieldOfView);
+
+        /**
+         * Remove the viewpoint, which updates all actor instances at full rate.
+         */
+        void ClearViewpoint();
+
+        void SetSettings(const Settings& settings);
+        const Settings& GetSettings() const                         { return m_settings; }
+
+        /**
+         * Get the tier an actor instance has been put in during the last Execute() call.
+         * @param actorInstance The actor instance to get the tier for.
+         * @result The tier index, where 0 is the most significant tier.
+         */
+        size_t GetTier(const ActorInstance* actorInstance) const;
+
+    protected:
+        /**
+         * The per actor instance update state.
+         */
+        struct ActorInstanceState
+        {
+            Pose    m_fromPose;                 /**< The pose sampled before the most recent one. */
+            Pose    m_toPose;                   /**< The most recently sampled pose. */
+            size_t  m_tier = 0;                 /**< The tier the actor instance is in this frame. */
+            AZ::u32 m_phase = 0;                /**< Offsets the frames at which the motions are sampled, so that throttled actor instances are spread over the frames. */
+            AZ::u32 m_framesSinceSample = 0;    /**< The number of frames since the motions got sampled. */
+            bool    m_hasPoses = false;         /**< Do the from and to poses contain sampled poses? */
+        };
+
+        AZStd::unordered_map<const ActorInstance*, ActorInstanceState> m_states;
+        Settings    m_settings;
+        AZ::Vector3 m_viewpointPosition = AZ::Vector3::CreateZero();
+        float       m_tanHalfFieldOfView = 1.0f;
+        AZ::u32     m_frameCounter = 0;
+        bool        m_hasViewpoint = false;
+
+        /**
+         * The constructor.
+         */
+        SignificanceScheduler();
+
+        /**
+         * The destructor.
+         */
+        ~SignificanceScheduler() override;
+
+        /**
+         * Calculate the tier of a root actor instance, based on its bounds and the viewpoint.
+         * @param actorInstance The root actor instance.
+         * @result The tier index.
+         */
+        size_t CalculateTier(const ActorInstance* actorInstance) const;
+
+        /**
+         * Put an actor instance and all of its attachments into a given tier.
+         * @param actorInstance The actor instance.
+         * @param tier The tier index.
+         * @param phase The frame offset to use for the actor instance and its attachments.
+         */
+        void RecursiveAssignTier(ActorInstance* actorInstance, size_t tier, AZ::u32 phase);
+
+        /**
+         * Update a single actor instance, sampling its motions when its tier requires it and interpolating its pose otherwise.
+         * @param actorInstance The actor instance to update.
+         * @param state The update state of the actor instance.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateThrottledActorInstance(ActorInstance* actorInstance, ActorInstanceState& state, float timePassedInSeconds);
+
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds) override;
+        float EstimateUpdateCost(const ActorInstance* actorInstance) const override;
+    };
+}   // namespace EMotionFX
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include required headers
+#include "TransformKernels.h"
+#include "Transform.h"
+#include <AzCore/Math/SimdMath.h>
+#include <MCore/Source/AzCoreConversions.h>
+
+
+namespace EMotionFX
+{
+    namespace TransformKernels
+    {
+        namespace
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            // The number of quaternions processed by a single set of SIMD instructions.
+            constexpr size_t BatchSize = 4;
+
+            // Four quaternions, transposed so that each register holds the same component of every quaternion.
+            struct QuaternionBatch
+            {
+                Vec4::FloatType m_x;
+                Vec4::FloatType m_y;
+                Vec4::FloatType m_z;
+                Vec4::FloatType m_w;
+            };
+
+            AZ_FORCE_INLINE QuaternionBatch LoadBatch(const Vec4::FloatType* quaternions)
+            {
+                Vec4::FloatType columns[BatchSize];
+                Vec4::Mat4x4Transpose(quaternions, columns);
+                return { columns[0], columns[1], columns[2], columns[3] };
+            }
+
+            AZ_FORCE_INLINE void StoreBatch(const QuaternionBatch& batch, Vec4::FloatType* outQuaternions)
+            {
+                const Vec4::FloatType columns[BatchSize] = { batch.m_x, batch.m_y, batch.m_z, batch.m_w };
+                Vec4::Mat4x4Transpose(columns, outQuaternions);
+            }
+
+            AZ_FORCE_INLINE Vec4::FloatType Dot(const QuaternionBatch& a, const QuaternionBatch& b)
+            {
+                return Vec4::Madd(a.m_x, b.m_x, Vec4::Madd(a.m_y, b.m_y, Vec4::Madd(a.m_z, b.m_z, Vec4::Mul(a.m_w, b.m_w))));
+            }
+
+            AZ_FORCE_INLINE QuaternionBatch Normalize(const QuaternionBatch& q)
+            {
+                const Vec4::FloatType invLength = Vec4::SqrtInv(Dot(q, q));
+                return { Vec4::Mul(q.m_x, invLength), Vec4::Mul(q.m_y, invLength), Vec4::Mul(q.m_z, invLength), Vec4::Mul(q.m_w, invLength) };
+            }
+
+            AZ_FORCE_INLINE QuaternionBatch Conjugate(const QuaternionBatch& q)
+            {
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+                return { Vec4::Sub(zero, q.m_x), Vec4::Sub(zero, q.m_y), Vec4::Sub(zero, q.m_z), q.m_w };
+            }
+
+            // The same as AZ::Quaternion::operator*, for four quaternions at once.
+            AZ_FORCE_INLINE QuaternionBatch Multiply(const QuaternionBatch& a, const QuaternionBatch& b)
+            {
+                QuaternionBatch result;
+                result.m_x = Vec4::Sub(Vec4::Madd(a.m_w, b.m_x, Vec4::Madd(a.m_x, b.m_w, Vec4::Mul(a.m_y, b.m_z))), Vec4::Mul(a.m_z, b.m_y));
+                result.m_y = Vec4::Sub(Vec4::Madd(a.m_w, b.m_y, Vec4::Madd(a.m_y, b.m_w, Vec4::Mul(a.m_z, b.m_x))), Vec4::Mul(a.m_x, b.m_z));
+                result.m_z = Vec4::Sub(Vec4::Madd(a.m_w, b.m_z, Vec4::Madd(a.m_z, b.m_w, Vec4::Mul(a.m_x, b.m_y))), Vec4::Mul(a.m_y, b.m_x));
+                result.m_w = Vec4::Sub(Vec4::Mul(a.m_w, b.m_w), Vec4::Madd(a.m_x, b.m_x, Vec4::Madd(a.m_y, b.m_y, Vec4::Mul(a.m_z, b.m_z))));
+                return result;
+            }
+
+            // The same as MCore::NLerp, which takes the shortest path by negating the weight of the target when the quaternions
+            // are in opposite hemispheres.
+            AZ_FORCE_INLINE QuaternionBatch NLerpBatch(const QuaternionBatch& from, const QuaternionBatch& to, Vec4::FloatType t)
+            {
+                const Vec4::FloatType oneMinusT = Vec4::Sub(Vec4::Splat(1.0f), t);
+                const Vec4::FloatType oppositeHemisphere = Vec4::CmpLt(Dot(from, to), Vec4::ZeroFloat());
+                const Vec4::FloatType signedT = Vec4::Select(Vec4::Sub(Vec4::ZeroFloat(), t), t, oppositeHemisphere);
+
+                const QuaternionBatch result = {
+                    Vec4::Madd(signedT, to.m_x, Vec4::Mul(oneMinusT, from.m_x)),
+                    Vec4::Madd(signedT, to.m_y, Vec4::Mul(oneMinusT, from.m_y)),
+                    Vec4::Madd(signedT, to.m_z, Vec4::Mul(oneMinusT, from.m_z)),
+                    Vec4::Madd(signedT, to.m_w, Vec4::Mul(oneMinusT, from.m_w))
+                };
+                return Normalize(result);
+            }
+
+            struct IdentityIndex
+            {
+                AZ_FORCE_INLINE size_t operator()(size_t i) const
+                {
+                    return i;
+                }
+            };
+
+            template <typename IndexType>
+            struct SpanIndex
+            {
+                AZ_FORCE_INLINE size_t operator()(size_t i) const
+                {
+                    return static_cast<size_t>(m_indices[i]);
+                }
+
+                AZStd::span<const IndexType> m_indices;
+            };
+
+            template <typename GetIndex>
+            void BlendImpl(Transform* transforms, const Transform* destTransforms, size_t count, float weight, GetIndex getIndex)
+            {
+                size_t i = 0;
+                for (; i + BatchSize <= count; i += BatchSize)
+                {
+                    Transform* batchTransforms[BatchSize];
+                    const Transform* batchDestTransforms[BatchSize];
+                    Vec4::FloatType fromRotations[BatchSize];
+                    Vec4::FloatType toRotations[BatchSize];
+                    for (size_t j = 0; j < BatchSize; ++j)
+                    {
+                        const size_t index = getIndex(i + j);
+                        batchTransforms[j] = &transforms[index];
+                        batchDestTransforms[j] = &destTransforms[index];
+                        fromRotations[j] = batchTransforms[j]->m_rotation.GetSimdValue();
+                        toRotations[j] = batchDestTransforms[j]->m_rotation.GetSimdValue();
+                    }
+
+                    Vec4::FloatType rotations[BatchSize];
+                    StoreBatch(NLerpBatch(LoadBatch(fromRotations), LoadBatch(toRotations), Vec4::Splat(weight)), rotations);
+
+                    for (size_t j = 0; j < BatchSize; ++j)
+                    {
+                        Transform& transform = *batchTransforms[j];
+                        const Transform& destTransform = *batchDestTransforms[j];
+                        transform.m_rotation = AZ::Quaternion(rotations[j]);
+                        transform.m_position = MCore::LinearInterpolate<AZ::Vector3>(transform.m_position, destTransform.m_position, weight);
+
+                        EMFX_SCALECODE
+                        (
+                            transform.m_scale = MCore::LinearInterpolate<AZ::Vector3>(transform.m_scale, destTransform.m_scale, weight);
+                        )
+                    }
+                }
+
+                for (; i < count; ++i)
+                {
+                    const size_t index = getIndex(i);
+                    transforms[index].Blend(destTransforms[index], weight);
+                }
+            }
+
+            template <typename GetIndex>
+            void BlendAdditiveImpl(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, size_t count, float weight, GetIndex getIndex)
+            {
+                size_t i = 0;
+                for (; i + BatchSize <= count; i += BatchSize)
+                {
+                    Transform* batchTransforms[BatchSize];
+                    const Transform* batchDestTransforms[BatchSize];
+                    const Transform* batchBaseTransforms[BatchSize];
+                    Vec4::FloatType currentRotations[BatchSize];
+                    Vec4::FloatType destRotations[BatchSize];
+                    Vec4::FloatType baseRotations[BatchSize];
+                    for (size_t j = 0; j < BatchSize; ++j)
+                    {
+                        const size_t index = getIndex(i + j);
+                        batchTransforms[j] = &transforms[index];
+                        batchDestTransforms[j] = &destTransforms[index];
+                        batchBaseTransforms[j] = &baseTransforms[index];
+                        currentRotations[j] = batchTransforms[j]->m_rotation.GetSimdValue();
+                        destRotations[j] = batchDestTransforms[j]->m_rotation.GetSimdValue();
+                        baseRotations[j] = batchBaseTransforms[j]->m_rotation.GetSimdValue();
+                    }
+
+                    // Apply the rotation from the base to the blended destination on top of the current rotation.
+                    const QuaternionBatch base = LoadBatch(baseRotations);
+                    const QuaternionBatch blended = NLerpBatch(base, LoadBatch(destRotations), Vec4::Splat(weight));
+                    const QuaternionBatch result = Normalize(Multiply(LoadBatch(currentRotations), Multiply(Conjugate(base), blended)));
+
+                    Vec4::FloatType rotations[BatchSize];
+                    StoreBatch(result, rotations);
+
+                    for (size_t j = 0; j < BatchSize; ++j)
+                    {
+                        Transform& transform = *batchTransforms[j];
+                        const Transform& destTransform = *batchDestTransforms[j];
+                        const Transform& baseTransform = *batchBaseTransforms[j];
+                        transform.m_rotation = AZ::Quaternion(rotations[j]);
+                        transform.m_position += (destTransform.m_position - baseTransform.m_position) * weight;
+
+                        EMFX_SCALECODE
+                        (
+                            transform.m_scale += (destTransform.m_scale - baseTransform.m_scale) * weight;
+                        )
+                    }
+                }
+
+                for (; i < count; ++i)
+                {
+                    const size_t index = getIndex(i);
+                    transforms[index].BlendAdditive(destTransforms[index], baseTransforms[index], weight);
+                }
+            }
+        } // namespace
+
+
+        void NLerp(const AZ::Quaternion* from, const AZ::Quaternion* to, float t, AZ::Quaternion* out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + BatchSize <= count; i += BatchSize)
+            {
+                Vec4::FloatType fromRotations[BatchSize];
+                Vec4::FloatType toRotations[BatchSize];
+                for (size_t j = 0; j < BatchSize; ++j)
+                {
+                    fromRotations[j] = from[i + j].GetSimdValue();
+                    toRotations[j] = to[i + j].GetSimdValue();
+                }
+
+                Vec4::FloatType rotations[BatchSize];
+                StoreBatch(NLerpBatch(LoadBatch(fromRotations), LoadBatch(toRotations), Vec4::Splat(t)), rotations);
+                for (size_t j = 0; j < BatchSize; ++j)
+                {
+                    out[i + j] = AZ::Quaternion(rotations[j]);
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                out[i] = MCore::NLerp(from[i], to[i], t);
+            }
+        }
+
+
+        void NLerp(const AZ::Quaternion* from, const AZ::Quaternion* to, const float* t, AZ::Quaternion* out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + BatchSize <= count; i += BatchSize)
+            {
+                Vec4::FloatType fromRotations[BatchSize];
+                Vec4::FloatType toRotations[BatchSize];
+                for (size_t j = 0; j < BatchSize; ++j)
+                {
+                    fromRotations[j] = from[i + j].GetSimdValue();
+                    toRotations[j] = to[i + j].GetSimdValue();
+                }
+
+                Vec4::FloatType rotations[BatchSize];
+                StoreBatch(NLerpBatch(LoadBatch(fromRotations), LoadBatch(toRotations), Vec4::LoadUnaligned(&t[i])), rotations);
+                for (size_t j = 0; j < BatchSize; ++j)
+                {
+                    out[i + j] = AZ::Quaternion(rotations[j]);
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                out[i] = MCore::NLerp(from[i], to[i], t[i]);
+            }
+        }
+
+
+        void Blend(Transform* transforms, const Transform* destTransforms, size_t count, float weight)
+        {
+            BlendImpl(transforms, destTransforms, count, weight, IdentityIndex{});
+        }
+
+
+        void Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const uint16> indices, float weight)
+        {
+            BlendImpl(transforms, destTransforms, indices.size(), weight, SpanIndex<uint16>{ indices });
+        }
+
+
+        void Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const size_t> indices, float weight)
+        {
+            BlendImpl(transforms, destTransforms, indices.size(), weight, SpanIndex<size_t>{ indices });
+        }
+
+
+        void BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, size_t count, float weight)
+        {
+            BlendAdditiveImpl(transforms, destTransforms, baseTransforms, count, weight, IdentityIndex{});
+        }
+
+
+        void BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, AZStd::span<const uint16> indices, float weight)
+        {
+            BlendAdditiveImpl(transforms, destTransforms, baseTransforms, indices.size(), weight, SpanIndex<uint16>{ indices });
+        }
+    } // namespace TransformKernels
+} // namespace EMotionFX
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "EMotionFXConfig.h"
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/span.h>
+
+
+namespace EMotionFX
+{
+    class Transform;
+
+    /**
+     * Batched versions of the per transform interpolation functions, used when sampling and blending whole poses.
+     * The rotations of four transforms are transposed into x, y, z and w registers, so that the dot products and
+     * normalizations that dominate the cost of a quaternion nlerp are done for four joints with single SIMD instructions.
+     * The transforms themselves keep their regular layout, so the results match Transform::Blend() and Transform::BlendAdditive().
+     * The index spans select which transforms to process, for example the enabled nodes of an actor instance or the joints in a mask.
+     */
+    namespace TransformKernels
+    {
+        /**
+         * Normalized linear interpolation of count quaternions, the same as MCore::NLerp(from[i], to[i], t).
+         * The output may alias either of the inputs.
+         */
+        void EMFX_API NLerp(const AZ::Quaternion* from, const AZ::Quaternion* to, float t, AZ::Quaternion* out, size_t count);
+
+        /**
+         * Normalized linear interpolation of count quaternions, each with its own interpolation weight t[i].
+         * The output may alias either of the inputs.
+         */
+        void EMFX_API NLerp(const AZ::Quaternion* from, const AZ::Quaternion* to, const float* t, AZ::Quaternion* out, size_t count);
+
+        /**
+         * Blends transforms[i] towards destTransforms[i] for the first count transforms, the same as Transform::Blend().
+         */
+        void EMFX_API Blend(Transform* transforms, const Transform* destTransforms, size_t count, float weight);
+        void EMFX_API Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const uint16> indices, float weight);
+        void EMFX_API Blend(Transform* transforms, const Transform* destTransforms, AZStd::span<const size_t> indices, float weight);
+
+        /**
+         * Adds the difference between destTransforms[i] and baseTransforms[i] to transforms[i], the same as Transform::BlendAdditive().
+         */
+        void EMFX_API BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, size_t count, float weight);
+        void EMFX_API BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, AZStd::span<const uint16> indices, float weight);
+    } // namespace TransformKernels
+} // namespace EMotionFX
@@ -116,6 +116,8 @@ set(FILES
     Source/RecorderBus.h
     Source/RepositioningLayerPass.cpp
     Source/RepositioningLayerPass.h
+    Source/SignificanceScheduler.cpp
+    Source/SignificanceScheduler.h
     Source/SimulatedObjectBus.h
     Source/SimulatedObjectSetup.cpp
     Source/SimulatedObjectSetup.h
@@ -139,6 +141,8 @@ set(FILES
     Source/ThreadData.h
     Source/Transform.cpp
     Source/Transform.h
+    Source/TransformKernels.cpp
+    Source/TransformKernels.h
     Source/TransformData.cpp
     Source/TransformData.h
     Source/TriggerActionSetup.cpp
@@ -347,6 +351,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp()
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown()
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+    };
+
+    TEST_F(CompressedMotionDataTests, Init)
+    {
+        CompressedMotionData motionData;
+        CompressedMotionData::InitSettings settings;
+        settings.m_sampleRate = 30.0f;
+        settings.m_numSamples = 301;
+        settings.m_numJoints = 3;
+        settings.m_numMorphs = 4;
+        settings.m_numFloats = 5;
+        motionData.Init(settings);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 10.0f);
+        EXPECT_FLOAT_EQ(motionData.GetSampleSpacing(), 1.0f / 30.0f);
+        EXPECT_EQ(motionData.GetNumSamples(), 301);
+        EXPECT_EQ(motionData.GetNumJoints(), 3);
+        EXPECT_EQ(motionData.GetNumMorphs(), 4);
+        EXPECT_EQ(motionData.GetNumFloats(), 5);
+        EXPECT_FALSE(motionData.IsJointAnimated(0));
+
+        motionData.Clear();
+        EXPECT_EQ(motionData.GetNumSamples(), 0);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 0.0f);
+        EXPECT_EQ(motionData.GetNumJoints(), 0);
+    }
+
+    TEST_F(CompressedMotionDataTests, QuantizedSamples)
+    {
+        CompressedMotionData motionData;
+        CompressedMotionData::InitSettings settings;
+        settings.m_sampleRate = 10.0f;
+        settings.m_numSamples = 11;
+        settings.m_numJoints = 1;
+        settings.m_numFloats = 1;
+        motionData.Init(settings);
+
+        AZStd::vector<AZ::Vector3> positions(11);
+        AZStd::vector<AZ::Quaternion> rotations(11);
+        AZStd::vector<float> values(11);
+        for (size_t i = 0; i < 11; ++i)
+        {
+            const float iFloat = static_cast<float>(i);
+            positions[i] = AZ::Vector3(iFloat, -2.0f * iFloat, 5.0f);
+            rotations[i] = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), AZ::DegToRad(iFloat * 30.0f));
+            values[i] = iFloat * 0.1f;
+        }
+        motionData.SetJointPositionSamples(0, positions);
+        motionData.SetJointRotationSamples(0, rotations);
+        motionData.SetFloatSamples(0, values);
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), 11);
+        EXPECT_EQ(motionData.GetNumJointRotationKeys(0), 11);
+        EXPECT_EQ(motionData.GetNumFloatKeys(0), 11);
+
+        for (size_t i = 0; i < 11; ++i)
+        {
+            const float sampleTime = static_cast<float>(i) * 0.1f;
+            EXPECT_THAT(motionData.SampleJointPosition(sampleTime, 0), IsClose(positions[i]));
+            EXPECT_THAT(motionData.SampleJointRotation(sampleTime, 0), IsClose(rotations[i]));
+            EXPECT_NEAR(motionData.SampleFloat(sampleTime, 0), values[i], 0.0001f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeKeys)
+    {
+        CompressedMotionData motionData;
+        CompressedMotionData::InitSettings settings;
+        settings.m_sampleRate = 10.0f;
+        settings.m_numSamples = 11;
+        settings.m_numJoints = 1;
+        settings.m_numFloats = 1;
+        motionData.Init(settings);
+
+        // A linear position, a rotation bump at frame 5 and a flat float signal.
+        const AZ::Quaternion rotatedQuat = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::DegToRad(5.0f));
+        AZStd::vector<AZ::Vector3> positions(11);
+        AZStd::vector<AZ::Quaternion> rotations(11, AZ::Quaternion::CreateIdentity());
+        AZStd::vector<float> values(11, 0.0f);
+        for (size_t i = 0; i < 11; ++i)
+        {
+            positions[i] = AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f);
+        }
+        rotations[5] = rotatedQuat;
+        motionData.SetJointPositionSamples(0, positions);
+        motionData.SetJointRotationSamples(0, rotations);
+        motionData.SetFloatSamples(0, values);
+
+        MotionData::OptimizeSettings optimizeSettings;
+        motionData.Optimize(optimizeSettings);
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), 2);
+        EXPECT_EQ(motionData.GetNumJointRotationKeys(0), 5);
+        EXPECT_EQ(motionData.GetNumFloatKeys(0), 0);
+        EXPECT_FALSE(motionData.IsFloatAnimated(0));
+
+        EXPECT_THAT(motionData.SampleJointPosition(0.25f, 0), IsClose(AZ::Vector3(2.5f, 0.0f, 0.0f)));
+        EXPECT_THAT(motionData.SampleJointRotation(0.5f, 0), IsClose(rotatedQuat));
+        EXPECT_THAT(motionData.SampleJointRotation(0.8f, 0), IsClose(AZ::Quaternion::CreateIdentity()));
+    }
+
+    TEST_F(CompressedMotionDataTests, ErrorReport)
+    {
+        NonUniformMotionData sourceData;
+        sourceData.Resize(1, 0, 0);
+        sourceData.AllocateJointPositionSamples(0, 2);
+        sourceData.SetJointPositionSample(0, 0, { 0.0f, AZ::Vector3::CreateZero() });
+        sourceData.SetJointPositionSample(0, 1, { 1.0f, AZ::Vector3(10.0f, 0.0f, 0.0f) });
+        sourceData.UpdateDuration();
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, false, 30.0f);
+        EXPECT_EQ(motionData.GetNumSamples(), 31);
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), 31);
+
+        motionData.Optimize(MotionData::OptimizeSettings());
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), 2);
+
+        const CompressedMotionData::ErrorReport report = motionData.CalculateErrorReport(sourceData);
+        EXPECT_LT(report.m_maxPosError, 0.001f);
+        EXPECT_FLOAT_EQ(report.m_maxRotError, 0.0f);
+        EXPECT_EQ(report.m_numKeys, 2);
+        EXPECT_EQ(report.m_numUncompressedKeys, 31);
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        CompressedMotionData motionData;
+        CompressedMotionData::InitSettings settings;
+        settings.m_sampleRate = 10.0f;
+        settings.m_numSamples = 11;
+        settings.m_numJoints = 1;
+        settings.m_numMorphs = 1;
+        motionData.Init(settings);
+        motionData.SetJointName(0, "Joint1");
+        motionData.SetMorphName(0, "Morph1");
+
+        AZStd::vector<AZ::Quaternion> rotations(11);
+        AZStd::vector<float> values(11);
+        for (size_t i = 0; i < 11; ++i)
+        {
+            rotations[i] = AZ::Quaternion::CreateRotationY(AZ::DegToRad(static_cast<float>(i) * 10.0f));
+            values[i] = static_cast<float>(i % 2);
+        }
+        motionData.SetJointRotationSamples(0, rotations);
+        motionData.SetMorphSamples(0, values);
+
+        MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile memoryFile;
+        memoryFile.Open();
+        ASSERT_TRUE(motionData.Save(&memoryFile, saveSettings));
+        EXPECT_EQ(memoryFile.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        memoryFile.Seek(0);
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&memoryFile, readSettings));
+        EXPECT_EQ(loadedData.GetNumSamples(), 11);
+        EXPECT_STREQ(loadedData.GetJointName(0).c_str(), "Joint1");
+        EXPECT_STREQ(loadedData.GetMorphName(0).c_str(), "Morph1");
+        EXPECT_EQ(loadedData.GetNumJointRotationKeys(0), 11);
+        EXPECT_FALSE(loadedData.IsJointPositionAnimated(0));
+        for (size_t i = 0; i < 11; ++i)
+        {
+            const float sampleTime = static_cast<float>(i) * 0.1f;
+            EXPECT_THAT(loadedData.SampleJointRotation(sampleTime, 0), IsClose(motionData.SampleJointRotation(sampleTime, 0)));
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(sampleTime, 0), motionData.SampleMorph(sampleTime, 0));
+        }
+    }
+} // namespace EMotionFX
@@ -44,4 +44,36 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, MultiThreadSchedulerWorkChunks)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            actorInstances.emplace_back(ActorInstance::Create(actor.get()));
+        }
+
+        scheduler->Execute(1.0f / 60.0f);
+        ASSERT_EQ(scheduler->GetNumScheduleSteps(), 1);
+        const size_t expectedNumChunks = AZStd::min<size_t>(GetEMotionFX().GetNumThreads(), 10);
+        EXPECT_EQ(scheduler->GetNumWorkChunks(0), expectedNumChunks) << "Expected at most one work chunk per thread.";
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 10);
+
+        // The retained task graph has to be rebuilt after the schedule changed.
+        actorInstances.back()->Destroy();
+        actorInstances.pop_back();
+        actorInstances[0]->SetIsEnabled(false);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 8) << "Disabled actor instances should not be updated.";
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // namespace EMotionFX
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/SignificanceScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    TEST_F(SystemComponentFixture, SignificanceSchedulerTiers)
+    {
+        SignificanceScheduler* scheduler = SignificanceScheduler::Create();
+        GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+
+        SignificanceScheduler::Settings settings;
+        settings.m_metric = SignificanceScheduler::SignificanceMetric::Distance;
+        settings.m_tiers = {{
+            { 10.0f, 1, true },
+            { 50.0f, 2, false },
+            { 0.0f, 4, false }
+        }};
+        scheduler->SetSettings(settings);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+
+        // Without a viewpoint, everything updates at full rate.
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetTier(actorInstance), 0);
+        EXPECT_TRUE(actorInstance->GetExpensiveNodesEnabled());
+
+        scheduler->SetViewpoint(AZ::Vector3(0.0f, 30.0f, 0.0f), AZ::DegToRad(60.0f));
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetTier(actorInstance), 1);
+        EXPECT_FALSE(actorInstance->GetExpensiveNodesEnabled());
+
+        scheduler->SetViewpoint(AZ::Vector3(0.0f, 100.0f, 0.0f), AZ::DegToRad(60.0f));
+        size_t numSampledFrames = 0;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            scheduler->Execute(1.0f / 60.0f);
+            numSampledFrames += scheduler->GetNumSampledActorInstances();
+        }
+        EXPECT_EQ(scheduler->GetTier(actorInstance), 2);
+        EXPECT_EQ(numSampledFrames, 2) << "The least significant tier should sample every fourth frame.";
+
+        scheduler->ClearViewpoint();
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetTier(actorInstance), 0);
+        EXPECT_TRUE(actorInstance->GetExpensiveNodesEnabled());
+
+        actorInstance->Destroy();
+        GetEMotionFX().GetActorManager()->SetScheduler(MultiThreadScheduler::Create());
+    }
+} // namespace EMotionFX
@@ -17,10 +17,12 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Random.h>
 #include <MCore/Source/AzCoreConversions.h>
 #include <EMotionFX/Source/PlayBackInfo.h>
 
 #include <EMotionFX/Source/Transform.h>
+#include <EMotionFX/Source/TransformKernels.h>
 
 #if defined(EMFX_SCALE_DISABLED)
 #define EMFX_SCALE false
@@ -886,6 +888,98 @@ namespace EMotionFX
         );
     }
 
+    class TransformKernelsFixture
+        : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            // An odd count, so that both the four-wide batches and the remainder are covered.
+            AZ::SimpleLcgRandom random(1234);
+            auto randomFloat = [&random](float min, float max)
+            {
+                return min + random.GetRandomFloat() * (max - min);
+            };
+            auto randomTransform = [&randomFloat]()
+            {
+                const AZ::Vector3 axis = AZ::Vector3(randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f)).GetNormalizedSafe();
+                AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(axis.IsZero() ? AZ::Vector3::CreateAxisZ() : axis, randomFloat(-AZ::Constants::Pi, AZ::Constants::Pi));
+                if (randomFloat(0.0f, 1.0f) < 0.5f)
+                {
+                    // Flip some of the rotations into the other hemisphere, to cover the shortest path logic.
+                    rotation = -rotation;
+                }
+                return Transform(
+                    AZ::Vector3(randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f)),
+                    rotation,
+                    AZ::Vector3(randomFloat(0.5f, 2.0f), randomFloat(0.5f, 2.0f), randomFloat(0.5f, 2.0f)));
+            };
+
+            for (size_t i = 0; i < s_transformCount; ++i)
+            {
+                m_transforms.push_back(randomTransform());
+                m_destTransforms.push_back(randomTransform());
+                m_baseTransforms.push_back(randomTransform());
+            }
+        }
+
+        static constexpr size_t s_transformCount = 19;
+        AZStd::vector<Transform> m_transforms;
+        AZStd::vector<Transform> m_destTransforms;
+        AZStd::vector<Transform> m_baseTransforms;
+    };
+
+    TEST_F(TransformKernelsFixture, NLerp_MatchesScalarNLerp)
+    {
+        AZStd::vector<AZ::Quaternion> from;
+        AZStd::vector<AZ::Quaternion> to;
+        for (size_t i = 0; i < s_transformCount; ++i)
+        {
+            from.push_back(m_transforms[i].m_rotation);
+            to.push_back(m_destTransforms[i].m_rotation);
+        }
+
+        AZStd::vector<AZ::Quaternion> result(s_transformCount);
+        TransformKernels::NLerp(from.data(), to.data(), 0.3f, result.data(), s_transformCount);
+        for (size_t i = 0; i < s_transformCount; ++i)
+        {
+            EXPECT_THAT(result[i], IsClose(MCore::NLerp(from[i], to[i], 0.3f)));
+        }
+    }
+
+    TEST_F(TransformKernelsFixture, Blend_MatchesTransformBlend)
+    {
+        AZStd::vector<Transform> result = m_transforms;
+        TransformKernels::Blend(result.data(), m_destTransforms.data(), s_transformCount, 0.6f);
+        for (size_t i = 0; i < s_transformCount; ++i)
+        {
+            EXPECT_THAT(result[i], IsClose(Transform(m_transforms[i]).Blend(m_destTransforms[i], 0.6f)));
+        }
+    }
+
+    TEST_F(TransformKernelsFixture, Blend_OnlyBlendsIndexedTransforms)
+    {
+        const AZStd::vector<size_t> indices = { 0, 2, 3, 5, 8, 13, 14, 18 };
+        AZStd::vector<Transform> result = m_transforms;
+        TransformKernels::Blend(result.data(), m_destTransforms.data(), indices, 0.6f);
+        for (size_t i = 0; i < s_transformCount; ++i)
+        {
+            const bool isIndexed = AZStd::find(indices.begin(), indices.end(), i) != indices.end();
+            const Transform expected = isIndexed ? Transform(m_transforms[i]).Blend(m_destTransforms[i], 0.6f) : m_transforms[i];
+            EXPECT_THAT(result[i], IsClose(expected));
+        }
+    }
+
+    TEST_F(TransformKernelsFixture, BlendAdditive_MatchesTransformBlendAdditive)
+    {
+        AZStd::vector<Transform> result = m_transforms;
+        TransformKernels::BlendAdditive(result.data(), m_destTransforms.data(), m_baseTransforms.data(), s_transformCount, 0.4f);
+        for (size_t i = 0; i < s_transformCount; ++i)
+        {
+            EXPECT_THAT(result[i], IsClose(Transform(m_transforms[i]).BlendAdditive(m_destTransforms[i], m_baseTransforms[i], 0.4f)));
+        }
+    }
+
     class TransformProjectedToGroundPlaneFixture
         : public TransformConstructFromVec3QuatVec3Fixture
     {
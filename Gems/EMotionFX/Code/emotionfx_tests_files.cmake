@@ -103,6 +103,8 @@ set(FILES
     Tests/RandomMotionSelectionTests.cpp
     Tests/RenderBackendManagerTests.cpp
     Tests/SelectionListTests.cpp
+    Tests/SignificanceSchedulerTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/SimpleMotionComponentBusTests.cpp
     Tests/SimulatedObjectCommandTests.cpp
     Tests/SimulatedObjectSerializeTests.cpp
@@ -343,19 +343,20 @@ namespace FastNoiseGem
             return;
         }
 
-        AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
-        AZ::Vector3 uvw;
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
 
-        for (size_t index = 0; index < positions.size(); index++)
         {
-            bool wasPointRejected = false;
-
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
+            m_gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
+        }
 
+        for (size_t index = 0; index < positions.size(); index++)
+        {
             // Generator returns a range between [-1, 1], map that to [0, 1]
-            outValues[index] = wasPointRejected ?
+            outValues[index] = wasPointRejected[index] ?
                 0.0f :
-                AZ::GetClamp((m_generator.GetNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+                AZ::GetClamp((m_generator.GetNoise(uvws[index].GetX(), uvws[index].GetY(), uvws[index].GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
         }
     }
 
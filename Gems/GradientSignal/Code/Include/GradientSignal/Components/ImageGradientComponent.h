@@ -17,6 +17,7 @@
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Ebuses/ImageGradientRequestBus.h>
 #include <GradientSignal/ImageAsset.h>
+#include <GradientSignal/TiledImage.h>
 #include <GradientSignal/Util.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 
@@ -51,6 +52,9 @@ namespace GradientSignal
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> m_imageAsset = { AZ::Data::AssetLoadBehavior::QueueLoad };
         float m_tilingX = 1.0f;
         float m_tilingY = 1.0f;
+        SamplingType m_samplingType = SamplingType::Point;
+        //! Samples GetValues() queries from a lower resolution mip when the queried positions are several pixels apart.
+        bool m_useMips = false;
     };
 
     static const AZ::Uuid ImageGradientComponentTypeId = "{4741F079-157F-457E-93E0-D6BA4EAF76FE}";
@@ -99,7 +103,6 @@ namespace GradientSignal
         void SetupDependencies();
 
         void GetSubImageData();
-        float GetValueFromImageData(const AZ::Vector3& uvw, float tilingX, float tilingY, float defaultValue) const;
 
         // ImageGradientRequestBus overrides...
         AZStd::string GetImageAssetPath() const override;
@@ -116,6 +119,6 @@ namespace GradientSignal
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         mutable AZStd::shared_mutex m_imageMutex;
         GradientTransform m_gradientTransform;
-        AZStd::span<const uint8_t> m_imageData;
+        TiledImage m_image;
     };
 }
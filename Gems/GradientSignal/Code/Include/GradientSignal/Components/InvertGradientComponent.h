@@ -41,6 +41,7 @@ namespace GradientSignal
         : public AZ::Component
         , private GradientRequestBus::Handler
         , private InvertGradientRequestBus::Handler
+        , private LmbrCentral::DependencyNotificationBus::Handler
     {
     public:
         template<typename, typename> friend class LmbrCentral::EditorWrappedComponentBase;
@@ -66,6 +67,11 @@ namespace GradientSignal
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
+        bool CompileProgram(GradientProgram& program) const override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // LmbrCentral::DependencyNotificationBus
+        void OnCompositionChanged() override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -48,6 +48,7 @@ namespace GradientSignal
         , public GradientRequestBus::Handler
         , public SmoothStepGradientRequestBus::Handler
         , public SmoothStepRequestBus::Handler
+        , public LmbrCentral::DependencyNotificationBus::Handler
     {
     public:
         template<typename, typename> friend class LmbrCentral::EditorWrappedComponentBase;
@@ -73,6 +74,11 @@ namespace GradientSignal
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
+        bool CompileProgram(GradientProgram& program) const override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // LmbrCentral::DependencyNotificationBus
+        void OnCompositionChanged() override;
 
     protected:
 
@@ -14,6 +14,8 @@
 
 namespace GradientSignal
 {
+    class GradientProgram;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator, 0);
@@ -79,6 +81,16 @@ namespace GradientSignal
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
         virtual bool IsEntityInHierarchy([[maybe_unused]] const AZ::EntityId& entityId) const { return false; }
+
+        /**
+         * Compiles this gradient and its inputs into the program, so that a chain of gradients can be evaluated in blocks
+         * without a GetValues call per gradient. Gradients that support this compile their input samplers into the program,
+         * then append their own operations, and need to call GradientProgram::InvalidateCompiledPrograms() whenever they're
+         * activated, deactivated, or their settings change.
+         * \param program The program to append to.
+         * \return false if this gradient can't be compiled, in which case it's evaluated as the source of the program.
+         */
+        virtual bool CompileProgram([[maybe_unused]] GradientProgram& program) const { return false; }
     };
 
     using GradientRequestBus = AZ::EBus<GradientRequests>;
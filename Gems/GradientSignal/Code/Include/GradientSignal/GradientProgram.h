@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace GradientSignal
+{
+    //! A chain of gradient modifiers flattened into a single source gradient followed by a list of per-value operations.
+    //! Instead of every modifier in the chain requesting all of the values from its input and then walking over the whole
+    //! output list again, the program evaluates the source in fixed-size blocks and runs every operation over a block
+    //! while it's still in cache. Positions that need to be transformed before reaching the source are transformed into a
+    //! scratch block on the stack, so evaluation doesn't allocate.
+    //!
+    //! Programs are built by GradientRequests::CompileProgram(), and are cached by GradientSampler until any compiled
+    //! gradient changes (see InvalidateCompiledPrograms()), or until one of the settings copied into the program no longer
+    //! matches its origin (see AddSettingsCheck()). Gradients that don't compile themselves, such as gradients with
+    //! more than one input, become the source of the program and are evaluated through GradientRequestBus as before.
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator, 0);
+
+        //! The number of values that are evaluated at once.
+        static constexpr size_t BlockSize = 256;
+
+        //! An operation that modifies a block of values in place.
+        using Operation = AZStd::function<void(AZStd::span<float> inOutValues)>;
+
+        //! Returns false once settings that were copied into the program have been changed at their origin.
+        using SettingsCheck = AZStd::function<bool()>;
+
+        //! Sets the gradient entity that produces the values that the operations run on.
+        void SetSource(const AZ::EntityId& gradientId);
+
+        //! Makes the program produce a constant value before the operations run.
+        void SetConstantSource(float value);
+
+        //! Transforms the positions before they reach the source. Transforms are applied in the order they're added.
+        void AddPositionTransform(const AZ::Matrix3x4& transform);
+
+        //! Appends an operation that runs on the values produced by the source and the operations added before it.
+        void AddOperation(Operation operation);
+
+        size_t GetOperationCount() const;
+
+        //! Adds a check for settings that were copied into the program but can be changed without notifying anyone,
+        //! such as the public members of a nested GradientSampler. The checks only run while no compiled gradient has been
+        //! deactivated since the program was compiled, so they may refer to the objects that own the settings.
+        void AddSettingsCheck(SettingsCheck settingsCheck);
+
+        //! Returns true if none of the settings copied into the program have changed since it was compiled.
+        bool AreSettingsCurrent() const;
+
+        //! Evaluates the program for every position. Safe to call from multiple threads at the same time.
+        void Evaluate(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! Marks every cached program as stale, so that they get compiled again the next time they're used.
+        //! Programs hold a copy of the settings and the input of every gradient compiled into them, so compiled gradients
+        //! call this whenever they're activated, deactivated, or their composition changes.
+        static void InvalidateCompiledPrograms();
+
+        //! Returns a number that changes every time InvalidateCompiledPrograms() is called.
+        static AZ::u32 GetCompiledProgramGeneration();
+
+    private:
+        void EvaluateBlock(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        AZ::EntityId m_sourceId;
+        float m_constantValue = 0.0f;
+        bool m_hasConstantSource = false;
+
+        AZ::Matrix3x4 m_positionTransform = AZ::Matrix3x4::CreateIdentity();
+        bool m_hasPositionTransform = false;
+
+        AZStd::vector<Operation> m_operations;
+        AZStd::vector<SettingsCheck> m_settingsChecks;
+    };
+
+    //! Holds the compiled program for a GradientSampler. Copies start out empty, so copying a sampler never shares
+    //! its cached program with the copy.
+    class GradientProgramCache final
+    {
+    public:
+        GradientProgramCache() = default;
+        GradientProgramCache(const GradientProgramCache&) {}
+        GradientProgramCache& operator=(const GradientProgramCache&) { return *this; }
+
+        //! Returns the cached program if it was compiled for the given gradient, hasn't been invalidated since,
+        //! and its copied settings are still current.
+        AZStd::shared_ptr<const GradientProgram> Find(const AZ::EntityId& gradientId) const;
+
+        //! Caches the program compiled for the given gradient at the given generation.
+        void Store(const AZ::EntityId& gradientId, AZ::u32 generation, AZStd::shared_ptr<const GradientProgram> program);
+
+    private:
+        //! Only held while copying the shared pointer, never while compiling or evaluating a program, so it can't
+        //! take part in a lock inversion with the gradient buses.
+        mutable AZStd::mutex m_mutex;
+        AZStd::shared_ptr<const GradientProgram> m_program;
+        AZ::EntityId m_gradientId;
+        AZ::u32 m_generation = 0;
+    };
+} // namespace GradientSignal
@@ -18,6 +18,7 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
@@ -33,10 +34,16 @@ namespace GradientSignal
         static void Reflect(AZ::ReflectContext* context);
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
-        inline void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
 
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
+        //! Compiles the sampled gradient chain and this sampler's own settings (transform, invert, levels, opacity)
+        //! into the program. Used by gradients that compile their input samplers, see GradientRequests::CompileProgram().
+        //! The settings are public and can be changed without notifying anyone, so the program checks them against
+        //! this sampler whenever it's fetched from a cache, and gets compiled again if they differ.
+        void CompileProgram(GradientProgram& program) const;
+
         AZ::EntityId m_gradientId;
         //! Entity that owns the gradientSampler itself, used by the gradient previewer
         AZ::EntityId m_ownerEntityId;
@@ -68,8 +75,41 @@ namespace GradientSignal
 
         AZ::Outcome<void, AZStd::string>  ValidatePotentialEntityId(void* newValue, const AZ::Uuid& valueType) const;
 
-        //prevent recursion in case user attaches cyclic dependences
-        mutable bool m_isRequestInProgress = false; 
+        //! Marks this sampler as being evaluated on the current thread until EndRequest() is called, to prevent recursion
+        //! in case user attaches cyclic dependencies. Returns false if the sampler is already being evaluated on this thread.
+        //! Other threads can evaluate the same sampler at the same time, so no locks are needed.
+        bool BeginRequest() const;
+        void EndRequest() const;
+
+        //! Returns the program for the sampled gradient chain, compiling it if the cached one is missing or stale.
+        //! The sampler's own settings aren't part of this program, so changing them never requires a recompile.
+        AZStd::shared_ptr<const GradientProgram> GetCompiledProgram() const;
+
+        inline AZ::Matrix3x4 GetTransformMatrix() const;
+
+        //! The settings that CompileProgram() copies into a program.
+        struct CompiledSettings
+        {
+            AZ::EntityId m_gradientId;
+            float m_opacity = 1.0f;
+            bool m_invertInput = false;
+            bool m_enableTransform = false;
+            AZ::Vector3 m_translate = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_scale = AZ::Vector3::CreateOne();
+            AZ::Vector3 m_rotate = AZ::Vector3::CreateZero();
+            bool m_enableLevels = false;
+            float m_inputMid = 1.0f;
+            float m_inputMin = 0.0f;
+            float m_inputMax = 1.0f;
+            float m_outputMin = 0.0f;
+            float m_outputMax = 1.0f;
+
+            bool operator==(const CompiledSettings& other) const;
+        };
+
+        CompiledSettings GetCompiledSettings() const;
+
+        mutable GradientProgramCache m_programCache;
     };
 
     namespace GradientSamplerUtil
@@ -87,6 +127,15 @@ namespace GradientSignal
         }
     }
 
+    inline AZ::Matrix3x4 GradientSampler::GetTransformMatrix() const
+    {
+        AZ::Matrix3x4 matrix3x4;
+        matrix3x4.SetFromEulerDegrees(m_rotate);
+        matrix3x4.MultiplyByScale(m_scale);
+        matrix3x4.SetTranslation(m_translate);
+        return matrix3x4;
+    }
+
     inline float GradientSampler::GetValue(const GradientSampleParams& sampleParams) const
     {
         if (m_opacity <= 0.0f || !m_gradientId.IsValid())
@@ -99,130 +148,34 @@ namespace GradientSignal
         //apply transform if set
         if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
         {
-            AZ::Matrix3x4 matrix3x4;
-            matrix3x4.SetFromEulerDegrees(m_rotate);
-            matrix3x4.MultiplyByScale(m_scale);
-            matrix3x4.SetTranslation(m_translate);
-
-            sampleParamsTransformed.m_position = matrix3x4 * sampleParamsTransformed.m_position;
+            sampleParamsTransformed.m_position = GetTransformMatrix() * sampleParamsTransformed.m_position;
         }
 
         float output = 0.0f;
 
+        if (!BeginRequest())
         {
-            // Block other threads from accessing the surface data bus while we are in GetValue (which may call into the SurfaceData bus).
-            // We lock our surface data mutex *before* checking / setting "isRequestInProgress" so that we prevent race conditions
-            // that create false detection of cyclic dependencies when multiple requests occur on different threads simultaneously.
-            // (One case where this was previously able to occur was in rapid updating of the Preview widget on the GradientSurfaceDataComponent
-            // in the Editor when moving the threshold sliders back and forth rapidly)
-            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
-            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
-
-            if (m_isRequestInProgress)
-            {
-                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependencies with gradient entity references");
-            }
-            else
-            {
-                m_isRequestInProgress = true;
-
-                GradientRequestBus::EventResult(output, m_gradientId, &GradientRequestBus::Events::GetValue, sampleParamsTransformed);
-
-                if (m_invertInput)
-                {
-                    output = 1.0f - output;
-                }
-
-                //apply levels if set
-                if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
-                {
-                    output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
-                }
-
-                m_isRequestInProgress = false;
-            }
-
-        }
-
-        return output * m_opacity;
-    }
-
-    inline void GradientSampler::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
-    {
-        auto ClearOutputValues = [](AZStd::span<float> outValues)
-        {
-            // If we don't have a valid gradient (or it is fully transparent), clear out all the output values.
-            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
-        };
-
-        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
-        {
-            ClearOutputValues(outValues);
-            return;
+            AZ_ErrorOnce("GradientSignal", false, "Detected cyclic dependencies with gradient entity references");
         }
-
-        AZStd::vector<AZ::Vector3> transformedPositions;
-        bool useTransformedPositions = false;
-
-        // apply transform if set
-        if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
+        else
         {
-            AZ::Matrix3x4 matrix3x4;
-            matrix3x4.SetFromEulerDegrees(m_rotate);
-            matrix3x4.MultiplyByScale(m_scale);
-            matrix3x4.SetTranslation(m_translate);
-
-            useTransformedPositions = true;
-            transformedPositions.resize(positions.size());
-            for (size_t index = 0; index < positions.size(); index++)
-            {
-                transformedPositions[index] = matrix3x4 * positions[index];
-            }
-        }
+            GradientRequestBus::EventResult(output, m_gradientId, &GradientRequestBus::Events::GetValue, sampleParamsTransformed);
 
-        {
-            // Block other threads from accessing the surface data bus while we are in GetValue (which may call into the SurfaceData bus).
-            // We lock our surface data mutex *before* checking / setting "isRequestInProgress" so that we prevent race conditions
-            // that create false detection of cyclic dependencies when multiple requests occur on different threads simultaneously.
-            // (One case where this was previously able to occur was in rapid updating of the Preview widget on the
-            // GradientSurfaceDataComponent in the Editor when moving the threshold sliders back and forth rapidly)
-            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
-            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
-
-            if (m_isRequestInProgress)
-            {
-                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependencies with gradient entity references");
-                ClearOutputValues(outValues);
-                return;
-            }
-            else
-            {
-                m_isRequestInProgress = true;
-
-                GradientRequestBus::Event(
-                    m_gradientId, &GradientRequestBus::Events::GetValues, useTransformedPositions ? transformedPositions : positions,
-                    outValues);
-
-                m_isRequestInProgress = false;
-            }
-        }
-
-        // Perform any post-fetch transformations on the gradient values (invert, levels, opacity).
-        for (auto& outValue : outValues)
-        {
             if (m_invertInput)
             {
-                outValue = 1.0f - outValue;
+                output = 1.0f - output;
             }
 
-            // apply levels if set
+            //apply levels if set
             if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
             {
-                outValue = GetLevels(outValue, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
             }
 
-            outValue = outValue * m_opacity;
+            EndRequest();
         }
+
+        return output * m_opacity;
     }
 
 }
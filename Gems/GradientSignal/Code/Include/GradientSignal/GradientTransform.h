@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 
 namespace GradientSignal
@@ -86,6 +87,16 @@ namespace GradientSignal
          */
         void TransformPositionToUVW(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, bool& wasPointRejected) const;
 
+        /**
+         * Bulk version of TransformPositionToUVW, which transforms several positions at once using SIMD.
+         * Produces the same results as calling TransformPositionToUVW for each position.
+         * \param inPositions The input world space positions to transform.
+         * \param outUVWs [out] The UVW values for each input position. Must be the same size as inPositions.
+         * \param wasPointRejected [out] The rejection result for each input position. Must be the same size as inPositions.
+         */
+        void TransformPositionsToUVW(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const;
+
         /**
          * Transform the given world space position to a gradient space UVW lookup value and normalize to the shape bounds.
          * "Normalizing" in this context means that regardless of the world space coordinates, (0,0,0) represents the minimum
@@ -99,6 +110,16 @@ namespace GradientSignal
          */
         void TransformPositionToUVWNormalized(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, bool& wasPointRejected) const;
 
+        /**
+         * Bulk version of TransformPositionToUVWNormalized.
+         * Produces the same results as calling TransformPositionToUVWNormalized for each position.
+         * \param inPositions The input world space positions to transform.
+         * \param outUVWs [out] The normalized UVW values for each input position. Must be the same size as inPositions.
+         * \param wasPointRejected [out] The rejection result for each input position. Must be the same size as inPositions.
+         */
+        void TransformPositionsToUVWNormalized(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const;
+
         /**
          * Epsilon value to allow our UVW range to go to [min, max) by using the range [min, max - epsilon].
          * To keep things behaving consistently between clamped and unbounded uv ranges, we want our clamped uvs to use a
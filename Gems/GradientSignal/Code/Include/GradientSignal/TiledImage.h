@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Reflect/ImageDescriptor.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace GradientSignal
+{
+    //! Controls how an image is read at positions that fall between its pixels.
+    enum class SamplingType : AZ::u8
+    {
+        Point = 0,          //! The value of the pixel containing the position.
+        Bilinear,           //! A blend of the 2x2 pixels nearest to the position.
+        Bicubic,            //! A Catmull-Rom blend of the 4x4 pixels nearest to the position.
+    };
+
+    //! A single channel float copy of an image, stored in square tiles so that the pixels read by one lookup, and by
+    //! lookups near each other, share cache lines. The image can also carry a chain of box filtered mips.
+    //! The pixels are decoded once when the image is built, so lookups don't go through the per-format pixel accessors.
+    //! Lookups treat the image as infinitely tiling, and row 0 is the bottom row of the image so that V goes up.
+    class TiledImage
+    {
+    public:
+        //! The number of pixels along each side of a tile.
+        static constexpr AZ::u32 TileSize = 8;
+
+        //! Decodes the first channel of the image. When generateMips is true, mips are built all the way down to 1x1.
+        void Build(AZStd::span<const uint8_t> imageData, const AZ::RHI::ImageDescriptor& imageDescriptor, bool generateMips);
+        void Clear();
+        bool IsEmpty() const;
+
+        AZ::u32 GetMipCount() const;
+        AZ::u32 GetWidth(AZ::u32 mip = 0) const;
+        AZ::u32 GetHeight(AZ::u32 mip = 0) const;
+
+        //! Returns the pixel at the given coordinates, which must be inside the mip.
+        float GetPixel(AZ::u32 mip, AZ::u32 x, AZ::u32 y) const;
+
+        //! Returns the mip whose pixel size best matches the distance between lookups, given in mip 0 pixels.
+        AZ::u32 SelectMip(float pixelsPerLookup) const;
+
+        //! Samples the image at a UV position, where the 0-1 range covers the image tilingX by tilingY times.
+        //! The W coordinate is ignored.
+        float Sample(const AZ::Vector3& uvw, float tilingX, float tilingY, SamplingType samplingType, AZ::u32 mip = 0) const;
+
+        //! Bulk version of Sample(), which computes the lookups for several positions at once using SIMD.
+        void Sample(AZStd::span<const AZ::Vector3> uvws, float tilingX, float tilingY, SamplingType samplingType, AZ::u32 mip,
+            AZStd::span<float> outValues) const;
+
+    private:
+        struct Mip
+        {
+            AZ::u32 m_width = 0;
+            AZ::u32 m_height = 0;
+            AZ::u32 m_tilesPerRow = 0;
+            AZStd::vector<float> m_pixels;
+        };
+
+        //! Each batch function samples exactly four positions, scaling their UVs into pixel space by scaleX and scaleY.
+        using BatchFunction = void (*)(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues);
+
+        static void ResizeMip(Mip& mip, AZ::u32 width, AZ::u32 height);
+        static size_t GetPixelIndex(const Mip& mip, AZ::u32 x, AZ::u32 y);
+        static AZ::u32 WrapCoordinate(int32_t coordinate, AZ::u32 size);
+
+        static void SamplePointBatch(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues);
+        static void SampleBilinearBatch(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues);
+        static void SampleBicubicBatch(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues);
+
+        AZStd::vector<Mip> m_mips;
+    };
+} // namespace GradientSignal
@@ -251,14 +251,12 @@ namespace GradientSignal
                 {
                     inBounds.resize(positions.size(), false);
 
+                    // Check all the points against the actual shape geometry in one batch, then against the AABB.
+                    shape->IsPointsInside(positions, inBounds);
+
                     for (size_t index = 0; index < positions.size(); index++)
                     {
-                        // Check the AABB first.
-                        if (shapeConstraintBounds.Contains(positions[index]))
-                        {
-                            // The point is in the AABB, so check against the actual shape geometry.
-                            inBounds[index] = shape->IsPointInside(positions[index]);
-                        }
+                        inBounds[index] = inBounds[index] && shapeConstraintBounds.Contains(positions[index]);
                     }
                 });
         }
@@ -16,10 +16,41 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/array.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
 namespace GradientSignal
 {
+    namespace
+    {
+        //! The number of positions that GetValues() transforms and samples at a time.
+        constexpr size_t SampleBlockSize = 256;
+
+        //! Estimates how many pixels apart a set of lookups are from the smallest nonzero distance between consecutive accepted
+        //! positions. Region queries step along rows, so this is the step size in pixels. Returns 0 if there's no such distance.
+        float GetPixelsPerLookup(
+            AZStd::span<const AZ::Vector3> uvws, AZStd::span<const bool> wasPointRejected, float pixelsPerUnitX, float pixelsPerUnitY)
+        {
+            float pixelsPerLookup = std::numeric_limits<float>::max();
+            for (size_t index = 1; index < uvws.size(); ++index)
+            {
+                if (wasPointRejected[index] || wasPointRejected[index - 1])
+                {
+                    continue;
+                }
+
+                const AZ::Vector3 delta = (uvws[index] - uvws[index - 1]).GetAbs();
+                const float distance = AZStd::max(delta.GetX() * pixelsPerUnitX, delta.GetY() * pixelsPerUnitY);
+                if (distance > 0.0f)
+                {
+                    pixelsPerLookup = AZStd::min(pixelsPerLookup, distance);
+                }
+            }
+
+            return (pixelsPerLookup == std::numeric_limits<float>::max()) ? 0.0f : pixelsPerLookup;
+        }
+    }
+
     AZ::JsonSerializationResult::Result JsonImageGradientConfigSerializer::Load(
         void* outputValue, [[maybe_unused]] const AZ::Uuid& outputValueTypeId,
         const rapidjson::Value& inputValue, AZ::JsonDeserializerContext& context)
@@ -117,6 +148,8 @@ namespace GradientSignal
                 ->Field("TilingX", &ImageGradientConfig::m_tilingX)
                 ->Field("TilingY", &ImageGradientConfig::m_tilingY)
                 ->Field("StreamingImageAsset", &ImageGradientConfig::m_imageAsset)
+                ->Field("SamplingType", &ImageGradientConfig::m_samplingType)
+                ->Field("UseMips", &ImageGradientConfig::m_useMips)
                 ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -141,6 +174,11 @@ namespace GradientSignal
                     ->Attribute(AZ::Edit::Attributes::Max, std::numeric_limits<float>::max())
                     ->Attribute(AZ::Edit::Attributes::SoftMax, 1024.0f)
                     ->Attribute(AZ::Edit::Attributes::Step, 0.25f)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &ImageGradientConfig::m_samplingType, "Sampling Type", "How the image is read between its pixels.")
+                    ->EnumAttribute(SamplingType::Point, "Point")
+                    ->EnumAttribute(SamplingType::Bilinear, "Bilinear")
+                    ->EnumAttribute(SamplingType::Bicubic, "Bicubic")
+                    ->DataElement(0, &ImageGradientConfig::m_useMips, "Use Mips", "Reads bulk queries whose positions are several pixels apart from a lower resolution copy of the image, which reduces aliasing.")
                     ;
             }
         }
@@ -152,6 +190,10 @@ namespace GradientSignal
                 ->Attribute(AZ::Script::Attributes::Category, "Vegetation")
                 ->Property("tilingX", BehaviorValueProperty(&ImageGradientConfig::m_tilingX))
                 ->Property("tilingY", BehaviorValueProperty(&ImageGradientConfig::m_tilingY))
+                ->Property("samplingType",
+                    [](ImageGradientConfig* config) { return (AZ::u8&)(config->m_samplingType); },
+                    [](ImageGradientConfig* config, const AZ::u8& i) { config->m_samplingType = (SamplingType)i; })
+                ->Property("useMips", BehaviorValueProperty(&ImageGradientConfig::m_useMips))
                 ;
         }
     }
@@ -238,61 +280,9 @@ namespace GradientSignal
             return;
         }
 
-        m_imageData = m_configuration.m_imageAsset->GetSubImageData(0, 0);
-    }
-
-    float ImageGradientComponent::GetValueFromImageData(const AZ::Vector3& uvw, float tilingX, float tilingY, float defaultValue) const
-    {
-        if (!m_imageData.empty())
-        {
-            const AZ::RHI::ImageDescriptor& imageDescriptor = m_configuration.m_imageAsset->GetImageDescriptor();
-            auto width = imageDescriptor.m_size.m_width;
-            auto height = imageDescriptor.m_size.m_height;
-
-            if (width > 0 && height > 0)
-            {
-                // When "rasterizing" from uvs, a range of 0-1 has slightly different meanings depending on the sampler state.
-                // For repeating states (Unbounded/None, Repeat), a uv value of 1 should wrap around back to our 0th pixel.
-                // For clamping states (Clamp to Zero, Clamp to Edge), a uv value of 1 should point to the last pixel.
-
-                // We assume here that the code handling sampler states has handled this for us in the clamping cases
-                // by reducing our uv by a small delta value such that anything that wants the last pixel has a value
-                // just slightly less than 1.
-
-                // Keeping that in mind, we scale our uv from 0-1 to 0-image size inclusive.  So a 4-pixel image will scale
-                // uv values of 0-1 to 0-4, not 0-3 as you might expect.  This is because we want the following range mappings:
-                // [0 - 1/4)   = pixel 0
-                // [1/4 - 1/2) = pixel 1
-                // [1/2 - 3/4) = pixel 2
-                // [3/4 - 1)   = pixel 3
-                // [1 - 1 1/4) = pixel 0
-                // ...
-
-                // Also, based on our tiling settings, we extend the size of our image virtually by a factor of tilingX and tilingY.  
-                // A 16x16 pixel image and tilingX = tilingY = 1  maps the uv range of 0-1 to 0-16 pixels.  
-                // A 16x16 pixel image and tilingX = tilingY = 1.5 maps the uv range of 0-1 to 0-24 pixels.
-
-                const AZ::Vector3 tiledDimensions((width * tilingX),
-                    (height * tilingY),
-                    0.0f);
-
-                // Convert from uv space back to pixel space
-                AZ::Vector3 pixelLookup = (uvw * tiledDimensions);
-
-                // UVs outside the 0-1 range are treated as infinitely tiling, so that we behave the same as the 
-                // other gradient generators.  As mentioned above, if clamping is desired, we expect it to be applied
-                // outside of this function.
-                auto x = aznumeric_cast<AZ::u32>(pixelLookup.GetX()) % width;
-                auto y = aznumeric_cast<AZ::u32>(pixelLookup.GetY()) % height;
-
-                // Flip the y because images are stored in reverse of our world axes
-                y = (height - 1) - y;
-
-                return AZ::RPI::GetImageDataPixelValue<float>(m_imageData, imageDescriptor, x, y);
-            }
-        }
-
-        return defaultValue;
+        m_image.Build(
+            m_configuration.m_imageAsset->GetSubImageData(0, 0), m_configuration.m_imageAsset->GetImageDescriptor(),
+            m_configuration.m_useMips);
     }
 
     void ImageGradientComponent::Activate()
@@ -307,7 +297,10 @@ namespace GradientSignal
 
         // Invoke the QueueLoad before connecting to the AssetBus, so that
         // if the asset is already ready, then OnAssetReady will be triggered immediately
-        m_imageData = AZStd::span<const uint8_t>();
+        {
+            AZStd::unique_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+            m_image.Clear();
+        }
         m_configuration.m_imageAsset.QueueLoad();
 
         AZ::Data::AssetBus::Handler::BusConnect(m_configuration.m_imageAsset.GetId());
@@ -323,6 +316,7 @@ namespace GradientSignal
         m_dependencyMonitor.Reset();
 
         AZStd::unique_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+        m_image.Clear();
         m_configuration.m_imageAsset.Release();
     }
 
@@ -381,22 +375,19 @@ namespace GradientSignal
         AZ::Vector3 uvw = sampleParams.m_position;
         bool wasPointRejected = false;
 
+        AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+
         // Return immediately if our cached image data hasn't been retrieved yet
-        if (m_imageData.empty())
+        if (m_image.IsEmpty())
         {
             return 0.0f;
         }
 
-        {
-            AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
-
-            m_gradientTransform.TransformPositionToUVWNormalized(sampleParams.m_position, uvw, wasPointRejected);
+        m_gradientTransform.TransformPositionToUVWNormalized(sampleParams.m_position, uvw, wasPointRejected);
 
-            if (!wasPointRejected)
-            {
-                return GetValueFromImageData(
-                    uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
-            }
+        if (!wasPointRejected)
+        {
+            return m_image.Sample(uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, m_configuration.m_samplingType);
         }
 
         return 0.0f;
@@ -410,29 +401,47 @@ namespace GradientSignal
             return;
         }
 
+        AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+
         // Return immediately if our cached image data hasn't been retrieved yet
-        if (m_imageData.empty())
+        if (m_image.IsEmpty())
         {
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        const float pixelsPerUnitX = m_image.GetWidth() * m_configuration.m_tilingX;
+        const float pixelsPerUnitY = m_image.GetHeight() * m_configuration.m_tilingY;
 
-        AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+        // The positions are transformed and sampled a block at a time, so that the intermediate UVWs stay on the stack.
+        AZStd::array<AZ::Vector3, SampleBlockSize> uvws;
+        AZStd::array<bool, SampleBlockSize> wasPointRejected;
 
-        for (size_t index = 0; index < positions.size(); index++)
+        for (size_t blockStart = 0; blockStart < positions.size(); blockStart += SampleBlockSize)
         {
-            m_gradientTransform.TransformPositionToUVWNormalized(positions[index], uvw, wasPointRejected);
+            const size_t blockCount = AZStd::min(SampleBlockSize, positions.size() - blockStart);
+            const AZStd::span<AZ::Vector3> blockUvws(uvws.data(), blockCount);
+            const AZStd::span<bool> blockRejected(wasPointRejected.data(), blockCount);
+            const AZStd::span<float> blockValues = outValues.subspan(blockStart, blockCount);
 
-            if (!wasPointRejected)
+            m_gradientTransform.TransformPositionsToUVWNormalized(positions.subspan(blockStart, blockCount), blockUvws, blockRejected);
+
+            // Positions that are several pixels apart would skip over most of the image, so read them from a mip that
+            // has roughly one pixel per position instead. This averages away the skipped detail and touches far less memory.
+            AZ::u32 mip = 0;
+            if (m_configuration.m_useMips)
             {
-                outValues[index] = GetValueFromImageData(
-                    uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+                mip = m_image.SelectMip(GetPixelsPerLookup(blockUvws, blockRejected, pixelsPerUnitX, pixelsPerUnitY));
             }
-            else
+
+            m_image.Sample(
+                blockUvws, m_configuration.m_tilingX, m_configuration.m_tilingY, m_configuration.m_samplingType, mip, blockValues);
+
+            for (size_t index = 0; index < blockCount; ++index)
             {
-                outValues[index] = 0.0f;
+                if (wasPointRejected[index])
+                {
+                    blockValues[index] = 0.0f;
+                }
             }
         }
     }
@@ -469,7 +478,7 @@ namespace GradientSignal
                 AZStd::unique_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
 
                 // Clear our cached image data
-                m_imageData = AZStd::span<const uint8_t>();
+                m_image.Clear();
 
                 if (assetPath.empty())
                 {
@@ -98,6 +98,8 @@ namespace GradientSignal
         m_dependencyMonitor.ConnectOwner(GetEntityId());
         m_dependencyMonitor.ConnectDependency(m_configuration.m_gradientSampler.m_gradientId);
         GradientRequestBus::Handler::BusConnect(GetEntityId());
+        LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
+        GradientProgram::InvalidateCompiledPrograms();
         InvertGradientRequestBus::Handler::BusConnect(GetEntityId());
     }
 
@@ -105,6 +107,8 @@ namespace GradientSignal
     {
         m_dependencyMonitor.Reset();
         GradientRequestBus::Handler::BusDisconnect();
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        GradientProgram::InvalidateCompiledPrograms();
         InvertGradientRequestBus::Handler::BusDisconnect();
     }
 
@@ -157,6 +161,24 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool InvertGradientComponent::CompileProgram(GradientProgram& program) const
+    {
+        m_configuration.m_gradientSampler.CompileProgram(program);
+        program.AddOperation([](AZStd::span<float> inOutValues)
+        {
+            for (auto& value : inOutValues)
+            {
+                value = 1.0f - AZ::GetClamp(value, 0.0f, 1.0f);
+            }
+        });
+        return true;
+    }
+
+    void InvertGradientComponent::OnCompositionChanged()
+    {
+        GradientProgram::InvalidateCompiledPrograms();
+    }
+
     GradientSampler& InvertGradientComponent::GetGradientSampler()
     {
         return m_configuration.m_gradientSampler;
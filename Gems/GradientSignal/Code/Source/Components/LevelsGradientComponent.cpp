@@ -140,6 +140,8 @@ namespace GradientSignal
         m_dependencyMonitor.ConnectOwner(GetEntityId());
         m_dependencyMonitor.ConnectDependency(m_configuration.m_gradientSampler.m_gradientId);
         GradientRequestBus::Handler::BusConnect(GetEntityId());
+        LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
+        GradientProgram::InvalidateCompiledPrograms();
         LevelsGradientRequestBus::Handler::BusConnect(GetEntityId());
     }
 
@@ -147,6 +149,8 @@ namespace GradientSignal
     {
         m_dependencyMonitor.Reset();
         GradientRequestBus::Handler::BusDisconnect();
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        GradientProgram::InvalidateCompiledPrograms();
         LevelsGradientRequestBus::Handler::BusDisconnect();
     }
 
@@ -205,6 +209,23 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool LevelsGradientComponent::CompileProgram(GradientProgram& program) const
+    {
+        m_configuration.m_gradientSampler.CompileProgram(program);
+        program.AddOperation(
+            [inputMid = m_configuration.m_inputMid, inputMin = m_configuration.m_inputMin, inputMax = m_configuration.m_inputMax,
+             outputMin = m_configuration.m_outputMin, outputMax = m_configuration.m_outputMax](AZStd::span<float> inOutValues)
+        {
+            GetLevels(inOutValues, inputMid, inputMin, inputMax, outputMin, outputMax);
+        });
+        return true;
+    }
+
+    void LevelsGradientComponent::OnCompositionChanged()
+    {
+        GradientProgram::InvalidateCompiledPrograms();
+    }
+
     float LevelsGradientComponent::GetInputMin() const
     {
         return m_configuration.m_inputMin;
@@ -211,22 +211,21 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
 
-        AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
+        {
+            AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
+            m_gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
+        }
+
+        // Generate the noise for all the points in one bulk call, then clear out the values for the rejected points.
+        m_perlinImprovedNoise->GenerateOctaveNoise(
+            uvws, outValues, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
 
         for (size_t index = 0; index < positions.size(); index++)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
-
-            if (!wasPointRejected)
-            {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
-            }
-            else
+            if (wasPointRejected[index])
             {
                 outValues[index] = 0.0f;
             }
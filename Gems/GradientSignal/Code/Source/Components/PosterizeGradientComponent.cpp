@@ -118,6 +118,8 @@ namespace GradientSignal
         m_dependencyMonitor.ConnectOwner(GetEntityId());
         m_dependencyMonitor.ConnectDependency(m_configuration.m_gradientSampler.m_gradientId);
         GradientRequestBus::Handler::BusConnect(GetEntityId());
+        LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
+        GradientProgram::InvalidateCompiledPrograms();
         PosterizeGradientRequestBus::Handler::BusConnect(GetEntityId());
     }
 
@@ -125,6 +127,8 @@ namespace GradientSignal
     {
         m_dependencyMonitor.Reset();
         GradientRequestBus::Handler::BusDisconnect();
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        GradientProgram::InvalidateCompiledPrograms();
         PosterizeGradientRequestBus::Handler::BusDisconnect();
     }
 
@@ -180,6 +184,25 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool PosterizeGradientComponent::CompileProgram(GradientProgram& program) const
+    {
+        m_configuration.m_gradientSampler.CompileProgram(program);
+        program.AddOperation(
+            [bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f), mode = m_configuration.m_mode](AZStd::span<float> inOutValues)
+        {
+            for (auto& value : inOutValues)
+            {
+                value = PosterizeValue(value, bands, mode);
+            }
+        });
+        return true;
+    }
+
+    void PosterizeGradientComponent::OnCompositionChanged()
+    {
+        GradientProgram::InvalidateCompiledPrograms();
+    }
+
     AZ::s32 PosterizeGradientComponent::GetBands() const
     {
         return m_configuration.m_bands;
@@ -185,9 +185,12 @@ namespace GradientSignal
             {
                 shapeConnected = true;
 
+                // Query all the distances in one batch, then convert them to falloff values in place.
+                shapeRequests->DistancesSquaredFromPoints(positions, outValues);
+
                 for (size_t index = 0; index < positions.size(); index++)
                 {
-                    float distance = shapeRequests->DistanceFromPoint(positions[index]);
+                    float distance = sqrtf(outValues[index]);
 
                     // Since this is outer falloff, distance should give us values from 1.0 at the minimum distance to 0.0 at the maximum
                     // distance. The statement is written specifically to handle the 0 falloff case as well. For 0 falloff, all points
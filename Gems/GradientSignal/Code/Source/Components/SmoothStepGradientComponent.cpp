@@ -134,6 +134,8 @@ namespace GradientSignal
         m_dependencyMonitor.ConnectOwner(GetEntityId());
         m_dependencyMonitor.ConnectDependency(m_configuration.m_gradientSampler.m_gradientId);
         GradientRequestBus::Handler::BusConnect(GetEntityId());
+        LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
+        GradientProgram::InvalidateCompiledPrograms();
         SmoothStepGradientRequestBus::Handler::BusConnect(GetEntityId());
         SmoothStepRequestBus::Handler::BusConnect(GetEntityId());
     }
@@ -142,6 +144,8 @@ namespace GradientSignal
     {
         m_dependencyMonitor.Reset();
         GradientRequestBus::Handler::BusDisconnect();
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        GradientProgram::InvalidateCompiledPrograms();
         SmoothStepGradientRequestBus::Handler::BusDisconnect();
         SmoothStepRequestBus::Handler::BusDisconnect();
     }
@@ -189,6 +193,21 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool SmoothStepGradientComponent::CompileProgram(GradientProgram& program) const
+    {
+        m_configuration.m_gradientSampler.CompileProgram(program);
+        program.AddOperation([smoothStep = m_configuration.m_smoothStep](AZStd::span<float> inOutValues)
+        {
+            smoothStep.GetSmoothedValues(inOutValues);
+        });
+        return true;
+    }
+
+    void SmoothStepGradientComponent::OnCompositionChanged()
+    {
+        GradientProgram::InvalidateCompiledPrograms();
+    }
+
     float SmoothStepGradientComponent::GetFallOffRange() const
     {
         return m_configuration.m_smoothStep.m_falloffRange;
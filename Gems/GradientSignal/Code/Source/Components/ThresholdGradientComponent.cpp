@@ -106,6 +106,8 @@ namespace GradientSignal
         m_dependencyMonitor.ConnectOwner(GetEntityId());
         m_dependencyMonitor.ConnectDependency(m_configuration.m_gradientSampler.m_gradientId);
         GradientRequestBus::Handler::BusConnect(GetEntityId());
+        LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
+        GradientProgram::InvalidateCompiledPrograms();
         ThresholdGradientRequestBus::Handler::BusConnect(GetEntityId());
     }
 
@@ -113,6 +115,8 @@ namespace GradientSignal
     {
         m_dependencyMonitor.Reset();
         GradientRequestBus::Handler::BusDisconnect();
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        GradientProgram::InvalidateCompiledPrograms();
         ThresholdGradientRequestBus::Handler::BusDisconnect();
     }
 
@@ -161,6 +165,24 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool ThresholdGradientComponent::CompileProgram(GradientProgram& program) const
+    {
+        m_configuration.m_gradientSampler.CompileProgram(program);
+        program.AddOperation([threshold = m_configuration.m_threshold](AZStd::span<float> inOutValues)
+        {
+            for (auto& value : inOutValues)
+            {
+                value = (value <= threshold) ? 0.0f : 1.0f;
+            }
+        });
+        return true;
+    }
+
+    void ThresholdGradientComponent::OnCompositionChanged()
+    {
+        GradientProgram::InvalidateCompiledPrograms();
+    }
+
     float ThresholdGradientComponent::GetThreshold() const
     {
         return m_configuration.m_threshold;
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        AZStd::atomic<AZ::u32> s_compiledProgramGeneration{ 0 };
+    }
+
+    void GradientProgram::SetSource(const AZ::EntityId& gradientId)
+    {
+        m_sourceId = gradientId;
+        m_hasConstantSource = false;
+    }
+
+    void GradientProgram::SetConstantSource(float value)
+    {
+        m_sourceId = AZ::EntityId();
+        m_constantValue = value;
+        m_hasConstantSource = true;
+    }
+
+    void GradientProgram::AddPositionTransform(const AZ::Matrix3x4& transform)
+    {
+        m_positionTransform = transform * m_positionTransform;
+        m_hasPositionTransform = true;
+    }
+
+    void GradientProgram::AddOperation(Operation operation)
+    {
+        m_operations.emplace_back(AZStd::move(operation));
+    }
+
+    size_t GradientProgram::GetOperationCount() const
+    {
+        return m_operations.size();
+    }
+
+    void GradientProgram::AddSettingsCheck(SettingsCheck settingsCheck)
+    {
+        m_settingsChecks.emplace_back(AZStd::move(settingsCheck));
+    }
+
+    bool GradientProgram::AreSettingsCurrent() const
+    {
+        for (const SettingsCheck& settingsCheck : m_settingsChecks)
+        {
+            if (!settingsCheck())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void GradientProgram::Evaluate(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        for (size_t blockStart = 0; blockStart < positions.size(); blockStart += BlockSize)
+        {
+            const size_t blockCount = AZStd::min(BlockSize, positions.size() - blockStart);
+            EvaluateBlock(positions.subspan(blockStart, blockCount), outValues.subspan(blockStart, blockCount));
+        }
+    }
+
+    void GradientProgram::EvaluateBlock(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        if (m_hasConstantSource)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), m_constantValue);
+        }
+        else if (m_hasPositionTransform)
+        {
+            AZStd::array<AZ::Vector3, BlockSize> transformedPositions;
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                transformedPositions[index] = m_positionTransform * positions[index];
+            }
+
+            GradientRequestBus::Event(
+                m_sourceId, &GradientRequestBus::Events::GetValues,
+                AZStd::span<const AZ::Vector3>(transformedPositions.data(), positions.size()), outValues);
+        }
+        else
+        {
+            GradientRequestBus::Event(m_sourceId, &GradientRequestBus::Events::GetValues, positions, outValues);
+        }
+
+        for (const Operation& operation : m_operations)
+        {
+            operation(outValues);
+        }
+    }
+
+    void GradientProgram::InvalidateCompiledPrograms()
+    {
+        ++s_compiledProgramGeneration;
+    }
+
+    AZ::u32 GradientProgram::GetCompiledProgramGeneration()
+    {
+        return s_compiledProgramGeneration;
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientProgramCache::Find(const AZ::EntityId& gradientId) const
+    {
+        const AZ::u32 generation = GradientProgram::GetCompiledProgramGeneration();
+
+        AZStd::shared_ptr<const GradientProgram> program;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            if (m_program && (m_gradientId == gradientId) && (m_generation == generation))
+            {
+                program = m_program;
+            }
+        }
+
+        // The settings checks run outside of the lock, since they read the settings of other gradients' samplers.
+        if (program && !program->AreSettingsCurrent())
+        {
+            program.reset();
+        }
+        return program;
+    }
+
+    void GradientProgramCache::Store(const AZ::EntityId& gradientId, AZ::u32 generation, AZStd::shared_ptr<const GradientProgram> program)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_program = AZStd::move(program);
+        m_gradientId = gradientId;
+        m_generation = generation;
+    }
+} // namespace GradientSignal
@@ -12,12 +12,23 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
 {
+    namespace
+    {
+        // The samplers that are being evaluated on the current thread, from the outermost to the innermost request.
+        // These are plain arrays so that nothing needs to be allocated or destroyed per thread.
+        constexpr size_t MaxRequestDepth = 256;
+        thread_local const GradientSampler* t_activeRequests[MaxRequestDepth];
+        thread_local size_t t_activeRequestCount = 0;
+    }
+
     void GradientSampler::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -199,6 +210,230 @@ namespace GradientSignal
         return inHierarchy;
     }
 
+    void GradientSampler::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        auto ClearOutputValues = [](AZStd::span<float> outValues)
+        {
+            // If we don't have a valid gradient (or it is fully transparent), clear out all the output values.
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        };
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            ClearOutputValues(outValues);
+            return;
+        }
+
+        const bool useTransformedPositions = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        const AZ::Matrix3x4 matrix3x4 = useTransformedPositions ? GetTransformMatrix() : AZ::Matrix3x4::CreateIdentity();
+        const bool applyLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+
+        if (!BeginRequest())
+        {
+            AZ_ErrorOnce("GradientSignal", false, "Detected cyclic dependencies with gradient entity references");
+            ClearOutputValues(outValues);
+            return;
+        }
+
+        // The program is fetched while this sampler is marked as in progress, so that cyclic references are caught
+        // while compiling as well.
+        const AZStd::shared_ptr<const GradientProgram> program = GetCompiledProgram();
+
+        // Run the whole chain one block at a time, so that the positions and values stay in cache from the source
+        // gradient through to this sampler's own post-fetch transformations (invert, levels, opacity).
+        AZStd::array<AZ::Vector3, GradientProgram::BlockSize> transformedPositions;
+        for (size_t blockStart = 0; blockStart < positions.size(); blockStart += GradientProgram::BlockSize)
+        {
+            const size_t blockCount = AZStd::min(GradientProgram::BlockSize, positions.size() - blockStart);
+            AZStd::span<const AZ::Vector3> blockPositions = positions.subspan(blockStart, blockCount);
+            AZStd::span<float> blockValues = outValues.subspan(blockStart, blockCount);
+
+            if (useTransformedPositions)
+            {
+                for (size_t index = 0; index < blockCount; index++)
+                {
+                    transformedPositions[index] = matrix3x4 * blockPositions[index];
+                }
+                blockPositions = AZStd::span<const AZ::Vector3>(transformedPositions.data(), blockCount);
+            }
+
+            program->Evaluate(blockPositions, blockValues);
+
+            for (auto& outValue : blockValues)
+            {
+                if (m_invertInput)
+                {
+                    outValue = 1.0f - outValue;
+                }
+
+                // apply levels if set
+                if (applyLevels)
+                {
+                    outValue = GetLevels(outValue, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+                }
+
+                outValue = outValue * m_opacity;
+            }
+        }
+
+        EndRequest();
+    }
+
+    void GradientSampler::CompileProgram(GradientProgram& program) const
+    {
+        // Nested samplers are usually edited through their owner's GetGradientSampler() or the BehaviorContext, neither of
+        // which tells the compiled programs, so have the program compare the settings it copies from here on every fetch.
+        program.AddSettingsCheck([this, settings = GetCompiledSettings()]()
+        {
+            return GetCompiledSettings() == settings;
+        });
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            program.SetConstantSource(0.0f);
+            return;
+        }
+
+        if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
+        {
+            program.AddPositionTransform(GetTransformMatrix());
+        }
+
+        if (!BeginRequest())
+        {
+            AZ_ErrorOnce("GradientSignal", false, "Detected cyclic dependencies with gradient entity references");
+            program.SetConstantSource(0.0f);
+            return;
+        }
+
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, m_gradientId, &GradientRequestBus::Events::CompileProgram, program);
+        if (!compiled)
+        {
+            program.SetSource(m_gradientId);
+        }
+
+        EndRequest();
+
+        if (m_invertInput)
+        {
+            program.AddOperation([](AZStd::span<float> inOutValues)
+            {
+                for (auto& value : inOutValues)
+                {
+                    value = 1.0f - value;
+                }
+            });
+        }
+
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            program.AddOperation(
+                [inputMid = m_inputMid, inputMin = m_inputMin, inputMax = m_inputMax, outputMin = m_outputMin,
+                 outputMax = m_outputMax](AZStd::span<float> inOutValues)
+            {
+                for (auto& value : inOutValues)
+                {
+                    value = GetLevels(value, inputMid, inputMin, inputMax, outputMin, outputMax);
+                }
+            });
+        }
+
+        if (m_opacity != 1.0f)
+        {
+            program.AddOperation([opacity = m_opacity](AZStd::span<float> inOutValues)
+            {
+                for (auto& value : inOutValues)
+                {
+                    value *= opacity;
+                }
+            });
+        }
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientSampler::GetCompiledProgram() const
+    {
+        if (AZStd::shared_ptr<const GradientProgram> program = m_programCache.Find(m_gradientId))
+        {
+            return program;
+        }
+
+        // Read the generation before compiling, so that a change made while compiling leaves the program stale.
+        const AZ::u32 generation = GradientProgram::GetCompiledProgramGeneration();
+
+        auto program = AZStd::make_shared<GradientProgram>();
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, m_gradientId, &GradientRequestBus::Events::CompileProgram, *program);
+        if (!compiled)
+        {
+            program->SetSource(m_gradientId);
+        }
+
+        m_programCache.Store(m_gradientId, generation, program);
+        return program;
+    }
+
+    bool GradientSampler::CompiledSettings::operator==(const CompiledSettings& other) const
+    {
+        return m_gradientId == other.m_gradientId && m_opacity == other.m_opacity && m_invertInput == other.m_invertInput &&
+            m_enableTransform == other.m_enableTransform && m_translate == other.m_translate && m_scale == other.m_scale &&
+            m_rotate == other.m_rotate && m_enableLevels == other.m_enableLevels && m_inputMid == other.m_inputMid &&
+            m_inputMin == other.m_inputMin && m_inputMax == other.m_inputMax && m_outputMin == other.m_outputMin &&
+            m_outputMax == other.m_outputMax;
+    }
+
+    GradientSampler::CompiledSettings GradientSampler::GetCompiledSettings() const
+    {
+        CompiledSettings settings;
+        settings.m_gradientId = m_gradientId;
+        settings.m_opacity = m_opacity;
+        settings.m_invertInput = m_invertInput;
+        settings.m_enableTransform = m_enableTransform;
+        settings.m_translate = m_translate;
+        settings.m_scale = m_scale;
+        settings.m_rotate = m_rotate;
+        settings.m_enableLevels = m_enableLevels;
+        settings.m_inputMid = m_inputMid;
+        settings.m_inputMin = m_inputMin;
+        settings.m_inputMax = m_inputMax;
+        settings.m_outputMin = m_outputMin;
+        settings.m_outputMax = m_outputMax;
+        return settings;
+    }
+
+    bool GradientSampler::BeginRequest() const
+    {
+        // A chain that's deeper than the maximum depth can only come from cyclic references.
+        if (t_activeRequestCount >= MaxRequestDepth)
+        {
+            return false;
+        }
+
+        for (size_t index = 0; index < t_activeRequestCount; ++index)
+        {
+            if (t_activeRequests[index] == this)
+            {
+                return false;
+            }
+        }
+
+        t_activeRequests[t_activeRequestCount++] = this;
+        return true;
+    }
+
+    void GradientSampler::EndRequest() const
+    {
+        AZ_Assert((t_activeRequestCount > 0) && (t_activeRequests[t_activeRequestCount - 1] == this),
+            "Gradient sampler requests ended out of order.");
+        --t_activeRequestCount;
+    }
+
     bool GradientSampler::AreLevelSettingsDisabled() const
     {
         return !m_enableLevels;
@@ -8,6 +8,7 @@
 
 
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <GradientSignal/GradientTransform.h>
 
 
@@ -84,6 +85,114 @@ namespace GradientSignal
         outUVW *= m_frequencyZoom;
     }
 
+    void GradientTransform::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        constexpr size_t BatchSize = Vec4::ElementCount;
+
+        AZ_Assert(
+            (inPositions.size() == outUVWs.size()) && (inPositions.size() == wasPointRejected.size()),
+            "input and output lists are different sizes (%zu vs %zu vs %zu).", inPositions.size(), outUVWs.size(), wasPointRejected.size());
+
+        const size_t positionCount = AZStd::min(inPositions.size(), AZStd::min(outUVWs.size(), wasPointRejected.size()));
+
+        // Each lane holds a different position, so every matrix element and bounds component is splatted across a register.
+        Vec4::FloatType matrix[3][4];
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                matrix[row][column] = Vec4::Splat(m_inverseTransform.GetElement(row, column));
+            }
+        }
+
+        const AZ::Vector3 boundsMin = m_shapeBounds.GetMin();
+        const AZ::Vector3 boundsMax = m_shapeBounds.GetMax();
+        const AZ::Vector3 clampMax = boundsMax - AZ::Vector3(UvEpsilon);
+        const Vec4::FloatType min[3] = { Vec4::Splat(boundsMin.GetX()), Vec4::Splat(boundsMin.GetY()), Vec4::Splat(boundsMin.GetZ()) };
+        const Vec4::FloatType max[3] = { Vec4::Splat(boundsMax.GetX()), Vec4::Splat(boundsMax.GetY()), Vec4::Splat(boundsMax.GetZ()) };
+        const Vec4::FloatType clampedMax[3] = { Vec4::Splat(clampMax.GetX()), Vec4::Splat(clampMax.GetY()), Vec4::Splat(clampMax.GetZ()) };
+        const Vec4::FloatType frequencyZoom = Vec4::Splat(m_frequencyZoom);
+        const bool clampToBounds = (m_wrappingType == WrappingType::ClampToEdge) || (m_wrappingType == WrappingType::ClampToZero);
+        const bool wrapPerPoint = (m_wrappingType == WrappingType::Mirror) || (m_wrappingType == WrappingType::Repeat);
+
+        size_t index = 0;
+        for (; index + BatchSize <= positionCount; index += BatchSize)
+        {
+            const Vec4::FloatType rows[4] = {
+                Vec4::FromVec3(inPositions[index].GetSimdValue()),
+                Vec4::FromVec3(inPositions[index + 1].GetSimdValue()),
+                Vec4::FromVec3(inPositions[index + 2].GetSimdValue()),
+                Vec4::FromVec3(inPositions[index + 3].GetSimdValue())
+            };
+            Vec4::FloatType position[4];
+            Vec4::Mat4x4Transpose(rows, position);
+
+            Vec4::FloatType uvw[3];
+            Vec4::FloatType acceptedMask = Vec4::CastToFloat(Vec4::Splat(-1));
+            for (int component = 0; component < 3; ++component)
+            {
+                // Same operation order as Matrix3x4 * Vector3 (Dot3 followed by adding the translation), so that the results match.
+                const Vec4::FloatType dot = Vec4::Add(
+                    Vec4::Add(Vec4::Mul(matrix[component][0], position[0]), Vec4::Mul(matrix[component][1], position[1])),
+                    Vec4::Mul(matrix[component][2], position[2]));
+                uvw[component] = Vec4::Add(dot, matrix[component][3]);
+
+                // Same [min, max) acceptance test as TransformPositionToUVW.
+                acceptedMask = Vec4::And(acceptedMask,
+                    Vec4::And(Vec4::CmpGtEq(uvw[component], min[component]), Vec4::CmpLt(uvw[component], max[component])));
+
+                if (clampToBounds)
+                {
+                    uvw[component] = Vec4::Clamp(uvw[component], min[component], clampedMax[component]);
+                }
+            }
+
+            alignas(16) float u[BatchSize];
+            alignas(16) float v[BatchSize];
+            alignas(16) float w[BatchSize];
+            alignas(16) int32_t accepted[BatchSize];
+            Vec4::StoreAligned(accepted, Vec4::CastToInt(acceptedMask));
+
+            if (wrapPerPoint)
+            {
+                // Mirror and Repeat wrap with fmod, so they're applied per point before the zoom.
+                Vec4::StoreAligned(u, uvw[0]);
+                Vec4::StoreAligned(v, uvw[1]);
+                Vec4::StoreAligned(w, uvw[2]);
+                for (size_t lane = 0; lane < BatchSize; ++lane)
+                {
+                    const AZ::Vector3 point(u[lane], v[lane], w[lane]);
+                    outUVWs[index + lane] = ((m_wrappingType == WrappingType::Mirror) ? GetMirroredPointInAabb(point, m_shapeBounds)
+                                                                                      : GetWrappedPointInAabb(point, m_shapeBounds)) * m_frequencyZoom;
+                }
+            }
+            else
+            {
+                Vec4::StoreAligned(u, Vec4::Mul(uvw[0], frequencyZoom));
+                Vec4::StoreAligned(v, Vec4::Mul(uvw[1], frequencyZoom));
+                Vec4::StoreAligned(w, Vec4::Mul(uvw[2], frequencyZoom));
+                for (size_t lane = 0; lane < BatchSize; ++lane)
+                {
+                    outUVWs[index + lane] = AZ::Vector3(u[lane], v[lane], w[lane]);
+                }
+            }
+
+            for (size_t lane = 0; lane < BatchSize; ++lane)
+            {
+                wasPointRejected[index + lane] = !m_alwaysAcceptPoint && (accepted[lane] == 0);
+            }
+        }
+
+        for (; index < positionCount; ++index)
+        {
+            bool rejected = false;
+            TransformPositionToUVW(inPositions[index], outUVWs[index], rejected);
+            wasPointRejected[index] = rejected;
+        }
+    }
+
     void GradientTransform::TransformPositionToUVWNormalized(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, bool& wasPointRejected) const
     {
         TransformPositionToUVW(inPosition, outUVW, wasPointRejected);
@@ -93,6 +202,19 @@ namespace GradientSignal
         outUVW = m_normalizeExtentsReciprocal * (outUVW - m_shapeBounds.GetMin());
     }
 
+    void GradientTransform::TransformPositionsToUVWNormalized(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected);
+
+        const size_t positionCount = AZStd::min(inPositions.size(), AZStd::min(outUVWs.size(), wasPointRejected.size()));
+        const AZ::Vector3 boundsMin = m_shapeBounds.GetMin();
+        for (size_t index = 0; index < positionCount; ++index)
+        {
+            outUVWs[index] = m_normalizeExtentsReciprocal * (outUVWs[index] - boundsMin);
+        }
+    }
+
     AZ::Vector3 GradientTransform::NoTransform(const AZ::Vector3& point, const AZ::Aabb& /*bounds*/)
     {
         return point;
@@ -9,6 +9,8 @@
 
 #include <GradientSignal/PerlinImprovedNoise.h>
 
+#include <AzCore/Math/SimdMath.h>
+
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
 
@@ -60,6 +62,94 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // SIMD versions of the functions above, each lane holds the value for a different position.
+        // The operations are kept in the same order as the scalar versions so that both produce the same results.
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Branchless equivalent of the switch statement in the scalar Gradient().
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType useXForU = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x8)));
+            const Vec4::FloatType useYForV = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x4)));
+            const Vec4::FloatType useXForV = Vec4::CastToFloat(Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(0xC)), Vec4::CmpEq(h, Vec4::Splat(0xE))));
+            const Vec4::FloatType positiveU = Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0x1)), Vec4::ZeroInt()));
+            const Vec4::FloatType positiveV = Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0x2)), Vec4::ZeroInt()));
+
+            const Vec4::FloatType u = Vec4::Select(x, y, useXForU);
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, useXForV), useYForV);
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return Vec4::Add(Vec4::Select(u, Vec4::Sub(zero, u), positiveU), Vec4::Select(v, Vec4::Sub(zero, v), positiveV));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType polynomial =
+                Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), polynomial);
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        // Same as PerlinImprovedNoise::GenerateNoise, for four positions at once.
+        Vec4::FloatType GenerateNoise(
+            const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            const Vec4::FloatType floorZ = Vec4::Floor(z);
+            const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+            const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+            const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+
+            const Vec4::Int32Type byteMask = Vec4::Splat(255);
+            alignas(16) int32_t xi0[Vec4::ElementCount];
+            alignas(16) int32_t yi0[Vec4::ElementCount];
+            alignas(16) int32_t zi0[Vec4::ElementCount];
+            Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), byteMask));
+            Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), byteMask));
+            Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), byteMask));
+
+            // There's no gather instruction available on every platform, so the permutation table lookups are done per lane.
+            alignas(16) int32_t aaa[Vec4::ElementCount], aba[Vec4::ElementCount], aab[Vec4::ElementCount], abb[Vec4::ElementCount];
+            alignas(16) int32_t baa[Vec4::ElementCount], bba[Vec4::ElementCount], bab[Vec4::ElementCount], bbb[Vec4::ElementCount];
+            for (int lane = 0; lane < Vec4::ElementCount; ++lane)
+            {
+                const int xi1 = xi0[lane] + 1;
+                const int yi1 = yi0[lane] + 1;
+                const int zi1 = zi0[lane] + 1;
+                aaa[lane] = p[p[p[xi0[lane]] + yi0[lane]] + zi0[lane]];
+                aba[lane] = p[p[p[xi0[lane]] + yi1] + zi0[lane]];
+                aab[lane] = p[p[p[xi0[lane]] + yi0[lane]] + zi1];
+                abb[lane] = p[p[p[xi0[lane]] + yi1] + zi1];
+                baa[lane] = p[p[p[xi1] + yi0[lane]] + zi0[lane]];
+                bba[lane] = p[p[p[xi1] + yi1] + zi0[lane]];
+                bab[lane] = p[p[p[xi1] + yi0[lane]] + zi1];
+                bbb[lane] = p[p[p[xi1] + yi1] + zi1];
+            }
+
+            const Vec4::FloatType u = Fade(xf);
+            const Vec4::FloatType v = Fade(yf);
+            const Vec4::FloatType w = Fade(zf);
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+            Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(aaa), xf, yf, zf), Gradient(Vec4::LoadAligned(baa), xf1, yf, zf), u);
+            Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(aba), xf, yf1, zf), Gradient(Vec4::LoadAligned(bba), xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp(x1, x2, v);
+            x1 = Lerp(Gradient(Vec4::LoadAligned(aab), xf, yf, zf1), Gradient(Vec4::LoadAligned(bab), xf1, yf, zf1), u);
+            x2 = Lerp(Gradient(Vec4::LoadAligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadAligned(bbb), xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+            return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -87,6 +177,56 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency)
+    {
+        using PerlinImprovedNoiseDetails::Vec4;
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+
+        constexpr size_t BatchSize = Vec4::ElementCount;
+        const size_t positionCount = AZStd::min(positions.size(), outValues.size());
+        size_t index = 0;
+        for (; index + BatchSize <= positionCount; index += BatchSize)
+        {
+            const Vec4::FloatType x = Vec4::LoadImmediate(
+                positions[index].GetX(), positions[index + 1].GetX(), positions[index + 2].GetX(), positions[index + 3].GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(
+                positions[index].GetY(), positions[index + 1].GetY(), positions[index + 2].GetY(), positions[index + 3].GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(
+                positions[index].GetZ(), positions[index + 1].GetZ(), positions[index + 2].GetZ(), positions[index + 3].GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            float maxValue = 0.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequency4 = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(x, frequency4), Vec4::Mul(y, frequency4), Vec4::Mul(z, frequency4));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                maxValue += amplitude;
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            if (maxValue <= 0.0f)
+            {
+                AZStd::fill(outValues.begin() + index, outValues.begin() + index + BatchSize, 0.0f);
+            }
+            else
+            {
+                Vec4::StoreUnaligned(&outValues[index], Vec4::Div(total, Vec4::Splat(maxValue)));
+            }
+        }
+
+        for (; index < positionCount; ++index)
+        {
+            outValues[index] = GenerateOctaveNoise(positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
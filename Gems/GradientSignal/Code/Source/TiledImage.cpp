@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/TiledImage.h>
+#include <Atom/RPI.Public/RPIUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        constexpr size_t BatchSize = Vec4::ElementCount;
+
+        constexpr AZ::u32 TileShift = 3;
+        constexpr AZ::u32 TileMask = TiledImage::TileSize - 1;
+        static_assert((1u << TileShift) == TiledImage::TileSize, "TileShift doesn't match the tile size.");
+
+        Vec4::FloatType LoadU(const AZ::Vector3* uvws)
+        {
+            return Vec4::LoadImmediate(uvws[0].GetX(), uvws[1].GetX(), uvws[2].GetX(), uvws[3].GetX());
+        }
+
+        Vec4::FloatType LoadV(const AZ::Vector3* uvws)
+        {
+            return Vec4::LoadImmediate(uvws[0].GetY(), uvws[1].GetY(), uvws[2].GetY(), uvws[3].GetY());
+        }
+
+        //! Computes the four Catmull-Rom weights for the fractional offsets in t.
+        void GetCubicWeights(Vec4::FloatArgType t, Vec4::FloatType weights[4])
+        {
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+            const Vec4::FloatType t2 = Vec4::Mul(t, t);
+            const Vec4::FloatType t3 = Vec4::Mul(t2, t);
+
+            // w0 = -0.5t + t^2 - 0.5t^3
+            weights[0] = Vec4::Sub(Vec4::Sub(t2, Vec4::Mul(half, t)), Vec4::Mul(half, t3));
+            // w1 = 1 - 2.5t^2 + 1.5t^3
+            weights[1] = Vec4::Add(Vec4::Sub(Vec4::Splat(1.0f), Vec4::Mul(Vec4::Splat(2.5f), t2)), Vec4::Mul(Vec4::Splat(1.5f), t3));
+            // w2 = 0.5t + 2t^2 - 1.5t^3
+            weights[2] = Vec4::Sub(Vec4::Add(Vec4::Mul(half, t), Vec4::Mul(Vec4::Splat(2.0f), t2)), Vec4::Mul(Vec4::Splat(1.5f), t3));
+            // w3 = -0.5t^2 + 0.5t^3
+            weights[3] = Vec4::Mul(half, Vec4::Sub(t3, t2));
+        }
+    }
+
+    void TiledImage::Build(AZStd::span<const uint8_t> imageData, const AZ::RHI::ImageDescriptor& imageDescriptor, bool generateMips)
+    {
+        Clear();
+
+        const AZ::u32 width = imageDescriptor.m_size.m_width;
+        const AZ::u32 height = imageDescriptor.m_size.m_height;
+        if (imageData.empty() || (width == 0) || (height == 0))
+        {
+            return;
+        }
+
+        AZ::u32 mipCount = 1;
+        if (generateMips)
+        {
+            for (AZ::u32 size = AZStd::max(width, height); size > 1; size >>= 1)
+            {
+                ++mipCount;
+            }
+        }
+        m_mips.resize(mipCount);
+
+        // Images are stored top row first, so flip them while decoding to make row 0 the bottom row.
+        Mip& baseMip = m_mips[0];
+        ResizeMip(baseMip, width, height);
+        for (AZ::u32 y = 0; y < height; ++y)
+        {
+            for (AZ::u32 x = 0; x < width; ++x)
+            {
+                baseMip.m_pixels[GetPixelIndex(baseMip, x, (height - 1) - y)] =
+                    AZ::RPI::GetImageDataPixelValue<float>(imageData, imageDescriptor, x, y);
+            }
+        }
+
+        // Each mip averages 2x2 pixels of the previous one. Odd sized mips reuse their last row or column.
+        for (AZ::u32 mipIndex = 1; mipIndex < mipCount; ++mipIndex)
+        {
+            const Mip& source = m_mips[mipIndex - 1];
+            Mip& mip = m_mips[mipIndex];
+            ResizeMip(mip, AZStd::max(source.m_width >> 1, 1u), AZStd::max(source.m_height >> 1, 1u));
+
+            for (AZ::u32 y = 0; y < mip.m_height; ++y)
+            {
+                const AZ::u32 y0 = AZStd::min(y * 2, source.m_height - 1);
+                const AZ::u32 y1 = AZStd::min(y * 2 + 1, source.m_height - 1);
+                for (AZ::u32 x = 0; x < mip.m_width; ++x)
+                {
+                    const AZ::u32 x0 = AZStd::min(x * 2, source.m_width - 1);
+                    const AZ::u32 x1 = AZStd::min(x * 2 + 1, source.m_width - 1);
+                    mip.m_pixels[GetPixelIndex(mip, x, y)] = 0.25f *
+                        (source.m_pixels[GetPixelIndex(source, x0, y0)] + source.m_pixels[GetPixelIndex(source, x1, y0)] +
+                         source.m_pixels[GetPixelIndex(source, x0, y1)] + source.m_pixels[GetPixelIndex(source, x1, y1)]);
+                }
+            }
+        }
+    }
+
+    void TiledImage::Clear()
+    {
+        m_mips.clear();
+    }
+
+    bool TiledImage::IsEmpty() const
+    {
+        return m_mips.empty();
+    }
+
+    AZ::u32 TiledImage::GetMipCount() const
+    {
+        return aznumeric_cast<AZ::u32>(m_mips.size());
+    }
+
+    AZ::u32 TiledImage::GetWidth(AZ::u32 mip) const
+    {
+        return (mip < m_mips.size()) ? m_mips[mip].m_width : 0;
+    }
+
+    AZ::u32 TiledImage::GetHeight(AZ::u32 mip) const
+    {
+        return (mip < m_mips.size()) ? m_mips[mip].m_height : 0;
+    }
+
+    float TiledImage::GetPixel(AZ::u32 mip, AZ::u32 x, AZ::u32 y) const
+    {
+        AZ_Assert(mip < m_mips.size(), "Mip %u is out of range.", mip);
+        AZ_Assert((x < m_mips[mip].m_width) && (y < m_mips[mip].m_height), "Pixel (%u, %u) is outside of mip %u.", x, y, mip);
+        return m_mips[mip].m_pixels[GetPixelIndex(m_mips[mip], x, y)];
+    }
+
+    AZ::u32 TiledImage::SelectMip(float pixelsPerLookup) const
+    {
+        // Lookups that are one pixel or less apart read every pixel anyway, so they use the full resolution image.
+        if ((m_mips.size() <= 1) || !(pixelsPerLookup > 1.0f))
+        {
+            return 0;
+        }
+
+        // Each mip halves the resolution, so this picks floor(log2(pixelsPerLookup)).
+        AZ::u32 mip = 0;
+        for (float mipPixelsPerLookup = pixelsPerLookup; (mipPixelsPerLookup >= 2.0f) && (mip + 1 < GetMipCount());
+             mipPixelsPerLookup *= 0.5f)
+        {
+            ++mip;
+        }
+        return mip;
+    }
+
+    float TiledImage::Sample(const AZ::Vector3& uvw, float tilingX, float tilingY, SamplingType samplingType, AZ::u32 mip) const
+    {
+        float value = 0.0f;
+        Sample(AZStd::span<const AZ::Vector3>(&uvw, 1), tilingX, tilingY, samplingType, mip, AZStd::span<float>(&value, 1));
+        return value;
+    }
+
+    void TiledImage::Sample(AZStd::span<const AZ::Vector3> uvws, float tilingX, float tilingY, SamplingType samplingType, AZ::u32 mip,
+        AZStd::span<float> outValues) const
+    {
+        AZ_Assert(uvws.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).", uvws.size(), outValues.size());
+
+        const size_t count = AZStd::min(uvws.size(), outValues.size());
+        if (m_mips.empty())
+        {
+            AZStd::fill(outValues.begin(), outValues.begin() + count, 0.0f);
+            return;
+        }
+
+        const Mip& sampledMip = m_mips[AZStd::min(mip, GetMipCount() - 1)];
+
+        // Tiling extends the size of the image virtually, so a 16x16 image with a tiling of 1.5 maps the 0-1 UV range to 0-24 pixels.
+        const float scaleX = sampledMip.m_width * tilingX;
+        const float scaleY = sampledMip.m_height * tilingY;
+
+        BatchFunction sampleBatch = &SamplePointBatch;
+        switch (samplingType)
+        {
+        case SamplingType::Bilinear:
+            sampleBatch = &SampleBilinearBatch;
+            break;
+        case SamplingType::Bicubic:
+            sampleBatch = &SampleBicubicBatch;
+            break;
+        default:
+            break;
+        }
+
+        alignas(16) float values[BatchSize];
+        size_t index = 0;
+        for (; index + BatchSize <= count; index += BatchSize)
+        {
+            sampleBatch(sampledMip, &uvws[index], scaleX, scaleY, values);
+            AZStd::copy(values, values + BatchSize, outValues.begin() + index);
+        }
+
+        // The leftover positions are padded out to a full batch by repeating the last one.
+        if (index < count)
+        {
+            AZ::Vector3 paddedUvws[BatchSize];
+            for (size_t lane = 0; lane < BatchSize; ++lane)
+            {
+                paddedUvws[lane] = uvws[AZStd::min(index + lane, count - 1)];
+            }
+
+            sampleBatch(sampledMip, paddedUvws, scaleX, scaleY, values);
+            AZStd::copy(values, values + (count - index), outValues.begin() + index);
+        }
+    }
+
+    void TiledImage::ResizeMip(Mip& mip, AZ::u32 width, AZ::u32 height)
+    {
+        mip.m_width = width;
+        mip.m_height = height;
+        mip.m_tilesPerRow = (width + TileSize - 1) / TileSize;
+        const AZ::u32 tilesPerColumn = (height + TileSize - 1) / TileSize;
+        mip.m_pixels.resize(size_t(mip.m_tilesPerRow) * tilesPerColumn * TileSize * TileSize, 0.0f);
+    }
+
+    size_t TiledImage::GetPixelIndex(const Mip& mip, AZ::u32 x, AZ::u32 y)
+    {
+        const size_t tileIndex = size_t(y >> TileShift) * mip.m_tilesPerRow + (x >> TileShift);
+        return (tileIndex * TileSize * TileSize) + ((y & TileMask) << TileShift) + (x & TileMask);
+    }
+
+    AZ::u32 TiledImage::WrapCoordinate(int32_t coordinate, AZ::u32 size)
+    {
+        const int32_t signedSize = aznumeric_cast<int32_t>(size);
+        const int32_t wrapped = coordinate % signedSize;
+        return aznumeric_cast<AZ::u32>((wrapped < 0) ? (wrapped + signedSize) : wrapped);
+    }
+
+    void TiledImage::SamplePointBatch(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues)
+    {
+        // A UV range of 0-1 maps to 0 to the image size inclusive, so on a 4 pixel image [0 - 1/4) is pixel 0,
+        // [1/4 - 1/2) is pixel 1, and so on, and a UV of 1 wraps back around to pixel 0.
+        alignas(16) int32_t pixelX[BatchSize];
+        alignas(16) int32_t pixelY[BatchSize];
+        Vec4::StoreAligned(pixelX, Vec4::ConvertToInt(Vec4::Floor(Vec4::Mul(LoadU(uvws), Vec4::Splat(scaleX)))));
+        Vec4::StoreAligned(pixelY, Vec4::ConvertToInt(Vec4::Floor(Vec4::Mul(LoadV(uvws), Vec4::Splat(scaleY)))));
+
+        for (size_t lane = 0; lane < BatchSize; ++lane)
+        {
+            outValues[lane] =
+                mip.m_pixels[GetPixelIndex(mip, WrapCoordinate(pixelX[lane], mip.m_width), WrapCoordinate(pixelY[lane], mip.m_height))];
+        }
+    }
+
+    void TiledImage::SampleBilinearBatch(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues)
+    {
+        // Pixel values are located at pixel centers, so shift by half a pixel to find the pixels on either side of each lookup.
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType x = Vec4::Sub(Vec4::Mul(LoadU(uvws), Vec4::Splat(scaleX)), half);
+        const Vec4::FloatType y = Vec4::Sub(Vec4::Mul(LoadV(uvws), Vec4::Splat(scaleY)), half);
+        const Vec4::FloatType floorX = Vec4::Floor(x);
+        const Vec4::FloatType floorY = Vec4::Floor(y);
+        const Vec4::FloatType fractionX = Vec4::Sub(x, floorX);
+        const Vec4::FloatType fractionY = Vec4::Sub(y, floorY);
+
+        alignas(16) int32_t pixelX[BatchSize];
+        alignas(16) int32_t pixelY[BatchSize];
+        Vec4::StoreAligned(pixelX, Vec4::ConvertToInt(floorX));
+        Vec4::StoreAligned(pixelY, Vec4::ConvertToInt(floorY));
+
+        // There's no gather, so the pixels are read one lane at a time.
+        alignas(16) float taps[2][2][BatchSize];
+        for (size_t lane = 0; lane < BatchSize; ++lane)
+        {
+            const AZ::u32 x0 = WrapCoordinate(pixelX[lane], mip.m_width);
+            const AZ::u32 y0 = WrapCoordinate(pixelY[lane], mip.m_height);
+            const AZ::u32 x1 = (x0 + 1 == mip.m_width) ? 0 : x0 + 1;
+            const AZ::u32 y1 = (y0 + 1 == mip.m_height) ? 0 : y0 + 1;
+            taps[0][0][lane] = mip.m_pixels[GetPixelIndex(mip, x0, y0)];
+            taps[0][1][lane] = mip.m_pixels[GetPixelIndex(mip, x1, y0)];
+            taps[1][0][lane] = mip.m_pixels[GetPixelIndex(mip, x0, y1)];
+            taps[1][1][lane] = mip.m_pixels[GetPixelIndex(mip, x1, y1)];
+        }
+
+        const Vec4::FloatType bottomLeft = Vec4::LoadAligned(taps[0][0]);
+        const Vec4::FloatType topLeft = Vec4::LoadAligned(taps[1][0]);
+        const Vec4::FloatType bottom = Vec4::Madd(Vec4::Sub(Vec4::LoadAligned(taps[0][1]), bottomLeft), fractionX, bottomLeft);
+        const Vec4::FloatType top = Vec4::Madd(Vec4::Sub(Vec4::LoadAligned(taps[1][1]), topLeft), fractionX, topLeft);
+        Vec4::StoreAligned(outValues, Vec4::Madd(Vec4::Sub(top, bottom), fractionY, bottom));
+    }
+
+    void TiledImage::SampleBicubicBatch(const Mip& mip, const AZ::Vector3* uvws, float scaleX, float scaleY, float* outValues)
+    {
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType x = Vec4::Sub(Vec4::Mul(LoadU(uvws), Vec4::Splat(scaleX)), half);
+        const Vec4::FloatType y = Vec4::Sub(Vec4::Mul(LoadV(uvws), Vec4::Splat(scaleY)), half);
+        const Vec4::FloatType floorX = Vec4::Floor(x);
+        const Vec4::FloatType floorY = Vec4::Floor(y);
+
+        Vec4::FloatType weightsX[4];
+        Vec4::FloatType weightsY[4];
+        GetCubicWeights(Vec4::Sub(x, floorX), weightsX);
+        GetCubicWeights(Vec4::Sub(y, floorY), weightsY);
+
+        alignas(16) int32_t pixelX[BatchSize];
+        alignas(16) int32_t pixelY[BatchSize];
+        Vec4::StoreAligned(pixelX, Vec4::ConvertToInt(floorX));
+        Vec4::StoreAligned(pixelY, Vec4::ConvertToInt(floorY));
+
+        // Read the 4x4 pixels around each lookup, starting one pixel below and to the left of the nearest 2x2 pixels.
+        alignas(16) float taps[4][4][BatchSize];
+        for (size_t lane = 0; lane < BatchSize; ++lane)
+        {
+            AZ::u32 columns[4];
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                columns[column] = WrapCoordinate(pixelX[lane] + column - 1, mip.m_width);
+            }
+
+            for (int32_t row = 0; row < 4; ++row)
+            {
+                const AZ::u32 pixelRow = WrapCoordinate(pixelY[lane] + row - 1, mip.m_height);
+                for (int32_t column = 0; column < 4; ++column)
+                {
+                    taps[row][column][lane] = mip.m_pixels[GetPixelIndex(mip, columns[column], pixelRow)];
+                }
+            }
+        }
+
+        Vec4::FloatType result = Vec4::ZeroFloat();
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            Vec4::FloatType rowValue = Vec4::ZeroFloat();
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                rowValue = Vec4::Madd(Vec4::LoadAligned(taps[row][column]), weightsX[column], rowValue);
+            }
+            result = Vec4::Madd(rowValue, weightsY[row], result);
+        }
+
+        // Catmull-Rom overshoots around sharp edges, so keep the result within the range of the nearest 2x2 pixels.
+        const Vec4::FloatType nearest[4] = { Vec4::LoadAligned(taps[1][1]), Vec4::LoadAligned(taps[1][2]),
+                                             Vec4::LoadAligned(taps[2][1]), Vec4::LoadAligned(taps[2][2]) };
+        const Vec4::FloatType minimum = Vec4::Min(Vec4::Min(nearest[0], nearest[1]), Vec4::Min(nearest[2], nearest[3]));
+        const Vec4::FloatType maximum = Vec4::Max(Vec4::Max(nearest[0], nearest[1]), Vec4::Max(nearest[2], nearest[3]));
+        Vec4::StoreAligned(outValues, Vec4::Clamp(result, minimum, maximum));
+    }
+} // namespace GradientSignal
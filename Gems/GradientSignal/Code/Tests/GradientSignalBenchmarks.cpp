@@ -12,6 +12,7 @@
 #include <Tests/GradientSignalTestHelpers.h>
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -289,6 +290,13 @@ namespace UnitTest
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        // Turn off the surface region cache so that every iteration runs the gradient surface modifiers.
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        if (console)
+        {
+            console->PerformCommand("sd_surfaceRegionCacheEnabled false");
+        }
+
         // Create our benchmark world
         float worldSize = aznumeric_cast<float>(state.range(0));
         AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateBenchmarkEntities(worldSize);
@@ -305,6 +313,11 @@ namespace UnitTest
                 &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, inRegion, stepSize, filterTags, points);
             benchmark::DoNotOptimize(points);
         }
+
+        if (console)
+        {
+            console->PerformCommand("sd_surfaceRegionCacheEnabled true");
+        }
     }
 
     BENCHMARK_DEFINE_F(GradientSurfaceData, BM_GetSurfacePointsFromList)(benchmark::State& state)
@@ -10,6 +10,8 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/Ebuses/ThresholdGradientRequestBus.h>
+#include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
 {
@@ -128,6 +130,73 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
-}
 
+    TEST_F(GradientSignalGetValuesTestsFixture, ModifierChain_VerifyGetValueAndGetValuesMatch)
+    {
+        // Chain every compiled modifier together, so that GetValues runs the whole chain as a single compiled program.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, posterizeEntity->GetId());
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, invertEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
 
+    TEST_F(GradientSignalGetValuesTestsFixture, ModifierChain_GetValuesReflectsChangesAfterCompiling)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, invertEntity->GetId());
+
+        // Reuse the same sampler for every query, so that the program compiled by the first query stays cached.
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = 0.0f; y < TestShapeHalfBounds; y += 1.0f)
+        {
+            for (float x = 0.0f; x < TestShapeHalfBounds; x += 1.0f)
+            {
+                positions.emplace_back(x, y, 0.0f);
+            }
+        }
+
+        auto compareResults = [&gradientSampler, &positions]()
+        {
+            AZStd::vector<float> results(positions.size());
+            gradientSampler.GetValues(positions, results);
+
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                GradientSignal::GradientSampleParams params(positions[index]);
+                ASSERT_NEAR(gradientSampler.GetValue(params), results[index], 0.000001f);
+            }
+        };
+
+        compareResults();
+
+        // Changing a modifier in the chain needs to recompile the program.
+        GradientSignal::ThresholdGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::ThresholdGradientRequestBus::Events::SetThreshold, 0.25f);
+        compareResults();
+
+        // Changing the settings of a nested sampler directly doesn't notify anyone, but needs to recompile the program too.
+        auto thresholdRequests = GradientSignal::ThresholdGradientRequestBus::FindFirstHandler(entity->GetId());
+        ASSERT_NE(thresholdRequests, nullptr);
+        GradientSignal::GradientSampler& nestedSampler = thresholdRequests->GetGradientSampler();
+        nestedSampler.m_invertInput = true;
+        nestedSampler.m_enableLevels = true;
+        nestedSampler.m_inputMin = 0.25f;
+        compareResults();
+
+        // Removing a modifier from the chain needs to recompile the program as well.
+        invertEntity->Deactivate();
+        compareResults();
+
+        // The sampler's own settings aren't compiled, so changing them never needs a recompile.
+        gradientSampler.m_opacity = 0.5f;
+        gradientSampler.m_invertInput = true;
+        compareResults();
+    }
+}
@@ -19,6 +19,7 @@
 
 #include <GradientSignal/Components/ImageGradientComponent.h>
 #include <GradientSignal/Components/GradientTransformComponent.h>
+#include <GradientSignal/TiledImage.h>
 
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 
@@ -418,6 +419,111 @@ namespace UnitTest
             TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
         }
     }
+
+    // Builds a TiledImage from R32_FLOAT pixels, given top row first like the image data in an image asset.
+    static void BuildTiledImage(GradientSignal::TiledImage& image, AZ::u32 width, AZ::u32 height, const AZStd::vector<float>& pixels, bool generateMips)
+    {
+        const auto imageDescriptor =
+            AZ::RHI::ImageDescriptor::Create2D(AZ::RHI::ImageBindFlags::ShaderRead, width, height, AZ::RHI::Format::R32_FLOAT);
+        const AZStd::span<const uint8_t> imageData(reinterpret_cast<const uint8_t*>(pixels.data()), pixels.size() * sizeof(float));
+        image.Build(imageData, imageDescriptor, generateMips);
+    }
+
+    TEST(GradientSignalTiledImageTest, PointSamplingFlipsRowsAndWraps)
+    {
+        // The top row of the image holds 1-3, so it should become the row at V = 1.
+        GradientSignal::TiledImage image;
+        BuildTiledImage(image, 3, 2, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f }, false);
+
+        EXPECT_EQ(image.GetPixel(0, 0, 1), 1.0f);
+        EXPECT_EQ(image.GetPixel(0, 2, 0), 6.0f);
+
+        const float tiling = 1.0f;
+        EXPECT_EQ(image.Sample(AZ::Vector3(0.0f, 0.0f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Point), 4.0f);
+        EXPECT_EQ(image.Sample(AZ::Vector3(0.5f, 0.75f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Point), 2.0f);
+
+        // UVs outside the 0-1 range wrap around in both directions.
+        EXPECT_EQ(image.Sample(AZ::Vector3(1.0f, 1.0f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Point), 4.0f);
+        EXPECT_EQ(image.Sample(AZ::Vector3(-0.1f, -0.1f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Point), 3.0f);
+    }
+
+    TEST(GradientSignalTiledImageTest, BilinearSamplingBlendsNeighboringPixels)
+    {
+        GradientSignal::TiledImage image;
+        BuildTiledImage(image, 2, 2, { 0.0f, 1.0f, 0.0f, 1.0f }, false);
+
+        // Pixel centers return the pixel values, and positions between them blend the pixels on either side.
+        const float tiling = 1.0f;
+        EXPECT_NEAR(image.Sample(AZ::Vector3(0.25f, 0.25f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Bilinear), 0.0f, 0.0001f);
+        EXPECT_NEAR(image.Sample(AZ::Vector3(0.75f, 0.25f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Bilinear), 1.0f, 0.0001f);
+        EXPECT_NEAR(image.Sample(AZ::Vector3(0.5f, 0.25f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Bilinear), 0.5f, 0.0001f);
+        EXPECT_NEAR(image.Sample(AZ::Vector3(0.625f, 0.5f, 0.0f), tiling, tiling, GradientSignal::SamplingType::Bilinear), 0.75f, 0.0001f);
+    }
+
+    TEST(GradientSignalTiledImageTest, BulkSamplingMatchesSingleSamples)
+    {
+        // Use a size that isn't a multiple of the tile size, and a position count that isn't a multiple of the SIMD width.
+        constexpr AZ::u32 Size = 11;
+        AZStd::vector<float> pixels(Size * Size);
+        for (size_t index = 0; index < pixels.size(); ++index)
+        {
+            pixels[index] = static_cast<float>((index * 7) % 13) / 12.0f;
+        }
+
+        GradientSignal::TiledImage image;
+        BuildTiledImage(image, Size, Size, pixels, true);
+
+        AZStd::vector<AZ::Vector3> uvws;
+        for (float v = -0.3f; v < 1.3f; v += 0.07f)
+        {
+            for (float u = -0.3f; u < 1.3f; u += 0.11f)
+            {
+                uvws.emplace_back(u, v, 0.0f);
+            }
+        }
+        uvws.pop_back();
+
+        for (auto samplingType : { GradientSignal::SamplingType::Point, GradientSignal::SamplingType::Bilinear, GradientSignal::SamplingType::Bicubic })
+        {
+            for (AZ::u32 mip = 0; mip < image.GetMipCount(); ++mip)
+            {
+                AZStd::vector<float> values(uvws.size());
+                image.Sample(uvws, 1.5f, 0.75f, samplingType, mip, values);
+                for (size_t index = 0; index < uvws.size(); ++index)
+                {
+                    EXPECT_EQ(values[index], image.Sample(uvws[index], 1.5f, 0.75f, samplingType, mip));
+                    EXPECT_GE(values[index], 0.0f);
+                    EXPECT_LE(values[index], 1.0f);
+                }
+            }
+        }
+    }
+
+    TEST(GradientSignalTiledImageTest, MipsAverageThePixelsTheyCover)
+    {
+        // A 4x4 checkerboard averages out to 0.5 in every mip after the first.
+        AZStd::vector<float> pixels(16);
+        for (AZ::u32 index = 0; index < 16; ++index)
+        {
+            pixels[index] = static_cast<float>(((index % 4) + (index / 4)) % 2);
+        }
+
+        GradientSignal::TiledImage image;
+        BuildTiledImage(image, 4, 4, pixels, true);
+
+        ASSERT_EQ(image.GetMipCount(), 3u);
+        EXPECT_EQ(image.GetWidth(1), 2u);
+        EXPECT_EQ(image.GetHeight(2), 1u);
+        EXPECT_EQ(image.GetPixel(1, 1, 0), 0.5f);
+        EXPECT_EQ(image.GetPixel(2, 0, 0), 0.5f);
+
+        // Lookups spaced N pixels apart use the mip whose pixels are closest to N pixels wide without going over.
+        EXPECT_EQ(image.SelectMip(0.0f), 0u);
+        EXPECT_EQ(image.SelectMip(1.0f), 0u);
+        EXPECT_EQ(image.SelectMip(3.0f), 1u);
+        EXPECT_EQ(image.SelectMip(4.0f), 2u);
+        EXPECT_EQ(image.SelectMip(100.0f), 2u);
+    }
 }
 
 
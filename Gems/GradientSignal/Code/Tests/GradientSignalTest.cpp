@@ -171,6 +171,29 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BulkOctaveNoiseMatchesSingleOctaveNoise)
+    {
+        // The bulk noise generation processes the positions in SIMD batches followed by a scalar remainder,
+        // so use a position count that exercises both, and include negative coordinates and exact integer coordinates.
+        GradientSignal::PerlinImprovedNoise noise(7878);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 23; ++index)
+        {
+            const float value = static_cast<float>(index);
+            positions.emplace_back(value * 0.37f - 3.0f, value * -1.91f + 7.5f, (index % 5 == 0) ? value : value * 0.13f);
+        }
+
+        AZStd::vector<float> bulkValues(positions.size());
+        noise.GenerateOctaveNoise(positions, bulkValues, 4, 3.0f, 1.13f);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float value = noise.GenerateOctaveNoise(positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), 4, 3.0f, 1.13f);
+            EXPECT_NEAR(bulkValues[index], value, 1.0e-5f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
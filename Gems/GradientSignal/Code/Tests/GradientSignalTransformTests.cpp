@@ -279,6 +279,43 @@ namespace UnitTest
             TestGradientTransform(setup, test);
         }
     }
-}
 
+    TEST_F(GradientSignalTransformTestsFixture, BulkTransformMatchesSingleTransform)
+    {
+        // The bulk transform processes the positions in SIMD batches followed by a scalar remainder, so use a position
+        // count that exercises both, with positions inside and outside the shape bounds, for every wrapping type.
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 11; ++index)
+        {
+            const float value = static_cast<float>(index);
+            positions.emplace_back(100.0f + value * 1.7f - 9.0f, 200.0f - value * 2.3f + 8.0f, 300.0f + value * 4.1f - 21.0f);
+        }
+
+        const AZ::Aabb shapeBounds = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(5.0f, 10.0f, 20.0f));
+        const AZ::Matrix3x4 transform = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.3f), AZ::Vector3(100.0f, 200.0f, 300.0f));
 
+        for (auto wrappingType : { GradientSignal::WrappingType::None, GradientSignal::WrappingType::ClampToEdge,
+                                   GradientSignal::WrappingType::Mirror, GradientSignal::WrappingType::Repeat,
+                                   GradientSignal::WrappingType::ClampToZero })
+        {
+            for (bool use3d : { true, false })
+            {
+                GradientSignal::GradientTransform gradientTransform(shapeBounds, transform, use3d, 1.5f, wrappingType);
+
+                AZStd::vector<AZ::Vector3> bulkUVWs(positions.size());
+                AZStd::vector<bool> bulkRejections(positions.size());
+                gradientTransform.TransformPositionsToUVW(positions, bulkUVWs, bulkRejections);
+
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    AZ::Vector3 outUVW;
+                    bool wasPointRejected;
+                    gradientTransform.TransformPositionToUVW(positions[index], outUVW, wasPointRejected);
+                    EXPECT_THAT(bulkUVWs[index], IsClose(outUVW));
+                    EXPECT_EQ(bulkRejections[index], wasPointRejected);
+                }
+            }
+        }
+    }
+}
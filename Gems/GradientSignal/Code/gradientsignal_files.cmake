@@ -8,7 +8,9 @@
 
 set(FILES
     Include/GradientSignal/GradientSampler.h
+    Include/GradientSignal/GradientProgram.h
     Include/GradientSignal/GradientTransform.h
+    Include/GradientSignal/TiledImage.h
     Include/GradientSignal/SmoothStep.h
     Include/GradientSignal/ImageAsset.h
     Include/GradientSignal/ImageSettings.h
@@ -76,9 +78,11 @@ set(FILES
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
     Source/GradientSampler.cpp
+    Source/GradientProgram.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
     Source/GradientTransform.cpp
+    Source/TiledImage.cpp
     Source/SmoothStep.cpp
     Source/ImageAsset.cpp
     Source/ImageSettings.cpp
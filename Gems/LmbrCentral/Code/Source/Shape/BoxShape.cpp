@@ -20,6 +20,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeSimdUtil.h>
 #include <random>
 
 namespace LmbrCentral
@@ -146,6 +147,104 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            const Points4 min = Splat(aabb.GetMin());
+            const Points4 max = Splat(aabb.GetMax());
+            ProcessPoints(points, results,
+                [&min, &max](const Points4& p)
+                {
+                    const FloatType insideX = Vec4::And(Vec4::CmpGtEq(p.m_x, min.m_x), Vec4::CmpLtEq(p.m_x, max.m_x));
+                    const FloatType insideY = Vec4::And(Vec4::CmpGtEq(p.m_y, min.m_y), Vec4::CmpLtEq(p.m_y, max.m_y));
+                    const FloatType insideZ = Vec4::And(Vec4::CmpGtEq(p.m_z, min.m_z), Vec4::CmpLtEq(p.m_z, max.m_z));
+                    return Vec4::And(insideX, Vec4::And(insideY, insideZ));
+                },
+                [&aabb](const AZ::Vector3& point)
+                {
+                    return aabb.Contains(point);
+                });
+            return;
+        }
+
+        // Project each point onto the box axes, then compare against the half lengths, matching Obb::Contains.
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const Points4 position = Splat(obb.GetPosition());
+        const Points4 axisX = Splat(obb.GetAxisX());
+        const Points4 axisY = Splat(obb.GetAxisY());
+        const Points4 axisZ = Splat(obb.GetAxisZ());
+        const Points4 halfLengths = Splat(obb.GetHalfLengths());
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 offset = Sub(p, position);
+                const FloatType localX = Vec4::Abs(Dot(offset, axisX));
+                const FloatType localY = Vec4::Abs(Dot(offset, axisY));
+                const FloatType localZ = Vec4::Abs(Dot(offset, axisZ));
+                return Vec4::And(Vec4::CmpLtEq(localX, halfLengths.m_x),
+                    Vec4::And(Vec4::CmpLtEq(localY, halfLengths.m_y), Vec4::CmpLtEq(localZ, halfLengths.m_z)));
+            },
+            [&obb](const AZ::Vector3& point)
+            {
+                return obb.Contains(point);
+            });
+    }
+
+    void BoxShape::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            const Points4 min = Splat(aabb.GetMin());
+            const Points4 max = Splat(aabb.GetMax());
+            ProcessPoints(points, results,
+                [&min, &max](const Points4& p)
+                {
+                    const Points4 closest = {
+                        Vec4::Clamp(p.m_x, min.m_x, max.m_x), Vec4::Clamp(p.m_y, min.m_y, max.m_y), Vec4::Clamp(p.m_z, min.m_z, max.m_z) };
+                    return LengthSq(Sub(p, closest));
+                },
+                [&aabb](const AZ::Vector3& point)
+                {
+                    return aabb.GetDistanceSq(point);
+                });
+            return;
+        }
+
+        // The distance to the box is the length of the part of the local offset that exceeds the half lengths.
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const Points4 position = Splat(obb.GetPosition());
+        const Points4 axisX = Splat(obb.GetAxisX());
+        const Points4 axisY = Splat(obb.GetAxisY());
+        const Points4 axisZ = Splat(obb.GetAxisZ());
+        const Points4 halfLengths = Splat(obb.GetHalfLengths());
+        const FloatType zero = Vec4::ZeroFloat();
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 offset = Sub(p, position);
+                const Points4 excess = {
+                    Vec4::Max(Vec4::Sub(Vec4::Abs(Dot(offset, axisX)), halfLengths.m_x), zero),
+                    Vec4::Max(Vec4::Sub(Vec4::Abs(Dot(offset, axisY)), halfLengths.m_y), zero),
+                    Vec4::Max(Vec4::Sub(Vec4::Abs(Dot(offset, axisZ)), halfLengths.m_z), zero) };
+                return LengthSq(excess);
+            },
+            [&obb](const AZ::Vector3& point)
+            {
+                return obb.GetDistanceSq(point);
+            });
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
@@ -15,6 +15,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <CryCommon/Cry_GeoDistance.h>
 #include <MathConversion.h>
+#include <Shape/ShapeSimdUtil.h>
 
 namespace LmbrCentral
 {
@@ -175,6 +176,84 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void CapsuleShape::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        // Same tests as IsPointInside: the end cap spheres, then the internal cylinder.
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        const float axisLengthSquared = powf(m_intersectionDataCache.m_internalHeight, 2.0f);
+        const bool isSphere = m_intersectionDataCache.m_isSphere;
+        const bool hasCylinderVolume = axisLengthSquared > 0.0f && radiusSquared > 0.0f;
+
+        const Points4 base = Splat(m_intersectionDataCache.m_basePlaneCenterPoint);
+        const Points4 top = Splat(m_intersectionDataCache.m_topPlaneCenterPoint);
+        const Points4 axis = Splat(m_intersectionDataCache.m_axisVector);
+        const FloatType radiusSquared4 = Vec4::Splat(radiusSquared);
+        const FloatType axisLengthSquared4 = Vec4::Splat(axisLengthSquared);
+        const FloatType zero = Vec4::ZeroFloat();
+
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 baseToPoint = Sub(p, base);
+                FloatType inside = Vec4::CmpLt(LengthSq(baseToPoint), radiusSquared4);
+                if (isSphere)
+                {
+                    return inside;
+                }
+
+                inside = Vec4::Or(inside, Vec4::CmpLt(LengthSq(Sub(p, top)), radiusSquared4));
+                if (hasCylinderVolume)
+                {
+                    const FloatType dot = Dot(baseToPoint, axis);
+                    const FloatType withinCaps = Vec4::And(Vec4::CmpGtEq(dot, zero), Vec4::CmpLtEq(dot, axisLengthSquared4));
+                    const FloatType distanceSquared = Vec4::Sub(LengthSq(baseToPoint), Vec4::Div(Vec4::Mul(dot, dot), axisLengthSquared4));
+                    inside = Vec4::Or(inside, Vec4::And(withinCaps, Vec4::CmpLtEq(distanceSquared, radiusSquared4)));
+                }
+                return inside;
+            },
+            [this](const AZ::Vector3& point)
+            {
+                return IsPointInside(point);
+            });
+    }
+
+    void CapsuleShape::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        // Distance from the closest point on the segment between the end cap centers, minus the radius.
+        const AZ::Vector3 segment = m_intersectionDataCache.m_topPlaneCenterPoint - m_intersectionDataCache.m_basePlaneCenterPoint;
+        const float segmentLengthSquared = segment.GetLengthSq();
+        const float inverseSegmentLengthSquared = (segmentLengthSquared > 0.0f) ? (1.0f / segmentLengthSquared) : 0.0f;
+
+        const Points4 base = Splat(m_intersectionDataCache.m_basePlaneCenterPoint);
+        const Points4 segment4 = Splat(segment);
+        const FloatType inverseSegmentLengthSquared4 = Vec4::Splat(inverseSegmentLengthSquared);
+        const FloatType radius4 = Vec4::Splat(m_intersectionDataCache.m_radius);
+        const FloatType zero = Vec4::ZeroFloat();
+        const FloatType one = Vec4::Splat(1.0f);
+
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 baseToPoint = Sub(p, base);
+                const FloatType t = Vec4::Clamp(Vec4::Mul(Dot(baseToPoint, segment4), inverseSegmentLengthSquared4), zero, one);
+                const FloatType distance = Vec4::Sub(Vec4::Sqrt(LengthSq(Sub(baseToPoint, Mul(segment4, t)))), radius4);
+                const FloatType clampedDistance = Vec4::Max(distance, zero);
+                return Vec4::Mul(clampedDistance, clampedDistance);
+            },
+            [this](const AZ::Vector3& point)
+            {
+                return DistanceSquaredFromPoint(point);
+            });
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
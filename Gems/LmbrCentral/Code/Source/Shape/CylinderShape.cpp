@@ -18,6 +18,7 @@
 #include <AzCore/Math/Sfmt.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeSimdUtil.h>
 
 #include "Cry_GeoDistance.h"
 #include <random>
@@ -249,6 +250,103 @@ namespace LmbrCentral
             m_intersectionDataCache.m_radius);
     }
 
+    void CylinderShape::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const float axisLengthSquared = powf(m_intersectionDataCache.m_height, 2.0f);
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+
+        // If the cylinder shape has no volume then no point can be inside, same as AZ::Intersect::PointCylinder.
+        if (axisLengthSquared <= 0.0f || radiusSquared <= 0.0f)
+        {
+            AZStd::fill(results.begin(), results.end(), false);
+            return;
+        }
+
+        const Points4 base = Splat(m_intersectionDataCache.m_baseCenterPoint);
+        const Points4 axis = Splat(m_intersectionDataCache.m_axisVector);
+        const FloatType axisLengthSquared4 = Vec4::Splat(axisLengthSquared);
+        const FloatType radiusSquared4 = Vec4::Splat(radiusSquared);
+        const FloatType zero = Vec4::ZeroFloat();
+
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 baseToPoint = Sub(p, base);
+                const FloatType dot = Dot(baseToPoint, axis);
+                const FloatType withinCaps = Vec4::And(Vec4::CmpGtEq(dot, zero), Vec4::CmpLtEq(dot, axisLengthSquared4));
+                const FloatType distanceSquared = Vec4::Sub(LengthSq(baseToPoint), Vec4::Div(Vec4::Mul(dot, dot), axisLengthSquared4));
+                return Vec4::And(withinCaps, Vec4::CmpLtEq(distanceSquared, radiusSquared4));
+            },
+            [this](const AZ::Vector3& point)
+            {
+                return IsPointInside(point);
+            });
+    }
+
+    void CylinderShape::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
+        {
+            const Points4 base = Splat(m_intersectionDataCache.m_baseCenterPoint);
+            ProcessPoints(points, results,
+                [&base](const Points4& p)
+                {
+                    return LengthSq(Sub(base, p));
+                },
+                [this](const AZ::Vector3& point)
+                {
+                    return DistanceSquaredFromPoint(point);
+                });
+            return;
+        }
+
+        // Vectorized version of Distance::Point_CylinderSq, which splits the space around the cylinder center
+        // into the inside, the side, the end caps and the cap edges.
+        const AZ::Vector3& axisVector = m_intersectionDataCache.m_axisVector;
+        const float halfLength = axisVector.GetLength() * 0.5f;
+        const float radius = m_intersectionDataCache.m_radius;
+
+        const Points4 center = Splat(m_intersectionDataCache.m_baseCenterPoint + axisVector * 0.5f);
+        const Points4 axisUnit = Splat(axisVector.GetNormalized());
+        const FloatType halfLength4 = Vec4::Splat(halfLength);
+        const FloatType radius4 = Vec4::Splat(radius);
+        const FloatType radiusSquared4 = Vec4::Splat(radius * radius);
+        const FloatType zero = Vec4::ZeroFloat();
+
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 centerToPoint = Sub(p, center);
+                const FloatType axialDistance = Vec4::Abs(Dot(centerToPoint, axisUnit));
+                const FloatType radialDistanceSquared = Vec4::Sub(LengthSq(centerToPoint), Vec4::Mul(axialDistance, axialDistance));
+
+                const FloatType radialExcess = Vec4::Sub(Vec4::Sqrt(Vec4::Max(radialDistanceSquared, zero)), radius4);
+                const FloatType radialExcessSquared = Vec4::Mul(radialExcess, radialExcess);
+                const FloatType axialExcess = Vec4::Sub(axialDistance, halfLength4);
+                const FloatType axialExcessSquared = Vec4::Mul(axialExcess, axialExcess);
+
+                const FloatType betweenCaps = Vec4::CmpLt(axialDistance, halfLength4);
+                const FloatType outsideRadius = Vec4::CmpGt(radialDistanceSquared, radiusSquared4);
+                const FloatType withinRadius = Vec4::CmpLt(radialDistanceSquared, radiusSquared4);
+
+                const FloatType sideDistance = Vec4::And(outsideRadius, radialExcessSquared);
+                const FloatType capDistance = Vec4::Select(axialExcessSquared, Vec4::Add(radialExcessSquared, axialExcessSquared), withinRadius);
+                return Vec4::Select(sideDistance, capDistance, betweenCaps);
+            },
+            [this](const AZ::Vector3& point)
+            {
+                return DistanceSquaredFromPoint(point);
+            });
+    }
+
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
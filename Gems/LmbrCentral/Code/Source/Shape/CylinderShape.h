@@ -45,6 +45,8 @@ namespace LmbrCentral
         AZ::Crc32 GetShapeType() override { return AZ_CRC("Cylinder", 0x9b045bea); }
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) override;
+        void DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) override;
         AZ::Aabb GetEncompassingAabb() override;
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) override;
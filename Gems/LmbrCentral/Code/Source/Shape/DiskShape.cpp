@@ -16,6 +16,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <LmbrCentral/Shape/DiskShapeComponentBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeSimdUtil.h>
 
 namespace LmbrCentral
 {
@@ -148,6 +149,43 @@ namespace LmbrCentral
         return closestPoint.GetDistanceSq(point);
     }
 
+    void DiskShape::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        AZ_Assert(points.size() == results.size(), "Point and result lists are different sizes (%zu vs %zu).", points.size(), results.size());
+        AZStd::fill(results.begin(), results.end(), false); // 2D object cannot have points that are strictly inside in 3d space.
+    }
+
+    void DiskShape::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_diskShapeConfig);
+
+        // Project each point onto the plane of the disk, then pull the projected point back onto the disk if it's past the radius.
+        const float radius = m_intersectionDataCache.m_radius;
+        const Points4 center = Splat(m_currentTransform.GetTranslation());
+        const Points4 normal = Splat(m_intersectionDataCache.m_normal);
+        const FloatType radius4 = Vec4::Splat(radius);
+        const FloatType radiusSquared4 = Vec4::Splat(radius * radius);
+
+        ProcessPoints(points, results,
+            [&](const Points4& p)
+            {
+                const Points4 centerToPoint = Sub(p, center);
+                const Points4 centerToProjectedPoint = Sub(centerToPoint, Mul(normal, Dot(centerToPoint, normal)));
+                const FloatType projectedLengthSquared = LengthSq(centerToProjectedPoint);
+
+                const FloatType scale = Vec4::Select(
+                    Vec4::Mul(radius4, Vec4::SqrtInv(projectedLengthSquared)), Vec4::Splat(1.0f),
+                    Vec4::CmpGt(projectedLengthSquared, radiusSquared4));
+                return LengthSq(Sub(centerToPoint, Mul(centerToProjectedPoint, scale)));
+            },
+            [this](const AZ::Vector3& point)
+            {
+                return DistanceSquaredFromPoint(point);
+            });
+    }
+
     bool DiskShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_diskShapeConfig);
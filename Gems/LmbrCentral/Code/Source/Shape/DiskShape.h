@@ -43,6 +43,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point)  override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) override;
+        void DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
         // DiskShapeComponentRequestBus
@@ -18,6 +18,7 @@
 #include <MathConversion.h>
 #include <Shape/ShapeGeometryUtil.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeSimdUtil.h>
 #include <ISystem.h>
 #include <IRenderAuxGeom.h>
 
@@ -374,6 +375,52 @@ namespace LmbrCentral
         return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);;
     }
 
+    void PolygonPrismShape::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        // The aabb rejection test is done four points at a time, the crossings test only runs for the points inside the aabb.
+        const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+        const Points4 aabbMin = Splat(aabb.GetMin());
+        const Points4 aabbMax = Splat(aabb.GetMax());
+        ProcessPoints(points, results,
+            [&aabbMin, &aabbMax](const Points4& p)
+            {
+                return Vec4::And(
+                    Vec4::And(
+                        Vec4::And(Vec4::CmpGtEq(p.m_x, aabbMin.m_x), Vec4::CmpLtEq(p.m_x, aabbMax.m_x)),
+                        Vec4::And(Vec4::CmpGtEq(p.m_y, aabbMin.m_y), Vec4::CmpLtEq(p.m_y, aabbMax.m_y))),
+                    Vec4::And(Vec4::CmpGtEq(p.m_z, aabbMin.m_z), Vec4::CmpLtEq(p.m_z, aabbMax.m_z)));
+            },
+            [&aabb](const AZ::Vector3& point)
+            {
+                return aabb.Contains(point);
+            });
+
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            if (results[index])
+            {
+                results[index] = PolygonPrismUtil::IsPointInside(*m_polygonPrism, points[index], m_currentTransform);
+            }
+        }
+    }
+
+    void PolygonPrismShape::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        AZ_Assert(points.size() == results.size(), "Point and result lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        const size_t pointCount = AZStd::min(points.size(), results.size());
+        for (size_t index = 0; index < pointCount; ++index)
+        {
+            results[index] = PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
@@ -275,6 +275,32 @@ namespace LmbrCentral
         return result;
     }
 
+    void ReferenceShapeComponent::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        AZStd::fill(results.begin(), results.end(), false);
+
+        AZ_WarningOnce("Shape", !m_isRequestInProgress, "Detected cyclic dependencies with shape entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointsInside, points, results);
+            m_isRequestInProgress = false;
+        }
+    }
+
+    void ReferenceShapeComponent::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        AZStd::fill(results.begin(), results.end(), FLT_MAX);
+
+        AZ_WarningOnce("Shape", !m_isRequestInProgress, "Detected cyclic dependencies with shape entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistancesSquaredFromPoints, points, results);
+            m_isRequestInProgress = false;
+        }
+    }
+
     AZ::Vector3 ReferenceShapeComponent::GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution)
     {
         AZ::Vector3 result = AZ::Vector3::CreateZero();
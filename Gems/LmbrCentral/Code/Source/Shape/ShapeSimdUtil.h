@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+
+namespace LmbrCentral
+{
+    /// Helpers for the batched shape queries (IsPointsInside/DistancesSquaredFromPoints).
+    /// Points are processed four at a time, with one SIMD register per component (x, y, z) so that
+    /// each lane holds one point, and the remaining points are processed one by one.
+    namespace ShapeSimdUtil
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using FloatType = AZ::Simd::Vec4::FloatType;
+        using FloatArgType = AZ::Simd::Vec4::FloatArgType;
+
+        /// Number of points processed by each SIMD iteration.
+        static constexpr size_t PointsPerBatch = Vec4::ElementCount;
+
+        /// The components of four points (or of one point splatted to all lanes).
+        struct Points4
+        {
+            FloatType m_x;
+            FloatType m_y;
+            FloatType m_z;
+        };
+
+        /// Loads four consecutive points and transposes them so that each register holds one component.
+        inline Points4 LoadPoints(const AZ::Vector3* points)
+        {
+            const FloatType rows[4] = {
+                Vec4::FromVec3(points[0].GetSimdValue()),
+                Vec4::FromVec3(points[1].GetSimdValue()),
+                Vec4::FromVec3(points[2].GetSimdValue()),
+                Vec4::FromVec3(points[3].GetSimdValue())
+            };
+            FloatType columns[4];
+            Vec4::Mat4x4Transpose(rows, columns);
+            return { columns[0], columns[1], columns[2] };
+        }
+
+        /// Replicates a single point (or vector) in all four lanes.
+        inline Points4 Splat(const AZ::Vector3& value)
+        {
+            return { Vec4::Splat(value.GetX()), Vec4::Splat(value.GetY()), Vec4::Splat(value.GetZ()) };
+        }
+
+        inline Points4 Sub(const Points4& lhs, const Points4& rhs)
+        {
+            return { Vec4::Sub(lhs.m_x, rhs.m_x), Vec4::Sub(lhs.m_y, rhs.m_y), Vec4::Sub(lhs.m_z, rhs.m_z) };
+        }
+
+        inline Points4 Add(const Points4& lhs, const Points4& rhs)
+        {
+            return { Vec4::Add(lhs.m_x, rhs.m_x), Vec4::Add(lhs.m_y, rhs.m_y), Vec4::Add(lhs.m_z, rhs.m_z) };
+        }
+
+        inline Points4 Mul(const Points4& lhs, FloatArgType rhs)
+        {
+            return { Vec4::Mul(lhs.m_x, rhs), Vec4::Mul(lhs.m_y, rhs), Vec4::Mul(lhs.m_z, rhs) };
+        }
+
+        inline FloatType Dot(const Points4& lhs, const Points4& rhs)
+        {
+            return Vec4::Madd(lhs.m_x, rhs.m_x, Vec4::Madd(lhs.m_y, rhs.m_y, Vec4::Mul(lhs.m_z, rhs.m_z)));
+        }
+
+        inline FloatType LengthSq(const Points4& value)
+        {
+            return Dot(value, value);
+        }
+
+        inline void StoreResults(FloatArgType mask, bool* results)
+        {
+            alignas(16) int32_t lanes[PointsPerBatch];
+            Vec4::StoreAligned(lanes, Vec4::CastToInt(mask));
+            for (size_t lane = 0; lane < PointsPerBatch; ++lane)
+            {
+                results[lane] = lanes[lane] != 0;
+            }
+        }
+
+        inline void StoreResults(FloatArgType values, float* results)
+        {
+            Vec4::StoreUnaligned(results, values);
+        }
+
+        /// Runs simdFunction (Points4 -> FloatType mask or value) over the points four at a time, and
+        /// scalarFunction (Vector3 -> ResultType) over the remaining points.
+        template<typename ResultType, typename SimdFunction, typename ScalarFunction>
+        void ProcessPoints(
+            AZStd::span<const AZ::Vector3> points, AZStd::span<ResultType> results,
+            SimdFunction&& simdFunction, ScalarFunction&& scalarFunction)
+        {
+            AZ_Assert(points.size() == results.size(), "Point and result lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+            const size_t pointCount = AZStd::min(points.size(), results.size());
+            size_t index = 0;
+            for (; index + PointsPerBatch <= pointCount; index += PointsPerBatch)
+            {
+                StoreResults(simdFunction(LoadPoints(&points[index])), &results[index]);
+            }
+            for (; index < pointCount; ++index)
+            {
+                results[index] = scalarFunction(points[index]);
+            }
+        }
+    } // namespace ShapeSimdUtil
+} // namespace LmbrCentral
@@ -15,6 +15,7 @@
 #include <AzCore/Math/IntersectSegment.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeSimdUtil.h>
 
 namespace LmbrCentral
 {
@@ -118,6 +119,50 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void SphereShape::IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        const AZ::Vector3& position = m_intersectionDataCache.m_position;
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        const Points4 center = Splat(position);
+        const FloatType radiusSquared4 = Vec4::Splat(radiusSquared);
+        ProcessPoints(points, results,
+            [&center, &radiusSquared4](const Points4& p)
+            {
+                return Vec4::CmpLt(LengthSq(Sub(p, center)), radiusSquared4);
+            },
+            [&position, radiusSquared](const AZ::Vector3& point)
+            {
+                return AZ::Intersect::PointSphere(position, radiusSquared, point);
+            });
+    }
+
+    void SphereShape::DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+    {
+        using namespace ShapeSimdUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        const AZ::Vector3& position = m_intersectionDataCache.m_position;
+        const float radius = m_intersectionDataCache.m_radius;
+        const Points4 center = Splat(position);
+        const FloatType radius4 = Vec4::Splat(radius);
+        const FloatType zero = Vec4::ZeroFloat();
+        ProcessPoints(points, results,
+            [&center, &radius4, &zero](const Points4& p)
+            {
+                const FloatType distance = Vec4::Max(Vec4::Sub(Vec4::Sqrt(LengthSq(Sub(p, center))), radius4), zero);
+                return Vec4::Mul(distance, distance);
+            },
+            [&position, radius](const AZ::Vector3& point)
+            {
+                return powf(AZStd::max(position.GetDistance(point) - radius, 0.0f), 2.0f);
+            });
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <LmbrCentral/Shape/DiskShapeComponentBus.h>
+#include <LmbrCentral/Shape/SphereShapeComponentBus.h>
+#include <Shape/BoxShapeComponent.h>
+#include <Shape/CapsuleShapeComponent.h>
+#include <Shape/CylinderShapeComponent.h>
+#include <Shape/DiskShapeComponent.h>
+#include <Shape/PolygonPrismShapeComponent.h>
+#include <Shape/SphereShapeComponent.h>
+
+namespace UnitTest
+{
+    // Verifies that the batched shape queries (IsPointsInside/DistancesSquaredFromPoints) give the same results
+    // as the per-point queries, for both the points processed in SIMD batches and the remaining points.
+    class ShapeBatchQueryTest
+        : public AllocatorsFixture
+    {
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<AZStd::unique_ptr<AZ::ComponentDescriptor>> m_componentDescriptors;
+
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+
+            m_componentDescriptors.emplace_back(AzFramework::TransformComponent::CreateDescriptor());
+            m_componentDescriptors.emplace_back(LmbrCentral::BoxShapeComponent::CreateDescriptor());
+            m_componentDescriptors.emplace_back(LmbrCentral::CapsuleShapeComponent::CreateDescriptor());
+            m_componentDescriptors.emplace_back(LmbrCentral::CylinderShapeComponent::CreateDescriptor());
+            m_componentDescriptors.emplace_back(LmbrCentral::DiskShapeComponent::CreateDescriptor());
+            m_componentDescriptors.emplace_back(LmbrCentral::PolygonPrismShapeComponent::CreateDescriptor());
+            m_componentDescriptors.emplace_back(LmbrCentral::SphereShapeComponent::CreateDescriptor());
+            for (auto& descriptor : m_componentDescriptors)
+            {
+                descriptor->Reflect(&(*m_serializeContext));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_componentDescriptors.clear();
+            m_serializeContext.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+    protected:
+        template<typename ShapeComponentType>
+        void CreateShapeEntity(const AZ::Transform& transform, AZ::Entity& entity)
+        {
+            entity.CreateComponent<ShapeComponentType>();
+            entity.CreateComponent<AzFramework::TransformComponent>();
+
+            entity.Init();
+            entity.Activate();
+
+            AZ::TransformBus::Event(entity.GetId(), &AZ::TransformBus::Events::SetWorldTM, transform);
+        }
+
+        // Queries a grid of points around the center, with a point count that isn't a multiple of the SIMD batch size.
+        void ExpectBatchMatchesPerPointQueries(const AZ::Entity& entity, const AZ::Vector3& center, float extent)
+        {
+            AZStd::vector<AZ::Vector3> points;
+            constexpr int StepCount = 7;
+            for (int z = 0; z < StepCount; ++z)
+            {
+                for (int y = 0; y < StepCount; ++y)
+                {
+                    for (int x = 0; x < StepCount; ++x)
+                    {
+                        const AZ::Vector3 offset = AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), aznumeric_cast<float>(z)) *
+                            (2.0f * extent / (StepCount - 1)) - AZ::Vector3(extent);
+                        points.push_back(center + offset);
+                    }
+                }
+            }
+
+            AZStd::vector<bool> batchInside(points.size());
+            AZStd::vector<float> batchDistances(points.size());
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entity.GetId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointsInside, points, batchInside);
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entity.GetId(), &LmbrCentral::ShapeComponentRequestsBus::Events::DistancesSquaredFromPoints, points, batchDistances);
+
+            size_t insideCount = 0;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                bool inside = false;
+                float distanceSquared = 0.0f;
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    inside, entity.GetId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, points[index]);
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    distanceSquared, entity.GetId(), &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPoint, points[index]);
+
+                EXPECT_EQ(batchInside[index], inside) << "Point " << index;
+                EXPECT_NEAR(batchDistances[index], distanceSquared, AZ::GetMax(distanceSquared, 1.0f) * 1e-4f) << "Point " << index;
+                insideCount += inside ? 1 : 0;
+            }
+
+            // Make sure the grid covers both sides of the shape boundary.
+            EXPECT_LT(insideCount, points.size());
+        }
+    };
+
+    TEST_F(ShapeBatchQueryTest, AxisAlignedBoxBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(5.0f, -3.0f, 2.0f);
+        CreateShapeEntity<LmbrCentral::BoxShapeComponent>(AZ::Transform::CreateTranslation(center), entity);
+        LmbrCentral::BoxShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, AZ::Vector3(2.0f, 3.0f, 4.0f));
+
+        ExpectBatchMatchesPerPointQueries(entity, center, 3.0f);
+    }
+
+    TEST_F(ShapeBatchQueryTest, RotatedBoxBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(5.0f, -3.0f, 2.0f);
+        CreateShapeEntity<LmbrCentral::BoxShapeComponent>(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.6f) * AZ::Quaternion::CreateRotationX(0.3f), center),
+            entity);
+        LmbrCentral::BoxShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, AZ::Vector3(2.0f, 3.0f, 4.0f));
+
+        ExpectBatchMatchesPerPointQueries(entity, center, 3.0f);
+    }
+
+    TEST_F(ShapeBatchQueryTest, SphereBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(-2.0f, 4.0f, 1.0f);
+        CreateShapeEntity<LmbrCentral::SphereShapeComponent>(AZ::Transform::CreateTranslation(center), entity);
+        LmbrCentral::SphereShapeComponentRequestsBus::Event(entity.GetId(), &LmbrCentral::SphereShapeComponentRequests::SetRadius, 1.5f);
+
+        ExpectBatchMatchesPerPointQueries(entity, center, 2.5f);
+    }
+
+    TEST_F(ShapeBatchQueryTest, CapsuleBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(1.0f, 2.0f, 3.0f);
+        CreateShapeEntity<LmbrCentral::CapsuleShapeComponent>(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationY(0.8f), center), entity);
+        LmbrCentral::CapsuleShapeComponentRequestsBus::Event(entity.GetId(), &LmbrCentral::CapsuleShapeComponentRequestsBus::Events::SetHeight, 4.0f);
+        LmbrCentral::CapsuleShapeComponentRequestsBus::Event(entity.GetId(), &LmbrCentral::CapsuleShapeComponentRequestsBus::Events::SetRadius, 1.0f);
+
+        ExpectBatchMatchesPerPointQueries(entity, center, 3.0f);
+    }
+
+    TEST_F(ShapeBatchQueryTest, CylinderBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(1.0f, 2.0f, 3.0f);
+        CreateShapeEntity<LmbrCentral::CylinderShapeComponent>(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationX(0.5f), center), entity);
+        LmbrCentral::CylinderShapeComponentRequestsBus::Event(entity.GetId(), &LmbrCentral::CylinderShapeComponentRequestsBus::Events::SetHeight, 3.0f);
+        LmbrCentral::CylinderShapeComponentRequestsBus::Event(entity.GetId(), &LmbrCentral::CylinderShapeComponentRequestsBus::Events::SetRadius, 1.5f);
+
+        ExpectBatchMatchesPerPointQueries(entity, center, 3.0f);
+    }
+
+    TEST_F(ShapeBatchQueryTest, DiskBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(-1.0f, 0.5f, 2.0f);
+        CreateShapeEntity<LmbrCentral::DiskShapeComponent>(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationY(0.4f), center), entity);
+        LmbrCentral::DiskShapeComponentRequestBus::Event(entity.GetId(), &LmbrCentral::DiskShapeComponentRequests::SetRadius, 2.0f);
+
+        ExpectBatchMatchesPerPointQueries(entity, center, 3.0f);
+    }
+
+    TEST_F(ShapeBatchQueryTest, PolygonPrismBatchQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Vector3 center(2.0f, 2.0f, 0.0f);
+        CreateShapeEntity<LmbrCentral::PolygonPrismShapeComponent>(AZ::Transform::CreateTranslation(center), entity);
+        LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(entity.GetId(), &LmbrCentral::PolygonPrismShapeComponentRequests::SetHeight, 2.0f);
+        LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(
+            entity.GetId(), &LmbrCentral::PolygonPrismShapeComponentRequests::SetVertices,
+            AZStd::vector<AZ::Vector2>{ AZ::Vector2(-2.0f, -2.0f), AZ::Vector2(2.0f, -2.0f), AZ::Vector2(0.0f, 0.0f), AZ::Vector2(2.0f, 2.0f),
+                                        AZ::Vector2(-2.0f, 2.0f) });
+
+        ExpectBatchMatchesPerPointQueries(entity, center + AZ::Vector3(0.0f, 0.0f, 1.0f), 3.0f);
+    }
+} // namespace UnitTest
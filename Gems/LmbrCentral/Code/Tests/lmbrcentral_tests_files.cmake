@@ -20,6 +20,7 @@ set(FILES
     LmbrCentralReflectionTest.h
     LmbrCentralTest.cpp
     ShapeGeometryUtilTest.cpp
+    ShapeBatchQueryTest.cpp
     SpawnerComponentTest.cpp
     SplineComponentTests.cpp
     DiskShapeTest.cpp
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
 
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -144,6 +145,32 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) = 0;
 
+        /// @brief Checks if each of the given points is inside a shape or outside it
+        /// Prefer this over IsPointInside when testing many points, shapes can implement it with a single update of
+        /// their cached intersection data and test several points at once.
+        /// @param points Vector3 list of the points to be tested
+        /// @param results bool list receiving whether each point is inside or out, must be the same size as points
+        virtual void IsPointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results)
+        {
+            AZ_Assert(points.size() == results.size(), "Point and result lists are different sizes (%zu vs %zu).", points.size(), results.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min squared distance each of the given points is from the shape
+        /// @param points Vector3 list of the points to calculate square distances from
+        /// @param results float list receiving the square distance of each point from the shape, must be the same size as points
+        virtual void DistancesSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results)
+        {
+            AZ_Assert(points.size() == results.size(), "Point and result lists are different sizes (%zu vs %zu).", points.size(), results.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/)
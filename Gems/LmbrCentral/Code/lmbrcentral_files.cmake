@@ -94,6 +94,7 @@ set(FILES
     Source/Shape/ShapeComponentConverters.inl
     Source/Shape/ShapeGeometryUtil.h
     Source/Shape/ShapeGeometryUtil.cpp
+    Source/Shape/ShapeSimdUtil.h
     Source/Unhandled/Other/AudioAssetTypeInfo.cpp
     Source/Unhandled/Other/AudioAssetTypeInfo.h
     Source/Unhandled/Other/CharacterPhysicsAssetTypeInfo.cpp
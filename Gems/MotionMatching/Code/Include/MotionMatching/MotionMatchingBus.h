@@ -15,6 +15,8 @@
 
 namespace EMotionFX::MotionMatching
 {
+    class MotionMatchingInstance;
+
     class DebugDrawRequests
         : public AZ::EBusTraits
     {
@@ -30,7 +32,17 @@ namespace EMotionFX::MotionMatching
     public:
         AZ_RTTI(MotionMatchingRequests, "{b08f73cc-a922-49ef-8c0e-07166b43ea65}");
         virtual ~MotionMatchingRequests() = default;
-        // Put your public methods here
+
+        //! Queue the search for the lowest cost frame of the given instance, which has to have prepared its query values already.
+        //! All queued searches are answered together by ExecuteQueuedSearches(), batched per motion matching data, and the instance
+        //! picks up the result with its next update. This can be called from the animation update worker threads.
+        virtual void QueueSearch(MotionMatchingInstance* instance) = 0;
+
+        //! Remove a queued search, e.g. when the instance gets destroyed before its search got executed.
+        virtual void CancelSearch(MotionMatchingInstance* instance) = 0;
+
+        //! Answer all queued searches. This is called once per frame after the animation update.
+        virtual void ExecuteQueuedSearches() = 0;
     };
     
     class MotionMatchingBusTraits
@@ -8,6 +8,7 @@
 
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <EMotionFX/Source/AnimGraph.h>
@@ -101,9 +102,8 @@ namespace EMotionFX::MotionMatching
 
         // Clear existing data.
         delete m_instance;
-        delete m_data;
+        m_data.reset();
 
-        m_data = aznew MotionMatching::MotionMatchingData(animGraphNode->m_featureSchema);
         m_instance = aznew MotionMatching::MotionMatchingInstance();
 
         MotionSet* motionSet = m_animGraphInstance->GetMotionSet();
@@ -113,6 +113,22 @@ namespace EMotionFX::MotionMatching
             return;
         }
 
+        // Keep the lock while initializing, so that the other instances wait for the data instead of building their own.
+        AZStd::scoped_lock<AZStd::mutex> lock(animGraphNode->m_sharedDataMutex);
+        m_data = animGraphNode->FindSharedData(actorInstance->GetActor(), motionSet);
+        if (m_data)
+        {
+            MotionMatching::MotionMatchingInstance::InitSettings initSettings;
+            initSettings.m_actorInstance = actorInstance;
+            initSettings.m_data = m_data.get();
+            initSettings.m_useSharedSearch = animGraphNode->m_useSharedSearch;
+            m_instance->Init(initSettings);
+            SetHasError(false);
+            return;
+        }
+
+        m_data = AZStd::shared_ptr<MotionMatching::MotionMatchingData>(aznew MotionMatching::MotionMatchingData(animGraphNode->m_featureSchema));
+
         //---------------------------------
         AZ::Debug::Timer timer;
         timer.Stamp();
@@ -125,6 +141,7 @@ namespace EMotionFX::MotionMatching
         settings.m_importMirrored = animGraphNode->m_mirror;
         settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
         settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
+        settings.m_searchMethod = animGraphNode->m_searchMethod;
         settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
         for (const AZStd::string& id : animGraphNode->m_motionIds)
         {
@@ -147,12 +164,14 @@ namespace EMotionFX::MotionMatching
             SetHasError(true);
             return;
         }
+        animGraphNode->m_sharedDatas.emplace_back(SharedData{ actorInstance->GetActor(), motionSet, m_data });
 
         // Initialize the instance.
         AZ_Printf("Motion Matching", "Initializing instance...");
         MotionMatching::MotionMatchingInstance::InitSettings initSettings;
         initSettings.m_actorInstance = actorInstance;
-        initSettings.m_data = m_data;
+        initSettings.m_data = m_data.get();
+        initSettings.m_useSharedSearch = animGraphNode->m_useSharedSearch;
         m_instance->Init(initSettings);
 
         const float initTime = timer.GetDeltaTimeInSeconds();
@@ -163,6 +182,36 @@ namespace EMotionFX::MotionMatching
         SetHasError(false);
     }
 
+    void BlendTreeMotionMatchNode::InvalidateUniqueData(AnimGraphInstance* animGraphInstance)
+    {
+        // Make the next unique data update rebuild the data, instead of picking up the outdated one from the other instances.
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sharedDataMutex);
+            const Actor* actor = animGraphInstance->GetActorInstance()->GetActor();
+            const MotionSet* motionSet = animGraphInstance->GetMotionSet();
+            m_sharedDatas.erase(AZStd::remove_if(m_sharedDatas.begin(), m_sharedDatas.end(),
+                [actor, motionSet](const SharedData& sharedData)
+                {
+                    return (sharedData.m_actor == actor && sharedData.m_motionSet == motionSet) || sharedData.m_data.expired();
+                }),
+                m_sharedDatas.end());
+        }
+
+        AnimGraphNode::InvalidateUniqueData(animGraphInstance);
+    }
+
+    AZStd::shared_ptr<MotionMatchingData> BlendTreeMotionMatchNode::FindSharedData(const Actor* actor, const MotionSet* motionSet)
+    {
+        for (const SharedData& sharedData : m_sharedDatas)
+        {
+            if (sharedData.m_actor == actor && sharedData.m_motionSet == motionSet && !sharedData.m_data.expired())
+            {
+                return sharedData.m_data.lock();
+            }
+        }
+        return {};
+    }
+
     void BlendTreeMotionMatchNode::Update(AnimGraphInstance* animGraphInstance, float timePassedInSeconds)
     {
         AZ_PROFILE_SCOPE(Animation, "BlendTreeMotionMatchNode::Update");
@@ -318,11 +367,13 @@ namespace EMotionFX::MotionMatching
         }
 
         serializeContext->Class<BlendTreeMotionMatchNode, AnimGraphNode>()
-            ->Version(9)
+            ->Version(11)
             ->Field("sampleRate", &BlendTreeMotionMatchNode::m_sampleRate)
             ->Field("lowestCostSearchFrequency", &BlendTreeMotionMatchNode::m_lowestCostSearchFrequency)
             ->Field("maxKdTreeDepth", &BlendTreeMotionMatchNode::m_maxKdTreeDepth)
             ->Field("minFramesPerKdTreeNode", &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode)
+            ->Field("searchMethod", &BlendTreeMotionMatchNode::m_searchMethod)
+            ->Field("useSharedSearch", &BlendTreeMotionMatchNode::m_useSharedSearch)
             ->Field("mirror", &BlendTreeMotionMatchNode::m_mirror)
             ->Field("controlSplineMode", &BlendTreeMotionMatchNode::m_trajectoryQueryMode)
             ->Field("pathRadius", &BlendTreeMotionMatchNode::m_pathRadius)
@@ -349,6 +400,12 @@ namespace EMotionFX::MotionMatching
                 ->Attribute(AZ::Edit::Attributes::Min, 0.001f)
                 ->Attribute(AZ::Edit::Attributes::Max, std::numeric_limits<float>::max())
                 ->Attribute(AZ::Edit::Attributes::Step, 0.05f)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BlendTreeMotionMatchNode::m_searchMethod, "Search method", "The acceleration structure used to find the candidate frames. The brute-force search scales better with high dimensional feature schemas.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->EnumAttribute(MotionMatchingData::SEARCH_KDTREE, "KD-tree")
+                ->EnumAttribute(MotionMatchingData::SEARCH_BRUTEFORCE, "Brute-force")
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_useSharedSearch, "Shared search", "Answer the searches of all characters using the same actor and motion set together, spread across the worker threads. This scales better for crowds, but delays applying the search result by a frame.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxKdTreeDepth, "Max kdTree depth", "The maximum number of hierarchy levels in the kdTree.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 20)
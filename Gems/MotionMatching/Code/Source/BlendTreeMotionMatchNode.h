@@ -9,6 +9,9 @@
 #pragma once
 
 #include <AzCore/Debug/Timer.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
 #include <EMotionFX/Source/AnimGraphNode.h>
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <MotionMatchingInstance.h>
@@ -53,7 +56,6 @@ namespace EMotionFX::MotionMatching
 
             ~UniqueData()
             {
-                delete m_data;
                 delete m_instance;
             }
 
@@ -61,7 +63,7 @@ namespace EMotionFX::MotionMatching
 
         public:
             MotionMatching::MotionMatchingInstance* m_instance = nullptr;
-            MotionMatching::MotionMatchingData* m_data = nullptr;
+            AZStd::shared_ptr<MotionMatching::MotionMatchingData> m_data; //< Shared with the other anim graph instances using the same actor and motion set.
         };
 
         BlendTreeMotionMatchNode();
@@ -83,6 +85,17 @@ namespace EMotionFX::MotionMatching
         static void Reflect(AZ::ReflectContext* context);
 
     private:
+        //! The motion matching data shared by all anim graph instances that use the same actor and motion set.
+        struct SharedData
+        {
+            const Actor* m_actor = nullptr;
+            const MotionSet* m_motionSet = nullptr;
+            AZStd::weak_ptr<MotionMatchingData> m_data;
+        };
+
+        void InvalidateUniqueData(AnimGraphInstance* animGraphInstance) override;
+        AZStd::shared_ptr<MotionMatchingData> FindSharedData(const Actor* actor, const MotionSet* motionSet);
+
         void Output(AnimGraphInstance* animGraphInstance) override;
         void Update(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
         void PostUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
@@ -98,8 +111,13 @@ namespace EMotionFX::MotionMatching
         AZ::u32 m_sampleRate = 30;
         AZ::u32 m_maxKdTreeDepth = 15;
         AZ::u32 m_minFramesPerKdTreeNode = 1000;
+        MotionMatchingData::ESearchMethod m_searchMethod = MotionMatchingData::SEARCH_KDTREE;
         TrajectoryQuery::EMode m_trajectoryQueryMode = TrajectoryQuery::MODE_TARGETDRIVEN;
         bool m_mirror = false;
+        bool m_useSharedSearch = false;
+
+        AZStd::vector<SharedData> m_sharedDatas;
+        AZStd::mutex m_sharedDataMutex; //< Unique datas get updated from the animation worker threads.
 
         AZ::Debug::Timer m_timer;
         float m_updateTimeInMs = 0.0f;
@@ -0,0 +1,570 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <BruteForceSearch.h>
+#include <Allocators.h>
+#include <KdTree.h>
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(BruteForceSearch, MotionMatchAllocator, 0)
+
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using CostAndFrame = AZStd::pair<float, size_t>;
+
+        //! Calculate the eigenvalues and eigenvectors of a symmetric matrix using cyclic Jacobi rotations.
+        //! The matrix is destroyed and holds the eigenvalues on its diagonal afterwards. The eigenvectors are stored as columns.
+        void CalculateSymmetricEigenDecomposition(AZStd::vector<double>& matrix, size_t n, AZStd::vector<double>& outEigenVectors)
+        {
+            outEigenVectors.assign(n * n, 0.0);
+            for (size_t i = 0; i < n; ++i)
+            {
+                outEigenVectors[i * n + i] = 1.0;
+            }
+
+            double frobeniusNormSq = 0.0;
+            for (const double value : matrix)
+            {
+                frobeniusNormSq += value * value;
+            }
+
+            const size_t maxNumSweeps = 64;
+            for (size_t sweep = 0; sweep < maxNumSweeps; ++sweep)
+            {
+                double offDiagonalSq = 0.0;
+                for (size_t p = 0; p < n; ++p)
+                {
+                    for (size_t q = p + 1; q < n; ++q)
+                    {
+                        offDiagonalSq += matrix[p * n + q] * matrix[p * n + q];
+                    }
+                }
+
+                if (offDiagonalSq <= frobeniusNormSq * 1e-24)
+                {
+                    break;
+                }
+
+                for (size_t p = 0; p < n; ++p)
+                {
+                    for (size_t q = p + 1; q < n; ++q)
+                    {
+                        const double apq = matrix[p * n + q];
+                        if (AZ::GetAbs(apq) < 1e-300)
+                        {
+                            continue;
+                        }
+
+                        // Rotate in the (p, q) plane so that the (p, q) element becomes zero.
+                        const double theta = (matrix[q * n + q] - matrix[p * n + p]) / (2.0 * apq);
+                        const double t = (theta >= 0.0 ? 1.0 : -1.0) / (AZ::GetAbs(theta) + sqrt(theta * theta + 1.0));
+                        const double c = 1.0 / sqrt(t * t + 1.0);
+                        const double s = t * c;
+
+                        for (size_t k = 0; k < n; ++k)
+                        {
+                            const double akp = matrix[k * n + p];
+                            const double akq = matrix[k * n + q];
+                            matrix[k * n + p] = c * akp - s * akq;
+                            matrix[k * n + q] = s * akp + c * akq;
+                        }
+
+                        for (size_t k = 0; k < n; ++k)
+                        {
+                            const double apk = matrix[p * n + k];
+                            const double aqk = matrix[q * n + k];
+                            matrix[p * n + k] = c * apk - s * aqk;
+                            matrix[q * n + k] = s * apk + c * aqk;
+                        }
+
+                        for (size_t k = 0; k < n; ++k)
+                        {
+                            const double vkp = outEigenVectors[k * n + p];
+                            const double vkq = outEigenVectors[k * n + q];
+                            outEigenVectors[k * n + p] = c * vkp - s * vkq;
+                            outEigenVectors[k * n + q] = s * vkp + c * vkq;
+                        }
+                    }
+                }
+            }
+        }
+
+        //! Insert a frame into the max-heap of the nearest frames found so far, keeping at most maxNumResults frames.
+        AZ_FORCE_INLINE void InsertNearest(AZStd::vector<CostAndFrame>& heap, size_t maxNumResults, float cost, size_t frameIndex)
+        {
+            if (heap.size() < maxNumResults)
+            {
+                heap.emplace_back(cost, frameIndex);
+                AZStd::push_heap(heap.begin(), heap.end());
+            }
+            else
+            {
+                AZStd::pop_heap(heap.begin(), heap.end());
+                heap.back() = CostAndFrame(cost, frameIndex);
+                AZStd::push_heap(heap.begin(), heap.end());
+            }
+        }
+    } // namespace
+
+    void BruteForceSearch::Clear()
+    {
+        m_lanes.clear();
+        m_clusterMin.clear();
+        m_clusterMax.clear();
+        m_mean.clear();
+        m_scale.clear();
+        m_projection.clear();
+        m_numFrames = 0;
+        m_numBlocks = 0;
+        m_numClusters = 0;
+        m_numDimensions = 0;
+        m_numSearchDimensions = 0;
+    }
+
+    bool BruteForceSearch::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features, const InitSettings& settings)
+    {
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        m_numDimensions = KdTree::CalcNumDimensions(features);
+        const size_t numFrames = static_cast<size_t>(featureMatrix.rows());
+        if (m_numDimensions == 0 || numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize the brute-force search without any frames or feature dimensions.");
+            Clear();
+            return false;
+        }
+
+        if (settings.m_maxNumResults == 0)
+        {
+            AZ_Error("Motion Matching", false, "The brute-force search has to return at least one frame.");
+            Clear();
+            return false;
+        }
+
+        m_maxNumResults = settings.m_maxNumResults;
+
+        // Gather the values of the features in the same order as the query values are filled.
+        AZStd::vector<float> values(numFrames * m_numDimensions);
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            size_t dimension = 0;
+            for (const Feature* feature : features)
+            {
+                if (feature->GetId().IsNull())
+                {
+                    continue;
+                }
+
+                const size_t featureColumnOffset = feature->GetColumnOffset();
+                const size_t numFeatureDimensions = feature->GetNumDimensions();
+                for (size_t i = 0; i < numFeatureDimensions; ++i)
+                {
+                    values[frame * m_numDimensions + dimension] = featureMatrix(frame, featureColumnOffset + i);
+                    dimension++;
+                }
+            }
+        }
+
+        // Normalize each dimension to zero mean and unit variance, so that features with large value ranges don't dominate the search.
+        // The cost factor of the feature is applied on top, so that it keeps its influence like in the narrow-phase.
+        m_mean.assign(m_numDimensions, 0.0f);
+        m_scale.assign(m_numDimensions, 1.0f);
+        {
+            size_t dimension = 0;
+            for (const Feature* feature : features)
+            {
+                if (feature->GetId().IsNull())
+                {
+                    continue;
+                }
+
+                const float costFactorScale = sqrtf(AZ::GetMax(feature->GetCostFactor(), 0.0f));
+                const size_t numFeatureDimensions = feature->GetNumDimensions();
+                for (size_t i = 0; i < numFeatureDimensions; ++i, ++dimension)
+                {
+                    double sum = 0.0;
+                    double sumSq = 0.0;
+                    for (size_t frame = 0; frame < numFrames; ++frame)
+                    {
+                        const double value = values[frame * m_numDimensions + dimension];
+                        sum += value;
+                        sumSq += value * value;
+                    }
+
+                    const double mean = sum / static_cast<double>(numFrames);
+                    const double variance = AZ::GetMax(sumSq / static_cast<double>(numFrames) - mean * mean, 0.0);
+                    const double standardDeviation = sqrt(variance);
+                    m_mean[dimension] = static_cast<float>(mean);
+                    m_scale[dimension] = costFactorScale / static_cast<float>(standardDeviation > 1e-6 ? standardDeviation : 1.0);
+                }
+            }
+        }
+
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            float* frameValues = &values[frame * m_numDimensions];
+            Normalize(frameValues, frameValues);
+        }
+
+        m_numSearchDimensions = m_numDimensions;
+        if (settings.m_usePca && m_numDimensions > 1)
+        {
+            CalculatePrincipalComponents(values, AZ::GetClamp(settings.m_pcaVarianceRatio, 0.0f, 1.0f));
+        }
+
+        // Store the frames in search space in blocks, with the values of each dimension in a separate lane.
+        m_numFrames = numFrames;
+        m_numBlocks = (numFrames + s_framesPerBlock - 1) / s_framesPerBlock;
+        m_blocksPerCluster = AZ::GetMax<size_t>((settings.m_framesPerCluster + s_framesPerBlock - 1) / s_framesPerBlock, 1);
+        m_numClusters = (m_numBlocks + m_blocksPerCluster - 1) / m_blocksPerCluster;
+        m_lanes.resize(m_numBlocks * m_numSearchDimensions);
+        m_clusterMin.assign(m_numClusters * m_numSearchDimensions, FLT_MAX);
+        m_clusterMax.assign(m_numClusters * m_numSearchDimensions, -FLT_MAX);
+
+        AZStd::vector<float> searchValues(m_numSearchDimensions);
+        for (size_t block = 0; block < m_numBlocks; ++block)
+        {
+            const size_t cluster = block / m_blocksPerCluster;
+            float* clusterMin = &m_clusterMin[cluster * m_numSearchDimensions];
+            float* clusterMax = &m_clusterMax[cluster * m_numSearchDimensions];
+            Lane* lanes = &m_lanes[block * m_numSearchDimensions];
+            for (size_t i = 0; i < s_framesPerBlock; ++i)
+            {
+                const size_t frame = block * s_framesPerBlock + i;
+                if (frame >= numFrames)
+                {
+                    // Pad the last block, the padded frames are skipped when searching.
+                    for (size_t d = 0; d < m_numSearchDimensions; ++d)
+                    {
+                        lanes[d].m_values[i] = 0.0f;
+                    }
+                    continue;
+                }
+
+                Project(&values[frame * m_numDimensions], searchValues.data());
+
+                for (size_t d = 0; d < m_numSearchDimensions; ++d)
+                {
+                    lanes[d].m_values[i] = searchValues[d];
+                    clusterMin[d] = AZ::GetMin(clusterMin[d], searchValues[d]);
+                    clusterMax[d] = AZ::GetMax(clusterMax[d], searchValues[d]);
+                }
+            }
+        }
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Brute-force search initialized with %zu frames in %zu dimensions (%zu before PCA) in %.2f ms, using %.2f MB.",
+            m_numFrames, m_numSearchDimensions, m_numDimensions, initTime * 1000.0f,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+
+        return true;
+    }
+
+    void BruteForceSearch::CalculatePrincipalComponents(const AZStd::vector<float>& normalizedValues, float varianceRatio)
+    {
+        // The normalized values have zero mean, so the covariance matrix is the average outer product of the rows.
+        const size_t n = m_numDimensions;
+        const size_t numFrames = normalizedValues.size() / n;
+        AZStd::vector<double> covariance(n * n, 0.0);
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            const float* row = &normalizedValues[frame * n];
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = i; j < n; ++j)
+                {
+                    covariance[i * n + j] += static_cast<double>(row[i]) * static_cast<double>(row[j]);
+                }
+            }
+        }
+
+        const double invNumFrames = 1.0 / static_cast<double>(numFrames);
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = i; j < n; ++j)
+            {
+                covariance[i * n + j] *= invNumFrames;
+                covariance[j * n + i] = covariance[i * n + j];
+            }
+        }
+
+        AZStd::vector<double> eigenVectors;
+        CalculateSymmetricEigenDecomposition(covariance, n, eigenVectors);
+
+        // Sort the components by the variance they explain.
+        AZStd::vector<size_t> order(n);
+        double totalVariance = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            order[i] = i;
+            totalVariance += AZ::GetMax(covariance[i * n + i], 0.0);
+        }
+        AZStd::sort(order.begin(), order.end(), [&covariance, n](size_t a, size_t b)
+            {
+                return covariance[a * n + a] > covariance[b * n + b];
+            });
+
+        size_t numComponents = 0;
+        double explainedVariance = 0.0;
+        while (numComponents < n)
+        {
+            explainedVariance += AZ::GetMax(covariance[order[numComponents] * n + order[numComponents]], 0.0);
+            numComponents++;
+            if (explainedVariance >= totalVariance * static_cast<double>(varianceRatio))
+            {
+                break;
+            }
+        }
+
+        m_numSearchDimensions = numComponents;
+        m_projection.resize(numComponents * n);
+        for (size_t c = 0; c < numComponents; ++c)
+        {
+            for (size_t d = 0; d < n; ++d)
+            {
+                m_projection[c * n + d] = static_cast<float>(eigenVectors[d * n + order[c]]);
+            }
+        }
+    }
+
+    void BruteForceSearch::Normalize(const float* values, float* outNormalizedValues) const
+    {
+        for (size_t d = 0; d < m_numDimensions; ++d)
+        {
+            outNormalizedValues[d] = (values[d] - m_mean[d]) * m_scale[d];
+        }
+    }
+
+    void BruteForceSearch::Project(const float* normalizedValues, float* outSearchValues) const
+    {
+        if (m_projection.empty())
+        {
+            AZStd::copy(normalizedValues, normalizedValues + m_numDimensions, outSearchValues);
+            return;
+        }
+
+        for (size_t c = 0; c < m_numSearchDimensions; ++c)
+        {
+            const float* component = &m_projection[c * m_numDimensions];
+            float projected = 0.0f;
+            for (size_t d = 0; d < m_numDimensions; ++d)
+            {
+                projected += component[d] * normalizedValues[d];
+            }
+            outSearchValues[c] = projected;
+        }
+    }
+
+    float BruteForceSearch::CalculateLowerBound(size_t cluster, const float* query) const
+    {
+        const float* clusterMin = &m_clusterMin[cluster * m_numSearchDimensions];
+        const float* clusterMax = &m_clusterMax[cluster * m_numSearchDimensions];
+        float lowerBound = 0.0f;
+        for (size_t d = 0; d < m_numSearchDimensions; ++d)
+        {
+            const float distance = AZ::GetMax(AZ::GetMax(clusterMin[d] - query[d], query[d] - clusterMax[d]), 0.0f);
+            lowerBound += distance * distance;
+        }
+        return lowerBound;
+    }
+
+    void BruteForceSearch::SearchBlock(size_t block, const float* query, AZStd::vector<CostAndFrame>& nearest, size_t maxNumResults) const
+    {
+        // Accumulate the squared distances of 8 frames at once.
+        alignas(16) float blockCosts[s_framesPerBlock];
+        const Lane* lanes = &m_lanes[block * m_numSearchDimensions];
+        Vec4::FloatType sum0 = Vec4::ZeroFloat();
+        Vec4::FloatType sum1 = Vec4::ZeroFloat();
+        for (size_t d = 0; d < m_numSearchDimensions; ++d)
+        {
+            const Vec4::FloatType queryValue = Vec4::Splat(query[d]);
+            const Vec4::FloatType diff0 = Vec4::Sub(Vec4::LoadAligned(&lanes[d].m_values[0]), queryValue);
+            const Vec4::FloatType diff1 = Vec4::Sub(Vec4::LoadAligned(&lanes[d].m_values[4]), queryValue);
+            sum0 = Vec4::Madd(diff0, diff0, sum0);
+            sum1 = Vec4::Madd(diff1, diff1, sum1);
+        }
+        Vec4::StoreAligned(&blockCosts[0], sum0);
+        Vec4::StoreAligned(&blockCosts[4], sum1);
+
+        const size_t firstFrame = block * s_framesPerBlock;
+        const size_t numBlockFrames = AZ::GetMin(s_framesPerBlock, m_numFrames - firstFrame);
+        for (size_t i = 0; i < numBlockFrames; ++i)
+        {
+            if (nearest.size() < maxNumResults || blockCosts[i] < nearest.front().first)
+            {
+                InsertNearest(nearest, maxNumResults, blockCosts[i], firstFrame + i);
+            }
+        }
+    }
+
+    void BruteForceSearch::SearchCluster(size_t cluster, const float* query, AZStd::vector<CostAndFrame>& nearest, size_t maxNumResults) const
+    {
+        const size_t firstBlock = cluster * m_blocksPerCluster;
+        const size_t endBlock = AZ::GetMin(firstBlock + m_blocksPerCluster, m_numBlocks);
+        for (size_t block = firstBlock; block < endBlock; ++block)
+        {
+            SearchBlock(block, query, nearest, maxNumResults);
+        }
+    }
+
+    void BruteForceSearch::SortNearest(AZStd::vector<CostAndFrame>& nearest, AZStd::vector<size_t>& resultFrameIndices)
+    {
+        AZStd::sort_heap(nearest.begin(), nearest.end());
+        resultFrameIndices.resize(nearest.size());
+        for (size_t i = 0; i < nearest.size(); ++i)
+        {
+            resultFrameIndices[i] = nearest[i].second;
+        }
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearch::FindNearestNeighbors");
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute-force search. Did you forget to call BruteForceSearch::Init()?");
+        AZ_Assert(frameFloats.size() == m_numDimensions, "The number of query values (%zu) does not match the number of feature dimensions (%zu).", frameFloats.size(), m_numDimensions);
+
+        AZStd::vector<float> normalizedQuery(m_numDimensions);
+        AZStd::vector<float> query(m_numSearchDimensions);
+        Normalize(frameFloats.data(), normalizedQuery.data());
+        Project(normalizedQuery.data(), query.data());
+
+        // Visit the clusters in the order of the smallest possible distance to the query, so that the remaining ones can be skipped early.
+        AZStd::vector<CostAndFrame> clusterOrder(m_numClusters);
+        for (size_t cluster = 0; cluster < m_numClusters; ++cluster)
+        {
+            clusterOrder[cluster] = CostAndFrame(CalculateLowerBound(cluster, query.data()), cluster);
+        }
+        AZStd::sort(clusterOrder.begin(), clusterOrder.end());
+
+        const size_t maxNumResults = AZ::GetMin(m_maxNumResults, m_numFrames);
+        AZStd::vector<CostAndFrame> nearest;
+        nearest.reserve(maxNumResults + 1);
+
+        for (const CostAndFrame& clusterAndLowerBound : clusterOrder)
+        {
+            const float threshold = (nearest.size() < maxNumResults) ? FLT_MAX : nearest.front().first;
+            if (clusterAndLowerBound.first >= threshold)
+            {
+                break;
+            }
+
+            SearchCluster(clusterAndLowerBound.second, query.data(), nearest, maxNumResults);
+        }
+
+        SortNearest(nearest, resultFrameIndices);
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<const AZStd::vector<float>*>& queries, AZStd::vector<AZStd::vector<size_t>>& results) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearch::FindNearestNeighbors (batched)");
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute-force search. Did you forget to call BruteForceSearch::Init()?");
+
+        const size_t numQueries = queries.size();
+        results.resize(numQueries);
+        if (numQueries == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<float> normalizedQuery(m_numDimensions);
+        AZStd::vector<float> searchQueries(numQueries * m_numSearchDimensions);
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            AZ_Assert(queries[q]->size() == m_numDimensions, "The number of query values (%zu) does not match the number of feature dimensions (%zu).", queries[q]->size(), m_numDimensions);
+            Normalize(queries[q]->data(), normalizedQuery.data());
+            Project(normalizedQuery.data(), &searchQueries[q * m_numSearchDimensions]);
+        }
+
+        const size_t maxNumResults = AZ::GetMin(m_maxNumResults, m_numFrames);
+        AZStd::vector<AZStd::vector<CostAndFrame>> nearest(numQueries);
+        const auto getThreshold = [&nearest, maxNumResults](size_t q)
+        {
+            return (nearest[q].size() < maxNumResults) ? FLT_MAX : nearest[q].front().first;
+        };
+
+        // Start each query with its most promising cluster, so that its threshold allows skipping clusters right away.
+        AZStd::vector<size_t> seedClusters(numQueries);
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            const float* query = &searchQueries[q * m_numSearchDimensions];
+            float minLowerBound = FLT_MAX;
+            for (size_t cluster = 0; cluster < m_numClusters; ++cluster)
+            {
+                const float lowerBound = CalculateLowerBound(cluster, query);
+                if (lowerBound < minLowerBound)
+                {
+                    minLowerBound = lowerBound;
+                    seedClusters[q] = cluster;
+                }
+            }
+
+            nearest[q].reserve(maxNumResults + 1);
+            SearchCluster(seedClusters[q], query, nearest[q], maxNumResults);
+        }
+
+        // Visit the clusters in memory order and compare each block against all queries that can still find a closer frame in
+        // the cluster, while the block is in the cache. This streams the frames through the cache once for the whole batch.
+        AZStd::vector<size_t> activeQueries;
+        activeQueries.reserve(numQueries);
+        for (size_t cluster = 0; cluster < m_numClusters; ++cluster)
+        {
+            activeQueries.clear();
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                if (cluster != seedClusters[q] && CalculateLowerBound(cluster, &searchQueries[q * m_numSearchDimensions]) < getThreshold(q))
+                {
+                    activeQueries.emplace_back(q);
+                }
+            }
+
+            if (activeQueries.empty())
+            {
+                continue;
+            }
+
+            const size_t firstBlock = cluster * m_blocksPerCluster;
+            const size_t endBlock = AZ::GetMin(firstBlock + m_blocksPerCluster, m_numBlocks);
+            for (size_t block = firstBlock; block < endBlock; ++block)
+            {
+                for (const size_t q : activeQueries)
+                {
+                    SearchBlock(block, &searchQueries[q * m_numSearchDimensions], nearest[q], maxNumResults);
+                }
+            }
+        }
+
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            SortNearest(nearest[q], results[q]);
+        }
+    }
+
+    size_t BruteForceSearch::CalcMemoryUsageInBytes() const
+    {
+        size_t result = 0;
+        result += m_lanes.capacity() * sizeof(Lane);
+        result += (m_clusterMin.capacity() + m_clusterMax.capacity()) * sizeof(float);
+        result += (m_mean.capacity() + m_scale.capacity() + m_projection.capacity()) * sizeof(float);
+        result += sizeof(BruteForceSearch);
+        return result;
+    }
+} // namespace EMotionFX::MotionMatching
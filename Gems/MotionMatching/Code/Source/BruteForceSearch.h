@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search that compares the query against every frame in the motion database, as an alternative to the KdTree.
+    //! The kd-tree only splits along a single dimension per level and degenerates into a linear search through large leaves
+    //! for high dimensional feature schemas, while a linear scan over well laid out memory scales predictably.
+    //! The feature values are normalized per dimension (weighted by the feature cost factors), optionally reduced to their principal
+    //! components, and stored in blocks of 8 frames where each dimension of the block occupies one aligned, contiguous lane.
+    //! Consecutive frames are grouped into clusters with a bounding box in search space, so that whole clusters can be skipped
+    //! when they cannot contain a frame closer than the current nearest ones.
+    class EMFX_API BruteForceSearch
+    {
+    public:
+        AZ_RTTI(BruteForceSearch, "{6F2B44D1-8E5C-4B0B-9B3A-3C1E7A9D52F4}")
+        AZ_CLASS_ALLOCATOR_DECL
+
+        //! The number of frames whose values for a single dimension are stored next to each other.
+        static constexpr size_t s_framesPerBlock = 8;
+
+        struct EMFX_API InitSettings
+        {
+            size_t m_maxNumResults = 64; //< The number of nearest frames that are returned to the narrow-phase search.
+            size_t m_framesPerCluster = 64; //< The number of consecutive frames that share a bounding box. Rounded up to a multiple of the block size.
+            bool m_usePca = true; //< Reduce the number of dimensions using principal component analysis.
+            float m_pcaVarianceRatio = 0.99f; //< The ratio of the variance the kept principal components have to explain, in range [0, 1].
+        };
+
+        BruteForceSearch() = default;
+        virtual ~BruteForceSearch() = default;
+
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features, const InitSettings& settings);
+        void Clear();
+
+        //! The number of values in the query, which is the summed number of dimensions of the given features.
+        size_t GetNumDimensions() const { return m_numDimensions; }
+
+        //! The number of dimensions the frames are compared in, which is smaller than GetNumDimensions() when PCA reduced them.
+        size_t GetNumSearchDimensions() const { return m_numSearchDimensions; }
+
+        size_t GetNumFrames() const { return m_numFrames; }
+        size_t CalcMemoryUsageInBytes() const;
+        bool IsInitialized() const { return m_numFrames > 0; }
+
+        //! Find the frames closest to the query values, ordered from nearest to farthest.
+        //! This does not modify the search structure, so a single instance can be queried from multiple threads.
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        //! Find the nearest frames for a batch of queries with a single pass over the frames.
+        //! Each block of frames is compared against all queries that can still find a closer frame in it while the block is in the cache,
+        //! which amortizes the memory traffic over the batch. The results are the same as searching the queries one by one.
+        //! @param[in] queries The query values, GetNumDimensions() values per query.
+        //! @param[out] results The nearest frames per query, ordered from nearest to farthest.
+        void FindNearestNeighbors(const AZStd::vector<const AZStd::vector<float>*>& queries, AZStd::vector<AZStd::vector<size_t>>& results) const;
+
+    private:
+        using CostAndFrame = AZStd::pair<float, size_t>;
+
+        //! The values of a single dimension for all frames in a block.
+        struct alignas(32) Lane
+        {
+            float m_values[s_framesPerBlock];
+        };
+
+        void Normalize(const float* values, float* outNormalizedValues) const;
+        void Project(const float* normalizedValues, float* outSearchValues) const;
+        float CalculateLowerBound(size_t cluster, const float* query) const;
+        void SearchBlock(size_t block, const float* query, AZStd::vector<CostAndFrame>& nearest, size_t maxNumResults) const;
+        void SearchCluster(size_t cluster, const float* query, AZStd::vector<CostAndFrame>& nearest, size_t maxNumResults) const;
+        static void SortNearest(AZStd::vector<CostAndFrame>& nearest, AZStd::vector<size_t>& resultFrameIndices);
+        void CalculatePrincipalComponents(const AZStd::vector<float>& normalizedValues, float varianceRatio);
+
+        AZStd::vector<Lane> m_lanes; //< The frames in search space. Block b stores the lane for dimension d at index b * m_numSearchDimensions + d.
+        AZStd::vector<float> m_clusterMin; //< The minimum search space values per cluster, m_numSearchDimensions values per cluster.
+        AZStd::vector<float> m_clusterMax; //< The maximum search space values per cluster, m_numSearchDimensions values per cluster.
+        AZStd::vector<float> m_mean; //< The mean of each feature dimension.
+        AZStd::vector<float> m_scale; //< Normalizes each feature dimension to unit variance and applies the feature cost factor.
+        AZStd::vector<float> m_projection; //< The principal components as rows, m_numSearchDimensions x m_numDimensions. Empty when PCA is disabled.
+        size_t m_numFrames = 0;
+        size_t m_numBlocks = 0;
+        size_t m_blocksPerCluster = 1;
+        size_t m_numClusters = 0;
+        size_t m_numDimensions = 0;
+        size_t m_numSearchDimensions = 0;
+        size_t m_maxNumResults = 64;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -38,7 +38,7 @@ namespace EMotionFX::MotionMatching
         Clear();
     }
 
-    bool MotionMatchingData::ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, size_t maxKdTreeDepth, size_t minFramesPerKdTreeNode)
+    bool MotionMatchingData::ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, const InitSettings& settings)
     {
         AZ_PROFILE_SCOPE(Animation, "MotionMatchingData::ExtractFeatures");
         AZ::Debug::Timer timer;
@@ -100,8 +100,17 @@ namespace EMotionFX::MotionMatching
         const float extractFeaturesTime = timer.GetDeltaTimeInSeconds();
         timer.Stamp();
 
-        // Initialize the kd-tree used to accelerate the searches.
-        if (!m_kdTree->Init(*frameDatabase, m_featureMatrix, m_featuresInKdTree, maxKdTreeDepth, minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+        // Initialize the acceleration structure used for the broad-phase search.
+        m_searchMethod = settings.m_searchMethod;
+        if (m_searchMethod == SEARCH_BRUTEFORCE)
+        {
+            if (!m_bruteForceSearch.Init(m_featureMatrix, m_featuresInKdTree, settings.m_bruteForceSettings))
+            {
+                AZ_Error("EMotionFX", false, "Failed to initialize brute-force search.");
+                return false;
+            }
+        }
+        else if (!m_kdTree->Init(*frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
         {
             AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
             return false;
@@ -109,7 +118,7 @@ namespace EMotionFX::MotionMatching
 
         const float initKdTreeTimer = timer.GetDeltaTimeInSeconds();
 
-        AZ_Printf("MotionMatching", "Feature matrix (%zu, %zu) uses %.2f MB and took %.2f ms to initialize (KD-Tree %.2f ms).",
+        AZ_Printf("MotionMatching", "Feature matrix (%zu, %zu) uses %.2f MB and took %.2f ms to initialize (search structure %.2f ms).",
             m_featureMatrix.rows(),
             m_featureMatrix.cols(),
             static_cast<float>(m_featureMatrix.CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f,
@@ -162,7 +171,7 @@ namespace EMotionFX::MotionMatching
         }
 
         // Extract feature data and place the values into the feature matrix.
-        if (!ExtractFeatures(settings.m_actorInstance, &m_frameDatabase, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode))
+        if (!ExtractFeatures(settings.m_actorInstance, &m_frameDatabase, settings))
         {
             AZ_Error("Motion Matching", false, "Failed to extract features from motion database.");
             return false;
@@ -176,6 +185,35 @@ namespace EMotionFX::MotionMatching
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
         m_kdTree->Clear();
+        m_bruteForceSearch.Clear();
         m_featuresInKdTree.clear();
     }
+
+    void MotionMatchingData::FindNearestFrames(const AZStd::vector<float>& queryFeatureValues, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        if (m_searchMethod == SEARCH_BRUTEFORCE)
+        {
+            m_bruteForceSearch.FindNearestNeighbors(queryFeatureValues, resultFrameIndices);
+        }
+        else
+        {
+            m_kdTree->FindNearestNeighbors(queryFeatureValues, resultFrameIndices);
+        }
+    }
+
+    void MotionMatchingData::FindNearestFrames(const AZStd::vector<const AZStd::vector<float>*>& queries, AZStd::vector<AZStd::vector<size_t>>& results) const
+    {
+        if (m_searchMethod == SEARCH_BRUTEFORCE)
+        {
+            m_bruteForceSearch.FindNearestNeighbors(queries, results);
+            return;
+        }
+
+        // The kd-tree only visits a few leaves per query, so there is no shared pass over the frames to amortize.
+        results.resize(queries.size());
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            m_kdTree->FindNearestNeighbors(*queries[i], results[i]);
+        }
+    }
 } // namespace EMotionFX::MotionMatching
@@ -14,6 +14,7 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 
+#include <BruteForceSearch.h>
 #include <Feature.h>
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
@@ -40,13 +41,22 @@ namespace EMotionFX::MotionMatching
         MotionMatchingData(const FeatureSchema& featureSchema);
         virtual ~MotionMatchingData();
 
+        //! The acceleration structure used for the broad-phase search.
+        enum ESearchMethod : AZ::u8
+        {
+            SEARCH_KDTREE = 0,
+            SEARCH_BRUTEFORCE = 1
+        };
+
         struct EMFX_API InitSettings
         {
             ActorInstance* m_actorInstance = nullptr;
             AZStd::vector<Motion*> m_motionList;
             FrameDatabase::FrameImportSettings m_frameImportSettings;
+            ESearchMethod m_searchMethod = SEARCH_KDTREE;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            BruteForceSearch::InitSettings m_bruteForceSettings;
             bool m_importMirrored = false;
         };
         bool Init(const InitSettings& settings);
@@ -58,10 +68,22 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& GetFeatureSchema() const { return m_featureSchema; }
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const BruteForceSearch& GetBruteForceSearch() const { return m_bruteForceSearch; }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
+        ESearchMethod GetSearchMethod() const { return m_searchMethod; }
+
+        //! Run the broad-phase search using the search method the data got initialized with.
+        //! @param[in] queryFeatureValues The query values of the features in GetFeaturesInKdTree(), in that order.
+        //! @param[out] resultFrameIndices The candidate frames for the narrow-phase search.
+        void FindNearestFrames(const AZStd::vector<float>& queryFeatureValues, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        //! Run the broad-phase search for a batch of queries, which lets the brute-force search share a single pass over the frames.
+        //! @param[in] queries The query values per query, laid out like for the single query version.
+        //! @param[out] results The candidate frames per query.
+        void FindNearestFrames(const AZStd::vector<const AZStd::vector<float>*>& queries, AZStd::vector<AZStd::vector<size_t>>& results) const;
 
     protected:
-        bool ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, size_t maxKdTreeDepth=20, size_t minFramesPerKdTreeNode=2000);
+        bool ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, const InitSettings& settings);
 
         FrameDatabase m_frameDatabase; //< The animation database with all the keyframes and joint transform data.
 
@@ -69,6 +91,8 @@ namespace EMotionFX::MotionMatching
         FeatureMatrix m_featureMatrix;
 
         AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        BruteForceSearch m_bruteForceSearch; //< Alternative to the kd-tree for high dimensional feature schemas.
+        ESearchMethod m_searchMethod = SEARCH_KDTREE;
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
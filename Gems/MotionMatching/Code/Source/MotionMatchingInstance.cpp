@@ -35,6 +35,7 @@ namespace EMotionFX::MotionMatching
     MotionMatchingInstance::~MotionMatchingInstance()
     {
         DebugDrawRequestBus::Handler::BusDisconnect();
+        CancelQueuedSearch();
 
         if (m_motionInstance)
         {
@@ -71,8 +72,10 @@ namespace EMotionFX::MotionMatching
             }
         }
 
+        CancelQueuedSearch();
         m_actorInstance = settings.m_actorInstance;
         m_data = settings.m_data;
+        m_useSharedSearch = settings.m_useSharedSearch;
         if (settings.m_data->GetFrameDatabase().GetNumFrames() == 0)
         {
             return;
@@ -98,7 +101,7 @@ namespace EMotionFX::MotionMatching
         m_queryPose.InitFromBindPose(m_actorInstance);
 
         // Make sure we have enough space inside the frame floats array, which is used to search the kdTree.
-        const size_t numValuesInKdTree = m_data->GetKdTree().GetNumDimensions();
+        const size_t numValuesInKdTree = KdTree::CalcNumDimensions(m_data->GetFeaturesInKdTree());
         m_queryFeatureValues.resize(numValuesInKdTree);
 
         // Initialize the trajectory history.
@@ -268,6 +271,98 @@ namespace EMotionFX::MotionMatching
         }
     }
 
+    void MotionMatchingInstance::PrepareQueryPose(float newMotionTime)
+    {
+        // Sample the pose for the new motion time as the motion instance has not been updated with the timeDelta from this frame yet.
+        SamplePose(m_motionInstance->GetMotion(), m_queryPose, newMotionTime);
+
+        // Copy over the motion extraction joint transform from the current pose to the newly sampled pose.
+        // When sampling a motion, the motion extraction joint is in animation space, while we need the query pose to be in world space.
+        // Note: This does not yet take the extraction delta from the current tick into account.
+        if (m_actorInstance->GetActor()->GetMotionExtractionNode())
+        {
+            const Pose* currentPose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            const size_t motionExtractionJointIndex = m_actorInstance->GetActor()->GetMotionExtractionNodeIndex();
+            m_queryPose.SetWorldSpaceTransform(motionExtractionJointIndex,
+                currentPose->GetWorldSpaceTransform(motionExtractionJointIndex));
+        }
+
+        // Calculate the joint velocities for the sampled pose using the same method as we do for the frame database.
+        PoseDataJointVelocities* velocityPoseData = m_queryPose.GetAndPreparePoseData<PoseDataJointVelocities>(m_actorInstance);
+        velocityPoseData->CalculateVelocity(m_motionInstance, m_cachedTrajectoryFeature->GetRelativeToNodeIndex());
+    }
+
+    Feature::FrameCostContext MotionMatchingInstance::CreateFrameCostContext() const
+    {
+        Feature::FrameCostContext frameCostContext(m_data->GetFeatureMatrix(), m_queryPose);
+        frameCostContext.m_trajectoryQuery = &m_trajectoryQuery;
+        frameCostContext.m_actorInstance = m_actorInstance;
+        return frameCostContext;
+    }
+
+    void MotionMatchingInstance::FillQueryFeatureValues(const Feature::FrameCostContext& context)
+    {
+        // Build the input query features that will be compared to every entry in the feature database in the motion matching search.
+        size_t startOffset = 0;
+        for (Feature* feature : m_data->GetFeaturesInKdTree())
+        {
+            feature->FillQueryFeatureValues(startOffset, m_queryFeatureValues, context);
+            startOffset += feature->GetNumDimensions();
+        }
+        AZ_Assert(startOffset == m_queryFeatureValues.size(), "Frame float vector is not the expected size.");
+    }
+
+    void MotionMatchingInstance::CancelQueuedSearch()
+    {
+        if (!m_searchQueued)
+        {
+            return;
+        }
+
+        if (MotionMatchingRequests* sharedSearch = MotionMatchingInterface::Get())
+        {
+            sharedSearch->CancelSearch(this);
+        }
+        m_searchQueued = false;
+        m_queuedSearchResult = InvalidIndex;
+    }
+
+    void MotionMatchingInstance::SwitchToFrame(size_t currentFrameIndex, size_t lowestCostFrameIndex, float newMotionTime, float searchLatency, float timePassedInSeconds)
+    {
+        const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
+        const Frame& currentFrame = frameDatabase.GetFrame(currentFrameIndex);
+        const Frame& lowestCostFrame = frameDatabase.GetFrame(lowestCostFrameIndex);
+        const float targetTime = lowestCostFrame.GetSampleTime() + searchLatency;
+        const bool sameMotion = (currentFrame.GetSourceMotion() == lowestCostFrame.GetSourceMotion());
+        const float timeBetweenFrames = newMotionTime - targetTime;
+        const bool sameLocation = sameMotion && (AZ::GetAbs(timeBetweenFrames) < 0.1f);
+
+        if (lowestCostFrameIndex != currentFrameIndex && !sameLocation)
+        {
+            // Start a blend.
+            m_blending = true;
+            m_blendWeight = 0.0f;
+            m_blendProgressTime = 0.0f;
+
+            // Store the current motion instance state, so we can sample this as source pose.
+            m_prevMotionInstance->SetMotion(m_motionInstance->GetMotion());
+            m_prevMotionInstance->SetMirrorMotion(m_motionInstance->GetMirrorMotion());
+            m_prevMotionInstance->SetCurrentTime(newMotionTime, true);
+            m_prevMotionInstance->SetLastCurrentTime(m_prevMotionInstance->GetCurrentTime() - timePassedInSeconds);
+
+            m_lowestCostFrameIndex = lowestCostFrameIndex;
+
+            m_motionInstance->SetMotion(lowestCostFrame.GetSourceMotion());
+            m_motionInstance->SetMirrorMotion(lowestCostFrame.GetMirrored());
+
+            // The new motion time will become the current time after this frame while the current time
+            // becomes the last current time. As we just start playing at the search frame, calculate
+            // the last time based on the time delta.
+            m_motionInstance->SetCurrentTime(targetTime - timePassedInSeconds, true);
+            m_newMotionTime = targetTime;
+        }
+    }
+
     void MotionMatchingInstance::Update(float timePassedInSeconds, const AZ::Vector3& targetPos, const AZ::Vector3& targetFacingDir, TrajectoryQuery::EMode mode, float pathRadius, float pathSpeed)
     {
         AZ_PROFILE_SCOPE(Animation, "MotionMatchingInstance::Update");
@@ -328,67 +423,49 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        const bool searchLowestCostFrame = m_timeSinceLastFrameSwitch >= lowestCostSearchTimeInterval;
-        if (searchLowestCostFrame)
+        bool forceLocalSearch = false;
+        if (m_searchQueued)
         {
-            // Calculate the input query pose for the motion matching search algorithm.
+            m_searchLatency += timePassedInSeconds;
+            if (m_queuedSearchResult != InvalidIndex)
             {
-                // Sample the pose for the new motion time as the motion instance has not been updated with the timeDelta from this frame yet.
-                SamplePose(m_motionInstance->GetMotion(), m_queryPose, newMotionTime);
-
-                // Copy over the motion extraction joint transform from the current pose to the newly sampled pose.
-                // When sampling a motion, the motion extraction joint is in animation space, while we need the query pose to be in world space.
-                // Note: This does not yet take the extraction delta from the current tick into account.
-                if (m_actorInstance->GetActor()->GetMotionExtractionNode())
-                {
-                    const Pose* currentPose = m_actorInstance->GetTransformData()->GetCurrentPose();
-                    const size_t motionExtractionJointIndex = m_actorInstance->GetActor()->GetMotionExtractionNodeIndex();
-                    m_queryPose.SetWorldSpaceTransform(motionExtractionJointIndex,
-                        currentPose->GetWorldSpaceTransform(motionExtractionJointIndex));
-                }
-
-                // Calculate the joint velocities for the sampled pose using the same method as we do for the frame database.
-                PoseDataJointVelocities* velocityPoseData = m_queryPose.GetAndPreparePoseData<PoseDataJointVelocities>(m_actorInstance);
-                velocityPoseData->CalculateVelocity(m_motionInstance, m_cachedTrajectoryFeature->GetRelativeToNodeIndex());
+                // The shared search answered the query we prepared in a previous update.
+                const size_t lowestCostFrameIndex = m_queuedSearchResult;
+                m_searchQueued = false;
+                m_queuedSearchResult = InvalidIndex;
+                SwitchToFrame(currentFrameIndex, lowestCostFrameIndex, newMotionTime, m_searchLatency, timePassedInSeconds);
             }
+            else if (m_searchLatency >= lowestCostSearchTimeInterval)
+            {
+                // Nobody executed the queued search, e.g. because the system component does not tick. Search ourselves instead,
+                // queuing again would just wait for the next timeout.
+                CancelQueuedSearch();
+                forceLocalSearch = true;
+            }
+        }
 
-            const FeatureMatrix& featureMatrix = m_data->GetFeatureMatrix();
-            const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
-
-            Feature::FrameCostContext frameCostContext(featureMatrix, m_queryPose);
-            frameCostContext.m_trajectoryQuery = &m_trajectoryQuery;
-            frameCostContext.m_actorInstance = m_actorInstance;
-            const size_t lowestCostFrameIndex = FindLowestCostFrameIndex(frameCostContext);
+        const bool searchLowestCostFrame = forceLocalSearch || (!m_searchQueued && m_timeSinceLastFrameSwitch >= lowestCostSearchTimeInterval);
+        if (searchLowestCostFrame)
+        {
+            PrepareQueryPose(newMotionTime);
 
-            const Frame& currentFrame = frameDatabase.GetFrame(currentFrameIndex);
-            const Frame& lowestCostFrame = frameDatabase.GetFrame(lowestCostFrameIndex);
-            const bool sameMotion = (currentFrame.GetSourceMotion() == lowestCostFrame.GetSourceMotion());
-            const float timeBetweenFrames = newMotionTime - lowestCostFrame.GetSampleTime();
-            const bool sameLocation = sameMotion && (AZ::GetAbs(timeBetweenFrames) < 0.1f);
+            const Feature::FrameCostContext frameCostContext = CreateFrameCostContext();
+            FillQueryFeatureValues(frameCostContext);
 
-            if (lowestCostFrameIndex != currentFrameIndex && !sameLocation)
+            MotionMatchingRequests* sharedSearch = (m_useSharedSearch && !forceLocalSearch) ? MotionMatchingInterface::Get() : nullptr;
+            if (sharedSearch)
+            {
+                // The system component searches after the animation update, before our next update changes the query pose or trajectory query.
+                m_searchQueued = true;
+                m_queuedSearchResult = InvalidIndex;
+                m_searchLatency = 0.0f;
+                sharedSearch->QueueSearch(this);
+            }
+            else
             {
-                // Start a blend.
-                m_blending = true;
-                m_blendWeight = 0.0f;
-                m_blendProgressTime = 0.0f;
-
-                // Store the current motion instance state, so we can sample this as source pose.
-                m_prevMotionInstance->SetMotion(m_motionInstance->GetMotion());
-                m_prevMotionInstance->SetMirrorMotion(m_motionInstance->GetMirrorMotion());
-                m_prevMotionInstance->SetCurrentTime(newMotionTime, true);
-                m_prevMotionInstance->SetLastCurrentTime(m_prevMotionInstance->GetCurrentTime() - timePassedInSeconds);
-
-                m_lowestCostFrameIndex = lowestCostFrameIndex;
-
-                m_motionInstance->SetMotion(lowestCostFrame.GetSourceMotion());
-                m_motionInstance->SetMirrorMotion(lowestCostFrame.GetMirrored());
-
-                // The new motion time will become the current time after this frame while the current time
-                // becomes the last current time. As we just start playing at the search frame, calculate
-                // the last time based on the time delta.
-                m_motionInstance->SetCurrentTime(lowestCostFrame.GetSampleTime() -  timePassedInSeconds, true);
-                m_newMotionTime = lowestCostFrame.GetSampleTime();
+                m_data->FindNearestFrames(m_queryFeatureValues, m_nearestFrames);
+                const size_t lowestCostFrameIndex = FindLowestCostFrameIndex(m_nearestFrames);
+                SwitchToFrame(currentFrameIndex, lowestCostFrameIndex, newMotionTime, 0.0f, timePassedInSeconds);
             }
 
             // Do this always, else wise we search for the lowest cost frame index too many times.
@@ -413,7 +490,7 @@ namespace EMotionFX::MotionMatching
         }
     }
 
-    size_t MotionMatchingInstance::FindLowestCostFrameIndex(const Feature::FrameCostContext& context)
+    size_t MotionMatchingInstance::FindLowestCostFrameIndex(const AZStd::vector<size_t>& nearestFrames)
     {
         AZ::Debug::Timer timer;
         timer.Stamp();
@@ -423,23 +500,9 @@ namespace EMotionFX::MotionMatching
         const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
         const FeatureSchema& featureSchema = m_data->GetFeatureSchema();
         const FeatureTrajectory* trajectoryFeature = m_cachedTrajectoryFeature;
+        const Feature::FrameCostContext context = CreateFrameCostContext();
 
-        // 1. Broad-phase search using KD-tree
-        {
-            // Build the input query features that will be compared to every entry in the feature database in the motion matching search.
-            size_t startOffset = 0;
-            for (Feature* feature : m_data->GetFeaturesInKdTree())
-            {
-                feature->FillQueryFeatureValues(startOffset, m_queryFeatureValues, context);
-                startOffset += feature->GetNumDimensions();
-            }
-            AZ_Assert(startOffset == m_queryFeatureValues.size(), "Frame float vector is not the expected size.");
-
-            // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(m_queryFeatureValues, m_nearestFrames);
-        }
-
-        // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
+        // Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
         float minCost = FLT_MAX;
         size_t minCostFrameIndex = 0;
         m_tempCosts.resize(featureSchema.GetNumFeatures());
@@ -448,7 +511,7 @@ namespace EMotionFX::MotionMatching
         float minTrajectoryFutureCost = 0.0f;
 
         // Iterate through the frames filtered by the broad-phase search.
-        for (const size_t frameIndex : m_nearestFrames)
+        for (const size_t frameIndex : nearestFrames)
         {
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
@@ -506,7 +569,7 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 3. ImGui debug visualization
+        // ImGui debug visualization
         {
             const float time = timer.GetDeltaTimeInSeconds();
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushPerformanceHistogramValue, "FindLowestCostFrameIndex", time * 1000.0f);
@@ -53,6 +53,7 @@ namespace EMotionFX::MotionMatching
         {
             ActorInstance* m_actorInstance = nullptr;
             MotionMatchingData* m_data = nullptr;
+            bool m_useSharedSearch = false; //< Queue the searches with the system component, which batches them with the other instances using the same data.
         };
         void Init(const InitSettings& settings);
 
@@ -78,12 +79,30 @@ namespace EMotionFX::MotionMatching
         const TrajectoryHistory& GetTrajectoryHistory() const { return m_trajectoryHistory; }
         const Transform& GetMotionExtractionDelta() const { return m_motionExtractionDelta; }
 
+        //! The query values of the features in the broad-phase search, as prepared by the last search.
+        const AZStd::vector<float>& GetQueryFeatureValues() const { return m_queryFeatureValues; }
+
+        //! Narrow-phase search, which finds the frame with the lowest cost among the candidates from the broad-phase search.
+        //! The frames are compared to the query pose and trajectory prepared by the last search.
+        size_t FindLowestCostFrameIndex(const AZStd::vector<size_t>& nearestFrames);
+
+        //! Hand over the result of a search queued via MotionMatchingRequests::QueueSearch(), which gets applied with the next update.
+        void SetQueuedSearchResult(size_t lowestCostFrameIndex) { m_queuedSearchResult = lowestCostFrameIndex; }
+        bool HasQueuedSearch() const { return m_searchQueued; }
+
     private:
         MotionInstance* CreateMotionInstance() const;
         void SamplePose(MotionInstance* motionInstance, Pose& outputPose);
         void SamplePose(Motion* motion, Pose& outputPose, float sampleTime) const;
 
-        size_t FindLowestCostFrameIndex(const Feature::FrameCostContext& context);
+        void PrepareQueryPose(float newMotionTime);
+        Feature::FrameCostContext CreateFrameCostContext() const;
+        void FillQueryFeatureValues(const Feature::FrameCostContext& context);
+        void CancelQueuedSearch();
+
+        //! Start blending towards the lowest cost frame, unless it continues the currently playing motion anyway.
+        //! @param searchLatency The time passed since the query got prepared, which the target frame is advanced by.
+        void SwitchToFrame(size_t currentFrameIndex, size_t lowestCostFrameIndex, float newMotionTime, float searchLatency, float timePassedInSeconds);
 
         MotionMatchingData* m_data = nullptr;
         ActorInstance* m_actorInstance = nullptr;
@@ -96,7 +115,7 @@ namespace EMotionFX::MotionMatching
 
         /// Buffers used for the broad-phase KD-tree search.
         AZStd::vector<float> m_queryFeatureValues; //< The input query features to be compared to every entry/row in the feature matrix with the motion matching search.
-        AZStd::vector<size_t> m_nearestFrames; //< Stores the nearest matching frames / search result from the KD-tree.
+        AZStd::vector<size_t> m_nearestFrames; //< Stores the nearest matching frames / search result from the broad-phase search.
 
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
@@ -108,6 +127,11 @@ namespace EMotionFX::MotionMatching
         size_t m_lowestCostFrameIndex = InvalidIndex;
         float m_lowestCostSearchFrequency = 5.0f; //< How often the lowest cost frame shall be searched per second.
 
+        bool m_useSharedSearch = false;
+        bool m_searchQueued = false; //< A search got queued with the system component and its result has not been applied yet.
+        size_t m_queuedSearchResult = InvalidIndex; //< The lowest cost frame found by the queued search, set by the system component.
+        float m_searchLatency = 0.0f; //< The time passed since the queued search prepared its query.
+
         bool m_blending = false;
         float m_blendWeight = 1.0f;
         float m_blendProgressTime = 0.0f; //< How long are we already blending? In seconds.
@@ -6,8 +6,12 @@
  *
  */
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 
 #include <EMotionFX/Source/AnimGraphObjectFactory.h>
@@ -24,6 +28,8 @@
 #include <FeatureTrajectory.h>
 #include <FeatureVelocity.h>
 #include <EventData.h>
+#include <MotionMatchingData.h>
+#include <MotionMatchingInstance.h>
 #include <MotionMatchingSystemComponent.h>
 #include <PoseDataJointVelocities.h>
 
@@ -80,21 +86,9 @@ namespace EMotionFX::MotionMatching
     {
     }
 
-    MotionMatchingSystemComponent::MotionMatchingSystemComponent()
-    {
-        if (MotionMatchingInterface::Get() == nullptr)
-        {
-            MotionMatchingInterface::Register(this);
-        }
-    }
+    MotionMatchingSystemComponent::MotionMatchingSystemComponent() = default;
 
-    MotionMatchingSystemComponent::~MotionMatchingSystemComponent()
-    {
-        if (MotionMatchingInterface::Get() == this)
-        {
-            MotionMatchingInterface::Unregister(this);
-        }
-    }
+    MotionMatchingSystemComponent::~MotionMatchingSystemComponent() = default;
 
     void MotionMatchingSystemComponent::Init()
     {
@@ -102,6 +96,11 @@ namespace EMotionFX::MotionMatching
 
     void MotionMatchingSystemComponent::Activate()
     {
+        // Only register while active, as the queued searches are executed on tick. Instances search themselves otherwise.
+        if (MotionMatchingInterface::Get() == nullptr)
+        {
+            MotionMatchingInterface::Register(this);
+        }
         MotionMatchingRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
 
@@ -122,6 +121,101 @@ namespace EMotionFX::MotionMatching
     {
         AZ::TickBus::Handler::BusDisconnect();
         MotionMatchingRequestBus::Handler::BusDisconnect();
+        if (MotionMatchingInterface::Get() == this)
+        {
+            MotionMatchingInterface::Unregister(this);
+        }
+
+        // The instances waiting for these fall back to searching themselves.
+        AZStd::scoped_lock<AZStd::mutex> lock(m_queuedSearchesMutex);
+        m_queuedSearches.clear();
+    }
+
+    void MotionMatchingSystemComponent::QueueSearch(MotionMatchingInstance* instance)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_queuedSearchesMutex);
+        m_queuedSearches.emplace_back(instance);
+    }
+
+    void MotionMatchingSystemComponent::CancelSearch(MotionMatchingInstance* instance)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_queuedSearchesMutex);
+        const auto iterator = AZStd::find(m_queuedSearches.begin(), m_queuedSearches.end(), instance);
+        if (iterator != m_queuedSearches.end())
+        {
+            m_queuedSearches.erase(iterator);
+        }
+    }
+
+    void MotionMatchingSystemComponent::ExecuteQueuedSearches()
+    {
+        AZ_PROFILE_SCOPE(Animation, "MotionMatchingSystemComponent::ExecuteQueuedSearches");
+
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_queuedSearchesMutex);
+            m_executingSearches.swap(m_queuedSearches);
+        }
+
+        if (m_executingSearches.empty())
+        {
+            return;
+        }
+
+        // Group the searches by the data they search in, so that each batch shares a single pass over the feature values.
+        AZStd::sort(m_executingSearches.begin(), m_executingSearches.end(),
+            [](const MotionMatchingInstance* a, const MotionMatchingInstance* b)
+            {
+                return a->GetData() < b->GetData();
+            });
+
+        AZ::JobCompletion jobCompletion;
+        const size_t numSearches = m_executingSearches.size();
+        size_t batchStart = 0;
+        while (batchStart < numSearches)
+        {
+            const MotionMatchingData* data = m_executingSearches[batchStart]->GetData();
+            size_t batchEnd = batchStart + 1;
+            while (batchEnd < numSearches && batchEnd - batchStart < s_maxQueriesPerBatch && m_executingSearches[batchEnd]->GetData() == data)
+            {
+                ++batchEnd;
+            }
+
+            MotionMatchingInstance* const* instances = &m_executingSearches[batchStart];
+            const size_t numInstances = batchEnd - batchStart;
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([instances, numInstances]()
+                {
+                    ExecuteSearchBatch(instances, numInstances);
+                }, /*isAutoDelete=*/true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+
+            batchStart = batchEnd;
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        m_executingSearches.clear();
+    }
+
+    void MotionMatchingSystemComponent::ExecuteSearchBatch(MotionMatchingInstance* const* instances, size_t numInstances)
+    {
+        AZ_PROFILE_SCOPE(Animation, "MotionMatchingSystemComponent::ExecuteSearchBatch");
+
+        // 1. Broad-phase search for the whole batch, as all instances search the same data.
+        AZStd::vector<const AZStd::vector<float>*> queries(numInstances);
+        for (size_t i = 0; i < numInstances; ++i)
+        {
+            queries[i] = &instances[i]->GetQueryFeatureValues();
+        }
+
+        AZStd::vector<AZStd::vector<size_t>> nearestFrames;
+        instances[0]->GetData()->FindNearestFrames(queries, nearestFrames);
+
+        // 2. Narrow-phase search per instance, using the query pose and trajectory each instance prepared when queuing its search.
+        for (size_t i = 0; i < numInstances; ++i)
+        {
+            instances[i]->SetQueuedSearchResult(instances[i]->FindLowestCostFrameIndex(nearestFrames[i]));
+        }
     }
 
     void MotionMatchingSystemComponent::DebugDraw(AZ::s32 debugDisplayId)
@@ -147,6 +241,9 @@ namespace EMotionFX::MotionMatching
 
     void MotionMatchingSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        // The animation update ticks before us and queued the searches of the instances that use the shared search.
+        ExecuteQueuedSearches();
+
         // Draw the debug visualizations to the Animation Editor as well as the LY Editor viewport.
         AZ::s32 animationEditorViewportId = -1;
         EMStudio::ViewportPluginRequestBus::BroadcastResult(animationEditorViewportId, &EMStudio::ViewportPluginRequestBus::Events::GetViewportId);
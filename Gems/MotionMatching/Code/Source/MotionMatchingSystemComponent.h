@@ -10,6 +10,8 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <MotionMatching/MotionMatchingBus.h>
 
 namespace EMotionFX::MotionMatching
@@ -32,9 +34,19 @@ namespace EMotionFX::MotionMatching
         MotionMatchingSystemComponent();
         ~MotionMatchingSystemComponent();
 
+        //! The maximum number of queries that are searched together by a single job.
+        static constexpr size_t s_maxQueriesPerBatch = 16;
+
     protected:
         void DebugDraw(AZ::s32 debugDisplayId);
 
+        ////////////////////////////////////////////////////////////////////////
+        // MotionMatchingRequestBus::Handler overrides
+        void QueueSearch(MotionMatchingInstance* instance) override;
+        void CancelSearch(MotionMatchingInstance* instance) override;
+        void ExecuteQueuedSearches() override;
+        ////////////////////////////////////////////////////////////////////////
+
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
         void Init() override;
@@ -50,5 +62,12 @@ namespace EMotionFX::MotionMatching
         }
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        static void ExecuteSearchBatch(MotionMatchingInstance* const* instances, size_t numInstances);
+
+        AZStd::mutex m_queuedSearchesMutex;
+        AZStd::vector<MotionMatchingInstance*> m_queuedSearches;
+        AZStd::vector<MotionMatchingInstance*> m_executingSearches; //< The searches taken from the queue by ExecuteQueuedSearches(), kept to reuse the memory.
     };
 } // namespace EMotionFX::MotionMatching
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <BruteForceSearch.h>
+#include <FeatureMatrix.h>
+#include <FeaturePosition.h>
+#include <Frame.h>
+#include <FrameDatabase.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Compares the broad-phase search methods on a synthetic motion database with one million frames.
+    //! The benchmark argument is the number of position features, each adding three dimensions.
+    class MotionMatchingSearchBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InitDatabase(static_cast<size_t>(state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InitDatabase(static_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            ReleaseDatabase();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            ReleaseDatabase();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void InitDatabase(size_t numFeatures)
+        {
+            m_frameDatabase = AZStd::make_unique<FrameDatabase>();
+            m_featureMatrix = AZStd::make_unique<FeatureMatrix>();
+
+            const size_t numDimensions = numFeatures * 3;
+            for (size_t i = 0; i < numFeatures; ++i)
+            {
+                Feature* feature = aznew FeaturePosition();
+                feature->SetColumnOffset(i * 3);
+                m_features.emplace_back(feature);
+            }
+
+            // Generate clips of smooth random walks, which resembles the continuity of the features extracted from real motions.
+            AZ::SimpleLcgRandom random(42);
+            AZStd::vector<Frame>& frames = m_frameDatabase->GetFrames();
+            frames.reserve(s_numFrames);
+            m_featureMatrix->resize(s_numFrames, numDimensions);
+            AZStd::vector<float> values(numDimensions);
+            for (size_t frame = 0; frame < s_numFrames; ++frame)
+            {
+                const bool startOfClip = (frame % s_framesPerClip) == 0;
+                for (size_t d = 0; d < numDimensions; ++d)
+                {
+                    values[d] = startOfClip ? random.GetRandomFloat() * 2.0f - 1.0f : values[d] + (random.GetRandomFloat() - 0.5f) * 0.05f;
+                    (*m_featureMatrix)(frame, d) = values[d];
+                }
+
+                frames.emplace_back(frame, nullptr, static_cast<float>(frame % s_framesPerClip) / 30.0f, false);
+            }
+
+            m_query.resize(numDimensions);
+            for (size_t d = 0; d < numDimensions; ++d)
+            {
+                m_query[d] = random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+        }
+
+        void ReleaseDatabase()
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features = {};
+            m_query = {};
+            m_result = {};
+            m_featureMatrix.reset();
+            m_frameDatabase.reset();
+        }
+
+        static constexpr size_t s_numFrames = 1000000;
+        static constexpr size_t s_framesPerClip = 300;
+
+        AZStd::unique_ptr<FrameDatabase> m_frameDatabase;
+        AZStd::unique_ptr<FeatureMatrix> m_featureMatrix;
+        AZStd::vector<Feature*> m_features;
+        AZStd::vector<float> m_query;
+        AZStd::vector<size_t> m_result;
+    };
+
+    BENCHMARK_DEFINE_F(MotionMatchingSearchBenchmarkFixture, BM_KdTreeSearch)(benchmark::State& state)
+    {
+        KdTree kdTree;
+        kdTree.Init(*m_frameDatabase, *m_featureMatrix, m_features, /*maxDepth=*/20, /*minFramesPerLeaf=*/1000);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            kdTree.FindNearestNeighbors(m_query, m_result);
+            benchmark::DoNotOptimize(m_result.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(MotionMatchingSearchBenchmarkFixture, BM_BruteForceSearch)(benchmark::State& state)
+    {
+        BruteForceSearch::InitSettings settings;
+        settings.m_usePca = false;
+        BruteForceSearch search;
+        search.Init(*m_featureMatrix, m_features, settings);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            search.FindNearestNeighbors(m_query, m_result);
+            benchmark::DoNotOptimize(m_result.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(MotionMatchingSearchBenchmarkFixture, BM_BruteForceSearchPca)(benchmark::State& state)
+    {
+        BruteForceSearch::InitSettings settings;
+        settings.m_usePca = true;
+        BruteForceSearch search;
+        search.Init(*m_featureMatrix, m_features, settings);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            search.FindNearestNeighbors(m_query, m_result);
+            benchmark::DoNotOptimize(m_result.data());
+        }
+        state.counters["SearchDimensions"] = static_cast<double>(search.GetNumSearchDimensions());
+    }
+
+    //! Searches a batch of 16 queries, like the shared search does for a crowd, so compare against 16 times the single query search.
+    BENCHMARK_DEFINE_F(MotionMatchingSearchBenchmarkFixture, BM_BruteForceSearchBatched)(benchmark::State& state)
+    {
+        BruteForceSearch::InitSettings settings;
+        settings.m_usePca = true;
+        BruteForceSearch search;
+        search.Init(*m_featureMatrix, m_features, settings);
+
+        // Offset the query per character, so that the queries are similar but not the same.
+        AZStd::vector<AZStd::vector<float>> queryValues(16, m_query);
+        AZStd::vector<const AZStd::vector<float>*> queries;
+        for (size_t i = 0; i < queryValues.size(); ++i)
+        {
+            for (float& value : queryValues[i])
+            {
+                value += static_cast<float>(i) * 0.01f;
+            }
+            queries.emplace_back(&queryValues[i]);
+        }
+
+        AZStd::vector<AZStd::vector<size_t>> results;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            search.FindNearestNeighbors(queries, results);
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(MotionMatchingSearchBenchmarkFixture, BM_KdTreeSearch)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MotionMatchingSearchBenchmarkFixture, BM_BruteForceSearch)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MotionMatchingSearchBenchmarkFixture, BM_BruteForceSearchPca)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MotionMatchingSearchBenchmarkFixture, BM_BruteForceSearchBatched)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <Fixture.h>
+#include <BruteForceSearch.h>
+#include <FeatureMatrix.h>
+#include <FeaturePosition.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class BruteForceSearchFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // Two position features, so six columns with different value ranges.
+            m_features.emplace_back(aznew FeaturePosition());
+            m_features.emplace_back(aznew FeaturePosition());
+            m_features[0]->SetColumnOffset(0);
+            m_features[1]->SetColumnOffset(3);
+
+            AZ::SimpleLcgRandom random(1234);
+            m_featureMatrix.resize(s_numFrames, 6);
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                for (size_t column = 0; column < 6; ++column)
+                {
+                    m_featureMatrix(row, column) = random.GetRandomFloat() * static_cast<float>(column + 1);
+                }
+            }
+        }
+
+        void TearDown() override
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features.clear();
+            m_featureMatrix.Clear();
+
+            Fixture::TearDown();
+        }
+
+        AZStd::vector<float> GetQuery(size_t frameIndex) const
+        {
+            AZStd::vector<float> query(6);
+            for (size_t column = 0; column < 6; ++column)
+            {
+                query[column] = m_featureMatrix(frameIndex, column);
+            }
+            return query;
+        }
+
+        static constexpr size_t s_numFrames = 1001;
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<Feature*> m_features;
+    };
+
+    TEST_F(BruteForceSearchFixture, FindsExactFrame)
+    {
+        BruteForceSearch::InitSettings settings;
+        settings.m_usePca = false;
+        settings.m_maxNumResults = 10;
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, settings));
+        EXPECT_EQ(search.GetNumDimensions(), 6);
+        EXPECT_EQ(search.GetNumSearchDimensions(), 6);
+        EXPECT_EQ(search.GetNumFrames(), s_numFrames);
+
+        AZStd::vector<size_t> result;
+        for (const size_t frameIndex : { size_t{0}, size_t{123}, size_t{1000} })
+        {
+            search.FindNearestNeighbors(GetQuery(frameIndex), result);
+            ASSERT_EQ(result.size(), 10);
+            EXPECT_EQ(result[0], frameIndex);
+        }
+    }
+
+    TEST_F(BruteForceSearchFixture, MatchesLinearSearch)
+    {
+        BruteForceSearch::InitSettings settings;
+        settings.m_usePca = true;
+        settings.m_pcaVarianceRatio = 1.0f; // Keeping all components only rotates the search space, which preserves the distances.
+        settings.m_maxNumResults = 5;
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, settings));
+
+        // Calculate the expected result with a plain linear search in the normalized space.
+        AZStd::vector<float> mean(6, 0.0f);
+        AZStd::vector<float> standardDeviation(6, 0.0f);
+        for (size_t column = 0; column < 6; ++column)
+        {
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                mean[column] += m_featureMatrix(row, column) / static_cast<float>(s_numFrames);
+            }
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                const float diff = m_featureMatrix(row, column) - mean[column];
+                standardDeviation[column] += diff * diff / static_cast<float>(s_numFrames);
+            }
+            standardDeviation[column] = sqrtf(standardDeviation[column]);
+        }
+
+        const AZStd::vector<float> query = { 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f };
+        size_t expectedFrame = 0;
+        float minCost = FLT_MAX;
+        for (size_t row = 0; row < s_numFrames; ++row)
+        {
+            float cost = 0.0f;
+            for (size_t column = 0; column < 6; ++column)
+            {
+                const float diff = (m_featureMatrix(row, column) - query[column]) / standardDeviation[column];
+                cost += diff * diff;
+            }
+
+            if (cost < minCost)
+            {
+                minCost = cost;
+                expectedFrame = row;
+            }
+        }
+
+        AZStd::vector<size_t> result;
+        search.FindNearestNeighbors(query, result);
+        ASSERT_EQ(result.size(), 5);
+        EXPECT_EQ(result[0], expectedFrame);
+    }
+
+    TEST_F(BruteForceSearchFixture, BatchedSearchMatchesSingleSearch)
+    {
+        BruteForceSearch::InitSettings settings;
+        settings.m_maxNumResults = 8;
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, settings));
+
+        AZStd::vector<AZStd::vector<float>> queryValues = { GetQuery(3), GetQuery(500), GetQuery(999), { 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f } };
+        AZStd::vector<const AZStd::vector<float>*> queries;
+        for (const AZStd::vector<float>& query : queryValues)
+        {
+            queries.emplace_back(&query);
+        }
+
+        AZStd::vector<AZStd::vector<size_t>> batchedResults;
+        search.FindNearestNeighbors(queries, batchedResults);
+        ASSERT_EQ(batchedResults.size(), queries.size());
+
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            search.FindNearestNeighbors(*queries[i], result);
+            EXPECT_EQ(batchedResults[i], result);
+        }
+    }
+
+    TEST_F(BruteForceSearchFixture, PcaReducesCorrelatedDimensions)
+    {
+        // Make all columns depend on the first one, so that a single principal component explains all variance.
+        for (size_t row = 0; row < s_numFrames; ++row)
+        {
+            const float value = m_featureMatrix(row, 0);
+            for (size_t column = 1; column < 6; ++column)
+            {
+                m_featureMatrix(row, column) = value * static_cast<float>(column + 1) - 3.0f;
+            }
+        }
+
+        BruteForceSearch::InitSettings settings;
+        settings.m_usePca = true;
+        settings.m_pcaVarianceRatio = 0.99f;
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, settings));
+        EXPECT_EQ(search.GetNumSearchDimensions(), 1);
+
+        AZStd::vector<size_t> result;
+        search.FindNearestNeighbors(GetQuery(500), result);
+        ASSERT_FALSE(result.empty());
+        EXPECT_EQ(result[0], 500);
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <Fixture.h>
+#include <FeatureSchema.h>
+#include <FeatureSchemaDefault.h>
+#include <MotionMatchingData.h>
+#include <MotionMatchingInstance.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class SharedSearchFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(5);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+
+            m_motion = aznew Motion("SharedSearchTest");
+            m_motion->SetMotionData(aznew NonUniformMotionData());
+            m_motion->GetMotionData()->SetDuration(2.0f);
+
+            DefaultFeatureSchemaInitSettings schemaSettings;
+            schemaSettings.m_rootJointName = "rootJoint";
+            schemaSettings.m_pelvisJointName = "joint1";
+            schemaSettings.m_leftFootJointName = "joint3";
+            schemaSettings.m_rightFootJointName = "joint4";
+            DefaultFeatureSchema(m_featureSchema, schemaSettings);
+
+            m_data = AZStd::make_unique<MotionMatchingData>(m_featureSchema);
+            MotionMatchingData::InitSettings dataSettings;
+            dataSettings.m_actorInstance = m_actorInstance;
+            dataSettings.m_motionList.emplace_back(m_motion);
+            ASSERT_TRUE(m_data->Init(dataSettings));
+            ASSERT_GT(m_data->GetFrameDatabase().GetNumFrames(), 0);
+        }
+
+        void TearDown() override
+        {
+            m_instances.clear();
+            m_data.reset();
+            m_featureSchema.Clear();
+            m_motion->Destroy();
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            Fixture::TearDown();
+        }
+
+        MotionMatchingInstance* CreateInstance(bool useSharedSearch)
+        {
+            MotionMatchingInstance::InitSettings settings;
+            settings.m_actorInstance = m_actorInstance;
+            settings.m_data = m_data.get();
+            settings.m_useSharedSearch = useSharedSearch;
+
+            m_instances.emplace_back(aznew MotionMatchingInstance());
+            m_instances.back()->Init(settings);
+            return m_instances.back().get();
+        }
+
+        static void UpdateInstance(MotionMatchingInstance* instance, float timePassedInSeconds)
+        {
+            instance->Update(timePassedInSeconds,
+                AZ::Vector3::CreateZero(),
+                AZ::Vector3::CreateAxisY(),
+                TrajectoryQuery::MODE_TARGETDRIVEN,
+                /*pathRadius=*/1.0f,
+                /*pathSpeed=*/1.0f);
+        }
+
+        // Longer than the search interval of the instances, so that each of these updates searches.
+        static constexpr float s_searchTimeDelta = 0.25f;
+        static constexpr float s_shortTimeDelta = 0.01f;
+
+        AZStd::unique_ptr<SimpleJointChainActor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Motion* m_motion = nullptr;
+        FeatureSchema m_featureSchema;
+        AZStd::unique_ptr<MotionMatchingData> m_data;
+        AZStd::vector<AZStd::unique_ptr<MotionMatchingInstance>> m_instances;
+    };
+
+    TEST_F(SharedSearchFixture, SystemComponentProvidesSharedSearchWhileActive)
+    {
+        EXPECT_NE(MotionMatchingInterface::Get(), nullptr);
+    }
+
+    TEST_F(SharedSearchFixture, LocalSearchIsNotQueued)
+    {
+        MotionMatchingInstance* instance = CreateInstance(/*useSharedSearch=*/false);
+        UpdateInstance(instance, s_searchTimeDelta);
+        EXPECT_FALSE(instance->HasQueuedSearch());
+    }
+
+    TEST_F(SharedSearchFixture, QueuedSearchIsAppliedAfterExecution)
+    {
+        MotionMatchingInstance* instance = CreateInstance(/*useSharedSearch=*/true);
+        UpdateInstance(instance, s_searchTimeDelta);
+        ASSERT_TRUE(instance->HasQueuedSearch());
+
+        // Nothing executed the search yet, so the instance keeps waiting.
+        UpdateInstance(instance, s_shortTimeDelta);
+        EXPECT_TRUE(instance->HasQueuedSearch());
+
+        MotionMatchingInterface::Get()->ExecuteQueuedSearches();
+        UpdateInstance(instance, s_shortTimeDelta);
+        EXPECT_FALSE(instance->HasQueuedSearch());
+    }
+
+    TEST_F(SharedSearchFixture, QueuedSearchesAreExecutedInBatches)
+    {
+        // More instances than fit into a single batch.
+        const size_t numInstances = MotionMatchingSystemComponent::s_maxQueriesPerBatch * 2 + 1;
+        for (size_t i = 0; i < numInstances; ++i)
+        {
+            UpdateInstance(CreateInstance(/*useSharedSearch=*/true), s_searchTimeDelta);
+        }
+
+        MotionMatchingInterface::Get()->ExecuteQueuedSearches();
+        for (const AZStd::unique_ptr<MotionMatchingInstance>& instance : m_instances)
+        {
+            ASSERT_TRUE(instance->HasQueuedSearch());
+            UpdateInstance(instance.get(), s_shortTimeDelta);
+            EXPECT_FALSE(instance->HasQueuedSearch());
+        }
+    }
+
+    TEST_F(SharedSearchFixture, DestroyedInstanceIsRemovedFromTheQueue)
+    {
+        MotionMatchingInstance* instance = CreateInstance(/*useSharedSearch=*/true);
+        UpdateInstance(instance, s_searchTimeDelta);
+        ASSERT_TRUE(instance->HasQueuedSearch());
+
+        m_instances.clear();
+        MotionMatchingInterface::Get()->ExecuteQueuedSearches();
+    }
+
+    TEST_F(SharedSearchFixture, UnansweredSearchFallsBackToLocalSearch)
+    {
+        MotionMatchingInstance* instance = CreateInstance(/*useSharedSearch=*/true);
+        UpdateInstance(instance, s_searchTimeDelta);
+        ASSERT_TRUE(instance->HasQueuedSearch());
+
+        // The search interval passed without anybody executing the queued search, the instance has to search itself instead of queuing again.
+        UpdateInstance(instance, s_searchTimeDelta);
+        EXPECT_FALSE(instance->HasQueuedSearch());
+
+        // The fallback only applies to the timed out search, the next search is shared again.
+        UpdateInstance(instance, s_searchTimeDelta);
+        EXPECT_TRUE(instance->HasQueuedSearch());
+    }
+} // namespace EMotionFX::MotionMatching
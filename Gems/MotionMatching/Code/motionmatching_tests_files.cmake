@@ -8,7 +8,10 @@
 
 set(FILES
     Tests/Fixture.h
+    Tests/BruteForceSearchBenchmarks.cpp
+    Tests/BruteForceSearchTests.cpp
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
     Tests/MotionMatchingTest.cpp
+    Tests/SharedSearchTests.cpp
 )
\ No newline at end of file
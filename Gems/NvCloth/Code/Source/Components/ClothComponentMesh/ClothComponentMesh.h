@@ -114,6 +114,9 @@ namespace NvCloth
         AZ::u32 m_renderDataBufferIndex = 0;
         AZStd::array<RenderData, RenderDataBufferSize> m_renderDataBuffer;
 
+        // Normals of the simplified mesh used in cloth simulation, kept to reuse the memory every frame.
+        AZStd::vector<AZ::Vector3> m_simplifiedMeshNormals;
+
         // Vertex mapping between full mesh and simplified mesh used in cloth simulation.
         // Negative elements means the vertex has been removed.
         AZStd::vector<int> m_meshRemappedVertices;
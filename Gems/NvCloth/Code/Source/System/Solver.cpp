@@ -17,6 +17,46 @@
 
 namespace NvCloth
 {
+    namespace
+    {
+        // Cloths are grouped into jobs until they reach this number of particles, so that many small
+        // cloth pieces (flags, capes) don't spend more time scheduling jobs than processing them.
+        const size_t MinParticlesPerJob = 1024;
+
+        // Starts jobs that call the function for each cloth, grouping small cloths together.
+        // The continuation job is not allowed to run until all the jobs are finished.
+        template<typename ClothFunction>
+        void StartClothJobs(const AZStd::vector<Cloth*>& cloths, AZ::Job* continuationJob, const ClothFunction& clothFunction)
+        {
+            size_t firstCloth = 0;
+            size_t numParticles = 0;
+            for (size_t clothIndex = 0; clothIndex < cloths.size(); ++clothIndex)
+            {
+                numParticles += cloths[clothIndex]->GetParticles().size();
+
+                const bool isLastCloth = (clothIndex + 1) == cloths.size();
+                if (numParticles < MinParticlesPerJob && !isLastCloth)
+                {
+                    continue;
+                }
+
+                AZ::Job* job = AZ::CreateJobFunction([&cloths, firstCloth, endCloth = clothIndex + 1, clothFunction]
+                {
+                    for (size_t i = firstCloth; i < endCloth; ++i)
+                    {
+                        clothFunction(cloths[i]);
+                    }
+                }, true /*isAutoDelete*/);
+
+                job->SetDependentStarted(continuationJob);
+                job->Start();
+
+                firstCloth = clothIndex + 1;
+                numParticles = 0;
+            }
+        }
+    } // namespace
+
     Solver::Solver(const AZStd::string& name, NvSolverUniquePtr nvSolver)
         : m_name(name)
         , m_nvSolver(AZStd::move(nvSolver))
@@ -237,22 +277,16 @@ namespace NvCloth
 
     void Solver::ClothsPostSimulationJob::Process()
     {
-        for (Cloth* cloth : *m_cloths)
+        StartClothJobs(*m_cloths, m_continuationJob, [deltaTime = m_deltaTime](Cloth* cloth)
         {
-            AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloth, deltaTime = m_deltaTime]
-            {
-                AZ_PROFILE_SCOPE(Cloth, "NvCloth::PostSimulationJob");
+            AZ_PROFILE_SCOPE(Cloth, "NvCloth::PostSimulationJob");
 
-                // Update the cloth data after the simulation
-                cloth->Update();
-
-                // Issue post-simulation events
-                cloth->m_postSimulationEvent.Signal(cloth->GetId(), deltaTime, cloth->GetParticles());
-            }, true /*isAutoDelete*/);
+            // Update the cloth data after the simulation
+            cloth->Update();
 
-            eventSignalJob->SetDependentStarted(m_continuationJob);
-            eventSignalJob->Start();
-        }
+            // Issue post-simulation events
+            cloth->m_postSimulationEvent.Signal(cloth->GetId(), deltaTime, cloth->GetParticles());
+        });
     }
 
 
@@ -266,19 +300,13 @@ namespace NvCloth
 
     void Solver::ClothsPreSimulationJob::Process()
     {
-        for (Cloth* cloth : *m_cloths)
+        StartClothJobs(*m_cloths, m_continuationJob, [deltaTime = m_deltaTime](Cloth* cloth)
         {
-            AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloth, deltaTime = m_deltaTime]
-            {
-                AZ_PROFILE_SCOPE(Cloth, "NvCloth::PreSimulationJob");
+            AZ_PROFILE_SCOPE(Cloth, "NvCloth::PreSimulationJob");
 
-                // Issue pre-simulation events
-                cloth->m_preSimulationEvent.Signal(cloth->GetId(), deltaTime);
-            }, true /*isAutoDelete*/);
-
-            eventSignalJob->SetDependentStarted(m_continuationJob);
-            eventSignalJob->Start();
-        }
+            // Issue pre-simulation events
+            cloth->m_preSimulationEvent.Signal(cloth->GetId(), deltaTime);
+        });
     }
 
 } // namespace NvCloth
@@ -405,11 +405,20 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        // Start all solvers before waiting for any of them, so that the cloths
+        // of all solvers are processed in parallel with a single sync point.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
+            }
+        }
+
+        for (auto& solverIt : m_solvers)
+        {
+            if (!solverIt->IsUserSimulated())
+            {
                 solverIt->FinishSimulation();
             }
         }
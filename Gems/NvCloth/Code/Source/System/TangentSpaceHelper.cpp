@@ -9,6 +9,7 @@
 #include <System/TangentSpaceHelper.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
 
 namespace NvCloth
 {
@@ -53,13 +54,12 @@ namespace NvCloth
             ComputeNormal(triangleEdges, normal);
 
             // distribute the normals to the vertices.
+            const AZ::Vector3 weights = GetVertexWeightsInTriangle(trianglePositions).GetMax(AZ::Vector3(Tolerance));
             for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
                 const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
 
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
+                outNormals[vertexIndex] += normal * weights.GetElement(vertexIndexInTriangle);
             }
         }
 
@@ -138,9 +138,10 @@ namespace NvCloth
             ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
 
             // distribute the uv vectors to the vertices.
+            const AZ::Vector3 weights = GetVertexWeightsInTriangle(trianglePositions);
             for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+                const float weight = weights.GetElement(vertexIndexInTriangle);
 
                 const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
 
@@ -232,9 +233,10 @@ namespace NvCloth
             }
 
             // distribute the normals and uv vectors to the vertices.
+            const AZ::Vector3 weights = GetVertexWeightsInTriangle(trianglePositions);
             for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+                const float weight = weights.GetElement(vertexIndexInTriangle);
 
                 const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
 
@@ -391,4 +393,31 @@ namespace NvCloth
         const AZ::Vector3 edgeB = trianglePositions[(vertexIndexInTriangle + 1) % 3] - trianglePositions[vertexIndexInTriangle];
         return edgeA.AngleSafe(edgeB);
     }
+
+    AZ::Vector3 TangentSpaceHelper::GetVertexWeightsInTriangle(const TrianglePositions& trianglePositions)
+    {
+        const AZ::Vector3 edge01 = trianglePositions[1] - trianglePositions[0];
+        const AZ::Vector3 edge12 = trianglePositions[2] - trianglePositions[1];
+        const AZ::Vector3 edge20 = trianglePositions[0] - trianglePositions[2];
+
+        // Corners with a zero length edge get no weight, which the per vertex version already handles.
+        if (edge01.IsZero() || edge12.IsZero() || edge20.IsZero())
+        {
+            return AZ::Vector3(
+                GetVertexWeightInTriangle(0, trianglePositions),
+                GetVertexWeightInTriangle(1, trianglePositions),
+                GetVertexWeightInTriangle(2, trianglePositions));
+        }
+
+        // Calculate the angles of all three corners at once, each lane holds the values of one corner.
+        // Corner i is enclosed by the edge leaving it and the (negated) edge arriving at it.
+        const AZ::Vector3 cornerDots(-edge20.Dot(edge01), -edge01.Dot(edge12), -edge12.Dot(edge20));
+        const AZ::Vector3 lengthsSq(edge01.GetLengthSq(), edge12.GetLengthSq(), edge20.GetLengthSq());
+        const AZ::Vector3 arrivingLengthsSq(lengthsSq.GetZ(), lengthsSq.GetX(), lengthsSq.GetY());
+        const AZ::Vector3 invLengths(AZ::Simd::Vec3::SqrtInv((lengthsSq * arrivingLengthsSq).GetSimdValue()));
+
+        // secure against any float precision error, cosine must be between [-1, 1]
+        const AZ::Vector3 cosines = (cornerDots * invLengths).GetClamp(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        return cosines.GetAcos();
+    }
 } // namespace NvCloth
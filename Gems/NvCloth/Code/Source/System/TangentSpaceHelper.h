@@ -78,5 +78,8 @@ namespace NvCloth
             const AZ::Vector3& normal, AZ::Vector3& tangent, AZ::Vector3& bitangent);
 
         float GetVertexWeightInTriangle(AZ::u32 vertexIndexInTriangle, const TrianglePositions& trianglePositions);
+
+        //! Returns the weights of all three vertices of the triangle, as GetVertexWeightInTriangle would, computed together using SIMD.
+        AZ::Vector3 GetVertexWeightsInTriangle(const TrianglePositions& trianglePositions);
     };
 } // namespace NvCloth
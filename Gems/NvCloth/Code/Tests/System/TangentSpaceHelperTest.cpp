@@ -473,6 +473,33 @@ namespace UnitTest
     }
 
 
+    TEST(NvClothSystem, TangentSpaceHelper_CalculateNormalsFoldedTriangles_ReturnsAngleWeightedNormals)
+    {
+        // Two triangles folded by 90 degrees along the X axis, one in the XY plane and one in the XZ plane.
+        // The corner angles at the shared vertices differ per triangle, so their normals get weighted differently.
+        const AZStd::vector<NvCloth::SimParticleFormat> vertices = {{
+            NvCloth::SimParticleFormat(0.0f, 0.0f, 0.0f, 1.0f),
+            NvCloth::SimParticleFormat(1.0f, 0.0f, 0.0f, 1.0f),
+            NvCloth::SimParticleFormat(1.0f, 1.0f, 0.0f, 1.0f),
+            NvCloth::SimParticleFormat(0.0f, 0.0f, 1.0f, 1.0f)
+        }};
+        const AZStd::vector<NvCloth::SimIndexType> indices = {{
+            0, 1, 2,
+            0, 3, 1
+        }};
+
+        AZStd::vector<AZ::Vector3> normals;
+        bool normalsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateNormals(
+            vertices, indices, normals);
+
+        EXPECT_TRUE(normalsCalculated);
+        ASSERT_EQ(normals.size(), vertices.size());
+        EXPECT_THAT(normals[0], IsCloseTolerance(AZ::Vector3(0.0f, 2.0f, 1.0f).GetNormalized(), Tolerance));
+        EXPECT_THAT(normals[1], IsCloseTolerance(AZ::Vector3(0.0f, 1.0f, 2.0f).GetNormalized(), Tolerance));
+        EXPECT_THAT(normals[2], IsCloseTolerance(AZ::Vector3::CreateAxisZ(), Tolerance));
+        EXPECT_THAT(normals[3], IsCloseTolerance(AZ::Vector3::CreateAxisY(), Tolerance));
+    }
+
     TEST(NvClothSystem, TangentSpaceHelper_CalculateNormalsPlaneXYRot90Y_ReturnsCorrectNormals)
     {
         const float width = 1.0f;
@@ -54,12 +54,14 @@ namespace PhysX
         virtual physx::PxConvexMesh* CreateConvexMesh(const void* vertices, AZ::u32 vertexNum, AZ::u32 vertexStride) = 0; // should we use AZ::Vector3* or physx::PxVec3 here?
 
         /// Creates a new convex mesh from pre-cooked convex mesh data.
+        /// Identical cooked data shares the same mesh, the caller owns a reference and has to release it.
         /// @param cookedMeshData Pointer to the cooked convex mesh data.
         /// @param bufferSize Size of the cookedMeshData buffer in bytes.
         /// @return Pointer to the created convex mesh.
         virtual physx::PxConvexMesh* CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize) = 0;
 
         /// Creates a new triangle mesh from pre-cooked mesh data.
+        /// Identical cooked data shares the same mesh, the caller owns a reference and has to release it.
         /// @param cookedMeshData Pointer to the cooked mesh data.
         /// @param bufferSize Size of the cookedMeshData buffer in bytes.
         /// @return Pointer to the created mesh.
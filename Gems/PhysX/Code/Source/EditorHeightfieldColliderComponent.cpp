@@ -12,6 +12,8 @@
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/Shape.h>
 #include <Source/HeightfieldColliderComponent.h>
+#include <Source/RigidBodyStatic.h>
+#include <Source/Shape.h>
 #include <Source/Utils.h>
 #include <System/PhysXSystem.h>
 
@@ -153,8 +155,19 @@ namespace PhysX
             { AZStd::make_shared<Physics::ColliderConfiguration>(m_colliderConfig), m_shapeConfig });
     }
 
-    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
+        // Try to patch just the changed part of the existing heightfield before falling back to rebuilding all of it.
+        if (auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(GetSimulatedBody()); body && (body->GetShapeCount() == 1))
+        {
+            if (auto shape = AZStd::rtti_pointer_cast<PhysX::Shape>(body->GetShape(0));
+                shape && Utils::UpdateHeightfieldShape(GetEntityId(), *m_shapeConfig, *shape, dirtyRegion))
+            {
+                Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+                return;
+            }
+        }
+
         RefreshHeightfield();
     }
 
@@ -17,6 +17,7 @@
 
 #include <Source/HeightfieldColliderComponent.h>
 #include <Source/RigidBodyStatic.h>
+#include <Source/Shape.h>
 #include <Source/SystemComponent.h>
 #include <Source/Utils.h>
 
@@ -86,8 +87,17 @@ namespace PhysX
         ClearHeightfield();
     }
 
-    void HeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void HeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
+        // Try to patch just the changed part of the existing heightfield before falling back to rebuilding all of it.
+        Physics::HeightfieldShapeConfiguration& configuration = static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+        if (auto shape = AZStd::rtti_pointer_cast<PhysX::Shape>(GetHeightfieldShape());
+            shape && Utils::UpdateHeightfieldShape(GetEntityId(), configuration, *shape, dirtyRegion))
+        {
+            Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+            return;
+        }
+
         RefreshHeightfield();
     }
 
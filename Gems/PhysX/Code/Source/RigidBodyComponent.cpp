@@ -12,6 +12,7 @@
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <PhysX/ColliderComponentBus.h>
@@ -19,10 +20,24 @@
 #include <Source/RigidBodyComponent.h>
 #include <Source/Shape.h>
 #include <Source/RigidBody.h>
+#include <Source/Scene/PhysXScene.h>
 
 namespace PhysX
 {
-
+    namespace Internal
+    {
+        SceneTransformSync* GetSceneTransformSync(AzPhysics::SceneHandle sceneHandle)
+        {
+            if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+            {
+                if (auto* physXScene = azrtti_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandle)))
+                {
+                    return &physXScene->GetTransformSync();
+                }
+            }
+            return nullptr;
+        }
+    } // namespace Internal
 
     void RigidBodyComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -89,16 +104,10 @@ namespace PhysX
         }
     }
 
-    RigidBodyComponent::RigidBodyComponent()
-    {
-        InitPhysicsTickHandler();
-    }
-
     RigidBodyComponent::RigidBodyComponent(const AzPhysics::RigidBodyConfiguration& config, AzPhysics::SceneHandle sceneHandle)
         : m_configuration(config)
         , m_attachedSceneHandle(sceneHandle)
     {
-        InitPhysicsTickHandler();
     }
 
     void RigidBodyComponent::Init()
@@ -175,6 +184,11 @@ namespace PhysX
             return;
         }
 
+        if (SceneTransformSync* transformSync = Internal::GetSceneTransformSync(m_attachedSceneHandle))
+        {
+            transformSync->UnregisterRigidBodyComponent(m_rigidBodyHandle);
+        }
+
         if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
         {
             sceneInterface->RemoveSimulatedBody(m_attachedSceneHandle, m_rigidBodyHandle);
@@ -183,7 +197,6 @@ namespace PhysX
         Physics::RigidBodyRequestBus::Handler::BusDisconnect();
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
-        m_sceneFinishSimHandler.Disconnect();
         AZ::TickBus::Handler::BusDisconnect();
     }
 
@@ -195,8 +208,7 @@ namespace PhysX
             AZ::Quaternion newRotation = AZ::Quaternion::CreateIdentity();
             m_interpolator->GetInterpolated(newPosition, newRotation, deltaTime);
 
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldRotationQuaternion, newRotation);
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTranslation, newPosition);
+            SetEntityPose(newPosition, newRotation);
         }
     }
 
@@ -205,17 +217,6 @@ namespace PhysX
         return AZ::ComponentTickBus::TICK_PHYSICS;
     }
 
-    void RigidBodyComponent::InitPhysicsTickHandler()
-    {
-        m_sceneFinishSimHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler([this](
-            [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
-            float fixedDeltatime
-            )
-            {
-                this->PostPhysicsTick(fixedDeltatime);
-            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
-    }
-
     void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
     {
         // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
@@ -250,12 +251,36 @@ namespace PhysX
         }
         else
         {
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldRotationQuaternion, rigidBody->GetOrientation());
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTranslation, rigidBody->GetPosition());
+            SetEntityPose(rigidBody->GetPosition(), rigidBody->GetOrientation());
         }
         m_isLastMovementFromKinematicSource = false;
     }
 
+    void RigidBodyComponent::ApplyActiveBodyPose(const AZ::Vector3& position, const AZ::Quaternion& orientation)
+    {
+        // Same rules as PostPhysicsTick, for a pose that the scene already read from the body.
+        if (!IsPhysicsEnabled() || (IsKinematic() && !m_isLastMovementFromKinematicSource))
+        {
+            return;
+        }
+
+        SetEntityPose(position, orientation);
+        m_isLastMovementFromKinematicSource = false;
+    }
+
+    void RigidBodyComponent::SetEntityPose(const AZ::Vector3& position, const AZ::Quaternion& orientation)
+    {
+        // A single world transform change, so that the children of the entity and the transform listeners
+        // are only notified once per step instead of once for the rotation and once for the translation.
+        if (AZ::TransformInterface* transformInterface = GetEntity()->GetTransform())
+        {
+            AZ::Transform worldTransform = transformInterface->GetWorldTM();
+            worldTransform.SetRotation(orientation);
+            worldTransform.SetTranslation(position);
+            transformInterface->SetWorldTM(worldTransform);
+        }
+    }
+
     void RigidBodyComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
     {
         // Note: OnTransformChanged is not safe at the moment due to TransformComponent design flaw.
@@ -298,10 +323,10 @@ namespace PhysX
             m_rigidBodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &m_configuration);
         }
 
-        // Listen to the PhysX system for events concerning this entity.
-        if (sceneInterface != nullptr)
+        // Have the scene move this entity to the simulated pose after each step.
+        if (SceneTransformSync* transformSync = Internal::GetSceneTransformSync(m_attachedSceneHandle))
         {
-            sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
+            transformSync->RegisterRigidBodyComponent(m_rigidBodyHandle, this);
         }
         AZ::TickBus::Handler::BusConnect();
         AZ::TransformNotificationBus::MultiHandler::BusConnect(GetEntityId());
@@ -576,6 +601,14 @@ namespace PhysX
 
     void RigidBodyComponent::SetKinematicTarget(const AZ::Transform& targetPosition)
     {
+        // The scene only visits the bodies that moved, so have it reset the flag after the next step even if this body doesn't.
+        if (!m_isLastMovementFromKinematicSource)
+        {
+            if (SceneTransformSync* transformSync = Internal::GetSceneTransformSync(m_attachedSceneHandle))
+            {
+                transformSync->AddKinematicSourceBody(m_rigidBodyHandle);
+            }
+        }
         m_isLastMovementFromKinematicSource = true;
         if (AzPhysics::RigidBody* body = GetRigidBody())
         {
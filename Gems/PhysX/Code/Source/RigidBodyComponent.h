@@ -25,6 +25,7 @@ namespace AzPhysics
 
 namespace PhysX
 {
+    class SceneTransformSync;
     class TransformForwardTimeInterpolator;
 
     /// Component used to register an entity as a dynamic rigid body in the PhysX simulation.
@@ -41,7 +42,7 @@ namespace PhysX
 
         static void Reflect(AZ::ReflectContext* context);
 
-        RigidBodyComponent();
+        RigidBodyComponent() = default;
         explicit RigidBodyComponent(const AzPhysics::RigidBodyConfiguration& config, AzPhysics::SceneHandle sceneHandle);
         ~RigidBodyComponent() override = default;
 
@@ -144,10 +145,14 @@ namespace PhysX
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
 
     private:
+        friend class SceneTransformSync;
+
         void SetupConfiguration();
         void CreatePhysics();
-        void InitPhysicsTickHandler();
         void PostPhysicsTick(float fixedDeltaTime);
+        //! Moves the entity to a pose the scene gathered for its body, unless the body is driven by the entity.
+        void ApplyActiveBodyPose(const AZ::Vector3& position, const AZ::Quaternion& orientation);
+        void SetEntityPose(const AZ::Vector3& position, const AZ::Quaternion& orientation);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -160,8 +165,6 @@ namespace PhysX
         bool m_staticTransformAtActivation = false; ///< Whether the transform was static when the component last activated.
         bool m_isLastMovementFromKinematicSource = false; ///< True when the source of the movement comes from SetKinematicTarget as opposed to coming from a Transform change
         bool m_rigidBodyTransformNeedsUpdateOnPhysReEnable = false; ///< True if rigid body transform needs to be synced to the entity's when physics is re-enabled
-
-        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
     };
 
     class TransformForwardTimeInterpolator
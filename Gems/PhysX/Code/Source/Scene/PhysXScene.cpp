@@ -24,6 +24,9 @@
 #include <Joint/PhysXJoint.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -43,6 +46,33 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Query batches smaller than this are run on the calling thread.
+        static constexpr size_t MinParallelQueryBatchSize = 32;
+        //! The number of queries run by each job of a parallel query batch.
+        static constexpr size_t QueryBatchJobSize = 16;
+        //! Scenes with fewer active actors than this gather their poses on the calling thread.
+        static constexpr size_t MinParallelPoseGatherSize = 1024;
+        //! The number of active actors whose pose is gathered by each job.
+        static constexpr size_t PoseGatherJobSize = 256;
+
+        //! Copies a request so that an async query doesn't depend on the lifetime of the caller's request.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CopySceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (const auto* raycastRequest = azrtti_cast<const AzPhysics::RayCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*raycastRequest);
+            }
+            if (const auto* shapecastRequest = azrtti_cast<const AzPhysics::ShapeCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*shapecastRequest);
+            }
+            if (const auto* overlapRequest = azrtti_cast<const AzPhysics::OverlapRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*overlapRequest);
+            }
+            return nullptr;
+        }
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -493,6 +523,9 @@ namespace PhysX
 
     PhysXScene::~PhysXScene()
     {
+        // Async queries use the scene from job threads, so they have to finish before it goes away.
+        WaitForAsyncQueries();
+
         m_physicsSystemConfigChanged.Disconnect();
 
         s_overlapBuffer.swap({});
@@ -584,18 +617,13 @@ namespace PhysX
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
 
-            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            GatherActiveBodyPoses();
 
-            physx::PxU32 numActiveActors = 0;
-            physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
-            activeBodyHandles.reserve(numActiveActors);
-            for (physx::PxU32 i = 0; i < numActiveActors; ++i)
+            activeBodyHandles.reserve(m_activeBodyPoses.size());
+            for (const ActiveBodyPose& pose : m_activeBodyPoses)
             {
-                if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
-                {
-                    activeBodyHandles.emplace_back(actorData->GetBodyHandle());
-                }
+                activeBodyHandles.emplace_back(pose.m_bodyHandle);
             }
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
@@ -603,6 +631,16 @@ namespace PhysX
         FlushQueuedEvents();
         ClearDeferedDeletions();
 
+        // Entities are moved before the finish event is signaled, so that its handlers see the simulated poses.
+        if (activeActorsEnabled)
+        {
+            m_transformSync.SyncActiveBodies(m_activeBodyPoses, m_currentDeltaTime);
+        }
+        else
+        {
+            m_transformSync.SyncAllBodies(m_currentDeltaTime);
+        }
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
             m_sceneSimuationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
@@ -611,6 +649,73 @@ namespace PhysX
         UpdateAzProfilerDataPoints();
     }
 
+    void PhysXScene::GatherActiveBodyPoses()
+    {
+        physx::PxU32 numActiveActors = 0;
+        physx::PxActor** activeActors = nullptr;
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            activeActors = m_pxScene->getActiveActors(numActiveActors);
+        }
+
+        m_activeBodyPoses.resize(numActiveActors);
+
+        // Each range takes its own read lock, the calling thread must not hold one while it waits for the jobs,
+        // otherwise a writer waiting on the scene would block the jobs' readers.
+        auto gatherPoses = [this, activeActors](size_t begin, size_t end)
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t i = begin; i < end; ++i)
+            {
+                ActiveBodyPose& pose = m_activeBodyPoses[i];
+                ActorData* actorData = Utils::GetUserData(activeActors[i]);
+                const physx::PxRigidActor* rigidActor = activeActors[i]->is<physx::PxRigidActor>();
+                if (actorData == nullptr || rigidActor == nullptr)
+                {
+                    pose.m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+                    continue;
+                }
+
+                const physx::PxTransform globalPose = rigidActor->getGlobalPose();
+                pose.m_bodyHandle = actorData->GetBodyHandle();
+                pose.m_position = PxMathConvert(globalPose.p);
+                pose.m_orientation = PxMathConvert(globalPose.q);
+            }
+        };
+
+        const size_t poseCount = m_activeBodyPoses.size();
+        if (poseCount < Internal::MinParallelPoseGatherSize || !AZ::JobContext::GetGlobalContext())
+        {
+            gatherPoses(0, poseCount);
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t begin = 0; begin < poseCount; begin += Internal::PoseGatherJobSize)
+            {
+                const size_t end = AZStd::min(begin + Internal::PoseGatherJobSize, poseCount);
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&gatherPoses, begin, end]()
+                    {
+                        AZ_PROFILE_SCOPE(Physics, "PhysXScene::GatherActiveBodyPoses Job");
+                        gatherPoses(begin, end);
+                    },
+                    true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        m_activeBodyPoses.erase(
+            AZStd::remove_if(m_activeBodyPoses.begin(), m_activeBodyPoses.end(),
+                [](const ActiveBodyPose& pose)
+                {
+                    return pose.m_bodyHandle == AzPhysics::InvalidSimulatedBodyHandle;
+                }),
+            m_activeBodyPoses.end());
+    }
+
     void PhysXScene::FlushQueuedEvents()
     {
         //send queued trigger events
@@ -951,27 +1056,117 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AzPhysics::SceneQueryHitsList results(requests.size());
+        RunQueryBatch(requests, results);
+        return results;
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
+    {
+        if (request == nullptr || !callback)
         {
-            results.emplace_back(QueryScene(request.get()));
+            return false;
         }
-        return results;
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CopySceneQueryRequest(request);
+        if (!requestCopy)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        return QueueAsyncQuery([this, requestId, requestCopy = AZStd::move(requestCopy), callback = AZStd::move(callback)]()
+            {
+                callback(requestId, QueryScene(requestCopy.get()));
+            });
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared pointers, so copying the list keeps them alive until the queries are done.
+        return QueueAsyncQuery([this, requestId, requests, callback = AZStd::move(callback)]()
+            {
+                AzPhysics::SceneQueryHitsList results(requests.size());
+                RunQueryBatch(requests, results);
+                callback(requestId, AZStd::move(results));
+            });
+    }
+
+    void PhysXScene::RunQueryBatch(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        // Holding a read lock across a range of queries turns the lock taken by each query into a recursion count.
+        auto runQueries = [this, &requests, &results](size_t begin, size_t end)
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t index = begin; index < end; ++index)
+            {
+                results[index] = QueryScene(requests[index].get());
+            }
+        };
+
+        const size_t requestCount = requests.size();
+        if (requestCount < Internal::MinParallelQueryBatchSize || !AZ::JobContext::GetGlobalContext())
+        {
+            runQueries(0, requestCount);
+            return;
+        }
+
+        // Each job holds its own read lock, the calling thread doesn't hold one while it waits. A PhysX reader blocks
+        // behind a writer that is waiting for the existing readers, so a job could otherwise wait on the calling thread forever.
+        AZ::JobCompletion jobCompletion;
+        for (size_t begin = 0; begin < requestCount; begin += Internal::QueryBatchJobSize)
+        {
+            const size_t end = AZStd::min(begin + Internal::QueryBatchJobSize, requestCount);
+            AZ::Job* job = AZ::CreateJobFunction([&runQueries, begin, end]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "PhysXScene::RunQueryBatchJob");
+                    runQueries(begin, end);
+                }, true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    bool PhysXScene::QueueAsyncQuery(AZStd::function<void()> query)
+    {
+        if (!AZ::JobContext::GetGlobalContext())
+        {
+            AZ_Warning("Physx", false, "Async scene queries require a job context.");
+            return false;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_asyncQueryMutex);
+            ++m_pendingAsyncQueryCount;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction([this, query = AZStd::move(query)]()
+            {
+                AZ_PROFILE_SCOPE(Physics, "PhysXScene::AsyncQueryJob");
+                query();
+
+                AZStd::scoped_lock lock(m_asyncQueryMutex);
+                --m_pendingAsyncQueryCount;
+                m_asyncQueriesFinished.notify_all();
+            }, true);
+        job->Start();
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    void PhysXScene::WaitForAsyncQueries()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZStd::unique_lock<AZStd::mutex> lock(m_asyncQueryMutex);
+        m_asyncQueriesFinished.wait(lock, [this]() { return m_pendingAsyncQueryCount == 0; });
     }
 
     void PhysXScene::SuppressCollisionEvents(
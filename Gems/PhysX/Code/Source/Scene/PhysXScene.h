@@ -12,9 +12,13 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <Scene/PhysXSceneTransformSync.h>
 
 namespace physx
 {
@@ -79,6 +83,9 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Rigid body components register here to have their entities moved to the simulated pose after each step.
+        SceneTransformSync& GetTransformSync() { return m_transformSync; }
+
     private:
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
@@ -90,6 +97,15 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Copies the pose of every active actor into m_activeBodyPoses, on worker threads when there are enough of them.
+        void GatherActiveBodyPoses();
+
+        //! Runs the queries on worker threads when there are enough of them, and stores the hits in the matching slots of results.
+        void RunQueryBatch(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results);
+        //! Runs the query on a job thread. Returns false if there is no job context to run it.
+        bool QueueAsyncQuery(AZStd::function<void()> query);
+        void WaitForAsyncQueries();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -114,9 +130,15 @@ namespace PhysX
 
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
+        SceneTransformSync m_transformSync; //!< Moves the entities of rigid bodies to their simulated pose.
+        AZStd::vector<ActiveBodyPose> m_activeBodyPoses; //!< The poses of the bodies that moved during the last step.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        AZStd::mutex m_asyncQueryMutex; //!< Guards the count of async queries that haven't finished yet.
+        AZStd::condition_variable m_asyncQueriesFinished;
+        size_t m_pendingAsyncQueryCount = 0;
     };
 }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneTransformSync.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <RigidBodyComponent.h>
+
+namespace PhysX
+{
+    void SceneTransformSync::RegisterRigidBodyComponent(AzPhysics::SimulatedBodyHandle bodyHandle, RigidBodyComponent* component)
+    {
+        const AzPhysics::SimulatedBodyIndex index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (index < 0 || component == nullptr)
+        {
+            return;
+        }
+
+        if (static_cast<size_t>(index) >= m_components.size())
+        {
+            m_components.resize(index + 1);
+        }
+        m_components[index] = { AZStd::get<AzPhysics::HandleTypeIndex::Crc>(bodyHandle), component };
+
+        if (component->m_configuration.m_interpolateMotion)
+        {
+            m_interpolatedComponents.push_back(component);
+        }
+    }
+
+    void SceneTransformSync::UnregisterRigidBodyComponent(AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        RigidBodyComponent* component = FindComponent(bodyHandle);
+        if (component == nullptr)
+        {
+            return;
+        }
+
+        m_components[AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle)] = {};
+
+        auto interpolatedIt = AZStd::find(m_interpolatedComponents.begin(), m_interpolatedComponents.end(), component);
+        if (interpolatedIt != m_interpolatedComponents.end())
+        {
+            *interpolatedIt = nullptr;
+            m_hasUnregisteredInterpolatedComponents = true;
+        }
+    }
+
+    void SceneTransformSync::AddKinematicSourceBody(AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        m_kinematicSourceBodies.push_back(bodyHandle);
+    }
+
+    void SceneTransformSync::SyncActiveBodies(AZStd::span<const ActiveBodyPose> activeBodyPoses, float fixedDeltaTime)
+    {
+        AZ_PROFILE_SCOPE(Physics, "SceneTransformSync::SyncActiveBodies");
+
+        RemoveUnregisteredInterpolatedComponents();
+
+        // Components are looked up again for every pose, as moving an entity can deactivate other entities.
+        for (const ActiveBodyPose& pose : activeBodyPoses)
+        {
+            RigidBodyComponent* component = FindComponent(pose.m_bodyHandle);
+            if (component != nullptr && !component->m_configuration.m_interpolateMotion)
+            {
+                component->ApplyActiveBodyPose(pose.m_position, pose.m_orientation);
+            }
+        }
+
+        // Indices are used rather than iterators, as the list can grow while it is walked.
+        for (size_t i = 0; i < m_interpolatedComponents.size(); ++i)
+        {
+            if (RigidBodyComponent* component = m_interpolatedComponents[i])
+            {
+                component->PostPhysicsTick(fixedDeltaTime);
+            }
+        }
+
+        // Bodies that are asleep or disabled aren't in the active list, but their flag has to be reset all the same.
+        ResetKinematicSourceBodies();
+    }
+
+    void SceneTransformSync::SyncAllBodies(float fixedDeltaTime)
+    {
+        AZ_PROFILE_SCOPE(Physics, "SceneTransformSync::SyncAllBodies");
+
+        RemoveUnregisteredInterpolatedComponents();
+
+        for (size_t i = 0; i < m_components.size(); ++i)
+        {
+            if (RigidBodyComponent* component = m_components[i].m_component)
+            {
+                component->PostPhysicsTick(fixedDeltaTime);
+            }
+        }
+
+        ResetKinematicSourceBodies();
+    }
+
+    RigidBodyComponent* SceneTransformSync::FindComponent(AzPhysics::SimulatedBodyHandle bodyHandle) const
+    {
+        const AzPhysics::SimulatedBodyIndex index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (index < 0 || static_cast<size_t>(index) >= m_components.size())
+        {
+            return nullptr;
+        }
+
+        const RegisteredComponent& registered = m_components[index];
+        return registered.m_bodyCrc == AZStd::get<AzPhysics::HandleTypeIndex::Crc>(bodyHandle) ? registered.m_component : nullptr;
+    }
+
+    void SceneTransformSync::ResetKinematicSourceBodies()
+    {
+        for (AzPhysics::SimulatedBodyHandle bodyHandle : m_kinematicSourceBodies)
+        {
+            if (RigidBodyComponent* component = FindComponent(bodyHandle))
+            {
+                component->m_isLastMovementFromKinematicSource = false;
+            }
+        }
+        m_kinematicSourceBodies.clear();
+    }
+
+    void SceneTransformSync::RemoveUnregisteredInterpolatedComponents()
+    {
+        if (m_hasUnregisteredInterpolatedComponents)
+        {
+            m_interpolatedComponents.erase(
+                AZStd::remove(m_interpolatedComponents.begin(), m_interpolatedComponents.end(), nullptr),
+                m_interpolatedComponents.end());
+            m_hasUnregisteredInterpolatedComponents = false;
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+namespace PhysX
+{
+    class RigidBodyComponent;
+
+    //! The pose of a body that moved during the last simulation step.
+    struct ActiveBodyPose
+    {
+        AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_orientation = AZ::Quaternion::CreateIdentity();
+    };
+
+    //! Helper class that copies the simulated poses of a scene's rigid bodies back to their entities once a simulation step finishes.
+    //! Rigid body components are registered against the slot of their body in the scene, so that the pose of an active body
+    //! can be matched to its component without going through any bus.
+    //! Everything here runs on the main thread, because transform changes notify the entity's children and listeners.
+    class SceneTransformSync
+    {
+    public:
+        SceneTransformSync() = default;
+        ~SceneTransformSync() = default;
+
+        void RegisterRigidBodyComponent(AzPhysics::SimulatedBodyHandle bodyHandle, RigidBodyComponent* component);
+        void UnregisterRigidBodyComponent(AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        //! Tracks a body that was moved with a kinematic target, so that its component stops treating the kinematic target as
+        //! the source of its movement after the next step, whether the body was active during that step or not.
+        void AddKinematicSourceBody(AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        //! Updates the entities of the bodies that moved during the step. Components that interpolate their motion are
+        //! updated every step, as their interpolator has to be kept in step with the fixed time.
+        void SyncActiveBodies(AZStd::span<const ActiveBodyPose> activeBodyPoses, float fixedDeltaTime);
+
+        //! Updates the entities of every registered body, used when the scene doesn't report its active actors.
+        void SyncAllBodies(float fixedDeltaTime);
+
+    private:
+        struct RegisteredComponent
+        {
+            AZ::Crc32 m_bodyCrc;
+            RigidBodyComponent* m_component = nullptr;
+        };
+
+        RigidBodyComponent* FindComponent(AzPhysics::SimulatedBodyHandle bodyHandle) const;
+        void RemoveUnregisteredInterpolatedComponents();
+        void ResetKinematicSourceBodies();
+
+        //! Indexed by the slot of the body in the scene.
+        AZStd::vector<RegisteredComponent> m_components;
+        //! Components that need to be updated every step whether their body moved or not.
+        //! Unregistered components are left as null until the next sync, so that the list can change while it is walked.
+        AZStd::vector<RigidBodyComponent*> m_interpolatedComponents;
+        bool m_hasUnregisteredInterpolatedComponents = false;
+        //! Bodies whose components have their kinematic source flag set. Handles are kept rather than components, so that
+        //! components unregistered in the meantime are skipped.
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_kinematicSourceBodies;
+    };
+} // namespace PhysX
@@ -401,6 +401,39 @@ namespace PhysX
         return nullptr;
     }
 
+    bool Shape::ModifyHeightfieldSamples(
+        int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows, const physx::PxHeightFieldSample* samples)
+    {
+        if (!m_pxShape || m_pxShape->getGeometryType() != physx::PxGeometryType::eHEIGHTFIELD)
+        {
+            return false;
+        }
+
+        PHYSX_SCENE_WRITE_LOCK(GetScene());
+
+        physx::PxHeightFieldGeometry geometry;
+        if (!m_pxShape->getHeightFieldGeometry(geometry) || !geometry.heightField)
+        {
+            return false;
+        }
+
+        physx::PxHeightFieldDesc desc;
+        desc.format = physx::PxHeightFieldFormat::eS16_TM;
+        desc.nbColumns = numColumns;
+        desc.nbRows = numRows;
+        desc.samples.data = samples;
+        desc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+        if (!geometry.heightField->modifySamples(startColumn, startRow, desc, true))
+        {
+            return false;
+        }
+
+        // Setting the geometry again makes the scene pick up the new bounds of the heightfield.
+        m_pxShape->setGeometry(geometry);
+        return true;
+    }
+
     void Shape::GetGeometry(AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, AZ::Aabb* optionalBounds)
     {
         if (!m_pxShape)
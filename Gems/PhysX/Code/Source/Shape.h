@@ -93,6 +93,16 @@ namespace PhysX
 
         void GetGeometry(AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, AZ::Aabb* optionalBounds = nullptr) override;
 
+        //! Replaces a rectangle of samples in this shape's heightfield, without recreating the heightfield.
+        //! @param startColumn First column of the rectangle.
+        //! @param startRow First row of the rectangle.
+        //! @param numColumns Number of columns in the rectangle.
+        //! @param numRows Number of rows in the rectangle.
+        //! @param samples The new samples for the rectangle, in row-major order.
+        //! @return False if this shape isn't a heightfield or the heightfield couldn't be modified.
+        bool ModifyHeightfieldSamples(
+            int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows, const physx::PxHeightFieldSample* samples);
+
     private:
         void BindMaterialsWithPxShape();
         void ExtractMaterialsFromPxShape();
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <System/PhysXCookedMeshCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <PxPhysicsAPI.h>
+
+#include <PhysX/SystemComponentBus.h>
+#include <Source/Utils.h>
+
+namespace PhysX
+{
+    AZ_CVAR(bool, physx_cookedMeshDiskCache, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Store the meshes cooked at run-time in the user folder, so that they don't have to be cooked again in later sessions.");
+    AZ_CVAR(AZ::u32, physx_cookedMeshCacheMemoryBudget, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The size in megabytes of the cooked mesh data kept in memory, so that cooking the same mesh again can be skipped.");
+
+    namespace
+    {
+        constexpr AZ::u32 CookedMeshFileVersion = 2;
+        constexpr size_t MinSweepThreshold = 64;
+
+        struct CookedMeshFileHeader
+        {
+            AZ::u32 m_version = CookedMeshFileVersion;
+            AZ::u32 m_meshType = 0;
+            AZ::u64 m_dataHash = 0;
+            AZ::u64 m_inputSize = 0; //!< The size of the cooking input, which together with the CRC tells apart inputs with the same hash.
+            AZ::u32 m_inputCrc = 0;
+            AZ::u32 m_padding = 0;
+        };
+
+        AZ::HashValue64 HashCookingParams(const physx::PxCookingParams& params, AZ::HashValue64 seed)
+        {
+            // The params contain padding, so hash the members one by one.
+            AZ::HashValue64 hash = AZ::TypeHash64(static_cast<AZ::u32>(PX_PHYSICS_VERSION), seed);
+            hash = AZ::TypeHash64(params.areaTestEpsilon, hash);
+            hash = AZ::TypeHash64(params.planeTolerance, hash);
+            hash = AZ::TypeHash64(static_cast<AZ::u32>(params.convexMeshCookingType), hash);
+            hash = AZ::TypeHash64(params.suppressTriangleMeshRemapTable, hash);
+            hash = AZ::TypeHash64(params.buildTriangleAdjacencies, hash);
+            hash = AZ::TypeHash64(params.buildGPUData, hash);
+            hash = AZ::TypeHash64(params.scale.length, hash);
+            hash = AZ::TypeHash64(params.scale.speed, hash);
+            hash = AZ::TypeHash64(static_cast<physx::PxU32>(params.meshPreprocessParams), hash);
+            hash = AZ::TypeHash64(params.meshWeldTolerance, hash);
+            hash = AZ::TypeHash64(static_cast<AZ::u32>(params.midphaseDesc.getType()), hash);
+            hash = AZ::TypeHash64(params.gaussMapLimit, hash);
+            return hash;
+        }
+
+        PhysXCookedMeshCache::ContentKey CreateCookingInputKey(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, PhysXCookedMeshCache::MeshType meshType)
+        {
+            physx::PxCooking* cooking = nullptr;
+            SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+
+            const AZ::u32 meshTypeValue = static_cast<AZ::u32>(meshType);
+            AZ::HashValue64 hash = AZ::TypeHash64(meshTypeValue);
+            AZ::Crc32 crc(&meshTypeValue, sizeof(meshTypeValue));
+            if (cooking)
+            {
+                // A collision of the params hash only leads to a cache miss of the input, so the params aren't added to the CRC.
+                hash = HashCookingParams(cooking->getParams(), hash);
+            }
+
+            // AZ::Vector3 is padded to 16 bytes, the padding is not initialized so only hash the components.
+            for (AZ::u32 i = 0; i < vertexCount; ++i)
+            {
+                const float components[3] = { vertices[i].GetX(), vertices[i].GetY(), vertices[i].GetZ() };
+                hash = AZ::TypeHash64(components, hash);
+                crc.Add(components, sizeof(components));
+            }
+
+            if (indexCount > 0)
+            {
+                hash = AZ::TypeHash64(reinterpret_cast<const uint8_t*>(indices), sizeof(AZ::u32) * indexCount, hash);
+                crc.Add(indices, sizeof(AZ::u32) * indexCount);
+            }
+
+            PhysXCookedMeshCache::ContentKey key;
+            key.m_hash = static_cast<AZ::u64>(hash);
+            key.m_crc = static_cast<AZ::u32>(crc);
+            key.m_size = sizeof(float) * 3 * vertexCount + sizeof(AZ::u32) * indexCount;
+            return key;
+        }
+
+        AZStd::string GetCookedMeshFilePath(const PhysXCookedMeshCache::ContentKey& key)
+        {
+            return AZStd::string::format("@user@/PhysX/CookedMeshCache/%016llx.pxmesh", static_cast<unsigned long long>(key.m_hash));
+        }
+
+        bool ReadCookedMeshFile(const PhysXCookedMeshCache::ContentKey& key, PhysXCookedMeshCache::MeshType meshType,
+            AZStd::vector<AZ::u8>& cookedData)
+        {
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            const AZStd::string filePath = GetCookedMeshFilePath(key);
+            if (!fileIO || !fileIO->Exists(filePath.c_str()))
+            {
+                return false;
+            }
+
+            auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(filePath);
+            if (!readResult.IsSuccess() || readResult.GetValue().size() <= sizeof(CookedMeshFileHeader))
+            {
+                return false;
+            }
+
+            // Files written by other versions, that were only partially written or that belong to another input with the same hash
+            // are cooked again.
+            const AZStd::vector<AZ::u8>& fileContent = readResult.GetValue();
+            CookedMeshFileHeader header;
+            memcpy(&header, fileContent.data(), sizeof(CookedMeshFileHeader));
+            const AZ::u8* data = fileContent.data() + sizeof(CookedMeshFileHeader);
+            const size_t dataSize = fileContent.size() - sizeof(CookedMeshFileHeader);
+            if (header.m_version != CookedMeshFileVersion || header.m_meshType != static_cast<AZ::u32>(meshType) ||
+                header.m_inputCrc != key.m_crc || header.m_inputSize != static_cast<AZ::u64>(key.m_size) ||
+                header.m_dataHash != static_cast<AZ::u64>(AZ::TypeHash64(data, dataSize)))
+            {
+                return false;
+            }
+
+            cookedData.assign(data, data + dataSize);
+            return true;
+        }
+
+        void WriteCookedMeshFile(const PhysXCookedMeshCache::ContentKey& key, PhysXCookedMeshCache::MeshType meshType,
+            const AZStd::vector<AZ::u8>& cookedData)
+        {
+            CookedMeshFileHeader header;
+            header.m_meshType = static_cast<AZ::u32>(meshType);
+            header.m_inputSize = static_cast<AZ::u64>(key.m_size);
+            header.m_inputCrc = key.m_crc;
+            header.m_dataHash = static_cast<AZ::u64>(AZ::TypeHash64(cookedData.data(), cookedData.size()));
+
+            AZStd::vector<AZ::u8> fileContent(sizeof(CookedMeshFileHeader) + cookedData.size());
+            memcpy(fileContent.data(), &header, sizeof(CookedMeshFileHeader));
+            memcpy(fileContent.data() + sizeof(CookedMeshFileHeader), cookedData.data(), cookedData.size());
+
+            const AZStd::string filePath = GetCookedMeshFilePath(key);
+            [[maybe_unused]] auto writeResult = AZ::Utils::WriteFile(
+                AZStd::string_view(reinterpret_cast<const char*>(fileContent.data()), fileContent.size()), filePath);
+            AZ_Warning("PhysX", writeResult.IsSuccess(), "Failed to store the cooked mesh: %s", writeResult.GetError().c_str());
+        }
+
+        physx::PxBase* CreateNativeMesh(physx::PxPhysics& physics, const AZ::u8* cookedData, size_t cookedDataSize,
+            PhysXCookedMeshCache::MeshType meshType)
+        {
+            // PxDefaultMemoryInputData only accepts a non-const U8* pointer however keeps it as const U8* inside.
+            physx::PxDefaultMemoryInputData inpStream(
+                const_cast<physx::PxU8*>(cookedData),
+                static_cast<physx::PxU32>(cookedDataSize));
+
+            if (meshType == PhysXCookedMeshCache::MeshType::Convex)
+            {
+                return physics.createConvexMesh(inpStream);
+            }
+            else
+            {
+                return physics.createTriangleMesh(inpStream);
+            }
+        }
+
+        void AcquireReference(physx::PxBase* nativeMesh)
+        {
+            if (auto* convexMesh = nativeMesh->is<physx::PxConvexMesh>())
+            {
+                convexMesh->acquireReference();
+            }
+            else if (auto* triangleMesh = nativeMesh->is<physx::PxTriangleMesh>())
+            {
+                triangleMesh->acquireReference();
+            }
+        }
+
+        physx::PxU32 GetReferenceCount(const physx::PxBase* nativeMesh)
+        {
+            if (const auto* convexMesh = nativeMesh->is<physx::PxConvexMesh>())
+            {
+                return convexMesh->getReferenceCount();
+            }
+            else if (const auto* triangleMesh = nativeMesh->is<physx::PxTriangleMesh>())
+            {
+                return triangleMesh->getReferenceCount();
+            }
+            return 0;
+        }
+    } // namespace
+
+    PhysXCookedMeshCache::~PhysXCookedMeshCache()
+    {
+        AZ_Assert(m_nativeMeshes.empty(), "PhysXCookedMeshCache: Shutdown has to be called before the PhysX SDK is released.");
+    }
+
+    void PhysXCookedMeshCache::Initialize(physx::PxPhysics* physics)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_physics = physics;
+        m_sweepThreshold = MinSweepThreshold;
+    }
+
+    void PhysXCookedMeshCache::Shutdown()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        // Meshes still referenced by configurations or shapes would be released after the PhysX SDK is gone.
+        [[maybe_unused]] size_t numMeshesInUse = 0;
+        for (auto& nativeMesh : m_nativeMeshes)
+        {
+            if (GetReferenceCount(nativeMesh.second) > 1)
+            {
+                ++numMeshesInUse;
+            }
+            nativeMesh.second->release();
+        }
+        AZ_Warning("PhysX", numMeshesInUse == 0,
+            "PhysXCookedMeshCache: %zu native meshes are still in use while shutting down, they have to be released before the PhysX SDK.",
+            numMeshesInUse);
+        m_nativeMeshes.clear();
+        m_nativeMeshKeys.clear();
+
+        m_cookedData.clear();
+        m_cookedDataOrder.clear();
+        m_cookedDataSize = 0;
+        m_physics = nullptr;
+    }
+
+    bool PhysXCookedMeshCache::CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
+    {
+        const ContentKey key = CreateCookingInputKey(vertices, vertexCount, nullptr, 0, MeshType::Convex);
+        return CookCached(key, MeshType::Convex, result,
+            [vertices, vertexCount](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream))
+                {
+                    return false;
+                }
+
+                cookedData.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            });
+    }
+
+    bool PhysXCookedMeshCache::CookTriangleMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+        const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
+    {
+        const ContentKey key = CreateCookingInputKey(vertices, vertexCount, indices, indexCount, MeshType::TriangleMesh);
+        return CookCached(key, MeshType::TriangleMesh, result,
+            [vertices, vertexCount, indices, indexCount](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream))
+                {
+                    return false;
+                }
+
+                cookedData.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            });
+    }
+
+    bool PhysXCookedMeshCache::CookCached(const ContentKey& key, MeshType meshType, AZStd::vector<AZ::u8>& result, const CookFunction& cookFunction)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto iterator = m_cookedData.find(key);
+            if (iterator != m_cookedData.end())
+            {
+                result.insert(result.end(), iterator->second.begin(), iterator->second.end());
+                return true;
+            }
+        }
+
+        // Cook without holding the lock, so that different meshes can be cooked in parallel.
+        AZStd::vector<AZ::u8> cookedData;
+        const bool useDiskCache = physx_cookedMeshDiskCache;
+        if (!useDiskCache || !ReadCookedMeshFile(key, meshType, cookedData))
+        {
+            if (!cookFunction(cookedData))
+            {
+                return false;
+            }
+
+            if (useDiskCache)
+            {
+                WriteCookedMeshFile(key, meshType, cookedData);
+            }
+        }
+
+        result.insert(result.end(), cookedData.begin(), cookedData.end());
+        AddCookedData(key, AZStd::move(cookedData));
+        return true;
+    }
+
+    void PhysXCookedMeshCache::AddCookedData(const ContentKey& key, AZStd::vector<AZ::u8> cookedData)
+    {
+        const size_t memoryBudget = static_cast<size_t>(static_cast<AZ::u32>(physx_cookedMeshCacheMemoryBudget)) * 1024 * 1024;
+        if (cookedData.size() > memoryBudget)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_cookedData.find(key) != m_cookedData.end())
+        {
+            return;
+        }
+
+        while (m_cookedDataSize + cookedData.size() > memoryBudget)
+        {
+            auto oldest = m_cookedData.find(m_cookedDataOrder.front());
+            m_cookedDataSize -= oldest->second.size();
+            m_cookedData.erase(oldest);
+            m_cookedDataOrder.pop_front();
+        }
+
+        m_cookedDataSize += cookedData.size();
+        m_cookedDataOrder.push_back(key);
+        m_cookedData.emplace(key, AZStd::move(cookedData));
+    }
+
+    physx::PxBase* PhysXCookedMeshCache::AcquireNativeMesh(const AZ::u8* cookedData, size_t cookedDataSize, MeshType meshType)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        const AZ::u32 meshTypeValue = static_cast<AZ::u32>(meshType);
+        ContentKey key;
+        key.m_hash = static_cast<AZ::u64>(AZ::TypeHash64(cookedData, cookedDataSize, AZ::TypeHash64(meshTypeValue)));
+        AZ::Crc32 crc(&meshTypeValue, sizeof(meshTypeValue));
+        crc.Add(cookedData, cookedDataSize);
+        key.m_crc = static_cast<AZ::u32>(crc);
+        key.m_size = cookedDataSize;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        AZ_Assert(m_physics, "PhysXCookedMeshCache: Native meshes can only be created after the cache is initialized.");
+        if (!m_physics)
+        {
+            return nullptr;
+        }
+
+        auto iterator = m_nativeMeshes.find(key);
+        if (iterator != m_nativeMeshes.end())
+        {
+            AcquireReference(iterator->second);
+            return iterator->second;
+        }
+
+        if (m_nativeMeshes.size() >= m_sweepThreshold)
+        {
+            ReleaseUnusedNativeMeshesUnlocked();
+        }
+
+        physx::PxBase* nativeMesh = CreateNativeMesh(*m_physics, cookedData, cookedDataSize, meshType);
+        if (!nativeMesh)
+        {
+            return nullptr;
+        }
+
+        // The mesh is created with the reference of the cache, acquire another one for the caller.
+        AcquireReference(nativeMesh);
+        m_nativeMeshes.emplace(key, nativeMesh);
+        m_nativeMeshKeys.emplace(nativeMesh, key);
+        return nativeMesh;
+    }
+
+    void PhysXCookedMeshCache::ReleaseNativeMesh(physx::PxBase* nativeMesh)
+    {
+        if (!nativeMesh)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto iterator = m_nativeMeshKeys.find(nativeMesh);
+        nativeMesh->release();
+
+        // Shapes hold their own reference to the mesh, so only the cache is left when no configuration or shape uses it.
+        if (iterator != m_nativeMeshKeys.end() && GetReferenceCount(nativeMesh) == 1)
+        {
+            m_nativeMeshes.erase(iterator->second);
+            m_nativeMeshKeys.erase(iterator);
+            nativeMesh->release();
+        }
+    }
+
+    void PhysXCookedMeshCache::ReleaseUnusedNativeMeshes()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ReleaseUnusedNativeMeshesUnlocked();
+    }
+
+    void PhysXCookedMeshCache::ReleaseUnusedNativeMeshesUnlocked()
+    {
+        // Meshes can also become unused when the last shape using them is released, which the cache isn't notified about.
+        for (auto iterator = m_nativeMeshes.begin(); iterator != m_nativeMeshes.end();)
+        {
+            physx::PxBase* nativeMesh = iterator->second;
+            if (GetReferenceCount(nativeMesh) == 1)
+            {
+                m_nativeMeshKeys.erase(nativeMesh);
+                nativeMesh->release();
+                iterator = m_nativeMeshes.erase(iterator);
+            }
+            else
+            {
+                ++iterator;
+            }
+        }
+
+        // Sweep again once the number of meshes doubled, which keeps the cost per created mesh constant.
+        m_sweepThreshold = AZStd::max(MinSweepThreshold, m_nativeMeshes.size() * 2);
+    }
+
+    size_t PhysXCookedMeshCache::GetNumCookedMeshes() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_cookedData.size();
+    }
+
+    size_t PhysXCookedMeshCache::GetNumNativeMeshes() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_nativeMeshes.size();
+    }
+} // namespace PhysX
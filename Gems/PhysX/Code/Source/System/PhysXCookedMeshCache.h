@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+namespace physx
+{
+    class PxBase;
+    class PxPhysics;
+}
+
+namespace PhysX
+{
+    //! Caches cooked meshes by their content, so that identical geometry is only cooked and created once.
+    //! The cooked data is keyed by the hashes of the cooking input and the cooking params. It is kept in memory up to
+    //! physx_cookedMeshCacheMemoryBudget and optionally stored in the user folder (physx_cookedMeshDiskCache),
+    //! so that later sessions don't cook it again.
+    //! The native meshes are keyed by the hashes of the cooked data and shared through the PhysX reference counting,
+    //! each AcquireNativeMesh has to be matched with a ReleaseNativeMesh.
+    class PhysXCookedMeshCache
+    {
+    public:
+        using MeshType = Physics::CookedMeshShapeConfiguration::MeshType;
+
+        //! Identifies the content of a cooking input or of cooked data.
+        //! Two independent hashes are compared, so that a collision of one of them doesn't return the data of another mesh.
+        struct ContentKey
+        {
+            AZ::u64 m_hash = 0;
+            AZ::u32 m_crc = 0;
+            size_t m_size = 0;
+
+            bool operator==(const ContentKey& other) const
+            {
+                return m_hash == other.m_hash && m_crc == other.m_crc && m_size == other.m_size;
+            }
+        };
+
+        PhysXCookedMeshCache() = default;
+        ~PhysXCookedMeshCache();
+
+        void Initialize(physx::PxPhysics* physics);
+
+        //! Releases the references held by the cache, this has to happen before the PhysX SDK is released.
+        //! Warns about native meshes that are still referenced by others, as they would be released after the SDK.
+        void Shutdown();
+
+        //! Cooks the convex hull of the vertices, or returns the cached result of cooking the same vertices before.
+        //! The cooked data is appended to the result.
+        bool CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result);
+
+        //! Cooks the triangle mesh, or returns the cached result of cooking the same vertices and indices before.
+        //! The cooked data is appended to the result.
+        bool CookTriangleMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result);
+
+        //! Returns a PxConvexMesh or PxTriangleMesh for the cooked data, with a reference acquired for the caller.
+        //! Cooked data that is the same as for a mesh that is still alive returns that mesh.
+        physx::PxBase* AcquireNativeMesh(const AZ::u8* cookedData, size_t cookedDataSize, MeshType meshType);
+
+        //! Releases the reference of the caller, meshes not created by the cache are released as well.
+        void ReleaseNativeMesh(physx::PxBase* nativeMesh);
+
+        //! Removes the native meshes that are only referenced by the cache anymore.
+        void ReleaseUnusedNativeMeshes();
+
+        size_t GetNumCookedMeshes() const;
+        size_t GetNumNativeMeshes() const;
+
+    private:
+        using CookFunction = AZStd::function<bool(AZStd::vector<AZ::u8>&)>;
+
+        bool CookCached(const ContentKey& key, MeshType meshType, AZStd::vector<AZ::u8>& result, const CookFunction& cookFunction);
+        void AddCookedData(const ContentKey& key, AZStd::vector<AZ::u8> cookedData);
+        void ReleaseUnusedNativeMeshesUnlocked();
+
+        struct ContentKeyHash
+        {
+            size_t operator()(const ContentKey& key) const { return static_cast<size_t>(key.m_hash); }
+        };
+
+        physx::PxPhysics* m_physics = nullptr;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<ContentKey, AZStd::vector<AZ::u8>, ContentKeyHash> m_cookedData; //!< Cooked data by the key of the cooking input.
+        AZStd::deque<ContentKey> m_cookedDataOrder; //!< The keys in m_cookedData from oldest to newest, to evict the oldest first.
+        size_t m_cookedDataSize = 0; //!< The summed size in bytes of the data in m_cookedData.
+        AZStd::unordered_map<ContentKey, physx::PxBase*, ContentKeyHash> m_nativeMeshes;
+        AZStd::unordered_map<physx::PxBase*, ContentKey> m_nativeMeshKeys; //!< Reverse lookup of m_nativeMeshes.
+        size_t m_sweepThreshold = 0; //!< The number of native meshes at which the unused ones get released.
+    };
+} // namespace PhysX
@@ -428,6 +428,7 @@ namespace PhysX
 
         // set up cooking for height fields, meshes etc.
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
+        m_cookedMeshCache.Initialize(m_physXSdk.m_physics);
 
         // Set up CPU dispatcher
 #if defined(AZ_PLATFORM_LINUX)
@@ -446,6 +447,8 @@ namespace PhysX
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
 
+        m_cookedMeshCache.Shutdown();
+
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
 
@@ -17,6 +17,7 @@
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCookedMeshCache.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -73,6 +74,7 @@ namespace PhysX
         //TEMP -- until these are fully moved over here
         physx::PxPhysics* GetPxPhysics() { return m_physXSdk.m_physics; }
         physx::PxCooking* GetPxCooking() { return m_physXSdk.m_cooking; }
+        PhysXCookedMeshCache& GetCookedMeshCache() { return m_cookedMeshCache; }
         physx::PxCpuDispatcher* GetPxCpuDispathcher()
         {
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
@@ -105,6 +107,7 @@ namespace PhysX
             physx::PxCooking* m_cooking = nullptr;
         };
         PhysXSdk m_physXSdk;
+        PhysXCookedMeshCache m_cookedMeshCache; //! Shares the cooked data and native meshes of identical geometry.
         PxAzAllocatorCallback m_physXAllocatorCallback;
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
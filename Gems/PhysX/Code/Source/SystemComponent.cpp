@@ -299,44 +299,27 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
-        
-        return cookingResult;
+        return m_physXSystem->GetCookedMeshCache().CookConvexMesh(vertices, vertexCount, result);
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
-
-        if (cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
-
-        return cookingResult;
+        return m_physXSystem->GetCookedMeshCache().CookTriangleMesh(vertices, vertexCount, indices, indexCount, result);
     }
 
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
     {
-        physx::PxDefaultMemoryInputData inpStream(reinterpret_cast<physx::PxU8*>(const_cast<void*>(cookedMeshData)), bufferSize);
-        //TEMP until this in moved over
-        return m_physXSystem->GetPxPhysics()->createConvexMesh(inpStream);
+        physx::PxBase* convexMesh = m_physXSystem->GetCookedMeshCache().AcquireNativeMesh(
+            static_cast<const AZ::u8*>(cookedMeshData), bufferSize, Physics::CookedMeshShapeConfiguration::MeshType::Convex);
+        return convexMesh ? convexMesh->is<physx::PxConvexMesh>() : nullptr;
     }
 
     physx::PxTriangleMesh* SystemComponent::CreateTriangleMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
     {
-        physx::PxDefaultMemoryInputData inpStream(reinterpret_cast<physx::PxU8*>(const_cast<void*>(cookedMeshData)), bufferSize);
-        //TEMP until this in moved over
-        return m_physXSystem->GetPxPhysics()->createTriangleMesh(inpStream);
+        physx::PxBase* triangleMesh = m_physXSystem->GetCookedMeshCache().AcquireNativeMesh(
+            static_cast<const AZ::u8*>(cookedMeshData), bufferSize, Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh);
+        return triangleMesh ? triangleMesh->is<physx::PxTriangleMesh>() : nullptr;
     }
 
     AZStd::shared_ptr<Physics::Shape> SystemComponent::CreateShape(const Physics::ColliderConfiguration& colliderConfiguration, const Physics::ShapeConfiguration& configuration)
@@ -368,7 +351,16 @@ namespace PhysX
 
     void SystemComponent::ReleaseNativeMeshObject(void* nativeMeshObject)
     {
-        if (nativeMeshObject)
+        if (!nativeMeshObject)
+        {
+            return;
+        }
+
+        if (m_physXSystem)
+        {
+            m_physXSystem->GetCookedMeshCache().ReleaseNativeMesh(static_cast<physx::PxBase*>(nativeMeshObject));
+        }
+        else
         {
             static_cast<physx::PxBase*>(nativeMeshObject)->release();
         }
@@ -40,6 +40,7 @@
 #include <Source/StaticRigidBodyComponent.h>
 #include <Source/RigidBodyStatic.h>
 #include <Source/Utils.h>
+#include <System/PhysXSystem.h>
 #include <PhysX/PhysXLocks.h>
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/MathConversion.h>
@@ -51,6 +52,12 @@ namespace PhysX
         physx::PxBase* CreateNativeMeshObjectFromCookedData(const AZStd::vector<AZ::u8>& cookedData,
             Physics::CookedMeshShapeConfiguration::MeshType meshType)
         {
+            // Share the mesh with the other configurations that have the same cooked data.
+            if (PhysXSystem* physXSystem = GetPhysXSystem())
+            {
+                return physXSystem->GetCookedMeshCache().AcquireNativeMesh(cookedData.data(), cookedData.size(), meshType);
+            }
+
             // PxDefaultMemoryInputData only accepts a non-const U8* pointer however keeps it as const U8* inside.
             // Hence we do const_cast here but it's safe to assume the data won't be modifed.
             physx::PxDefaultMemoryInputData inpStream(
@@ -129,21 +136,9 @@ namespace PhysX
             return { materialIndex0, materialIndex1 };
         }
 
-        void CreatePxGeometryFromHeightfield(
-            Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
+        //! Returns the scale factor that converts heights within the given bounds to the int16 heights that PhysX stores.
+        static float GetHeightfieldScaleFactor(float minHeightBounds, float maxHeightBounds)
         {
-            physx::PxHeightField* heightfield = nullptr;
-
-            const AZ::Vector2& gridSpacing = heightfieldConfig.GetGridResolution();
-
-            const int32_t numCols = heightfieldConfig.GetNumColumns();
-            const int32_t numRows = heightfieldConfig.GetNumRows();
-
-            const float rowScale = gridSpacing.GetX();
-            const float colScale = gridSpacing.GetY();
-
-            const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
-            const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
             const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
 
             // We're making the assumption right now that the min/max bounds are centered around 0.
@@ -162,11 +157,57 @@ namespace PhysX
             // full 16-bit range.
             // Note that the scaleFactor choice here affects overall precision.  For each bit that the integer part of our max
             // height uses, that's one less bit for the fractional part.
-            const float scaleFactor = (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
-            const float heightScale{ 1.0f / scaleFactor };
+            return (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+        }
 
+        //! Converts the heightfield sample at the given row and column to a PhysX heightfield sample.
+        static physx::PxHeightFieldSample CreatePxHeightfieldSample(
+            const AZStd::vector<Physics::HeightMaterialPoint>& samples,
+            const int32_t row, const int32_t col,
+            const int32_t numRows, const int32_t numCols,
+            const float minHeightBounds, const float maxHeightBounds, const float scaleFactor)
+        {
             [[maybe_unused]] constexpr uint8_t physxMaximumMaterialIndex = 0x7f;
 
+            const Physics::HeightMaterialPoint& currentSample = samples[(row * numCols) + col];
+            AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
+
+            physx::PxHeightFieldSample physxSample;
+            physxSample.height = azlossy_cast<physx::PxI16>(
+                AZ::GetClamp(currentSample.m_height, minHeightBounds, maxHeightBounds) * scaleFactor);
+
+            auto [materialIndex0, materialIndex1] = GetPhysXMaterialIndicesFromHeightfieldSamples(samples, row, col, numRows, numCols);
+            physxSample.materialIndex0 = materialIndex0;
+            physxSample.materialIndex1 = materialIndex1;
+
+            if (currentSample.m_quadMeshType == Physics::QuadMeshType::SubdivideUpperLeftToBottomRight)
+            {
+                // Set the tesselation flag to say that we need to go from UL to BR
+                physxSample.setTessFlag();
+            }
+
+            return physxSample;
+        }
+
+        void CreatePxGeometryFromHeightfield(
+            Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
+        {
+            physx::PxHeightField* heightfield = nullptr;
+
+            const AZ::Vector2& gridSpacing = heightfieldConfig.GetGridResolution();
+
+            const int32_t numCols = heightfieldConfig.GetNumColumns();
+            const int32_t numRows = heightfieldConfig.GetNumRows();
+
+            const float rowScale = gridSpacing.GetX();
+            const float colScale = gridSpacing.GetY();
+
+            const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
+            const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
+
+            const float scaleFactor = GetHeightfieldScaleFactor(minHeightBounds, maxHeightBounds);
+            const float heightScale{ 1.0f / scaleFactor };
+
             // Delete the cached heightfield object if it is there, and create a new one and save in the shape configuration
             heightfieldConfig.SetCachedNativeHeightfield(nullptr);
 
@@ -181,28 +222,8 @@ namespace PhysX
                 {
                     for (int32_t col = 0; col < numCols; col++)
                     {
-                        auto GetIndex = [numCols](int32_t row, int32_t col)
-                        {
-                            return (row * numCols) + col;
-                        };
-
-                        const int32_t sampleIndex = GetIndex(row, col);
-
-                        const Physics::HeightMaterialPoint& currentSample = samples[sampleIndex];
-                        physx::PxHeightFieldSample& currentPhysxSample = physxSamples[sampleIndex];
-                        AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
-                        currentPhysxSample.height = azlossy_cast<physx::PxI16>(
-                            AZ::GetClamp(currentSample.m_height, minHeightBounds, maxHeightBounds) * scaleFactor);
-
-                        auto [materialIndex0, materialIndex1] = GetPhysXMaterialIndicesFromHeightfieldSamples(samples, row, col, numRows, numCols);
-                        currentPhysxSample.materialIndex0 = materialIndex0;
-                        currentPhysxSample.materialIndex1 = materialIndex1;
-
-                        if (currentSample.m_quadMeshType == Physics::QuadMeshType::SubdivideUpperLeftToBottomRight)
-                        {
-                            // Set the tesselation flag to say that we need to go from UL to BR
-                            currentPhysxSample.setTessFlag();
-                        }
+                        physxSamples[(row * numCols) + col] = CreatePxHeightfieldSample(
+                            samples, row, col, numRows, numCols, minHeightBounds, maxHeightBounds, scaleFactor);
                     }
                 }
 
@@ -1596,6 +1617,92 @@ namespace PhysX
             return configuration;
         }
 
+        bool UpdateHeightfieldShape(
+            AZ::EntityId heightfieldProviderId, Physics::HeightfieldShapeConfiguration& configuration, Shape& shape,
+            const AZ::Aabb& dirtyRegion)
+        {
+            if (!dirtyRegion.IsValid() || !configuration.GetCachedNativeHeightfield())
+            {
+                return false;
+            }
+
+            // Changes to the size, spacing, or bounds of the heightfield need a new heightfield.
+            AZ::Vector2 gridSpacing(1.0f);
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                gridSpacing, heightfieldProviderId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSpacing);
+
+            int32_t numRows = 0;
+            int32_t numColumns = 0;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                heightfieldProviderId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, numColumns, numRows);
+
+            float minHeightBounds = 0.0f;
+            float maxHeightBounds = 0.0f;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                heightfieldProviderId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldHeightBounds,
+                minHeightBounds, maxHeightBounds);
+
+            if (!gridSpacing.IsClose(configuration.GetGridResolution()) || (numRows != configuration.GetNumRows()) ||
+                (numColumns != configuration.GetNumColumns()) || (minHeightBounds != configuration.GetMinHeightBounds()) ||
+                (maxHeightBounds != configuration.GetMaxHeightBounds()) ||
+                (configuration.GetSamples().size() != aznumeric_cast<size_t>(numRows * numColumns)))
+            {
+                return false;
+            }
+
+            size_t startColumn = 0;
+            size_t startRow = 0;
+            size_t numUpdatedColumns = 0;
+            size_t numUpdatedRows = 0;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                heightfieldProviderId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, dirtyRegion,
+                startColumn, startRow, numUpdatedColumns, numUpdatedRows);
+
+            if ((numUpdatedColumns == 0) || (numUpdatedRows == 0))
+            {
+                // Nothing in the heightfield changed.
+                return true;
+            }
+
+            // Updating the whole heightfield in place isn't any cheaper than building a new one.
+            if ((numUpdatedColumns * numUpdatedRows) == (configuration.GetSamples().size()))
+            {
+                return false;
+            }
+
+            auto updateSampleCallback = [&configuration](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+            {
+                configuration.ModifySample(column, row, point);
+            };
+
+            Physics::HeightfieldProviderRequestsBus::Event(
+                heightfieldProviderId, &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials, updateSampleCallback,
+                startColumn, startRow, numUpdatedColumns, numUpdatedRows);
+
+            // The material indices of a PhysX sample come from the samples below and to the right of it,
+            // so the samples one row above and one column to the left of the updated region need to be rebuilt too.
+            const int32_t firstRow = AZStd::max(aznumeric_cast<int32_t>(startRow) - 1, 0);
+            const int32_t firstColumn = AZStd::max(aznumeric_cast<int32_t>(startColumn) - 1, 0);
+            const int32_t endRow = aznumeric_cast<int32_t>(startRow + numUpdatedRows);
+            const int32_t endColumn = aznumeric_cast<int32_t>(startColumn + numUpdatedColumns);
+
+            const float scaleFactor = GetHeightfieldScaleFactor(minHeightBounds, maxHeightBounds);
+            const AZStd::vector<Physics::HeightMaterialPoint>& samples = configuration.GetSamples();
+
+            AZStd::vector<physx::PxHeightFieldSample> physxSamples;
+            physxSamples.reserve((endRow - firstRow) * (endColumn - firstColumn));
+            for (int32_t row = firstRow; row < endRow; row++)
+            {
+                for (int32_t col = firstColumn; col < endColumn; col++)
+                {
+                    physxSamples.emplace_back(CreatePxHeightfieldSample(
+                        samples, row, col, numRows, numColumns, minHeightBounds, maxHeightBounds, scaleFactor));
+                }
+            }
+
+            return shape.ModifyHeightfieldSamples(firstColumn, firstRow, endColumn - firstColumn, endRow - firstRow, physxSamples.data());
+        }
+
         void SetMaterialsFromHeightfieldProvider(const AZ::EntityId& heightfieldProviderId, Physics::MaterialSelection& materialSelection)
         {
             AZStd::vector<Physics::MaterialId> materialList;
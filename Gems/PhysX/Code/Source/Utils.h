@@ -198,6 +198,14 @@ namespace PhysX
 
         Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
 
+        //! Updates the part of a heightfield shape that's inside the dirty region with the latest data from the heightfield provider,
+        //! patching both the samples in the shape configuration and the samples of the PhysX heightfield used by the shape.
+        //! Returns false if the heightfield can't be updated in place (for example when its size changed), in which case the
+        //! whole heightfield shape needs to be created again.
+        bool UpdateHeightfieldShape(
+            AZ::EntityId heightfieldProviderId, Physics::HeightfieldShapeConfiguration& configuration, Shape& shape,
+            const AZ::Aabb& dirtyRegion);
+
         void SetMaterialsFromHeightfieldProvider(const AZ::EntityId& heightfieldProviderId, Physics::MaterialSelection& materialSelection);
 
         namespace Geometry
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
@@ -28,6 +29,7 @@ namespace PhysX::Benchmarks
         static const float SphereShapeRadius = 2.0f;
         static const AZ::u32 MinRadius = 2u;
         static const int Seed = 100;
+        static const size_t BatchSize = 1024;
 
         static const std::vector<std::vector<std::pair<int64_t, int64_t>>> BenchmarkConfigs =
         {
@@ -226,6 +228,61 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Creates a batch of raycasts from the origin, cycling through the boxes.
+    static AzPhysics::SceneQueryRequests CreateRaycastBatch(const std::vector<AZ::Vector3>& boxes)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(SceneQueryConstants::BatchSize);
+        for (size_t i = 0; i < SceneQueryConstants::BatchSize; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = boxes[i % boxes.size()].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+        return requests;
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.counters["QueriesPerSecond"] = benchmark::Counter(
+            aznumeric_cast<double>(state.iterations() * requests.size()), benchmark::Counter::kIsRate);
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AZStd::binary_semaphore batchDone;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&batchDone](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    benchmark::DoNotOptimize(results);
+                    batchDone.release();
+                });
+            if (queued)
+            {
+                batchDone.acquire();
+            }
+        }
+
+        state.counters["QueriesPerSecond"] = benchmark::Counter(
+            aznumeric_cast<double>(state.iterations() * requests.size()), benchmark::Counter::kIsRate);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -250,5 +307,17 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
@@ -8,6 +8,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 
+#include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
@@ -1009,4 +1010,128 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //enough requests to be split across several jobs, cycling through the targets
+        constexpr size_t requestCount = 500;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result lines up with its request
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_ReturnsExpectedHitsThroughCallback)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::SceneQuery::AsyncRequestId callbackRequestId = -1;
+        AzPhysics::SceneQueryHits callbackHits;
+        AZStd::binary_semaphore callbackCalled;
+
+        {
+            //the request only has to stay alive until the call returns
+            AzPhysics::RayCastRequest request;
+            request.m_start = AZ::Vector3::CreateZero();
+            request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+            request.m_distance = 200.0f;
+
+            const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 7, &request,
+                [&](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+                {
+                    callbackRequestId = requestId;
+                    callbackHits = AZStd::move(hits);
+                    callbackCalled.release();
+                });
+            ASSERT_TRUE(queued);
+        }
+
+        ASSERT_TRUE(callbackCalled.try_acquire_for(AZStd::chrono::seconds(10)));
+        EXPECT_EQ(callbackRequestId, 7);
+        ASSERT_EQ(callbackHits.m_hits.size(), 1);
+        EXPECT_TRUE(callbackHits.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_ReturnsExpectedHitsThroughCallback)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& targetPos : positions)
+        {
+            AZStd::shared_ptr<AzPhysics::OverlapRequest> request = AZStd::make_shared<AzPhysics::OverlapRequest>(
+                AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(2.0f, AZ::Transform::CreateTranslation(targetPos)));
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQuery::AsyncRequestId callbackRequestId = -1;
+        AzPhysics::SceneQueryHitsList callbackResults;
+        AZStd::binary_semaphore callbackCalled;
+
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 3, requests,
+            [&](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList results)
+            {
+                callbackRequestId = requestId;
+                callbackResults = AZStd::move(results);
+                callbackCalled.release();
+            });
+        ASSERT_TRUE(queued);
+
+        ASSERT_TRUE(callbackCalled.try_acquire_for(AZStd::chrono::seconds(10)));
+        EXPECT_EQ(callbackRequestId, 3);
+        ASSERT_EQ(callbackResults.size(), requests.size());
+        for (size_t i = 0; i < callbackResults.size(); i++)
+        {
+            ASSERT_EQ(callbackResults[i].m_hits.size(), 1);
+            EXPECT_TRUE(callbackResults[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
 }
@@ -8,7 +8,9 @@
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 
@@ -585,4 +587,39 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, SceneActiveSimulatedBodies_EntitiesMovedToSimulatedPose)
+    {
+        // Enough falling bodies for the poses to be gathered on worker threads, plus one asleep that shouldn't move.
+        constexpr AZ::u32 FallingSphereCount = 1100;
+        AZStd::vector<EntityPtr> fallingSpheres;
+        fallingSpheres.reserve(FallingSphereCount);
+        for (AZ::u32 i = 0; i < FallingSphereCount; ++i)
+        {
+            const AZ::Vector3 position(static_cast<float>(i % 40) * 2.0f, static_cast<float>(i / 40) * 2.0f, 10.0f);
+            fallingSpheres.push_back(TestUtils::CreateSphereEntity(m_testSceneHandle, position, 0.5f));
+        }
+
+        const AZ::Vector3 sleepingPosition(-10.0f, -10.0f, 10.0f);
+        EntityPtr sleepingSphere = TestUtils::CreateSphereEntity(m_testSceneHandle, sleepingPosition, 0.5f);
+        Physics::RigidBodyRequestBus::Event(sleepingSphere->GetId(), &Physics::RigidBodyRequests::ForceAsleep);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+
+        for (const EntityPtr& sphere : fallingSpheres)
+        {
+            AZ::Vector3 bodyPosition = AZ::Vector3::CreateZero();
+            Physics::RigidBodyRequestBus::EventResult(bodyPosition, sphere->GetId(), &Physics::RigidBodyRequests::GetCenterOfMassWorld);
+
+            AZ::Vector3 entityPosition = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(entityPosition, sphere->GetId(), &AZ::TransformInterface::GetWorldTranslation);
+
+            EXPECT_LT(entityPosition.GetZ(), 10.0f);
+            EXPECT_TRUE(entityPosition.IsClose(bodyPosition));
+        }
+
+        AZ::Vector3 sleepingEntityPosition = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(sleepingEntityPosition, sleepingSphere->GetId(), &AZ::TransformInterface::GetWorldTranslation);
+        EXPECT_TRUE(sleepingEntityPosition.IsClose(sleepingPosition));
+    }
 }
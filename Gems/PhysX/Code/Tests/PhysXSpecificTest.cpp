@@ -28,6 +28,7 @@
 #include <RigidBodyStatic.h>
 #include <SphereColliderComponent.h>
 #include <Utils.h>
+#include <System/PhysXSystem.h>
 
 #include <PhysX/MathConversion.h>
 #include <PhysX/PhysXLocks.h>
@@ -883,6 +884,93 @@ namespace PhysX
         rigidBody = nullptr;
     }
 
+    TEST_F(PhysXSpecificTest, CookedMeshCache_ShapesFromIdenticalCookedData_ShareNativeMesh)
+    {
+        // Generate input data
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = false;
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), cookedData);
+        ASSERT_TRUE(cookingResult);
+
+        // Two configurations with the same cooked data, like instances of the same mesh collider
+        Physics::CookedMeshShapeConfiguration firstShapeConfig;
+        firstShapeConfig.SetCookedMeshData(cookedData.data(), cookedData.size(),
+            Physics::CookedMeshShapeConfiguration::MeshType::Convex);
+        Physics::CookedMeshShapeConfiguration secondShapeConfig = firstShapeConfig;
+        secondShapeConfig.m_scale = AZ::Vector3(2.0f, 2.0f, 2.0f);
+
+        AZStd::shared_ptr<Physics::Shape> firstShape =
+            AZ::Interface<Physics::System>::Get()->CreateShape(Physics::ColliderConfiguration(), firstShapeConfig);
+        AZStd::shared_ptr<Physics::Shape> secondShape =
+            AZ::Interface<Physics::System>::Get()->CreateShape(Physics::ColliderConfiguration(), secondShapeConfig);
+        ASSERT_TRUE(firstShape != nullptr);
+        ASSERT_TRUE(secondShape != nullptr);
+
+        // Both shapes use the same native mesh
+        EXPECT_NE(firstShapeConfig.GetCachedNativeMesh(), nullptr);
+        EXPECT_EQ(firstShapeConfig.GetCachedNativeMesh(), secondShapeConfig.GetCachedNativeMesh());
+    }
+
+    TEST_F(PhysXSpecificTest, CookedMeshCache_CookingIdenticalGeometry_ReturnsCachedData)
+    {
+        PhysXCookedMeshCache& cookedMeshCache = GetPhysXSystem()->GetCookedMeshCache();
+        VertexIndexData cubeMeshData = TestUtils::GenerateCubeMeshData(3.0f);
+
+        AZStd::vector<AZ::u8> firstCookedData;
+        bool cookingResult = false;
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookTriangleMeshToMemory,
+            cubeMeshData.first.data(), static_cast<AZ::u32>(cubeMeshData.first.size()),
+            cubeMeshData.second.data(), static_cast<AZ::u32>(cubeMeshData.second.size()),
+            firstCookedData);
+        ASSERT_TRUE(cookingResult);
+        const size_t numCookedMeshes = cookedMeshCache.GetNumCookedMeshes();
+        EXPECT_GT(numCookedMeshes, 0);
+
+        // Cooking the same geometry again doesn't add a new entry and returns the same data
+        AZStd::vector<AZ::u8> secondCookedData;
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookTriangleMeshToMemory,
+            cubeMeshData.first.data(), static_cast<AZ::u32>(cubeMeshData.first.size()),
+            cubeMeshData.second.data(), static_cast<AZ::u32>(cubeMeshData.second.size()),
+            secondCookedData);
+        ASSERT_TRUE(cookingResult);
+        EXPECT_EQ(cookedMeshCache.GetNumCookedMeshes(), numCookedMeshes);
+        EXPECT_EQ(firstCookedData, secondCookedData);
+    }
+
+    TEST_F(PhysXSpecificTest, CookedMeshCache_ReleasingAllUsers_ReleasesNativeMesh)
+    {
+        PhysXCookedMeshCache& cookedMeshCache = GetPhysXSystem()->GetCookedMeshCache();
+        cookedMeshCache.ReleaseUnusedNativeMeshes();
+        const size_t numNativeMeshes = cookedMeshCache.GetNumNativeMeshes();
+
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(2.0f);
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = false;
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), cookedData);
+        ASSERT_TRUE(cookingResult);
+
+        AZStd::shared_ptr<Physics::Shape> shape;
+        {
+            Physics::CookedMeshShapeConfiguration shapeConfig;
+            shapeConfig.SetCookedMeshData(cookedData.data(), cookedData.size(),
+                Physics::CookedMeshShapeConfiguration::MeshType::Convex);
+            shape = AZ::Interface<Physics::System>::Get()->CreateShape(Physics::ColliderConfiguration(), shapeConfig);
+            ASSERT_TRUE(shape != nullptr);
+            EXPECT_EQ(cookedMeshCache.GetNumNativeMeshes(), numNativeMeshes + 1);
+        }
+
+        // The configuration released its reference, but the shape still uses the mesh
+        EXPECT_EQ(cookedMeshCache.GetNumNativeMeshes(), numNativeMeshes + 1);
+
+        // The cache isn't notified when the shape releases the mesh, so it is removed when sweeping the unused meshes
+        shape.reset();
+        cookedMeshCache.ReleaseUnusedNativeMeshes();
+        EXPECT_EQ(cookedMeshCache.GetNumNativeMeshes(), numNativeMeshes);
+    }
+
     TEST_F(PhysXSpecificTest, Shape_ConstructorDestructor_PxShapeReferenceCounterIsCorrect)
     {
         // Create physx::PxShape object
@@ -122,10 +122,14 @@ set(FILES
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
+    Source/Scene/PhysXSceneTransformSync.h
+    Source/Scene/PhysXSceneTransformSync.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
+    Source/System/PhysXCookedMeshCache.h
+    Source/System/PhysXCookedMeshCache.cpp
     Source/System/PhysXCpuDispatcher.cpp
     Source/System/PhysXCpuDispatcher.h
     Source/System/PhysXJob.cpp
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <SurfaceData/SurfaceDataRegionCache.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
 namespace SurfaceData
@@ -85,5 +86,8 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //results of region queries, invalidated whenever the surface data in a region changes
+        mutable SurfaceDataRegionCache m_regionCache;
     };
 }
@@ -31,6 +31,10 @@ namespace SurfaceData
 
         //! allows multiple threads to call
         using MutexType = AZStd::recursive_mutex;
+        //! The mutex only guards connection changes, so queries from multiple threads run concurrently.  This is safe because
+        //! modifiers unregister themselves from the SurfaceData system before disconnecting, so no query
+        //! can still be dispatching to a disconnected handler.
+        static const bool LocklessDispatch = true;
 
         virtual void ModifySurfacePoints(
             AZStd::span<const AZ::Vector3> positions,
@@ -31,6 +31,10 @@ namespace SurfaceData
 
         //! allows multiple threads to call
         using MutexType = AZStd::recursive_mutex;
+        //! The mutex only guards connection changes, so queries from multiple threads run concurrently.  This is safe because
+        //! providers unregister themselves from the SurfaceData system before disconnecting, so no query
+        //! can still be dispatching to a disconnected handler.
+        static const bool LocklessDispatch = true;
 
         //! Get all of the surface points that this provider has at the given input position.
         //! @param inPosition - The input position to query. Only XY are guaranteed to be valid, Z should be ignored.
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <SurfaceData/SurfacePointList.h>
+#include <SurfaceData/SurfaceTag.h>
+
+namespace SurfaceData
+{
+    //! Caches the results of region queries (SurfaceDataSystemRequests::GetSurfacePointsFromRegion), keyed on the region's XY
+    //! extents, the step size and the desired tags. Vegetation sectors request the same regions over and over as they get
+    //! rebuilt, so most of those queries can skip the surface providers and modifiers entirely.
+    //!
+    //! Results are stored compactly: only the points that are visible through the SurfacePointList query APIs are kept,
+    //! in sorted order, with the surface tag weights of every point packed into a single list.
+    //! Entries are discarded when a dirty area overlaps them, and the least recently used entries are evicted once the cache
+    //! holds more than the maximum number of entries. All methods are thread safe.
+    class SurfaceDataRegionCache
+    {
+    public:
+        static constexpr size_t DefaultMaxEntryCount = 256;
+
+        SurfaceDataRegionCache() = default;
+        AZ_DISABLE_COPY_MOVE(SurfaceDataRegionCache);
+
+        //! Sets the maximum number of entries to keep, evicting the least recently used entries if needed.
+        void SetMaxEntryCount(size_t maxEntryCount);
+        size_t GetMaxEntryCount() const;
+
+        //! Returns a number that changes every time entries are invalidated. Read this before running a query,
+        //! and pass it to StorePoints() so that results computed from data that changed in the meantime are dropped.
+        uint64_t GetGeneration() const;
+
+        //! Copies the cached points for the query into surfacePointList. Returns false if the query isn't cached.
+        bool GetPoints(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags,
+            SurfacePointList& surfacePointList) const;
+
+        //! Caches the points that were generated for the query, unless entries were invalidated since generation was read.
+        void StorePoints(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags,
+            const SurfacePointList& surfacePointList, uint64_t generation);
+
+        //! Discards every entry whose region overlaps the dirty area in XY. An invalid area discards every entry.
+        void InvalidateRegion(const AZ::Aabb& dirtyArea);
+
+        //! Discards all entries.
+        void Clear();
+
+        size_t GetEntryCount() const;
+
+    private:
+        struct QueryKey
+        {
+            float m_minX = 0.0f;
+            float m_minY = 0.0f;
+            float m_maxX = 0.0f;
+            float m_maxY = 0.0f;
+            float m_stepX = 0.0f;
+            float m_stepY = 0.0f;
+            SurfaceTagVector m_desiredTags;
+
+            bool operator==(const QueryKey& other) const;
+        };
+
+        struct QueryKeyHash
+        {
+            size_t operator()(const QueryKey& key) const;
+        };
+
+        //! The query results in structure-of-arrays form, with every point stored in the order that it's enumerated in.
+        struct CompactPoints
+        {
+            size_t m_inputPositionSize = 0;
+            size_t m_maxPointsPerInput = 0;
+            AZ::Aabb m_surfacePointBounds = AZ::Aabb::CreateNull();
+            AZStd::vector<size_t> m_pointCountPerInput;
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Vector3> m_normals;
+            AZStd::vector<AZ::EntityId> m_creatorIds;
+            //! For each point, the end of its range of tags and weights in m_weights.
+            AZStd::vector<AZ::u32> m_weightEnds;
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeight> m_weights;
+        };
+
+        using QueryLruList = AZStd::list<QueryKey>;
+
+        struct Entry
+        {
+            AZStd::shared_ptr<const CompactPoints> m_points;
+            QueryLruList::iterator m_lruIterator;
+        };
+
+        static QueryKey MakeKey(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags);
+        static void Compact(const SurfacePointList& surfacePointList, CompactPoints& compactPoints);
+        static void Expand(const CompactPoints& compactPoints, SurfacePointList& surfacePointList);
+
+        void EvictEntries();
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<QueryKey, Entry, QueryKeyHash> m_entries;
+
+        //! Query keys ordered from the most to the least recently used.
+        mutable QueryLruList m_lruList;
+        size_t m_maxEntryCount = DefaultMaxEntryCount;
+
+        AZStd::atomic<uint64_t> m_generation{ 0 };
+    };
+} // namespace SurfaceData
@@ -33,6 +33,9 @@ namespace SurfaceData
 
         //! allows multiple threads to call
         using MutexType = AZStd::recursive_mutex;
+        //! The mutex only guards connection changes, so queries from multiple threads run concurrently.
+        //! The SurfaceData system protects its registered providers and modifiers with its own lock.
+        static const bool LocklessDispatch = true;
 
         // Get all surface points located at the inPosition that matches one or more of the desiredTags.  Only the XY components of inPosition are used.
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const = 0;
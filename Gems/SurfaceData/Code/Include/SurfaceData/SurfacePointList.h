@@ -20,6 +20,8 @@
 
 namespace SurfaceData
 {
+    class SurfaceDataRegionCache;
+
     //! SurfacePointList stores a collection of surface point data, which consists of positions, normals, and surface tag weights.
     //! This class is specifically designed to be used in the following ways.
     //!
@@ -161,6 +163,9 @@ namespace SurfaceData
         }
 
     protected:
+        // The region cache stores lists in a compacted form and rebuilds them directly from that form.
+        friend class SurfaceDataRegionCache;
+
         // Remove any output surface points that don't contain any of the provided surface tags.
         void FilterPoints(AZStd::span<const SurfaceTag> desiredTags);
 
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SurfaceData/SurfaceDataRegionCache.h>
+
+#include <AzCore/std/hash.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+namespace SurfaceData
+{
+    bool SurfaceDataRegionCache::QueryKey::operator==(const QueryKey& other) const
+    {
+        return m_minX == other.m_minX && m_minY == other.m_minY && m_maxX == other.m_maxX && m_maxY == other.m_maxY &&
+            m_stepX == other.m_stepX && m_stepY == other.m_stepY && m_desiredTags == other.m_desiredTags;
+    }
+
+    size_t SurfaceDataRegionCache::QueryKeyHash::operator()(const QueryKey& key) const
+    {
+        size_t seed = 0;
+        AZStd::hash_combine(seed, key.m_minX, key.m_minY, key.m_maxX, key.m_maxY, key.m_stepX, key.m_stepY);
+        for (const SurfaceTag& tag : key.m_desiredTags)
+        {
+            AZStd::hash_combine(seed, static_cast<AZ::u32>(tag));
+        }
+        return seed;
+    }
+
+    void SurfaceDataRegionCache::SetMaxEntryCount(size_t maxEntryCount)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_maxEntryCount = maxEntryCount;
+        EvictEntries();
+    }
+
+    size_t SurfaceDataRegionCache::GetMaxEntryCount() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_maxEntryCount;
+    }
+
+    uint64_t SurfaceDataRegionCache::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    bool SurfaceDataRegionCache::GetPoints(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags,
+        SurfacePointList& surfacePointList) const
+    {
+        AZStd::shared_ptr<const CompactPoints> compactPoints;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            auto entryIter = m_entries.find(MakeKey(inRegion, stepSize, desiredTags));
+            if (entryIter == m_entries.end())
+            {
+                return false;
+            }
+
+            // Move the entry to the front of the list, splicing keeps the iterator stored in the entry valid.
+            m_lruList.splice(m_lruList.begin(), m_lruList, entryIter->second.m_lruIterator);
+            compactPoints = entryIter->second.m_points;
+        }
+
+        // The points are immutable once they're cached, so they can be expanded without holding the lock.
+        Expand(*compactPoints, surfacePointList);
+        return true;
+    }
+
+    void SurfaceDataRegionCache::StorePoints(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags,
+        const SurfacePointList& surfacePointList, uint64_t generation)
+    {
+        if ((GetMaxEntryCount() == 0) || (generation != m_generation))
+        {
+            return;
+        }
+
+        auto compactPoints = AZStd::make_shared<CompactPoints>();
+        Compact(surfacePointList, *compactPoints);
+
+        AZStd::scoped_lock lock(m_mutex);
+
+        // Check again now that we hold the lock, since invalidations happen while holding it.
+        if ((m_maxEntryCount == 0) || (generation != m_generation))
+        {
+            return;
+        }
+
+        QueryKey key = MakeKey(inRegion, stepSize, desiredTags);
+        auto [entryIter, inserted] = m_entries.try_emplace(key);
+        Entry& entry = entryIter->second;
+        entry.m_points = AZStd::move(compactPoints);
+        if (inserted)
+        {
+            m_lruList.push_front(AZStd::move(key));
+            entry.m_lruIterator = m_lruList.begin();
+            EvictEntries();
+        }
+        else
+        {
+            m_lruList.splice(m_lruList.begin(), m_lruList, entry.m_lruIterator);
+        }
+    }
+
+    void SurfaceDataRegionCache::InvalidateRegion(const AZ::Aabb& dirtyArea)
+    {
+        if (!dirtyArea.IsValid())
+        {
+            Clear();
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        ++m_generation;
+
+        for (auto entryIter = m_entries.begin(); entryIter != m_entries.end();)
+        {
+            const QueryKey& key = entryIter->first;
+            const AZ::Aabb queryRegion =
+                AZ::Aabb::CreateFromMinMax(AZ::Vector3(key.m_minX, key.m_minY, 0.0f), AZ::Vector3(key.m_maxX, key.m_maxY, 0.0f));
+            if (AabbOverlaps2D(queryRegion, dirtyArea))
+            {
+                m_lruList.erase(entryIter->second.m_lruIterator);
+                entryIter = m_entries.erase(entryIter);
+            }
+            else
+            {
+                ++entryIter;
+            }
+        }
+    }
+
+    void SurfaceDataRegionCache::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        ++m_generation;
+        m_entries.clear();
+        m_lruList.clear();
+    }
+
+    size_t SurfaceDataRegionCache::GetEntryCount() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_entries.size();
+    }
+
+    SurfaceDataRegionCache::QueryKey SurfaceDataRegionCache::MakeKey(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags)
+    {
+        // Region queries ignore the Z range of the region, so it isn't part of the key.
+        QueryKey key;
+        key.m_minX = inRegion.GetMin().GetX();
+        key.m_minY = inRegion.GetMin().GetY();
+        key.m_maxX = inRegion.GetMax().GetX();
+        key.m_maxY = inRegion.GetMax().GetY();
+        key.m_stepX = stepSize.GetX();
+        key.m_stepY = stepSize.GetY();
+        key.m_desiredTags = desiredTags;
+        return key;
+    }
+
+    void SurfaceDataRegionCache::Compact(const SurfacePointList& surfacePointList, CompactPoints& compactPoints)
+    {
+        compactPoints.m_inputPositionSize = surfacePointList.m_inputPositionSize;
+        compactPoints.m_surfacePointBounds = surfacePointList.m_surfacePointBounds;
+        compactPoints.m_pointCountPerInput.assign(
+            surfacePointList.m_numSurfacePointsPerInput.begin(), surfacePointList.m_numSurfacePointsPerInput.end());
+
+        // Only the points referenced by the sorted indices are visible, points that were filtered out are dropped here.
+        size_t pointCount = 0;
+        for (size_t inputIndex = 0; inputIndex < compactPoints.m_pointCountPerInput.size(); inputIndex++)
+        {
+            pointCount += compactPoints.m_pointCountPerInput[inputIndex];
+            compactPoints.m_maxPointsPerInput = AZStd::max(compactPoints.m_maxPointsPerInput, compactPoints.m_pointCountPerInput[inputIndex]);
+        }
+
+        compactPoints.m_positions.reserve(pointCount);
+        compactPoints.m_normals.reserve(pointCount);
+        compactPoints.m_creatorIds.reserve(pointCount);
+        compactPoints.m_weightEnds.reserve(pointCount);
+
+        for (size_t inputIndex = 0; inputIndex < compactPoints.m_pointCountPerInput.size(); inputIndex++)
+        {
+            const size_t startIndex = surfacePointList.GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
+            for (size_t index = startIndex; index < startIndex + compactPoints.m_pointCountPerInput[inputIndex]; index++)
+            {
+                const size_t pointIndex = surfacePointList.m_sortedSurfacePointIndices[index];
+                compactPoints.m_positions.emplace_back(surfacePointList.m_surfacePositionList[pointIndex]);
+                compactPoints.m_normals.emplace_back(surfacePointList.m_surfaceNormalList[pointIndex]);
+                compactPoints.m_creatorIds.emplace_back(surfacePointList.m_surfaceCreatorIdList[pointIndex]);
+
+                surfacePointList.m_surfaceWeightsList[pointIndex].EnumerateWeights(
+                    [&compactPoints](AZ::Crc32 tag, float weight)
+                    {
+                        compactPoints.m_weights.emplace_back(tag, weight);
+                        return true;
+                    });
+                compactPoints.m_weightEnds.emplace_back(aznumeric_cast<AZ::u32>(compactPoints.m_weights.size()));
+            }
+        }
+    }
+
+    void SurfaceDataRegionCache::Expand(const CompactPoints& compactPoints, SurfacePointList& surfacePointList)
+    {
+        surfacePointList.Clear();
+
+        surfacePointList.m_inputPositionSize = compactPoints.m_inputPositionSize;
+        surfacePointList.m_maxSurfacePointsPerInput = compactPoints.m_maxPointsPerInput;
+        surfacePointList.m_surfacePointBounds = compactPoints.m_surfacePointBounds;
+        surfacePointList.m_numSurfacePointsPerInput.assign(
+            compactPoints.m_pointCountPerInput.begin(), compactPoints.m_pointCountPerInput.end());
+
+        surfacePointList.m_surfacePositionList.assign(compactPoints.m_positions.begin(), compactPoints.m_positions.end());
+        surfacePointList.m_surfaceNormalList.assign(compactPoints.m_normals.begin(), compactPoints.m_normals.end());
+        surfacePointList.m_surfaceCreatorIdList.assign(compactPoints.m_creatorIds.begin(), compactPoints.m_creatorIds.end());
+
+        // The tags were stored in the order that SurfaceTagWeights keeps them in, so adding them back in order just appends them.
+        surfacePointList.m_surfaceWeightsList.resize(compactPoints.m_positions.size());
+        AZ::u32 weightStart = 0;
+        for (size_t pointIndex = 0; pointIndex < compactPoints.m_positions.size(); pointIndex++)
+        {
+            SurfaceTagWeights& weights = surfacePointList.m_surfaceWeightsList[pointIndex];
+            for (AZ::u32 weightIndex = weightStart; weightIndex < compactPoints.m_weightEnds[pointIndex]; weightIndex++)
+            {
+                weights.AddSurfaceTagWeight(compactPoints.m_weights[weightIndex].m_surfaceType, compactPoints.m_weights[weightIndex].m_weight);
+            }
+            weightStart = compactPoints.m_weightEnds[pointIndex];
+        }
+
+        // The points are stored in sorted order, so the sorted indices for each input position are just its range of points.
+        surfacePointList.m_sortedSurfacePointIndices.resize(compactPoints.m_inputPositionSize * compactPoints.m_maxPointsPerInput);
+        size_t pointIndex = 0;
+        for (size_t inputIndex = 0; inputIndex < compactPoints.m_pointCountPerInput.size(); inputIndex++)
+        {
+            const size_t startIndex = surfacePointList.GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
+            for (size_t index = startIndex; index < startIndex + compactPoints.m_pointCountPerInput[inputIndex]; index++)
+            {
+                surfacePointList.m_sortedSurfacePointIndices[index] = pointIndex++;
+            }
+        }
+    }
+
+    void SurfaceDataRegionCache::EvictEntries()
+    {
+        while (m_entries.size() > m_maxEntryCount)
+        {
+            m_entries.erase(m_lruList.back());
+            m_lruList.pop_back();
+        }
+    }
+} // namespace SurfaceData
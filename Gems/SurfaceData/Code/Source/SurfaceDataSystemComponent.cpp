@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -22,6 +23,22 @@
 
 namespace SurfaceData
 {
+    AZ_CVAR(bool,
+        sd_surfaceRegionCacheEnabled,
+        true,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Caches the surface points generated by region queries until the surface data in the region changes."
+    );
+
+    AZ_CVAR(AZ::u32,
+        sd_surfaceRegionCacheMaxEntries,
+        aznumeric_cast<AZ::u32>(SurfaceDataRegionCache::DefaultMaxEntryCount),
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of region queries kept in the surface region cache."
+    );
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -101,6 +118,7 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::Deactivate()
     {
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
+        m_regionCache.Clear();
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -108,6 +126,8 @@ namespace SurfaceData
         const SurfaceDataRegistryHandle handle = RegisterSurfaceDataProviderInternal(entry);
         if (handle != InvalidSurfaceDataRegistryHandle)
         {
+            m_regionCache.InvalidateRegion(entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause *all* vegetation sectors to get marked as dirty.
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds);
@@ -120,6 +140,8 @@ namespace SurfaceData
         const SurfaceDataRegistryEntry entry = UnregisterSurfaceDataProviderInternal(handle);
         if (entry.m_entityId.IsValid())
         {
+            m_regionCache.InvalidateRegion(entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for new bounds
             // would cause *all* vegetation sectors to get marked as dirty.
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds);
@@ -132,6 +154,8 @@ namespace SurfaceData
 
         if (UpdateSurfaceDataProviderInternal(handle, entry, oldBounds))
         {
+            m_regionCache.InvalidateRegion(oldBounds);
+            m_regionCache.InvalidateRegion(entry.m_bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, oldBounds, entry.m_bounds);
         }
     }
@@ -141,6 +165,8 @@ namespace SurfaceData
         const SurfaceDataRegistryHandle handle = RegisterSurfaceDataModifierInternal(entry);
         if (handle != InvalidSurfaceDataRegistryHandle)
         {
+            m_regionCache.InvalidateRegion(entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for old bounds
             // would cause *all* vegetation sectors to get marked as dirty.
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds);
@@ -153,6 +179,8 @@ namespace SurfaceData
         const SurfaceDataRegistryEntry entry = UnregisterSurfaceDataModifierInternal(handle);
         if (entry.m_entityId.IsValid())
         {
+            m_regionCache.InvalidateRegion(entry.m_bounds);
+
             // Send in the entry's bounds as both the old and new bounds, since a null Aabb for new bounds
             // would cause *all* vegetation sectors to get marked as dirty.
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds, entry.m_bounds);
@@ -165,12 +193,15 @@ namespace SurfaceData
 
         if (UpdateSurfaceDataModifierInternal(handle, entry, oldBounds))
         {
+            m_regionCache.InvalidateRegion(oldBounds);
+            m_regionCache.InvalidateRegion(entry.m_bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, oldBounds, entry.m_bounds);
         }
     }
 
     void SurfaceDataSystemComponent::RefreshSurfaceData(const AZ::Aabb& dirtyBounds)
     {
+        m_regionCache.InvalidateRegion(dirtyBounds);
         SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, AZ::EntityId(), dirtyBounds, dirtyBounds);
     }
 
@@ -211,6 +242,25 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize,
         const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointLists) const
     {
+        const bool useRegionCache = sd_surfaceRegionCacheEnabled;
+        uint64_t cacheGeneration = 0;
+        if (useRegionCache)
+        {
+            if (m_regionCache.GetMaxEntryCount() != sd_surfaceRegionCacheMaxEntries)
+            {
+                m_regionCache.SetMaxEntryCount(sd_surfaceRegionCacheMaxEntries);
+            }
+
+            if (m_regionCache.GetPoints(inRegion, stepSize, desiredTags, surfacePointLists))
+            {
+                return;
+            }
+
+            // Read the generation before generating the points, so that the results get dropped instead of cached if the
+            // surface data changes while they're being generated.
+            cacheGeneration = m_regionCache.GetGeneration();
+        }
+
         const size_t totalQueryPositions = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) *
             aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
 
@@ -228,6 +278,11 @@ namespace SurfaceData
         }
 
         GetSurfacePointsFromListInternal(inPositions, inRegion, desiredTags, surfacePointLists);
+
+        if (useRegionCache)
+        {
+            m_regionCache.StorePoints(inRegion, stepSize, desiredTags, surfacePointLists, cacheGeneration);
+        }
     }
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromList(
@@ -10,6 +10,7 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Math/Random.h>
@@ -148,6 +149,35 @@ namespace UnitTest
             return tagFilterList;
         }
 
+        static void SetSurfaceRegionCacheEnabled(bool enabled)
+        {
+            if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+            {
+                console->PerformCommand(enabled ? "sd_surfaceRegionCacheEnabled true" : "sd_surfaceRegionCacheEnabled false");
+            }
+        }
+
+        void RunGetSurfacePointsFromRegionBenchmark(benchmark::State& state)
+        {
+            // Create our benchmark world
+            float worldSize = aznumeric_cast<float>(state.range(0));
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateBenchmarkEntities(worldSize);
+            SurfaceData::SurfaceTagVector filterTags = CreateBenchmarkTagFilterList();
+
+            // Query every point in our world at 1 meter intervals.
+            for ([[maybe_unused]] auto _ : state)
+            {
+                SurfaceData::SurfacePointList points;
+
+                AZ::Aabb inRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(worldSize));
+                AZ::Vector2 stepSize(1.0f);
+                SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                    &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, inRegion, stepSize, filterTags,
+                    points);
+                benchmark::DoNotOptimize(points);
+            }
+        }
+
     protected:
         void SetUp([[maybe_unused]] const benchmark::State& state) override
         {
@@ -204,23 +234,19 @@ namespace UnitTest
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        // Create our benchmark world
-        float worldSize = aznumeric_cast<float>(state.range(0));
-        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateBenchmarkEntities(worldSize);
-        SurfaceData::SurfaceTagVector filterTags = CreateBenchmarkTagFilterList();
+        // Turn off the region cache so that every iteration generates the points.
+        SetSurfaceRegionCacheEnabled(false);
+        RunGetSurfacePointsFromRegionBenchmark(state);
+        SetSurfaceRegionCacheEnabled(true);
+    }
 
-        // Query every point in our world at 1 meter intervals.
-        for ([[maybe_unused]] auto _ : state)
-        {
-            SurfaceData::SurfacePointList points;
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromRegion_Cached)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-            AZ::Aabb inRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(worldSize));
-            AZ::Vector2 stepSize(1.0f);
-            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, inRegion, stepSize, filterTags,
-                points);
-            benchmark::DoNotOptimize(points);
-        }
+        // Every iteration after the first one is served by the region cache.
+        SetSurfaceRegionCacheEnabled(true);
+        RunGetSurfacePointsFromRegionBenchmark(state);
     }
 
     BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromList)(benchmark::State& state)
@@ -265,6 +291,11 @@ namespace UnitTest
         ->Arg( 2048 )
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromRegion_Cached)
+        ->Arg( 1024 )
+        ->Arg( 2048 )
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromList)
         ->Arg( 1024 )
         ->Arg( 2048 )
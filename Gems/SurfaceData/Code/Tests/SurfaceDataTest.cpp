@@ -53,6 +53,13 @@ class MockSurfaceProvider
             Unregister();
         }
 
+        // Replaces the generated points without notifying the surface data system, the way a provider with stale
+        // registration data would.
+        void ReplacePointsWithoutNotification(AZ::Vector3 start, AZ::Vector3 end, AZ::Vector3 stepSize)
+        {
+            SetPoints(start, end, stepSize);
+        }
+
     private:
         AZStd::unordered_map<AZStd::pair<float, float>, AZStd::vector<AzFramework::SurfaceData::SurfacePoint>> m_surfacePoints;
         SurfaceData::SurfaceTagVector m_tags;
@@ -781,5 +788,89 @@ TEST_F(SurfaceDataTestApp, SurfaceData_VerifyGetSurfacePointsFromListAndGetSurfa
     // For each point entry returned from GetSurfacePointsFromList, call GetSurfacePoints and verify the results match.
     CompareSurfacePointListWithGetSurfacePoints(queryPositions, availablePointsPerPosition, providerTags);
 }
+TEST_F(SurfaceDataTestApp, SurfaceData_RegionCacheInvalidatedByRegistrationChanges)
+{
+    // This verifies that cached region queries are discarded when a new surface provider is registered in the region.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfacePointList availablePointsPerPosition;
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    // Run the query twice so that the second query comes from the cache, and verify that both have two points per position.
+    for (int query = 0; query < 2; query++)
+    {
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            regionBounds, stepSize, providerTags, availablePointsPerPosition);
+        EXPECT_EQ(availablePointsPerPosition.GetInputPositionSize(), 16);
+        for (size_t inPositionIndex = 0; inPositionIndex < availablePointsPerPosition.GetInputPositionSize(); inPositionIndex++)
+        {
+            EXPECT_EQ(availablePointsPerPosition.GetSize(inPositionIndex), 2);
+        }
+    }
+
+    // Add a second provider with points at different heights in the same region. The cached results need to be discarded,
+    // so we expect to get back the points from both providers.
+    MockSurfaceProvider mockProvider2(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                      AZ::Vector3(0.0f, 0.0f, 2.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f),
+                                      AZ::EntityId(0x87654321));
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, availablePointsPerPosition);
+    for (size_t inPositionIndex = 0; inPositionIndex < availablePointsPerPosition.GetInputPositionSize(); inPositionIndex++)
+    {
+        EXPECT_EQ(availablePointsPerPosition.GetSize(inPositionIndex), 4);
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_RegionCacheInvalidatedByRefreshSurfaceData)
+{
+    // This verifies that cached region queries are only discarded when RefreshSurfaceData is called with an overlapping area.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfacePointList availablePointsPerPosition;
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    auto VerifyPointsPerPosition = [&](size_t expectedPointCount)
+    {
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            regionBounds, stepSize, providerTags, availablePointsPerPosition);
+        EXPECT_EQ(availablePointsPerPosition.GetInputPositionSize(), 16);
+        for (size_t inPositionIndex = 0; inPositionIndex < availablePointsPerPosition.GetInputPositionSize(); inPositionIndex++)
+        {
+            EXPECT_EQ(availablePointsPerPosition.GetSize(inPositionIndex), expectedPointCount);
+        }
+    };
+
+    VerifyPointsPerPosition(2);
+
+    // Change the provider to only generate one point per position without telling the surface data system.
+    // The cached results should still get returned.
+    mockProvider.ReplacePointsWithoutNotification(AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 8.0f));
+    VerifyPointsPerPosition(2);
+
+    // Refreshing an area that doesn't overlap the query shouldn't discard the cached results.
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::RefreshSurfaceData,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(16.0f), AZ::Vector3(32.0f)));
+    VerifyPointsPerPosition(2);
+
+    // Refreshing an area that overlaps the query should discard them, so the new points get returned.
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::RefreshSurfaceData,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(3.0f), AZ::Vector3(5.0f)));
+    VerifyPointsPerPosition(1);
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
@@ -18,9 +18,11 @@ set(FILES
     Include/SurfaceData/SurfaceDataTagProviderRequestBus.h
     Include/SurfaceData/SurfaceDataProviderRequestBus.h
     Include/SurfaceData/SurfaceDataModifierRequestBus.h
+    Include/SurfaceData/SurfaceDataRegionCache.h
     Include/SurfaceData/SurfacePointList.h
     Include/SurfaceData/SurfaceTag.h
     Include/SurfaceData/Utility/SurfaceDataUtility.h
+    Source/SurfaceDataRegionCache.cpp
     Source/SurfaceDataSystemComponent.cpp
     Source/SurfaceDataTypes.cpp
     Source/SurfacePointList.cpp
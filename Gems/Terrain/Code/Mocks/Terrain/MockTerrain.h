@@ -36,6 +36,8 @@ namespace UnitTest
         MOCK_METHOD1(UnregisterArea, void(AZ::EntityId areaId));
         MOCK_METHOD2(
             RefreshArea, void(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask));
+        MOCK_METHOD1(RegisterStreamingObserver, void(AZ::EntityId observerId));
+        MOCK_METHOD1(UnregisterStreamingObserver, void(AZ::EntityId observerId));
     };
 
     class MockTerrainAreaHeightRequests : public Terrain::TerrainAreaHeightRequestBus::Handler
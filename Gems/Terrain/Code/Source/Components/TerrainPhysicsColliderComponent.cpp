@@ -14,6 +14,10 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -25,6 +29,13 @@
 
 namespace Terrain
 {
+    namespace
+    {
+        // Heightfield updates smaller than this are generated on the calling thread, since splitting them across jobs
+        // would cost more than it saves.
+        constexpr size_t MinSamplesPerUpdateJob = 16 * 1024;
+    }
+
     void TerrainPhysicsSurfaceMaterialMapping::Reflect(AZ::ReflectContext* context)
     {
         if (auto serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -145,8 +156,13 @@ namespace Terrain
         LmbrCentral::ShapeComponentRequestsBus::EventResult(
             worldSize, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
 
+        NotifyListenersOfHeightfieldDataChange(worldSize);
+    }
+
+    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion)
+    {
         Physics::HeightfieldProviderNotificationBus::Broadcast(
-            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, worldSize);
+            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, dirtyRegion);
     }
 
     void TerrainPhysicsColliderComponent::OnShapeChanged([[maybe_unused]] ShapeChangeReasons changeReason)
@@ -171,9 +187,21 @@ namespace Terrain
         NotifyListenersOfHeightfieldDataChange();
     }
 
-    void TerrainPhysicsColliderComponent::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+    void TerrainPhysicsColliderComponent::OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
     {
+        // Settings changes can change the size or resolution of the heightfield, so those always refresh the whole heightfield.
+        // Height and surface changes only affect the heightfield data inside the dirty region, so listeners can just update that part.
+        const bool onlyDataChanged = (dataChangedMask & TerrainDataChangedMask::Settings) == 0;
+        if (onlyDataChanged && dirtyRegion.IsValid())
+        {
+            const AZ::Aabb heightfieldAabb = GetHeightfieldAabb();
+            if (heightfieldAabb.IsValid() && dirtyRegion.Overlaps(heightfieldAabb))
+            {
+                NotifyListenersOfHeightfieldDataChange(dirtyRegion.GetClamped(heightfieldAabb));
+            }
+            return;
+        }
+
         NotifyListenersOfHeightfieldDataChange();
     }
 
@@ -300,53 +328,162 @@ namespace Terrain
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
 
-        AZ::Aabb worldSize = GetHeightfieldAabb();
+        heightMaterials.clear();
+        heightMaterials.resize(gridWidth * gridHeight);
 
-        const float worldCenterZ = worldSize.GetCenter().GetZ();
-        const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
-        const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
+        auto updateHeightsMaterialsCallback = [&heightMaterials, gridWidth]
+            (size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+        {
+            heightMaterials[(row * gridWidth) + column] = point;
+        };
+
+        UpdateHeightsAndMaterials(updateHeightsMaterialsCallback, 0, 0, gridWidth, gridHeight);
+    }
+
+    void TerrainPhysicsColliderComponent::GetHeightfieldIndicesFromRegion(
+        const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const
+    {
+        startColumn = 0;
+        startRow = 0;
+        numColumns = 0;
+        numRows = 0;
+
+        const AZ::Aabb heightfieldAabb = GetHeightfieldAabb();
+        if (!region.IsValid() || !heightfieldAabb.IsValid())
+        {
+            return;
+        }
 
         int32_t gridWidth, gridHeight;
         GetHeightfieldGridSize(gridWidth, gridHeight);
 
-        heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+        const AZ::Vector2 heightfieldMin(heightfieldAabb.GetMin());
 
-        AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
+        // Include every grid point that's inside the region, including the ones that are exactly on its edges.
+        const AZ::Vector2 firstIndex = (AZ::Vector2(region.GetMin()) - heightfieldMin) / gridResolution;
+        const AZ::Vector2 lastIndex = (AZ::Vector2(region.GetMax()) - heightfieldMin) / gridResolution;
 
-        auto perPositionCallback = [&heightMaterials, &materialList, this, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax]
-            ([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        const int64_t firstColumn = AZStd::max<int64_t>(aznumeric_cast<int64_t>(floor(firstIndex.GetX())), 0);
+        const int64_t firstRow = AZStd::max<int64_t>(aznumeric_cast<int64_t>(floor(firstIndex.GetY())), 0);
+        const int64_t endColumn = AZStd::min<int64_t>(aznumeric_cast<int64_t>(floor(lastIndex.GetX())) + 1, gridWidth);
+        const int64_t endRow = AZStd::min<int64_t>(aznumeric_cast<int64_t>(floor(lastIndex.GetY())) + 1, gridHeight);
+
+        if ((firstColumn < endColumn) && (firstRow < endRow))
         {
-            float height = surfacePoint.m_position.GetZ();
+            startColumn = aznumeric_cast<size_t>(firstColumn);
+            startRow = aznumeric_cast<size_t>(firstRow);
+            numColumns = aznumeric_cast<size_t>(endColumn - firstColumn);
+            numRows = aznumeric_cast<size_t>(endRow - firstRow);
+        }
+    }
 
-            // Any heights that fall outside the range of our bounding box will get turned into holes.
-            if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
-            {
-                height = worldHeightBoundsMin;
-                terrainExists = false;
-            }
+    void TerrainPhysicsColliderComponent::UpdateHeightsAndMaterials(
+        const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-            // Find the best surface tag at this point.
-            // We want the MaxSurfaceWeight. The ProcessSurfacePoints callback has surface weights sorted.
-            // So, we pick the value at the front of the list.
-            AzFramework::SurfaceData::SurfaceTagWeight surfaceWeight;
-            if (!surfacePoint.m_surfaceTags.empty())
-            {
-                surfaceWeight = *surfacePoint.m_surfaceTags.begin();
-            }
+        // The terrain is queried directly instead of through the bus, so that the jobs below don't get serialized
+        // by the bus mutex. The terrain system guards its own data.
+        auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
+        if (!terrain || (numColumns == 0) || (numRows == 0))
+        {
+            return;
+        }
+
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+
+        const AZ::Aabb worldSize = GetHeightfieldAabb();
+
+        const float worldCenterZ = worldSize.GetCenter().GetZ();
+        const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
+        const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
+
+        const AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
 
-            Physics::HeightMaterialPoint point;
-            point.m_height = height - worldCenterZ;
-            point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
-            Physics::MaterialId materialId = FindMaterialIdForSurfaceTag(surfaceWeight.m_surfaceType);
-            point.m_materialIndex = GetMaterialIdIndex(materialId, materialList);
-            heightMaterials.emplace_back(point);
+        // Generates the heights and materials for a band of rows in the sub-rectangle.
+        auto processRows = [&](size_t firstRow, size_t rowCount)
+        {
+            const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(
+                worldSize.GetMin().GetX() + (startColumn * gridResolution.GetX()),
+                worldSize.GetMin().GetY() + (firstRow * gridResolution.GetY()),
+                worldHeightBoundsMin,
+                worldSize.GetMin().GetX() + ((startColumn + numColumns) * gridResolution.GetX()),
+                worldSize.GetMin().GetY() + ((firstRow + rowCount) * gridResolution.GetY()),
+                worldHeightBoundsMax);
+
+            auto perPositionCallback = [&, firstRow, rowCount]
+                (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                // Floating-point error in the region size can produce an extra row or column of points, so skip those.
+                if ((xIndex >= numColumns) || (yIndex >= rowCount))
+                {
+                    return;
+                }
+
+                float height = surfacePoint.m_position.GetZ();
+
+                // Any heights that fall outside the range of our bounding box will get turned into holes.
+                if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
+                {
+                    height = worldHeightBoundsMin;
+                    terrainExists = false;
+                }
+
+                // Find the best surface tag at this point.
+                // We want the MaxSurfaceWeight. The ProcessSurfacePoints callback has surface weights sorted.
+                // So, we pick the value at the front of the list.
+                AzFramework::SurfaceData::SurfaceTagWeight surfaceWeight;
+                if (!surfacePoint.m_surfaceTags.empty())
+                {
+                    surfaceWeight = *surfacePoint.m_surfaceTags.begin();
+                }
+
+                Physics::HeightMaterialPoint point;
+                point.m_height = height - worldCenterZ;
+                point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
+                Physics::MaterialId materialId = FindMaterialIdForSurfaceTag(surfaceWeight.m_surfaceType);
+                point.m_materialIndex = GetMaterialIdIndex(materialId, materialList);
+
+                updateHeightsMaterialsCallback(startColumn + xIndex, firstRow + yIndex, point);
+            };
+
+            terrain->ProcessSurfacePointsFromRegion(
+                region, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
         };
 
-        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(&AzFramework::Terrain::TerrainDataRequests::ProcessSurfacePointsFromRegion,
-            worldSize, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+        // Split the rows into one band per worker thread, unless the update is too small to be worth splitting up.
+        size_t numJobs = 1;
+        if (AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext())
+        {
+            const size_t maxJobsForSize = (numColumns * numRows) / MinSamplesPerUpdateJob;
+            numJobs = AZStd::min({ aznumeric_cast<size_t>(jobContext->GetJobManager().GetNumWorkerThreads()), maxJobsForSize, numRows });
+        }
+
+        if (numJobs <= 1)
+        {
+            processRows(startRow, numRows);
+            return;
+        }
+
+        const size_t rowsPerJob = (numRows + numJobs - 1) / numJobs;
+        AZ::JobCompletion jobCompletion;
+        for (size_t firstRow = startRow; firstRow < startRow + numRows; firstRow += rowsPerJob)
+        {
+            const size_t rowCount = AZStd::min(rowsPerJob, startRow + numRows - firstRow);
+            AZ::Job* job = AZ::CreateJobFunction([&processRows, firstRow, rowCount]()
+            {
+                AZ_PROFILE_SCOPE(Entity, "TerrainPhysicsColliderComponent::UpdateHeightsAndMaterialsJob");
+                processRows(firstRow, rowCount);
+            }, true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
     }
 
     AZ::Vector2 TerrainPhysicsColliderComponent::GetHeightfieldGridSpacing() const
@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainHeightCache.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        // Keeps grid coordinates computed from world positions well inside the int32_t range.
+        constexpr float MaxGridCoordinate = static_cast<float>(1 << 30);
+
+        int32_t ToGridCoordinate(float value)
+        {
+            return static_cast<int32_t>(AZ::GetClamp(value, -MaxGridCoordinate, MaxGridCoordinate));
+        }
+    }
+
+    void TerrainHeightCache::SetMaxTileCount(size_t maxTileCount)
+    {
+        m_maxTileCount = maxTileCount;
+        EvictTiles();
+    }
+
+    size_t TerrainHeightCache::GetMaxTileCount() const
+    {
+        return m_maxTileCount;
+    }
+
+    uint64_t TerrainHeightCache::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    bool TerrainHeightCache::GetHeight(int32_t gridX, int32_t gridY, float& height, bool& terrainExists) const
+    {
+        const GridPoint point{ gridX, gridY };
+        bool found = false;
+        return GetHeights(
+                   AZStd::span<const GridPoint>(&point, 1), AZStd::span<float>(&height, 1), AZStd::span<bool>(&terrainExists, 1),
+                   AZStd::span<bool>(&found, 1)) > 0;
+    }
+
+    size_t TerrainHeightCache::GetHeights(
+        AZStd::span<const GridPoint> points, AZStd::span<float> heights, AZStd::span<bool> terrainExists, AZStd::span<bool> found) const
+    {
+        AZ_Assert(
+            (points.size() == heights.size()) && (points.size() == terrainExists.size()) && (points.size() == found.size()),
+            "The sizes of the grid point, height, terrain exists and found lists should match.");
+
+        size_t foundCount = 0;
+        size_t index = 0;
+        while (index < points.size())
+        {
+            const TileKey tileKey = MakeTileKey(GetTileCoordinate(points[index].m_x), GetTileCoordinate(points[index].m_y));
+            const Shard& shard = m_shards[GetShardIndex(tileKey)];
+
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+            auto tileIter = shard.m_tiles.find(tileKey);
+            const Tile* tile = (tileIter != shard.m_tiles.end()) ? tileIter->second.get() : nullptr;
+            if (tile)
+            {
+                MarkUsed(*tile);
+            }
+
+            // Look up all of the consecutive points in the same tile while holding the lock.
+            for (; index < points.size(); ++index)
+            {
+                const GridPoint& point = points[index];
+                if (MakeTileKey(GetTileCoordinate(point.m_x), GetTileCoordinate(point.m_y)) != tileKey)
+                {
+                    break;
+                }
+
+                const size_t sampleIndex = GetSampleIndex(point.m_x, point.m_y);
+                found[index] = tile && (tile->m_states[sampleIndex] != SampleState::Empty);
+                if (found[index])
+                {
+                    heights[index] = tile->m_heights[sampleIndex];
+                    terrainExists[index] = tile->m_states[sampleIndex] == SampleState::TerrainExists;
+                    ++foundCount;
+                }
+            }
+        }
+
+        // The statistics are only updated once per call, so that threads don't contend on them for every point.
+        m_hitCount += foundCount;
+        m_missCount += points.size() - foundCount;
+        return foundCount;
+    }
+
+    bool TerrainHeightCache::GetSurfaceWeights(
+        int32_t gridX, int32_t gridY, AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights) const
+    {
+        const TileKey tileKey = MakeTileKey(GetTileCoordinate(gridX), GetTileCoordinate(gridY));
+        const Shard& shard = m_shards[GetShardIndex(tileKey)];
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+            auto tileIter = shard.m_tiles.find(tileKey);
+            if ((tileIter != shard.m_tiles.end()) && tileIter->second->m_surfaceWeights)
+            {
+                const Tile& tile = *tileIter->second;
+                const TileSurfaceWeights& tileSurfaceWeights = *tile.m_surfaceWeights;
+                const size_t sampleIndex = GetSampleIndex(gridX, gridY);
+                const uint8_t count = tileSurfaceWeights.m_counts[sampleIndex];
+                if (count != NoSurfaceWeights)
+                {
+                    MarkUsed(tile);
+
+                    const auto firstWeight = tileSurfaceWeights.m_weights.begin() + tileSurfaceWeights.m_offsets[sampleIndex];
+                    surfaceWeights.assign(firstWeight, firstWeight + count);
+                    ++m_hitCount;
+                    return true;
+                }
+            }
+        }
+
+        ++m_missCount;
+        return false;
+    }
+
+    void TerrainHeightCache::SetHeight(int32_t gridX, int32_t gridY, float height, bool terrainExists, uint64_t generation)
+    {
+        const GridPoint point{ gridX, gridY };
+        SetHeights(
+            AZStd::span<const GridPoint>(&point, 1), AZStd::span<const float>(&height, 1), AZStd::span<const bool>(&terrainExists, 1),
+            generation);
+    }
+
+    void TerrainHeightCache::SetHeights(
+        AZStd::span<const GridPoint> points, AZStd::span<const float> heights, AZStd::span<const bool> terrainExists, uint64_t generation)
+    {
+        AZ_Assert(
+            (points.size() == heights.size()) && (points.size() == terrainExists.size()),
+            "The sizes of the grid point, height and terrain exists lists should match.");
+
+        if (m_maxTileCount == 0)
+        {
+            return;
+        }
+
+        bool addedTiles = false;
+        size_t index = 0;
+        while (index < points.size())
+        {
+            const TileKey tileKey = MakeTileKey(GetTileCoordinate(points[index].m_x), GetTileCoordinate(points[index].m_y));
+            Shard& shard = m_shards[GetShardIndex(tileKey)];
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+
+            // Invalidations change the generation before they lock any shard, so a height evaluated before one of them
+            // is either dropped here, or stored before the invalidation reaches this shard and gets discarded by it.
+            if (generation != m_generation)
+            {
+                break;
+            }
+
+            bool added = false;
+            Tile& tile = GetOrAddTile(shard, tileKey, added);
+            addedTiles = addedTiles || added;
+
+            // Store all of the consecutive points in the same tile while holding the lock.
+            for (; index < points.size(); ++index)
+            {
+                const GridPoint& point = points[index];
+                if (MakeTileKey(GetTileCoordinate(point.m_x), GetTileCoordinate(point.m_y)) != tileKey)
+                {
+                    break;
+                }
+
+                const size_t sampleIndex = GetSampleIndex(point.m_x, point.m_y);
+                tile.m_heights[sampleIndex] = heights[index];
+                tile.m_states[sampleIndex] = terrainExists[index] ? SampleState::TerrainExists : SampleState::NoTerrain;
+            }
+        }
+
+        if (addedTiles && (m_tileCount > m_maxTileCount))
+        {
+            EvictTiles();
+        }
+    }
+
+    void TerrainHeightCache::SetSurfaceWeights(
+        int32_t gridX, int32_t gridY, const AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights, uint64_t generation)
+    {
+        if (m_maxTileCount == 0)
+        {
+            return;
+        }
+
+        const TileKey tileKey = MakeTileKey(GetTileCoordinate(gridX), GetTileCoordinate(gridY));
+        Shard& shard = m_shards[GetShardIndex(tileKey)];
+
+        bool added = false;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+            if (generation != m_generation)
+            {
+                return;
+            }
+
+            Tile& tile = GetOrAddTile(shard, tileKey, added);
+            if (!tile.m_surfaceWeights)
+            {
+                tile.m_surfaceWeights = AZStd::make_unique<TileSurfaceWeights>();
+                tile.m_surfaceWeights->m_counts.fill(NoSurfaceWeights);
+            }
+
+            TileSurfaceWeights& tileSurfaceWeights = *tile.m_surfaceWeights;
+            if (tileSurfaceWeights.m_weights.size() + surfaceWeights.size() > SamplesPerTile * MaxSurfaceWeightsPerSample)
+            {
+                tileSurfaceWeights.m_weights.clear();
+                tileSurfaceWeights.m_counts.fill(NoSurfaceWeights);
+            }
+
+            const size_t sampleIndex = GetSampleIndex(gridX, gridY);
+            tileSurfaceWeights.m_offsets[sampleIndex] = aznumeric_cast<uint32_t>(tileSurfaceWeights.m_weights.size());
+            tileSurfaceWeights.m_counts[sampleIndex] = aznumeric_cast<uint8_t>(surfaceWeights.size());
+            tileSurfaceWeights.m_weights.insert(tileSurfaceWeights.m_weights.end(), surfaceWeights.begin(), surfaceWeights.end());
+        }
+
+        if (added && (m_tileCount > m_maxTileCount))
+        {
+            EvictTiles();
+        }
+    }
+
+    void TerrainHeightCache::InvalidateRegion(const AZ::Aabb& region, float queryResolution)
+    {
+        InvalidateRegionData(region, queryResolution, true);
+    }
+
+    void TerrainHeightCache::InvalidateSurfaceWeightsInRegion(const AZ::Aabb& region, float queryResolution)
+    {
+        InvalidateRegionData(region, queryResolution, false);
+    }
+
+    void TerrainHeightCache::InvalidateRegionData(const AZ::Aabb& region, float queryResolution, bool invalidateHeights)
+    {
+        if (!region.IsValid() || queryResolution <= 0.0f)
+        {
+            return;
+        }
+
+        const int32_t minGridX = ToGridCoordinate(floorf(region.GetMin().GetX() / queryResolution)) - 1;
+        const int32_t minGridY = ToGridCoordinate(floorf(region.GetMin().GetY() / queryResolution)) - 1;
+        const int32_t maxGridX = ToGridCoordinate(ceilf(region.GetMax().GetX() / queryResolution)) + 1;
+        const int32_t maxGridY = ToGridCoordinate(ceilf(region.GetMax().GetY() / queryResolution)) + 1;
+
+        ++m_generation;
+
+        for (Shard& shard : m_shards)
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+
+            // The number of cached tiles is bounded, so walking the cached tiles is cheaper than walking every tile
+            // the region overlaps when the region is large.
+            for (auto tileIter = shard.m_tiles.begin(); tileIter != shard.m_tiles.end();)
+            {
+                const int32_t tileX = static_cast<int32_t>(tileIter->first >> 32);
+                const int32_t tileY = static_cast<int32_t>(tileIter->first & 0xFFFFFFFF);
+                const int32_t tileMinX = tileX * TileSize;
+                const int32_t tileMinY = tileY * TileSize;
+                const int32_t tileMaxX = tileMinX + TileSize - 1;
+                const int32_t tileMaxY = tileMinY + TileSize - 1;
+
+                if (tileMaxX < minGridX || tileMinX > maxGridX || tileMaxY < minGridY || tileMinY > maxGridY)
+                {
+                    ++tileIter;
+                    continue;
+                }
+
+                Tile& tile = *tileIter->second;
+                if (tileMinX >= minGridX && tileMaxX <= maxGridX && tileMinY >= minGridY && tileMaxY <= maxGridY)
+                {
+                    // The whole tile is inside the region, so drop it entirely, or at least all of its surface weights.
+                    if (invalidateHeights)
+                    {
+                        tileIter = shard.m_tiles.erase(tileIter);
+                        --m_tileCount;
+                        continue;
+                    }
+
+                    tile.m_surfaceWeights.reset();
+                    ++tileIter;
+                    continue;
+                }
+
+                // Only part of the tile is inside the region, so keep the samples outside of it.
+                for (int32_t gridY = AZStd::max(minGridY, tileMinY); gridY <= AZStd::min(maxGridY, tileMaxY); ++gridY)
+                {
+                    for (int32_t gridX = AZStd::max(minGridX, tileMinX); gridX <= AZStd::min(maxGridX, tileMaxX); ++gridX)
+                    {
+                        const size_t sampleIndex = GetSampleIndex(gridX, gridY);
+                        if (invalidateHeights)
+                        {
+                            tile.m_states[sampleIndex] = SampleState::Empty;
+                        }
+                        if (tile.m_surfaceWeights)
+                        {
+                            tile.m_surfaceWeights->m_counts[sampleIndex] = NoSurfaceWeights;
+                        }
+                    }
+                }
+                ++tileIter;
+            }
+        }
+    }
+
+    void TerrainHeightCache::Clear()
+    {
+        ++m_generation;
+
+        for (Shard& shard : m_shards)
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+            m_tileCount -= shard.m_tiles.size();
+            shard.m_tiles.clear();
+        }
+    }
+
+    size_t TerrainHeightCache::GetTileCount() const
+    {
+        return m_tileCount;
+    }
+
+    uint64_t TerrainHeightCache::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    uint64_t TerrainHeightCache::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    float TerrainHeightCache::GetHitRate() const
+    {
+        const uint64_t hitCount = m_hitCount;
+        const uint64_t lookupCount = hitCount + m_missCount;
+        return (lookupCount > 0) ? aznumeric_cast<float>(static_cast<double>(hitCount) / static_cast<double>(lookupCount)) : 0.0f;
+    }
+
+    void TerrainHeightCache::ResetStatistics()
+    {
+        m_hitCount = 0;
+        m_missCount = 0;
+    }
+
+    TerrainHeightCache::TileKey TerrainHeightCache::MakeTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<TileKey>(static_cast<uint32_t>(tileX)) << 32) | static_cast<TileKey>(static_cast<uint32_t>(tileY));
+    }
+
+    int32_t TerrainHeightCache::GetTileCoordinate(int32_t gridCoordinate)
+    {
+        // Round towards negative infinity so that negative grid coordinates map to the correct tile.
+        return (gridCoordinate >= 0) ? (gridCoordinate / TileSize) : ((gridCoordinate - TileSize + 1) / TileSize);
+    }
+
+    size_t TerrainHeightCache::GetSampleIndex(int32_t gridX, int32_t gridY)
+    {
+        const int32_t localX = gridX - GetTileCoordinate(gridX) * TileSize;
+        const int32_t localY = gridY - GetTileCoordinate(gridY) * TileSize;
+        return static_cast<size_t>(localY * TileSize + localX);
+    }
+
+    size_t TerrainHeightCache::GetShardIndex(TileKey tileKey)
+    {
+        // Every 4x4 block of tiles covers all of the shards, so queries over a region spread over all of them.
+        const uint32_t tileX = static_cast<uint32_t>(tileKey >> 32);
+        const uint32_t tileY = static_cast<uint32_t>(tileKey & 0xFFFFFFFF);
+        return static_cast<size_t>((tileX % 4) + (tileY % 4) * 4) % ShardCount;
+    }
+
+    void TerrainHeightCache::MarkUsed(const Tile& tile) const
+    {
+        // Only store when the mark changes, so that threads reading the same tile don't keep writing to it.
+        const uint64_t useClock = m_useClock.load(AZStd::memory_order_relaxed);
+        if (tile.m_lastUsed.load(AZStd::memory_order_relaxed) != useClock)
+        {
+            tile.m_lastUsed.store(useClock, AZStd::memory_order_relaxed);
+        }
+    }
+
+    TerrainHeightCache::Tile& TerrainHeightCache::GetOrAddTile(Shard& shard, TileKey tileKey, bool& added)
+    {
+        auto [tileIter, inserted] = shard.m_tiles.try_emplace(tileKey);
+        added = inserted;
+        if (inserted)
+        {
+            tileIter->second = AZStd::make_unique<Tile>();
+            tileIter->second->m_states.fill(SampleState::Empty);
+            tileIter->second->m_lastUsed = m_useClock.fetch_add(1);
+            ++m_tileCount;
+        }
+        else
+        {
+            MarkUsed(*tileIter->second);
+        }
+        return *tileIter->second;
+    }
+
+    void TerrainHeightCache::EvictTiles()
+    {
+        AZStd::lock_guard<AZStd::mutex> evictionLock(m_evictionMutex);
+
+        const size_t maxTileCount = m_maxTileCount;
+        if (m_tileCount <= maxTileCount)
+        {
+            return;
+        }
+
+        struct EvictionCandidate
+        {
+            uint64_t m_lastUsed;
+            size_t m_shardIndex;
+            TileKey m_tileKey;
+        };
+
+        AZStd::vector<EvictionCandidate> candidates;
+        candidates.reserve(m_tileCount);
+        for (size_t shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
+        {
+            const Shard& shard = m_shards[shardIndex];
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+            for (const auto& [tileKey, tile] : shard.m_tiles)
+            {
+                candidates.push_back({ tile->m_lastUsed.load(AZStd::memory_order_relaxed), shardIndex, tileKey });
+            }
+        }
+
+        // Evict a few more tiles than needed, so that the tiles don't have to be scanned again for every tile added after this.
+        const size_t targetTileCount = maxTileCount - maxTileCount / 16;
+        if (candidates.size() <= targetTileCount)
+        {
+            return;
+        }
+
+        const auto lastEvicted = candidates.begin() + (candidates.size() - targetTileCount);
+        AZStd::partial_sort(
+            candidates.begin(), lastEvicted, candidates.end(),
+            [](const EvictionCandidate& lhs, const EvictionCandidate& rhs)
+            {
+                return lhs.m_lastUsed < rhs.m_lastUsed;
+            });
+
+        // Group the evicted tiles by shard, so that each shard is only locked once.
+        AZStd::sort(
+            candidates.begin(), lastEvicted,
+            [](const EvictionCandidate& lhs, const EvictionCandidate& rhs)
+            {
+                return lhs.m_shardIndex < rhs.m_shardIndex;
+            });
+
+        for (auto candidate = candidates.begin(); candidate != lastEvicted;)
+        {
+            Shard& shard = m_shards[candidate->m_shardIndex];
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+            for (const size_t shardIndex = candidate->m_shardIndex; (candidate != lastEvicted) && (candidate->m_shardIndex == shardIndex);
+                 ++candidate)
+            {
+                // Tiles that were used again since the scan stay in the cache.
+                auto tileIter = shard.m_tiles.find(candidate->m_tileKey);
+                if ((tileIter != shard.m_tiles.end()) &&
+                    (tileIter->second->m_lastUsed.load(AZStd::memory_order_relaxed) == candidate->m_lastUsed))
+                {
+                    shard.m_tiles.erase(tileIter);
+                    --m_tileCount;
+                }
+            }
+        }
+    }
+} // namespace Terrain
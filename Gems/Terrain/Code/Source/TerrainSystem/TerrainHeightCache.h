@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+
+namespace Terrain
+{
+    //! Caches terrain heights and surface weights that were evaluated at points on the height query grid.
+    //! Grid points are grouped into square tiles, and the least recently used tiles are evicted once the cache
+    //! holds more than the maximum number of tiles. Each sample in a tile is filled individually the first time
+    //! it's requested, so the cache never evaluates more data than the queries themselves would.
+    //! Tiles are spread over several shards that are locked independently, and lookups only take a shared lock,
+    //! so parallel queries don't serialize on the cache. Lookups mark a tile as used with a single relaxed store,
+    //! and eviction scans for the tiles with the oldest marks instead of keeping the tiles in a list.
+    //! All methods are thread safe.
+    class TerrainHeightCache
+    {
+    public:
+        //! The number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 32;
+        static constexpr size_t DefaultMaxTileCount = 1024;
+
+        //! A point on the height query grid.
+        struct GridPoint
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+        };
+
+        TerrainHeightCache() = default;
+        AZ_DISABLE_COPY_MOVE(TerrainHeightCache);
+
+        //! Sets the maximum number of tiles to keep, evicting the least recently used tiles if needed.
+        void SetMaxTileCount(size_t maxTileCount);
+        size_t GetMaxTileCount() const;
+
+        //! Looks up the height at the given grid point. Returns false if the height hasn't been cached yet.
+        bool GetHeight(int32_t gridX, int32_t gridY, float& height, bool& terrainExists) const;
+
+        //! Looks up the heights of a list of grid points. found[i] is set to whether the height of points[i] was cached.
+        //! Consecutive points in the same tile share a single lock, so this is much cheaper than calling GetHeight()
+        //! for each point of a region. Returns the number of heights that were found.
+        size_t GetHeights(
+            AZStd::span<const GridPoint> points, AZStd::span<float> heights, AZStd::span<bool> terrainExists, AZStd::span<bool> found) const;
+
+        //! Looks up the surface weights at the given grid point. Returns false if they haven't been cached yet.
+        bool GetSurfaceWeights(int32_t gridX, int32_t gridY, AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights) const;
+
+        //! Returns a number that changes every time cached data is invalidated. Read this before evaluating any data,
+        //! and pass it to the setters so that data computed from terrain areas that changed in the meantime is dropped.
+        uint64_t GetGeneration() const;
+
+        //! Stores the height evaluated at the given grid point, unless the cache was invalidated since generation was read.
+        void SetHeight(int32_t gridX, int32_t gridY, float height, bool terrainExists, uint64_t generation);
+
+        //! Stores the heights evaluated at a list of grid points, unless the cache was invalidated since generation was read.
+        void SetHeights(
+            AZStd::span<const GridPoint> points, AZStd::span<const float> heights, AZStd::span<const bool> terrainExists,
+            uint64_t generation);
+
+        //! Stores the surface weights evaluated at the given grid point, unless the cache was invalidated since generation was read.
+        void SetSurfaceWeights(
+            int32_t gridX, int32_t gridY, const AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights, uint64_t generation);
+
+        //! Discards every cached height and surface weight inside the region, which is given in world space.
+        //! Surface weights are discarded along with the heights because surface providers can depend on the terrain height.
+        //! The region is expanded by one grid point on each side so that no sample influenced by a change
+        //! on the region's boundary survives.
+        void InvalidateRegion(const AZ::Aabb& region, float queryResolution);
+
+        //! Same as InvalidateRegion(), but keeps the cached heights.
+        void InvalidateSurfaceWeightsInRegion(const AZ::Aabb& region, float queryResolution);
+
+        //! Discards all cached data. The statistics are kept.
+        void Clear();
+
+        size_t GetTileCount() const;
+
+        uint64_t GetHitCount() const;
+        uint64_t GetMissCount() const;
+
+        //! Returns the ratio of lookups that were found in the cache, in the range [0-1].
+        float GetHitRate() const;
+
+        void ResetStatistics();
+
+    private:
+        static constexpr size_t SamplesPerTile = TileSize * TileSize;
+        static constexpr size_t ShardCount = 16;
+
+        //! Surface weights take a lot more space than heights, so each tile keeps at most this many on average per sample,
+        //! and drops all of its surface weights when it runs out of space.
+        static constexpr size_t MaxSurfaceWeightsPerSample = 4;
+        static constexpr uint8_t NoSurfaceWeights = 0xFF;
+
+        enum class SampleState : uint8_t
+        {
+            Empty,
+            TerrainExists,
+            NoTerrain
+        };
+
+        using TileKey = uint64_t;
+
+        //! The surface weights of the samples in a tile, which are only allocated once the first one is stored.
+        struct TileSurfaceWeights
+        {
+            //! The weights of all the samples stored back to back. Invalidated samples leave their weights in here
+            //! until the tile runs out of space.
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeight> m_weights;
+            AZStd::array<uint32_t, SamplesPerTile> m_offsets;
+            //! The number of weights of each sample, or NoSurfaceWeights if they haven't been cached.
+            AZStd::array<uint8_t, SamplesPerTile> m_counts;
+        };
+
+        struct Tile
+        {
+            AZStd::array<float, SamplesPerTile> m_heights;
+            AZStd::array<SampleState, SamplesPerTile> m_states;
+            AZStd::unique_ptr<TileSurfaceWeights> m_surfaceWeights;
+            //! The value of m_useClock when the tile was last used.
+            mutable AZStd::atomic<uint64_t> m_lastUsed{ 0 };
+        };
+
+        struct Shard
+        {
+            mutable AZStd::shared_mutex m_mutex;
+            AZStd::unordered_map<TileKey, AZStd::unique_ptr<Tile>> m_tiles;
+        };
+
+        static TileKey MakeTileKey(int32_t tileX, int32_t tileY);
+        static int32_t GetTileCoordinate(int32_t gridCoordinate);
+        static size_t GetSampleIndex(int32_t gridX, int32_t gridY);
+        static size_t GetShardIndex(TileKey tileKey);
+
+        void MarkUsed(const Tile& tile) const;
+
+        //! Returns the tile that holds the given key, adding it if needed. Must be called with the shard's exclusive lock.
+        Tile& GetOrAddTile(Shard& shard, TileKey tileKey, bool& added);
+
+        void InvalidateRegionData(const AZ::Aabb& region, float queryResolution, bool invalidateHeights);
+        void EvictTiles();
+
+        AZStd::array<Shard, ShardCount> m_shards;
+        AZStd::atomic<size_t> m_tileCount{ 0 };
+        AZStd::atomic<size_t> m_maxTileCount{ DefaultMaxTileCount };
+
+        //! Only one thread evicts at a time, the others keep using the cache meanwhile.
+        AZStd::mutex m_evictionMutex;
+
+        //! Advances whenever a tile is added. Tiles used since then are marked with its current value,
+        //! which orders them after every tile that was added before.
+        AZStd::atomic<uint64_t> m_useClock{ 0 };
+
+        AZStd::atomic<uint64_t> m_generation{ 0 };
+
+        mutable AZStd::atomic<uint64_t> m_hitCount{ 0 };
+        mutable AZStd::atomic<uint64_t> m_missCount{ 0 };
+    };
+} // namespace Terrain
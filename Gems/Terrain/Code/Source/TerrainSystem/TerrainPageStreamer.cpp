@@ -0,0 +1,535 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainPageStreamer.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        constexpr AZ::u32 PageMagic = AZ_CRC_CE("TerrainPage");
+        constexpr AZ::u32 PageVersion = 1;
+
+        // The per-sample layout of a page, both on disk (after the header) and in memory.
+        constexpr size_t SampleDataSize = sizeof(float) + sizeof(AZ::u32) + sizeof(AZ::u8) + sizeof(AZ::u8);
+
+        uint8_t QuantizeWeight(float weight)
+        {
+            return aznumeric_cast<uint8_t>(AZStd::lround(AZStd::clamp(weight, 0.0f, 1.0f) * 255.0f));
+        }
+
+        template<typename T>
+        void ReadArray(const AZ::u8*& data, AZStd::vector<T>& values, size_t count)
+        {
+            values.resize(count);
+            memcpy(values.data(), data, count * sizeof(T));
+            data += count * sizeof(T);
+        }
+
+        template<typename T>
+        void WriteValue(AZ::u8*& data, const T& value)
+        {
+            memcpy(data, &value, sizeof(T));
+            data += sizeof(T);
+        }
+    }
+
+    TerrainPageStreamer::~TerrainPageStreamer()
+    {
+        Stop();
+    }
+
+    void TerrainPageStreamer::Start(AZStd::string_view directory, float queryResolution)
+    {
+        Stop();
+
+        m_directory = directory;
+        m_queryResolution = queryResolution;
+        m_active = true;
+    }
+
+    void TerrainPageStreamer::Stop()
+    {
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_readMutex);
+            if (!m_pendingReads.empty())
+            {
+                // The canceled reads still run their completion callbacks, which is what's waited on below.
+                auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                for (auto& [key, pendingRead] : m_pendingReads)
+                {
+                    streamer->QueueRequest(streamer->Cancel(pendingRead.m_request));
+                }
+                m_readsFinishedCondition.wait(lock, [this] { return m_inFlightReadCount == 0; });
+            }
+            m_pendingReads.clear();
+            m_completedReads.clear();
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_active = false;
+        m_pages.clear();
+        m_lruList.clear();
+        m_residentMemory = 0;
+        m_changedRegion = AZ::Aabb::CreateNull();
+    }
+
+    bool TerrainPageStreamer::IsActive() const
+    {
+        return m_active;
+    }
+
+    float TerrainPageStreamer::GetQueryResolution() const
+    {
+        return m_queryResolution;
+    }
+
+    const AZ::IO::Path& TerrainPageStreamer::GetDirectory() const
+    {
+        return m_directory;
+    }
+
+    void TerrainPageStreamer::SetMemoryBudget(size_t memoryBudget)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_memoryBudget = memoryBudget;
+        EvictPages(0);
+    }
+
+    size_t TerrainPageStreamer::GetMemoryBudget() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_memoryBudget;
+    }
+
+    size_t TerrainPageStreamer::GetResidentMemory() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_residentMemory;
+    }
+
+    size_t TerrainPageStreamer::GetResidentPageCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_pages.size();
+    }
+
+    size_t TerrainPageStreamer::GetPendingPageCount() const
+    {
+        AZStd::scoped_lock lock(m_readMutex);
+        return m_pendingReads.size();
+    }
+
+    void TerrainPageStreamer::UpdateObservers(AZStd::span<const AZ::Vector3> observerPositions, float radius)
+    {
+        if (!m_active)
+        {
+            return;
+        }
+
+        ProcessCompletedReads();
+
+        // Find every page that's within the radius of an observer, along with its distance to the nearest one.
+        struct WantedPage
+        {
+            int32_t m_pageX;
+            int32_t m_pageY;
+            float m_distanceSq;
+        };
+        AZStd::vector<WantedPage> wantedPages;
+        AZStd::unordered_map<PageKey, size_t> wantedPageIndices;
+
+        const float pageWorldSize = PageSize * m_queryResolution;
+        const float radiusSq = radius * radius;
+        for (const AZ::Vector3& observerPosition : observerPositions)
+        {
+            const int32_t minPageX = GetPageCoordinate(aznumeric_cast<int32_t>(floor((observerPosition.GetX() - radius) / m_queryResolution)));
+            const int32_t minPageY = GetPageCoordinate(aznumeric_cast<int32_t>(floor((observerPosition.GetY() - radius) / m_queryResolution)));
+            const int32_t maxPageX = GetPageCoordinate(aznumeric_cast<int32_t>(floor((observerPosition.GetX() + radius) / m_queryResolution)));
+            const int32_t maxPageY = GetPageCoordinate(aznumeric_cast<int32_t>(floor((observerPosition.GetY() + radius) / m_queryResolution)));
+
+            for (int32_t pageY = minPageY; pageY <= maxPageY; ++pageY)
+            {
+                for (int32_t pageX = minPageX; pageX <= maxPageX; ++pageX)
+                {
+                    // Measure the distance to the closest point of the page, so that the page the observer is on comes first.
+                    const float pageMinX = pageX * pageWorldSize;
+                    const float pageMinY = pageY * pageWorldSize;
+                    const float deltaX = AZStd::max(AZStd::max(pageMinX - observerPosition.GetX(), observerPosition.GetX() - (pageMinX + pageWorldSize)), 0.0f);
+                    const float deltaY = AZStd::max(AZStd::max(pageMinY - observerPosition.GetY(), observerPosition.GetY() - (pageMinY + pageWorldSize)), 0.0f);
+                    const float distanceSq = deltaX * deltaX + deltaY * deltaY;
+                    if (distanceSq > radiusSq)
+                    {
+                        continue;
+                    }
+
+                    auto [indexIter, inserted] = wantedPageIndices.emplace(MakePageKey(pageX, pageY), wantedPages.size());
+                    if (inserted)
+                    {
+                        wantedPages.push_back({ pageX, pageY, distanceSq });
+                    }
+                    else
+                    {
+                        WantedPage& wantedPage = wantedPages[indexIter->second];
+                        wantedPage.m_distanceSq = AZStd::min(wantedPage.m_distanceSq, distanceSq);
+                    }
+                }
+            }
+        }
+
+        AZStd::sort(wantedPages.begin(), wantedPages.end(),
+            [](const WantedPage& lhs, const WantedPage& rhs)
+            {
+                return lhs.m_distanceSq < rhs.m_distanceSq;
+            });
+
+        AZStd::vector<WantedPage> pagesToRead;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            // Move the resident wanted pages to the front of the list, farthest first so that the nearest page ends up in front.
+            size_t residentWantedCount = 0;
+            for (auto pageIter = wantedPages.rbegin(); pageIter != wantedPages.rend(); ++pageIter)
+            {
+                auto residentIter = m_pages.find(MakePageKey(pageIter->m_pageX, pageIter->m_pageY));
+                if (residentIter != m_pages.end())
+                {
+                    m_lruList.splice(m_lruList.begin(), m_lruList, residentIter->second.m_lruIterator);
+                    ++residentWantedCount;
+                }
+            }
+
+            // Pages that are no longer wanted are only evicted when the memory is needed, so that observers moving back and
+            // forth don't keep reading the same pages.
+            AZStd::scoped_lock readLock(m_readMutex);
+            const size_t pendingMemory = m_pendingReads.size() * GetPageFileSize();
+            size_t committedMemory = m_residentMemory + pendingMemory;
+            for (const WantedPage& wantedPage : wantedPages)
+            {
+                const PageKey key = MakePageKey(wantedPage.m_pageX, wantedPage.m_pageY);
+                if (m_pages.contains(key) || m_pendingReads.contains(key))
+                {
+                    continue;
+                }
+
+                // Make room for the page by evicting pages that aren't wanted anymore.
+                while ((committedMemory + GetPageFileSize() > m_memoryBudget) && (m_lruList.size() > residentWantedCount))
+                {
+                    const size_t residentMemory = m_residentMemory;
+                    EvictLeastRecentlyUsedPage();
+                    committedMemory -= residentMemory - m_residentMemory;
+                }
+
+                // Pages are requested nearest first, so once one doesn't fit the remaining ones are left for later.
+                if (committedMemory + GetPageFileSize() > m_memoryBudget)
+                {
+                    break;
+                }
+
+                committedMemory += GetPageFileSize();
+                pagesToRead.push_back(wantedPage);
+            }
+        }
+
+        for (const WantedPage& wantedPage : pagesToRead)
+        {
+            QueueRead(wantedPage.m_pageX, wantedPage.m_pageY);
+        }
+    }
+
+    bool TerrainPageStreamer::GetSample(int32_t gridX, int32_t gridY, Sample& sample) const
+    {
+        const int32_t pageX = GetPageCoordinate(gridX);
+        const int32_t pageY = GetPageCoordinate(gridY);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        auto pageIter = m_pages.find(MakePageKey(pageX, pageY));
+        if (pageIter == m_pages.end())
+        {
+            return false;
+        }
+
+        const Page& page = pageIter->second;
+        if (page.m_heights.empty())
+        {
+            sample = Sample();
+            return true;
+        }
+
+        const size_t index = static_cast<size_t>((gridY - pageY * PageSize) * PageSize + (gridX - pageX * PageSize));
+        sample.m_height = page.m_heights[index];
+        sample.m_surfaceType = AZ::Crc32(page.m_surfaceTypes[index]);
+        sample.m_surfaceWeight = page.m_surfaceWeights[index] / 255.0f;
+        sample.m_terrainExists = (page.m_terrainExists[index] != 0);
+        return true;
+    }
+
+    bool TerrainPageStreamer::IsLoaded(int32_t gridX, int32_t gridY) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_pages.contains(MakePageKey(GetPageCoordinate(gridX), GetPageCoordinate(gridY)));
+    }
+
+    bool TerrainPageStreamer::StorePage(int32_t pageX, int32_t pageY, AZStd::span<const AZ::u8> pageData)
+    {
+        if (pageData.size() != GetPageFileSize())
+        {
+            AZ_Warning("TerrainPageStreamer", false, "Terrain page (%d, %d) has the wrong size (%zu bytes).", pageX, pageY, pageData.size());
+            return false;
+        }
+
+        PageHeader header;
+        memcpy(&header, pageData.data(), sizeof(PageHeader));
+        if ((header.m_magic != PageMagic) || (header.m_version != PageVersion) || (header.m_pageSize != PageSize))
+        {
+            AZ_Warning("TerrainPageStreamer", false, "Terrain page (%d, %d) isn't a valid terrain page.", pageX, pageY);
+            return false;
+        }
+        if ((header.m_pageX != pageX) || (header.m_pageY != pageY) || (header.m_queryResolution != m_queryResolution))
+        {
+            AZ_Warning("TerrainPageStreamer", false,
+                "Terrain page (%d, %d) was baked for page (%d, %d) with a query resolution of %f, but %f is in use.",
+                pageX, pageY, header.m_pageX, header.m_pageY, header.m_queryResolution, m_queryResolution);
+            return false;
+        }
+
+        Page page;
+        const AZ::u8* data = pageData.data() + sizeof(PageHeader);
+        ReadArray(data, page.m_heights, PageSampleCount);
+        ReadArray(data, page.m_surfaceTypes, PageSampleCount);
+        ReadArray(data, page.m_surfaceWeights, PageSampleCount);
+        ReadArray(data, page.m_terrainExists, PageSampleCount);
+
+        InsertPage(MakePageKey(pageX, pageY), AZStd::move(page), GetPageRegion(pageX, pageY, m_queryResolution));
+        return true;
+    }
+
+    AZ::Aabb TerrainPageStreamer::TakeChangedRegion()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        AZ::Aabb changedRegion = m_changedRegion;
+        m_changedRegion = AZ::Aabb::CreateNull();
+        return changedRegion;
+    }
+
+    AZStd::vector<AZ::u8> TerrainPageStreamer::BakePage(
+        int32_t pageX, int32_t pageY, float queryResolution, AZStd::span<const Sample> samples)
+    {
+        AZ_Assert(samples.size() == PageSampleCount, "A page needs %zu samples, but %zu were given.", PageSampleCount, samples.size());
+
+        AZStd::vector<AZ::u8> pageData(GetPageFileSize());
+        AZ::u8* data = pageData.data();
+
+        PageHeader header;
+        header.m_magic = PageMagic;
+        header.m_version = PageVersion;
+        header.m_pageSize = PageSize;
+        header.m_queryResolution = queryResolution;
+        header.m_pageX = pageX;
+        header.m_pageY = pageY;
+        WriteValue(data, header);
+
+        for (const Sample& sample : samples)
+        {
+            WriteValue(data, sample.m_height);
+        }
+        for (const Sample& sample : samples)
+        {
+            WriteValue(data, static_cast<AZ::u32>(sample.m_surfaceType));
+        }
+        for (const Sample& sample : samples)
+        {
+            WriteValue(data, QuantizeWeight(sample.m_surfaceWeight));
+        }
+        for (const Sample& sample : samples)
+        {
+            WriteValue(data, static_cast<AZ::u8>(sample.m_terrainExists ? 1 : 0));
+        }
+
+        return pageData;
+    }
+
+    AZStd::string TerrainPageStreamer::GetPageFileName(int32_t pageX, int32_t pageY)
+    {
+        return AZStd::string::format("page_%d_%d.terrainpage", pageX, pageY);
+    }
+
+    int32_t TerrainPageStreamer::GetPageCoordinate(int32_t gridCoordinate)
+    {
+        // Round towards negative infinity so that negative grid coordinates map to the correct page.
+        return (gridCoordinate >= 0) ? (gridCoordinate / PageSize) : ((gridCoordinate - PageSize + 1) / PageSize);
+    }
+
+    size_t TerrainPageStreamer::GetPageFileSize()
+    {
+        return sizeof(PageHeader) + PageSampleCount * SampleDataSize;
+    }
+
+    TerrainPageStreamer::PageKey TerrainPageStreamer::MakePageKey(int32_t pageX, int32_t pageY)
+    {
+        return (static_cast<PageKey>(static_cast<uint32_t>(pageX)) << 32) | static_cast<PageKey>(static_cast<uint32_t>(pageY));
+    }
+
+    size_t TerrainPageStreamer::GetPageMemory(const Page& page)
+    {
+        return sizeof(Page) + page.m_heights.size() * SampleDataSize;
+    }
+
+    AZ::Aabb TerrainPageStreamer::GetPageRegion(int32_t pageX, int32_t pageY, float queryResolution)
+    {
+        // Bilinear filtering blends between neighboring grid points, so positions up to one grid step past either edge of
+        // the page read its samples: the last row and column of the previous pages blend towards the page's first ones,
+        // and the page's last row and column blend towards the first ones of the next pages.
+        const float pageWorldSize = PageSize * queryResolution;
+        const AZ::Vector3 pageMin(pageX * pageWorldSize, pageY * pageWorldSize, 0.0f);
+        return AZ::Aabb::CreateFromMinMax(
+            pageMin - AZ::Vector3(queryResolution, queryResolution, 0.0f), pageMin + AZ::Vector3(pageWorldSize, pageWorldSize, 0.0f));
+    }
+
+    void TerrainPageStreamer::StoreEmptyPage(int32_t pageX, int32_t pageY)
+    {
+        InsertPage(MakePageKey(pageX, pageY), Page(), GetPageRegion(pageX, pageY, m_queryResolution));
+    }
+
+    void TerrainPageStreamer::InsertPage(PageKey key, Page&& page, const AZ::Aabb& pageRegion)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        auto [pageIter, inserted] = m_pages.try_emplace(key);
+        if (inserted)
+        {
+            m_lruList.push_front(key);
+        }
+        else
+        {
+            m_residentMemory -= GetPageMemory(pageIter->second);
+            m_lruList.splice(m_lruList.begin(), m_lruList, pageIter->second.m_lruIterator);
+        }
+
+        pageIter->second = AZStd::move(page);
+        pageIter->second.m_lruIterator = m_lruList.begin();
+        m_residentMemory += GetPageMemory(pageIter->second);
+        m_changedRegion.AddAabb(pageRegion);
+
+        // Never evict the page that was just stored, even if it doesn't fit by itself.
+        EvictPages(1);
+    }
+
+    void TerrainPageStreamer::ProcessCompletedReads()
+    {
+        struct LoadedPage
+        {
+            CompletedRead m_read;
+            AZStd::vector<AZ::u8> m_buffer;
+        };
+        AZStd::vector<LoadedPage> loadedPages;
+
+        {
+            AZStd::scoped_lock lock(m_readMutex);
+            loadedPages.reserve(m_completedReads.size());
+            for (const CompletedRead& completedRead : m_completedReads)
+            {
+                auto pendingIter = m_pendingReads.find(completedRead.m_key);
+                if (pendingIter != m_pendingReads.end())
+                {
+                    loadedPages.push_back({ completedRead, AZStd::move(pendingIter->second.m_buffer) });
+                    m_pendingReads.erase(pendingIter);
+                }
+            }
+            m_completedReads.clear();
+        }
+
+        for (const LoadedPage& loadedPage : loadedPages)
+        {
+            if (loadedPage.m_read.m_canceled)
+            {
+                continue;
+            }
+
+            const int32_t pageX = static_cast<int32_t>(static_cast<uint32_t>(loadedPage.m_read.m_key >> 32));
+            const int32_t pageY = static_cast<int32_t>(static_cast<uint32_t>(loadedPage.m_read.m_key));
+
+            // Pages are only baked where there's terrain, so a page that can't be read is treated as an empty page.
+            if (!loadedPage.m_read.m_succeeded || !StorePage(pageX, pageY, loadedPage.m_buffer))
+            {
+                StoreEmptyPage(pageX, pageY);
+            }
+        }
+    }
+
+    void TerrainPageStreamer::QueueRead(int32_t pageX, int32_t pageY)
+    {
+        auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        if (!streamer)
+        {
+            AZ_Error("TerrainPageStreamer", false, "Terrain page streaming requires AZ::IO::Streamer.");
+            return;
+        }
+
+        const PageKey key = MakePageKey(pageX, pageY);
+        const AZ::IO::Path pagePath = m_directory / GetPageFileName(pageX, pageY);
+
+        AZStd::scoped_lock lock(m_readMutex);
+
+        PendingRead& pendingRead = m_pendingReads[key];
+        pendingRead.m_buffer.resize(GetPageFileSize());
+        pendingRead.m_request = streamer->Read(
+            pagePath.Native(), pendingRead.m_buffer.data(), pendingRead.m_buffer.size(), pendingRead.m_buffer.size());
+
+        // Only the key is captured, capturing the request itself would keep it alive forever.
+        streamer->SetRequestCompleteCallback(
+            pendingRead.m_request,
+            [this, key](AZ::IO::FileRequestHandle request)
+            {
+                OnReadComplete(key, request);
+            });
+
+        ++m_inFlightReadCount;
+        streamer->QueueRequest(pendingRead.m_request);
+    }
+
+    void TerrainPageStreamer::OnReadComplete(PageKey key, AZ::IO::FileRequestHandle request)
+    {
+        // This runs on the streamer's thread, so the page is only stored the next time the observers are updated.
+        auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        const AZ::IO::IStreamerTypes::RequestStatus status = streamer->GetRequestStatus(request);
+
+        AZStd::scoped_lock lock(m_readMutex);
+        m_completedReads.push_back(
+            { key, status == AZ::IO::IStreamerTypes::RequestStatus::Completed, status == AZ::IO::IStreamerTypes::RequestStatus::Canceled });
+        --m_inFlightReadCount;
+        m_readsFinishedCondition.notify_all();
+    }
+
+    void TerrainPageStreamer::EvictPages(size_t keepCount)
+    {
+        while ((m_residentMemory > m_memoryBudget) && (m_lruList.size() > keepCount))
+        {
+            EvictLeastRecentlyUsedPage();
+        }
+    }
+
+    void TerrainPageStreamer::EvictLeastRecentlyUsedPage()
+    {
+        const PageKey key = m_lruList.back();
+        auto pageIter = m_pages.find(key);
+        m_residentMemory -= GetPageMemory(pageIter->second);
+        m_changedRegion.AddAabb(GetPageRegion(
+            static_cast<int32_t>(static_cast<uint32_t>(key >> 32)), static_cast<int32_t>(static_cast<uint32_t>(key)), m_queryResolution));
+        m_pages.erase(pageIter);
+        m_lruList.pop_back();
+    }
+} // namespace Terrain
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace Terrain
+{
+    //! Streams baked terrain data in from disk in fixed-size pages around a set of observers.
+    //! Each page holds the height, the dominant surface type and weight, and the "terrain exists" flag for a square of
+    //! points on the height query grid. Pages are read through AZ::IO::Streamer, and the least recently wanted pages are
+    //! evicted once the resident pages and the pending reads need more memory than the budget allows.
+    //! Pages that have no file on disk are kept as empty pages, so that the positions inside them report no terrain.
+    //! Sample lookups are thread safe, everything else is meant to be called from the main thread.
+    class TerrainPageStreamer
+    {
+    public:
+        //! The number of grid points along each side of a page.
+        static constexpr int32_t PageSize = 256;
+        static constexpr size_t PageSampleCount = PageSize * PageSize;
+        static constexpr size_t DefaultMemoryBudget = 256 * 1024 * 1024;
+
+        //! The baked data for a single point on the height query grid.
+        struct Sample
+        {
+            float m_height = 0.0f;
+            AZ::Crc32 m_surfaceType;
+            float m_surfaceWeight = 0.0f;
+            bool m_terrainExists = false;
+        };
+
+        TerrainPageStreamer() = default;
+        ~TerrainPageStreamer();
+        AZ_DISABLE_COPY_MOVE(TerrainPageStreamer);
+
+        //! Starts streaming pages from the given directory. The pages must have been baked with the same query resolution.
+        void Start(AZStd::string_view directory, float queryResolution);
+
+        //! Cancels all pending reads, waits for them to finish, and drops every resident page.
+        void Stop();
+
+        bool IsActive() const;
+        float GetQueryResolution() const;
+        const AZ::IO::Path& GetDirectory() const;
+
+        //! Sets the maximum number of bytes used by resident pages and pending reads, evicting pages if needed.
+        void SetMemoryBudget(size_t memoryBudget);
+        size_t GetMemoryBudget() const;
+
+        size_t GetResidentMemory() const;
+        size_t GetResidentPageCount() const;
+        size_t GetPendingPageCount() const;
+
+        //! Stores the pages that finished loading, then requests every page within the radius of any observer,
+        //! nearest pages first, and evicts the least recently wanted pages that don't fit in the memory budget.
+        void UpdateObservers(AZStd::span<const AZ::Vector3> observerPositions, float radius);
+
+        //! Looks up the sample at the given grid point. Returns false if the page holding it isn't resident.
+        bool GetSample(int32_t gridX, int32_t gridY, Sample& sample) const;
+
+        //! Returns true if the page holding the given grid point is resident.
+        bool IsLoaded(int32_t gridX, int32_t gridY) const;
+
+        //! Makes the page resident from baked page data. Returns false if the data isn't a valid page for this streamer.
+        bool StorePage(int32_t pageX, int32_t pageY, AZStd::span<const AZ::u8> pageData);
+
+        //! Returns the world space region covered by every page that was loaded or evicted since the last call,
+        //! extended by one grid step past each edge of the page, since bilinear filtering there blends with the page's
+        //! border samples. The Z range is left at zero.
+        AZ::Aabb TakeChangedRegion();
+
+        //! Serializes the samples of a page, given in row-major order, into the format read by StorePage().
+        static AZStd::vector<AZ::u8> BakePage(int32_t pageX, int32_t pageY, float queryResolution, AZStd::span<const Sample> samples);
+
+        static AZStd::string GetPageFileName(int32_t pageX, int32_t pageY);
+
+        //! Returns the page that holds the given grid coordinate.
+        static int32_t GetPageCoordinate(int32_t gridCoordinate);
+
+        //! The size of a baked page on disk.
+        static size_t GetPageFileSize();
+
+    private:
+        struct PageHeader
+        {
+            AZ::u32 m_magic;
+            AZ::u32 m_version;
+            AZ::u32 m_pageSize;
+            float m_queryResolution;
+            int32_t m_pageX;
+            int32_t m_pageY;
+        };
+
+        using PageKey = uint64_t;
+        using PageLruList = AZStd::list<PageKey>;
+
+        //! Empty pages don't have any samples, every position inside them reports no terrain.
+        struct Page
+        {
+            AZStd::vector<float> m_heights;
+            AZStd::vector<AZ::u32> m_surfaceTypes;
+            AZStd::vector<AZ::u8> m_surfaceWeights;
+            AZStd::vector<AZ::u8> m_terrainExists;
+            PageLruList::iterator m_lruIterator;
+        };
+
+        struct PendingRead
+        {
+            AZStd::vector<AZ::u8> m_buffer;
+            AZ::IO::FileRequestPtr m_request;
+        };
+
+        struct CompletedRead
+        {
+            PageKey m_key;
+            bool m_succeeded;
+            bool m_canceled;
+        };
+
+        static PageKey MakePageKey(int32_t pageX, int32_t pageY);
+        static size_t GetPageMemory(const Page& page);
+        static AZ::Aabb GetPageRegion(int32_t pageX, int32_t pageY, float queryResolution);
+
+        void StoreEmptyPage(int32_t pageX, int32_t pageY);
+        void InsertPage(PageKey key, Page&& page, const AZ::Aabb& pageRegion);
+        void ProcessCompletedReads();
+        void QueueRead(int32_t pageX, int32_t pageY);
+        void OnReadComplete(PageKey key, AZ::IO::FileRequestHandle request);
+
+        //! Evicts pages from the back of the LRU list until the budget is met, keeping the first keepCount pages.
+        void EvictPages(size_t keepCount);
+        void EvictLeastRecentlyUsedPage();
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<PageKey, Page> m_pages;
+
+        //! Page keys ordered from the most to the least recently wanted.
+        PageLruList m_lruList;
+        size_t m_residentMemory = 0;
+        size_t m_memoryBudget = DefaultMemoryBudget;
+        AZ::Aabb m_changedRegion = AZ::Aabb::CreateNull();
+
+        //! Guards the pending and completed reads, which are updated from the streamer's thread.
+        mutable AZStd::mutex m_readMutex;
+        AZStd::condition_variable m_readsFinishedCondition;
+        AZStd::unordered_map<PageKey, PendingRead> m_pendingReads;
+        AZStd::vector<CompletedRead> m_completedReads;
+        size_t m_inFlightReadCount = 0;
+
+        AZ::IO::Path m_directory;
+        float m_queryResolution = 1.0f;
+        AZStd::atomic_bool m_active{ false };
+    };
+} // namespace Terrain
@@ -19,8 +19,65 @@
 
 #include <Terrain/Ebuses/TerrainAreaSurfaceRequestBus.h>
 
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/math.h>
+#include <AzFramework/Components/CameraBus.h>
+
 using namespace Terrain;
 
+namespace Terrain
+{
+    AZ_CVAR(bool,
+        bg_terrainHeightCacheEnabled,
+        true,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Caches the terrain heights evaluated on the height query grid by the CLAMP and BILINEAR samplers, and the surface weights of positions on the grid."
+    );
+
+    AZ_CVAR(AZ::u32,
+        bg_terrainHeightCacheMaxTiles,
+        aznumeric_cast<AZ::u32>(TerrainHeightCache::DefaultMaxTileCount),
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of tiles of 32x32 grid points kept in the terrain height cache."
+    );
+
+    AZ_CVAR(bool,
+        bg_terrainPageStreamingEnabled,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Answers terrain queries from pages baked with BakeTerrainPages, streamed in around the terrain streaming observers."
+    );
+
+    AZ_CVAR(AZ::CVarFixedString,
+        bg_terrainPageDirectory,
+        "@products@/terrainpages",
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The directory that terrain pages are baked to and streamed from."
+    );
+
+    AZ_CVAR(float,
+        bg_terrainPageStreamingRadius,
+        2048.0f,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Terrain pages within this distance in meters of a streaming observer are streamed in."
+    );
+
+    AZ_CVAR(AZ::u32,
+        bg_terrainPageMemoryBudgetMB,
+        aznumeric_cast<AZ::u32>(TerrainPageStreamer::DefaultMemoryBudget / (1024 * 1024)),
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum amount of memory in megabytes used by resident and pending terrain pages."
+    );
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/keylookup.
@@ -90,6 +147,7 @@ void TerrainSystem::Activate()
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
+    m_heightCache.Clear();
 
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
@@ -131,6 +189,8 @@ void TerrainSystem::Deactivate()
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
+    m_heightCache.Clear();
+    m_pageStreamer.Stop();
 
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainHeightDirty = true;
@@ -273,6 +333,11 @@ void TerrainSystem::MakeBulkQueries(
     AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
     BulkQueriesCallback queryCallback) const
 {
+    if (inPositions.empty())
+    {
+        return;
+    }
+
     AZ::Aabb bounds;
     AZ::EntityId prevAreaId = FindBestAreaEntityAtPosition(inPositions[0].GetX(), inPositions[0].GetY(), bounds);
     
@@ -281,47 +346,39 @@ void TerrainSystem::MakeBulkQueries(
     // than sorting the points into separate lists and handling putting them back together.
     // This may be sub optimal if the points are randomly distributed in the list as opposed
     // to points in the same area id being close to each other.
+    // The window is submitted once a position falls in a different area, or once the end of the list is reached,
+    // so a list with a single position or a last position in its own area is queried too.
     size_t windowStart = 0;
-    size_t windowEnd = 0;
     const size_t numPositions = inPositions.size();
-    for(int i = 1; i < numPositions; i++)
+    for (size_t i = 1; i <= numPositions; i++)
     {
-        AZ::EntityId areaId = FindBestAreaEntityAtPosition(inPositions[i].GetX(), inPositions[i].GetY(), bounds);
-        bool queryHeights = false;
-        if (areaId == prevAreaId)
+        AZ::EntityId areaId;
+        if (i < numPositions)
         {
-            // Update window end to current position.
-            // If it's the last position, submit the query.
-            windowEnd = i;
-            if (windowEnd == numPositions - 1)
+            areaId = FindBestAreaEntityAtPosition(inPositions[i].GetX(), inPositions[i].GetY(), bounds);
+            if (areaId == prevAreaId)
             {
-                queryHeights = true;
+                // Extend the window to the current position.
+                continue;
             }
         }
-        else
-        {
-            queryHeights = true;
-        }
 
-        if (queryHeights)
+        // If the area id is a default entity id, it usually means the
+        // position is outside world bounds.
+        if (prevAreaId != AZ::EntityId())
         {
-            // If the area id is a default entity id, it usually means the
-            // position is outside world bounds.
-            if (prevAreaId != AZ::EntityId())
-            {
-                size_t spanLength = (windowEnd - windowStart) + 1;
-                queryCallback(AZStd::span<const AZ::Vector3>(inPositions.begin() + windowStart, spanLength),
-                    AZStd::span<AZ::Vector3>(outPositions.begin() + windowStart, spanLength),
-                    AZStd::span<bool>(outTerrainExists.begin() + windowStart, spanLength),
-                    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList>(outSurfaceWeights.begin() + windowStart, spanLength),
-                    prevAreaId);
-            }
+            size_t spanLength = i - windowStart;
+            queryCallback(AZStd::span<const AZ::Vector3>(inPositions.begin() + windowStart, spanLength),
+                AZStd::span<AZ::Vector3>(outPositions.begin() + windowStart, spanLength),
+                AZStd::span<bool>(outTerrainExists.begin() + windowStart, spanLength),
+                AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList>(outSurfaceWeights.begin() + windowStart, spanLength),
+                prevAreaId);
+        }
 
-            // Reset the window to start at the current position. Set the new area
-            // id on which to run the next query.
-            windowStart = windowEnd = i;
-            prevAreaId = areaId;
-        }   
+        // Reset the window to start at the current position. Set the new area
+        // id on which to run the next query.
+        windowStart = i;
+        prevAreaId = areaId;
     }
 }
 
@@ -342,7 +399,7 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     GenerateQueryPositions(inPositions, outPositions, sampler);
 
-    auto callback = []([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
+    auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
                         AZStd::span<bool> outTerrainExists,
                         [[maybe_unused]] AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
@@ -352,11 +409,30 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
                                 "The sizes of the terrain exists list and in/out positions list should match.");
                             Terrain::TerrainAreaHeightRequestBus::Event(areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights,
                                 outPositions, outTerrainExists);
+                            ApplyGroundPlane(areaId, outPositions, outTerrainExists);
                         };
 
-    // This will be unused for heights. It's fine if it's empty.
-    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    if (m_pageStreamer.IsActive())
+    {
+        // The query positions are all on the height query grid unless the sampler is EXACT, which uses the nearest grid point.
+        for (size_t index = 0; index < outPositions.size(); index++)
+        {
+            bool terrainExists = false;
+            outPositions[index].SetZ(GetTerrainAreaHeight(outPositions[index].GetX(), outPositions[index].GetY(), terrainExists));
+            outTerrainExists[index] = terrainExists;
+        }
+    }
+    else if (bg_terrainHeightCacheEnabled && (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT))
+    {
+        // The query positions are all on the height query grid, so only the heights that aren't cached yet are evaluated.
+        GetCachedHeights(outPositions, outTerrainExists, callback);
+    }
+    else
+    {
+        // This will be unused for heights. It's fine if it's empty.
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
+        MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -421,10 +497,10 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             ClampPosition(x, y, pos0, normalizedDelta);
             const AZ::Vector2 pos1 = pos0 + AZ::Vector2(m_currentSettings.m_heightQueryResolution);
 
-            const float heightX0Y0 = GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), terrainExists);
-            const float heightX1Y0 = GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), terrainExists);
-            const float heightX0Y1 = GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), terrainExists);
-            const float heightX1Y1 = GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), terrainExists);
+            const float heightX0Y0 = GetCachedTerrainAreaHeight(pos0.GetX(), pos0.GetY(), terrainExists);
+            const float heightX1Y0 = GetCachedTerrainAreaHeight(pos1.GetX(), pos0.GetY(), terrainExists);
+            const float heightX0Y1 = GetCachedTerrainAreaHeight(pos0.GetX(), pos1.GetY(), terrainExists);
+            const float heightX1Y1 = GetCachedTerrainAreaHeight(pos1.GetX(), pos1.GetY(), terrainExists);
             const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
             const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
             height = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
@@ -438,7 +514,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             ClampPosition(x, y, clampedPosition, normalizedDelta);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            height = GetCachedTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
         }
         break;
 
@@ -467,6 +543,18 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     float height = worldMin;
     terrainExists = false;
 
+    if (m_pageStreamer.IsActive())
+    {
+        // Positions in pages that haven't been streamed in yet have no terrain.
+        TerrainPageStreamer::Sample sample;
+        if (GetPagedSample(x, y, sample) && sample.m_terrainExists)
+        {
+            terrainExists = true;
+            height = sample.m_height;
+        }
+        return height;
+    }
+
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
     for (auto& [areaId, areaData] : m_registeredAreas)
@@ -494,6 +582,160 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+float TerrainSystem::GetCachedTerrainAreaHeight(float x, float y, bool& terrainExists) const
+{
+    // Baked pages are already a grid of heights, so there's nothing to gain from caching them.
+    if (!bg_terrainHeightCacheEnabled || m_pageStreamer.IsActive())
+    {
+        return GetTerrainAreaHeight(x, y, terrainExists);
+    }
+
+    // The position is already on the query grid, so rounding only removes floating point error.
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    const int32_t gridX = aznumeric_cast<int32_t>(AZStd::lround(x / queryResolution));
+    const int32_t gridY = aznumeric_cast<int32_t>(AZStd::lround(y / queryResolution));
+
+    // Read the generation before the lookup, so a height evaluated from data that gets invalidated meanwhile isn't cached.
+    const uint64_t generation = m_heightCache.GetGeneration();
+
+    float height = 0.0f;
+    if (m_heightCache.GetHeight(gridX, gridY, height, terrainExists))
+    {
+        return height;
+    }
+
+    height = GetTerrainAreaHeight(x, y, terrainExists);
+    m_heightCache.SetHeight(gridX, gridY, height, terrainExists, generation);
+    return height;
+}
+
+void TerrainSystem::GetCachedHeights(
+    AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists, BulkQueriesCallback queryCallback) const
+{
+    AZStd::vector<TerrainHeightCache::GridPoint> gridPoints;
+    gridPoints.reserve(positions.size());
+    for (const AZ::Vector3& position : positions)
+    {
+        TerrainHeightCache::GridPoint gridPoint;
+        GetQueryGridPoint(position.GetX(), position.GetY(), gridPoint);
+        gridPoints.push_back(gridPoint);
+    }
+
+    // Read the generation before the lookups, so heights evaluated from data that gets invalidated meanwhile aren't cached.
+    const uint64_t generation = m_heightCache.GetGeneration();
+
+    AZStd::vector<float> heights(positions.size());
+    AZStd::vector<bool> found(positions.size());
+    const size_t foundCount = m_heightCache.GetHeights(gridPoints, heights, terrainExists, found);
+
+    AZStd::vector<size_t> missIndices;
+    AZStd::vector<AZ::Vector3> missPositions;
+    AZStd::vector<TerrainHeightCache::GridPoint> missGridPoints;
+    missIndices.reserve(positions.size() - foundCount);
+    missPositions.reserve(positions.size() - foundCount);
+    missGridPoints.reserve(positions.size() - foundCount);
+    for (size_t index = 0; index < positions.size(); index++)
+    {
+        if (found[index])
+        {
+            positions[index].SetZ(heights[index]);
+        }
+        else
+        {
+            missIndices.push_back(index);
+            missPositions.push_back(positions[index]);
+            missGridPoints.push_back(gridPoints[index]);
+        }
+    }
+
+    if (missPositions.empty())
+    {
+        return;
+    }
+
+    // Evaluate all of the missing heights with bulk queries, then store them for the next queries.
+    AZStd::vector<bool> missTerrainExists(missPositions.size(), false);
+    // This will be unused for heights. It's fine if it's empty.
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
+    MakeBulkQueries(missPositions, missPositions, missTerrainExists, outSurfaceWeights, queryCallback);
+
+    AZStd::vector<float> missHeights(missPositions.size());
+    for (size_t missIndex = 0; missIndex < missPositions.size(); missIndex++)
+    {
+        missHeights[missIndex] = missPositions[missIndex].GetZ();
+        positions[missIndices[missIndex]].SetZ(missHeights[missIndex]);
+        terrainExists[missIndices[missIndex]] = missTerrainExists[missIndex];
+    }
+
+    m_heightCache.SetHeights(missGridPoints, missHeights, missTerrainExists, generation);
+}
+
+bool TerrainSystem::GetQueryGridPoint(float x, float y, TerrainHeightCache::GridPoint& gridPoint) const
+{
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    const float gridX = x / queryResolution;
+    const float gridY = y / queryResolution;
+    gridPoint.m_x = aznumeric_cast<int32_t>(AZStd::lround(gridX));
+    gridPoint.m_y = aznumeric_cast<int32_t>(AZStd::lround(gridY));
+
+    // Positions computed from grid points carry some floating point error, so they only need to be close to the grid point.
+    constexpr float GridTolerance = 0.001f;
+    return AZ::IsClose(gridX, aznumeric_cast<float>(gridPoint.m_x), GridTolerance) &&
+        AZ::IsClose(gridY, aznumeric_cast<float>(gridPoint.m_y), GridTolerance);
+}
+
+void TerrainSystem::ApplyGroundPlane(AZ::EntityId areaId, AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists) const
+{
+    // The registered areas are ordered by layer and priority, so the area has to be searched for by id.
+    auto areaIter = AZStd::find_if(
+        m_registeredAreas.begin(), m_registeredAreas.end(),
+        [areaId](const auto& item)
+        {
+            return item.first == areaId;
+        });
+    if (areaIter == m_registeredAreas.end())
+    {
+        return;
+    }
+
+    // Same as GetTerrainAreaHeight(), positions without height data are on the area's ground plane if it has one,
+    // and at the terrain world minimum otherwise.
+    const bool useGroundPlane = areaIter->second.m_useGroundPlane;
+    const float noTerrainHeight =
+        useGroundPlane ? areaIter->second.m_areaBounds.GetMin().GetZ() : m_currentSettings.m_worldBounds.GetMin().GetZ();
+    for (size_t index = 0; index < positions.size(); index++)
+    {
+        if (!terrainExists[index])
+        {
+            terrainExists[index] = useGroundPlane;
+            positions[index].SetZ(noTerrainHeight);
+        }
+    }
+}
+
+void TerrainSystem::InvalidateHeightCache(const AZ::Aabb& region)
+{
+    m_heightCache.InvalidateRegion(region, m_currentSettings.m_heightQueryResolution);
+}
+
+const TerrainHeightCache& TerrainSystem::GetHeightCache() const
+{
+    return m_heightCache;
+}
+
+const TerrainPageStreamer& TerrainSystem::GetPageStreamer() const
+{
+    return m_pageStreamer;
+}
+
+bool TerrainSystem::GetPagedSample(float x, float y, TerrainPageStreamer::Sample& sample) const
+{
+    const float queryResolution = m_pageStreamer.GetQueryResolution();
+    const int32_t gridX = aznumeric_cast<int32_t>(AZStd::lround(x / queryResolution));
+    const int32_t gridY = aznumeric_cast<int32_t>(AZStd::lround(y / queryResolution));
+    return m_pageStreamer.GetSample(gridX, gridY, sample);
+}
+
 float TerrainSystem::GetHeight(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -530,6 +772,24 @@ bool TerrainSystem::GetIsHoleFromFloats(float x, float y, Sampler sampler) const
     return !terrainExists;
 }
 
+bool TerrainSystem::GetIsLoaded(const AZ::Vector3& position) const
+{
+    return GetIsLoadedFromFloats(position.GetX(), position.GetY());
+}
+
+bool TerrainSystem::GetIsLoadedFromFloats(float x, float y) const
+{
+    if (!m_pageStreamer.IsActive())
+    {
+        return true;
+    }
+
+    const float queryResolution = m_pageStreamer.GetQueryResolution();
+    const int32_t gridX = aznumeric_cast<int32_t>(AZStd::lround(x / queryResolution));
+    const int32_t gridY = aznumeric_cast<int32_t>(AZStd::lround(y / queryResolution));
+    return m_pageStreamer.IsLoaded(gridX, gridY);
+}
+
 void TerrainSystem::GetNormalsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
     AZStd::span<AZ::Vector3> normals, AZStd::span<bool> terrainExists) const
 {
@@ -867,9 +1127,71 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                                 inPositions, outSurfaceWeights);
                         };
     
-    // This will be unused for surface weights. It's fine if it's empty.
+    if (m_pageStreamer.IsActive())
+    {
+        // Only the dominant surface is baked into the pages.
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            outSurfaceWeightsList[index].clear();
+            TerrainPageStreamer::Sample sample;
+            if (GetPagedSample(inPositions[index].GetX(), inPositions[index].GetY(), sample) && sample.m_terrainExists &&
+                (sample.m_surfaceType != AZ::Crc32()))
+            {
+                outSurfaceWeightsList[index].emplace_back(sample.m_surfaceType, sample.m_surfaceWeight);
+            }
+        }
+        return;
+    }
+
+    if (!bg_terrainHeightCacheEnabled)
+    {
+        // This will be unused for surface weights. It's fine if it's empty.
+        AZStd::vector<AZ::Vector3> outPositions;
+        MakeBulkQueries(inPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+        return;
+    }
+
+    // Read the generation before the lookups, so weights evaluated from data that gets invalidated meanwhile aren't cached.
+    const uint64_t generation = m_heightCache.GetGeneration();
+
+    // Positions on the height query grid are looked up in the cache first, everything else is evaluated with bulk queries.
+    AZStd::vector<size_t> missIndices;
+    AZStd::vector<AZ::Vector3> missPositions;
+    for (size_t index = 0; index < inPositions.size(); index++)
+    {
+        TerrainHeightCache::GridPoint gridPoint;
+        if (!GetQueryGridPoint(inPositions[index].GetX(), inPositions[index].GetY(), gridPoint) ||
+            !m_heightCache.GetSurfaceWeights(gridPoint.m_x, gridPoint.m_y, outSurfaceWeightsList[index]))
+        {
+            missIndices.push_back(index);
+            missPositions.push_back(inPositions[index]);
+        }
+    }
+
+    if (missPositions.empty())
+    {
+        return;
+    }
+
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> missSurfaceWeights(missPositions.size());
+    // These will be unused for surface weights. It's fine if they're empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(inPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    AZStd::vector<bool> outTerrainExists;
+    MakeBulkQueries(missPositions, outPositions, outTerrainExists, missSurfaceWeights, callback);
+
+    for (size_t missIndex = 0; missIndex < missPositions.size(); missIndex++)
+    {
+        // Sort the weights the same way GetOrderedSurfaceWeights() does, so cached weights don't depend on which query stored them.
+        AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights = missSurfaceWeights[missIndex];
+        AZStd::sort(surfaceWeights.begin(), surfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeightComparator());
+        outSurfaceWeightsList[missIndices[missIndex]] = surfaceWeights;
+
+        TerrainHeightCache::GridPoint gridPoint;
+        if (GetQueryGridPoint(missPositions[missIndex].GetX(), missPositions[missIndex].GetY(), gridPoint))
+        {
+            m_heightCache.SetSurfaceWeights(gridPoint.m_x, gridPoint.m_y, surfaceWeights, generation);
+        }
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -879,9 +1201,6 @@ void TerrainSystem::GetOrderedSurfaceWeights(
     AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
     bool* terrainExistsPtr) const
 {
-    AZ::Aabb bounds;
-    AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(x, y, bounds);
-
     if (terrainExistsPtr)
     {
         GetHeightFromFloats(x, y, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, terrainExistsPtr);
@@ -889,6 +1208,30 @@ void TerrainSystem::GetOrderedSurfaceWeights(
 
     outSurfaceWeights.clear();
 
+    if (m_pageStreamer.IsActive())
+    {
+        // Only the dominant surface is baked into the pages.
+        TerrainPageStreamer::Sample sample;
+        if (GetPagedSample(x, y, sample) && sample.m_terrainExists && (sample.m_surfaceType != AZ::Crc32()))
+        {
+            outSurfaceWeights.emplace_back(sample.m_surfaceType, sample.m_surfaceWeight);
+        }
+        return;
+    }
+
+    // Surface weights on the height query grid are cached, read the generation before the lookup so weights evaluated
+    // from data that gets invalidated meanwhile aren't stored.
+    TerrainHeightCache::GridPoint gridPoint;
+    const bool useCache = bg_terrainHeightCacheEnabled && GetQueryGridPoint(x, y, gridPoint);
+    const uint64_t generation = m_heightCache.GetGeneration();
+    if (useCache && m_heightCache.GetSurfaceWeights(gridPoint.m_x, gridPoint.m_y, outSurfaceWeights))
+    {
+        return;
+    }
+
+    AZ::Aabb bounds;
+    AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(x, y, bounds);
+
     if (!bestAreaId.IsValid())
     {
         return;
@@ -901,6 +1244,11 @@ void TerrainSystem::GetOrderedSurfaceWeights(
         bestAreaId, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeights, inPosition, outSurfaceWeights);
 
     AZStd::sort(outSurfaceWeights.begin(), outSurfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeightComparator());
+
+    if (useCache)
+    {
+        m_heightCache.SetSurfaceWeights(gridPoint.m_x, gridPoint.m_y, outSurfaceWeights, generation);
+    }
 }
 
 void TerrainSystem::GetSurfaceWeights(
@@ -1273,6 +1621,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    InvalidateHeightCache(aabb);
     m_terrainHeightDirty = true;
     m_terrainSurfacesDirty = true;
 }
@@ -1292,6 +1641,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                InvalidateHeightCache(areaData.m_areaBounds);
                 m_terrainHeightDirty = true;
                 m_terrainSurfacesDirty = true;
                 return true;
@@ -1318,6 +1668,16 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
 
     m_dirtyRegion.AddAabb(expandedAabb);
 
+    // Surface data changes don't affect heights, but any change in the area bounds moves the heights along with it.
+    if ((changeMask != Terrain::SurfaceData) || !oldAabb.IsClose(newAabb))
+    {
+        InvalidateHeightCache(expandedAabb);
+    }
+    else
+    {
+        m_heightCache.InvalidateSurfaceWeightsInRegion(expandedAabb, m_currentSettings.m_heightQueryResolution);
+    }
+
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
 
     m_terrainHeightDirty = m_terrainHeightDirty || ((changeMask & Terrain::HeightData) == Terrain::HeightData);
@@ -1325,6 +1685,170 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
     m_terrainSurfacesDirty = m_terrainSurfacesDirty || ((changeMask & Terrain::SurfaceData) == Terrain::SurfaceData);
 }
 
+void TerrainSystem::RegisterStreamingObserver(AZ::EntityId observerId)
+{
+    if (AZStd::find(m_streamingObservers.begin(), m_streamingObservers.end(), observerId) == m_streamingObservers.end())
+    {
+        m_streamingObservers.push_back(observerId);
+    }
+}
+
+void TerrainSystem::UnregisterStreamingObserver(AZ::EntityId observerId)
+{
+    AZStd::erase(m_streamingObservers, observerId);
+}
+
+void TerrainSystem::UpdatePageStreaming()
+{
+    const AZ::Aabb& worldBounds = m_currentSettings.m_worldBounds;
+
+    if (!bg_terrainPageStreamingEnabled || !m_currentSettings.m_systemActive)
+    {
+        if (m_pageStreamer.IsActive())
+        {
+            // Everything goes back to being evaluated from the terrain areas.
+            m_pageStreamer.Stop();
+            m_dirtyRegion.AddAabb(worldBounds);
+            m_terrainHeightDirty = true;
+            m_terrainSurfacesDirty = true;
+        }
+        return;
+    }
+
+    const AZ::CVarFixedString directory = static_cast<AZ::CVarFixedString>(bg_terrainPageDirectory);
+    if (!m_pageStreamer.IsActive() || (m_pageStreamer.GetQueryResolution() != m_currentSettings.m_heightQueryResolution) ||
+        (m_pageStreamer.GetDirectory().Native() != AZStd::string_view(directory)))
+    {
+        // Nothing is resident when streaming starts, so every query changes from the terrain areas to "no terrain".
+        m_pageStreamer.Start(directory, m_currentSettings.m_heightQueryResolution);
+        m_dirtyRegion.AddAabb(worldBounds);
+        m_terrainHeightDirty = true;
+        m_terrainSurfacesDirty = true;
+    }
+
+    m_pageStreamer.SetMemoryBudget(aznumeric_cast<size_t>(static_cast<AZ::u32>(bg_terrainPageMemoryBudgetMB)) * 1024 * 1024);
+
+    AZStd::vector<AZ::Vector3> observerPositions;
+    observerPositions.reserve(AZStd::max<size_t>(m_streamingObservers.size(), 1));
+    for (const AZ::EntityId& observerId : m_streamingObservers)
+    {
+        AZ::Vector3 observerPosition = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(observerPosition, observerId, &AZ::TransformBus::Events::GetWorldTranslation);
+        observerPositions.push_back(observerPosition);
+    }
+
+    if (observerPositions.empty())
+    {
+        AZ::EntityId cameraId;
+        Camera::CameraSystemRequestBus::BroadcastResult(cameraId, &Camera::CameraSystemRequests::GetActiveCamera);
+        if (cameraId.IsValid())
+        {
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(cameraPosition, cameraId, &AZ::TransformBus::Events::GetWorldTranslation);
+            observerPositions.push_back(cameraPosition);
+        }
+    }
+
+    m_pageStreamer.UpdateObservers(observerPositions, bg_terrainPageStreamingRadius);
+
+    // Let the listeners know about every page that was streamed in or evicted.
+    const AZ::Aabb changedRegion = m_pageStreamer.TakeChangedRegion();
+    if (changedRegion.IsValid())
+    {
+        m_dirtyRegion.AddAabb(AZ::Aabb::CreateFromMinMaxValues(
+            changedRegion.GetMin().GetX(), changedRegion.GetMin().GetY(), worldBounds.GetMin().GetZ(),
+            changedRegion.GetMax().GetX(), changedRegion.GetMax().GetY(), worldBounds.GetMax().GetZ()));
+        m_terrainHeightDirty = true;
+        m_terrainSurfacesDirty = true;
+    }
+}
+
+void TerrainSystem::BakeTerrainPages(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (m_pageStreamer.IsActive())
+    {
+        AZ_Error("TerrainSystem", false, "Terrain pages can't be baked while bg_terrainPageStreamingEnabled is set.");
+        return;
+    }
+
+    const AZ::Aabb& worldBounds = m_currentSettings.m_worldBounds;
+    if (!m_currentSettings.m_systemActive || !worldBounds.IsValid())
+    {
+        AZ_Error("TerrainSystem", false, "The terrain system needs to be active to bake terrain pages.");
+        return;
+    }
+
+    const AZ::CVarFixedString directory =
+        arguments.empty() ? static_cast<AZ::CVarFixedString>(bg_terrainPageDirectory) : AZ::CVarFixedString(arguments.front());
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    const float pageWorldSize = TerrainPageStreamer::PageSize * queryResolution;
+
+    const int32_t minPageX = TerrainPageStreamer::GetPageCoordinate(aznumeric_cast<int32_t>(floor(worldBounds.GetMin().GetX() / queryResolution)));
+    const int32_t minPageY = TerrainPageStreamer::GetPageCoordinate(aznumeric_cast<int32_t>(floor(worldBounds.GetMin().GetY() / queryResolution)));
+    const int32_t maxPageX = TerrainPageStreamer::GetPageCoordinate(aznumeric_cast<int32_t>(floor(worldBounds.GetMax().GetX() / queryResolution)));
+    const int32_t maxPageY = TerrainPageStreamer::GetPageCoordinate(aznumeric_cast<int32_t>(floor(worldBounds.GetMax().GetY() / queryResolution)));
+
+    AZStd::vector<TerrainPageStreamer::Sample> samples(TerrainPageStreamer::PageSampleCount);
+    size_t bakedPageCount = 0;
+
+    for (int32_t pageY = minPageY; pageY <= maxPageY; ++pageY)
+    {
+        for (int32_t pageX = minPageX; pageX <= maxPageX; ++pageX)
+        {
+            const AZ::Vector3 regionMin(pageX * pageWorldSize, pageY * pageWorldSize, worldBounds.GetMin().GetZ());
+            const AZ::Aabb region = AZ::Aabb::CreateFromMinMax(regionMin, regionMin + AZ::Vector3(pageWorldSize, pageWorldSize, 0.0f));
+
+            AZStd::fill(samples.begin(), samples.end(), TerrainPageStreamer::Sample());
+            bool pageHasTerrain = false;
+
+            auto perPositionCallback = [&samples, &pageHasTerrain](
+                size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                // Floating point error can add a row or column to the region, which belongs to the next page.
+                if ((xIndex >= TerrainPageStreamer::PageSize) || (yIndex >= TerrainPageStreamer::PageSize))
+                {
+                    return;
+                }
+
+                TerrainPageStreamer::Sample& sample = samples[yIndex * TerrainPageStreamer::PageSize + xIndex];
+                sample.m_height = surfacePoint.m_position.GetZ();
+                sample.m_terrainExists = terrainExists;
+                for (const auto& surfaceTagWeight : surfacePoint.m_surfaceTags)
+                {
+                    if (surfaceTagWeight.m_weight > sample.m_surfaceWeight)
+                    {
+                        sample.m_surfaceType = surfaceTagWeight.m_surfaceType;
+                        sample.m_surfaceWeight = surfaceTagWeight.m_weight;
+                    }
+                }
+                pageHasTerrain = pageHasTerrain || terrainExists;
+            };
+
+            ProcessSurfacePointsFromRegion(
+                region, AZ::Vector2(queryResolution), perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+
+            // Pages without any terrain aren't written, the streamer treats missing pages as empty.
+            if (!pageHasTerrain)
+            {
+                continue;
+            }
+
+            const AZStd::vector<AZ::u8> pageData = TerrainPageStreamer::BakePage(pageX, pageY, queryResolution, samples);
+            const AZ::IO::Path pagePath = AZ::IO::Path(directory) / TerrainPageStreamer::GetPageFileName(pageX, pageY);
+            AZ::IO::FileIOStream pageStream(
+                pagePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath);
+            if (!pageStream.IsOpen() || (pageStream.Write(pageData.size(), pageData.data()) != pageData.size()))
+            {
+                AZ_Error("TerrainSystem", false, "Failed to write terrain page '%s'.", pagePath.c_str());
+                return;
+            }
+            ++bakedPageCount;
+        }
+    }
+
+    AZ_TracePrintf("TerrainSystem", "Baked %zu terrain pages to '%s'.\n", bakedPageCount, directory.c_str());
+}
+
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
 {
     using Terrain = AzFramework::Terrain::TerrainDataNotifications;
@@ -1355,8 +1879,15 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // Cached heights are only valid for the grid and bounds they were evaluated with.
+        m_heightCache.Clear();
     }
 
+    m_heightCache.SetMaxTileCount(bg_terrainHeightCacheMaxTiles);
+
+    UpdatePageStreaming();
+
     if (terrainSettingsChanged || m_terrainHeightDirty || m_terrainSurfacesDirty)
     {
         // Block other threads from accessing the surface data bus while we are in GetValue (which may call into the SurfaceData bus).
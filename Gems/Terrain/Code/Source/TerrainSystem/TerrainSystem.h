@@ -20,11 +20,14 @@
 #include <AzCore/Math/Aabb.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobFunction.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainHeightCache.h>
+#include <TerrainSystem/TerrainPageStreamer.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 namespace Terrain
@@ -53,6 +56,9 @@ namespace Terrain
         void RefreshArea(
             AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
 
+        void RegisterStreamingObserver(AZ::EntityId observerId) override;
+        void UnregisterStreamingObserver(AZ::EntityId observerId) override;
+
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
         float GetTerrainHeightQueryResolution() const override;
@@ -110,6 +116,11 @@ namespace Terrain
         bool GetIsHoleFromVector2(const AZ::Vector2& position, Sampler sampleFilter = Sampler::BILINEAR) const override;
         bool GetIsHoleFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR) const override;
 
+        //! Returns true if the terrain data at location x,y is resident. Only terrain pages that haven't been streamed in
+        //! yet report false, queries at those locations report that no terrain exists.
+        bool GetIsLoaded(const AZ::Vector3& position) const override;
+        bool GetIsLoadedFromFloats(float x, float y) const override;
+
         // Given an XY coordinate, return the surface normal.
         //! @terrainExists: Can be nullptr. If != nullptr then, if there's no terrain at location x,y or location x,y is inside a terrain
         //! HOLE then *terrainExistsPtr will be set to false,
@@ -258,6 +269,18 @@ namespace Terrain
             Sampler sampleFilter = Sampler::DEFAULT,
             AZStd::shared_ptr<ProcessAsyncParams> params = nullptr) const override;
 
+        //! Returns the cache of heights evaluated on the height query grid, mostly for its hit-rate statistics.
+        const TerrainHeightCache& GetHeightCache() const;
+
+        //! Returns the streamer for baked terrain pages, which is only active while bg_terrainPageStreamingEnabled is set.
+        const TerrainPageStreamer& GetPageStreamer() const;
+
+        //! Bakes the terrain inside the world bounds into pages for TerrainPageStreamer. The pages are written to
+        //! bg_terrainPageDirectory, or to the directory given as the first argument.
+        AZ_CONSOLEFUNC(TerrainSystem, BakeTerrainPages, AZ::ConsoleFunctorFlags::Null,
+            "Bakes the terrain heights and surfaces into pages that can be streamed with bg_terrainPageStreamingEnabled.");
+        void BakeTerrainPages(const AZ::ConsoleCommandContainer& arguments);
+
     private:
         template<typename SynchronousFunctionType, typename VectorType>
         AZStd::shared_ptr<TerrainJobContext> ProcessFromListAsync(
@@ -288,6 +311,17 @@ namespace Terrain
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        //! Same as GetTerrainAreaHeight(), for positions on the height query grid, which are looked up in m_heightCache first.
+        float GetCachedTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        void InvalidateHeightCache(const AZ::Aabb& region);
+        //! Converts a position to the nearest point of the height query grid. Returns false if the position isn't on the grid.
+        bool GetQueryGridPoint(float x, float y, TerrainHeightCache::GridPoint& gridPoint) const;
+
+        //! Looks up the baked terrain page sample nearest to x,y. Returns false if its page isn't resident.
+        bool GetPagedSample(float x, float y, TerrainPageStreamer::Sample& sample) const;
+
+        //! Starts or stops page streaming to match the cvars, and streams pages in around the observers.
+        void UpdatePageStreaming();
         AZ::Vector3 GetNormalSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
 
         typedef AZStd::function<void(
@@ -297,6 +331,12 @@ namespace Terrain
             AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
             AZ::EntityId areaId)> BulkQueriesCallback;
 
+        //! Fills in the heights of positions on the height query grid from m_heightCache, and evaluates the rest with bulk queries.
+        void GetCachedHeights(
+            AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists, BulkQueriesCallback queryCallback) const;
+        //! Puts the positions of a bulk height query that have no terrain on the area's ground plane, like GetTerrainAreaHeight() does.
+        void ApplyGroundPlane(AZ::EntityId areaId, AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists) const;
+
         void GetHeightsSynchronous(
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<float> heights,
@@ -352,6 +392,13 @@ namespace Terrain
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::map<AZ::EntityId, TerrainAreaData, TerrainLayerPriorityComparator> m_registeredAreas;
 
+        // Heights of the height query grid points, invalidated with the same regions that are added to m_dirtyRegion.
+        mutable TerrainHeightCache m_heightCache;
+
+        // While active, queries are answered from the baked pages instead of the terrain areas.
+        TerrainPageStreamer m_pageStreamer;
+        AZStd::vector<AZ::EntityId> m_streamingObservers;
+
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
         AZ::JobManager* m_terrainJobManager = nullptr;
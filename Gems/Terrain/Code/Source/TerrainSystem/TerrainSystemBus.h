@@ -46,6 +46,11 @@ namespace Terrain
         virtual void RegisterArea(AZ::EntityId areaId) = 0;
         virtual void UnregisterArea(AZ::EntityId areaId) = 0;
         virtual void RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
+
+        // register an entity that baked terrain pages are streamed in around, such as a player on a dedicated server.
+        // The active camera is used when no observers are registered.
+        virtual void RegisterStreamingObserver(AZ::EntityId observerId) = 0;
+        virtual void UnregisterStreamingObserver(AZ::EntityId observerId) = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
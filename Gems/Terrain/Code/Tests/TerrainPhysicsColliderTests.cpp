@@ -591,3 +591,70 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderDefaultMateria
         EXPECT_EQ(heightsAndMaterials[256 * 128].m_materialIndex, 0);
     }
 }
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderUpdatesOnlyRequestedRegion)
+{
+    // Check that a region is converted to the grid points it contains, and that only those points get updated.
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    m_entity->Activate();
+
+    const AZ::Vector3 boundsMin = AZ::Vector3(0.0f);
+    const AZ::Vector3 boundsMax = AZ::Vector3(256.0f, 256.0f, 32768.0f);
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(boundsMin, boundsMax);
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    const float mockHeight = 32768.0f;
+    float mockHeightResolution = 1.0f;
+
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegion).WillByDefault(
+        [this, mockHeight](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+        {
+            ProcessRegionLoop(inRegion, stepSize, perPositionCallback, nullptr, mockHeight);
+        }
+    );
+
+    // The region includes the grid points that lie exactly on its max edges.
+    const AZ::Aabb dirtyRegion = AZ::Aabb::CreateFromMinMaxValues(10.5f, 20.0f, 0.0f, 30.0f, 40.2f, 100.0f);
+
+    size_t startColumn, startRow, numColumns, numRows;
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, dirtyRegion,
+        startColumn, startRow, numColumns, numRows);
+
+    EXPECT_EQ(startColumn, 10);
+    EXPECT_EQ(startRow, 20);
+    EXPECT_EQ(numColumns, 21);
+    EXPECT_EQ(numRows, 21);
+
+    size_t updatedPoints = 0;
+    bool allPointsInRegion = true;
+    auto updateCallback = [&](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+    {
+        updatedPoints++;
+        allPointsInRegion = allPointsInRegion && (column >= startColumn) && (column < startColumn + numColumns) &&
+            (row >= startRow) && (row < startRow + numRows) && (point.m_quadMeshType != Physics::QuadMeshType::Hole);
+    };
+
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials, updateCallback,
+        startColumn, startRow, numColumns, numRows);
+
+    EXPECT_EQ(updatedPoints, numColumns * numRows);
+    EXPECT_TRUE(allPointsInRegion);
+
+    // A region outside of the heightfield doesn't contain any grid points.
+    const AZ::Aabb outsideRegion = AZ::Aabb::CreateFromMinMaxValues(300.0f, 300.0f, 0.0f, 310.0f, 310.0f, 100.0f);
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, outsideRegion,
+        startColumn, startRow, numColumns, numRows);
+
+    EXPECT_EQ(numColumns, 0);
+    EXPECT_EQ(numRows, 0);
+}
@@ -10,6 +10,7 @@
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzTest/AzTest.h>
 
@@ -1144,4 +1145,467 @@ namespace UnitTest
         // Now wait until the async request has completed after being cancelled.
         asyncRequestCompletedEvent.acquire();
     }
+
+    TEST_F(TerrainSystemTest, TerrainHeightCacheReturnsCachedHeightsForRepeatedQueries)
+    {
+        // Verify that querying the same grid point twice with the "CLAMP" sampler only evaluates the height once.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        int heightEvaluationCount = 0;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightEvaluationCount](AZ::Vector3& position, bool& terrainExists)
+            {
+                ++heightEvaluationCount;
+                position.SetZ(position.GetX() + position.GetY());
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Both positions clamp to the (2, 3) grid point.
+        bool terrainExists = false;
+        float height = terrainSystem->GetHeightFromFloats(2.2f, 3.3f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP, &terrainExists);
+        EXPECT_NEAR(height, 5.0f, 0.0001f);
+        EXPECT_TRUE(terrainExists);
+
+        height = terrainSystem->GetHeightFromFloats(2.7f, 3.8f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP, &terrainExists);
+        EXPECT_NEAR(height, 5.0f, 0.0001f);
+        EXPECT_TRUE(terrainExists);
+
+        EXPECT_EQ(heightEvaluationCount, 1);
+        EXPECT_EQ(terrainSystem->GetHeightCache().GetHitCount(), 1);
+        EXPECT_EQ(terrainSystem->GetHeightCache().GetMissCount(), 1);
+        EXPECT_NEAR(terrainSystem->GetHeightCache().GetHitRate(), 0.5f, 0.0001f);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainHeightCacheIsInvalidatedWhenAreaHeightsChange)
+    {
+        // Verify that refreshing a terrain area with changed height data discards the heights cached inside of it.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        float heightOffset = 1.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        float height = terrainSystem->GetHeightFromFloats(1.0f, 1.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        EXPECT_NEAR(height, 1.0f, 0.0001f);
+
+        // Without a refresh, the cached height is still returned.
+        heightOffset = 2.0f;
+        height = terrainSystem->GetHeightFromFloats(1.0f, 1.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        EXPECT_NEAR(height, 1.0f, 0.0001f);
+
+        // Surface data changes don't affect the cached heights.
+        terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::SurfaceData);
+        height = terrainSystem->GetHeightFromFloats(1.0f, 1.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        EXPECT_NEAR(height, 1.0f, 0.0001f);
+
+        terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::HeightData);
+        height = terrainSystem->GetHeightFromFloats(1.0f, 1.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        EXPECT_NEAR(height, 2.0f, 0.0001f);
+    }
+
+    TEST(TerrainHeightCacheTest, InvalidateRegionOnlyDiscardsHeightsInsideRegion)
+    {
+        Terrain::TerrainHeightCache cache;
+        cache.SetHeight(0, 0, 1.0f, true, cache.GetGeneration());
+        cache.SetHeight(20, 20, 2.0f, false, cache.GetGeneration());
+        cache.SetHeight(-100, -100, 3.0f, true, cache.GetGeneration());
+
+        // With a query resolution of 1, the region covers grid points (-1, -1) to (3, 3).
+        cache.InvalidateRegion(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f), 1.0f);
+
+        float height = 0.0f;
+        bool terrainExists = false;
+        EXPECT_FALSE(cache.GetHeight(0, 0, height, terrainExists));
+
+        EXPECT_TRUE(cache.GetHeight(20, 20, height, terrainExists));
+        EXPECT_FLOAT_EQ(height, 2.0f);
+        EXPECT_FALSE(terrainExists);
+
+        EXPECT_TRUE(cache.GetHeight(-100, -100, height, terrainExists));
+        EXPECT_FLOAT_EQ(height, 3.0f);
+        EXPECT_TRUE(terrainExists);
+    }
+
+    TEST(TerrainHeightCacheTest, HeightsEvaluatedBeforeAnInvalidationAreNotStored)
+    {
+        Terrain::TerrainHeightCache cache;
+
+        // A height evaluated before an overlapping invalidation is stale and gets dropped.
+        const uint64_t generation = cache.GetGeneration();
+        cache.InvalidateRegion(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f), 1.0f);
+        cache.SetHeight(0, 0, 1.0f, true, generation);
+
+        float height = 0.0f;
+        bool terrainExists = false;
+        EXPECT_FALSE(cache.GetHeight(0, 0, height, terrainExists));
+
+        // Heights evaluated after the invalidation are stored.
+        cache.SetHeight(0, 0, 2.0f, true, cache.GetGeneration());
+        EXPECT_TRUE(cache.GetHeight(0, 0, height, terrainExists));
+        EXPECT_FLOAT_EQ(height, 2.0f);
+    }
+
+    TEST(TerrainHeightCacheTest, LeastRecentlyUsedTilesAreEvicted)
+    {
+        constexpr int32_t TileSize = Terrain::TerrainHeightCache::TileSize;
+
+        Terrain::TerrainHeightCache cache;
+        cache.SetMaxTileCount(2);
+        cache.SetHeight(0, 0, 1.0f, true, cache.GetGeneration());
+        cache.SetHeight(TileSize, 0, 2.0f, true, cache.GetGeneration());
+
+        // Touch the first tile so that the second one becomes the least recently used.
+        float height = 0.0f;
+        bool terrainExists = false;
+        EXPECT_TRUE(cache.GetHeight(0, 0, height, terrainExists));
+
+        cache.SetHeight(TileSize * 2, 0, 3.0f, true, cache.GetGeneration());
+        EXPECT_EQ(cache.GetTileCount(), 2);
+
+        EXPECT_TRUE(cache.GetHeight(0, 0, height, terrainExists));
+        EXPECT_FALSE(cache.GetHeight(TileSize, 0, height, terrainExists));
+        EXPECT_TRUE(cache.GetHeight(TileSize * 2, 0, height, terrainExists));
+    }
+
+    TEST_F(TerrainSystemTest, TerrainHeightCacheIsUsedByRegionQueries)
+    {
+        // Verify that region queries with the "CLAMP" sampler only evaluate the heights that aren't cached yet.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        int heightEvaluationCount = 0;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightEvaluationCount](AZ::Vector3& position, bool& terrainExists)
+            {
+                ++heightEvaluationCount;
+                position.SetZ(position.GetX() + position.GetY());
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        const AZ::Aabb testRegionBox = AZ::Aabb::CreateFromMinMaxValues(-4.0f, -4.0f, -1.0f, 4.0f, 4.0f, 1.0f);
+        const AZ::Vector2 stepSize(1.0f);
+
+        int positionCount = 0;
+        auto perPositionCallback = [&positionCount]([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            EXPECT_NEAR(surfacePoint.m_position.GetZ(), surfacePoint.m_position.GetX() + surfacePoint.m_position.GetY(), 0.0001f);
+            EXPECT_TRUE(terrainExists);
+            ++positionCount;
+        };
+
+        terrainSystem->ProcessHeightsFromRegion(
+            testRegionBox, stepSize, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        ASSERT_GT(positionCount, 0);
+        EXPECT_EQ(heightEvaluationCount, positionCount);
+        EXPECT_EQ(terrainSystem->GetHeightCache().GetHitCount(), 0);
+
+        // The second query only reads cached heights.
+        positionCount = 0;
+        terrainSystem->ProcessHeightsFromRegion(
+            testRegionBox, stepSize, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        EXPECT_EQ(heightEvaluationCount, positionCount);
+        EXPECT_EQ(terrainSystem->GetHeightCache().GetHitCount(), positionCount);
+
+        // Single point queries share the heights cached by the region queries.
+        EXPECT_NEAR(terrainSystem->GetHeightFromFloats(1.0f, 2.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 3.0f, 0.0001f);
+        EXPECT_EQ(heightEvaluationCount, positionCount);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainHeightCacheStoresSurfaceWeightsOnTheQueryGrid)
+    {
+        // Verify that surface weights queried on the height query grid are only evaluated once,
+        // and that surface data changes discard them without discarding the cached heights.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        int heightEvaluationCount = 0;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightEvaluationCount](AZ::Vector3& position, bool& terrainExists)
+            {
+                ++heightEvaluationCount;
+                position.SetZ(1.0f);
+                terrainExists = true;
+            });
+
+        AzFramework::SurfaceData::SurfaceTagWeight tagWeight;
+        tagWeight.m_surfaceType = SurfaceData::SurfaceTag("tag1");
+        tagWeight.m_weight = 1.0f;
+
+        int surfaceEvaluationCount = 0;
+        m_terrainAreaSurfaceRequests = AZStd::make_unique<NiceMock<UnitTest::MockTerrainAreaSurfaceRequestBus>>(entity->GetId());
+        ON_CALL(*m_terrainAreaSurfaceRequests, GetSurfaceWeightsFromList).WillByDefault(
+            [&surfaceEvaluationCount, &tagWeight](
+                AZStd::span<const AZ::Vector3> inPositionList,
+                AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList)
+            {
+                for (size_t i = 0; i < inPositionList.size(); i++)
+                {
+                    ++surfaceEvaluationCount;
+                    outSurfaceWeightsList[i].clear();
+                    outSurfaceWeightsList[i].push_back(tagWeight);
+                }
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        const AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.0f, 1.0f, 0.0f), AZ::Vector3(2.0f, 1.0f, 0.0f) };
+        auto querySurfaceWeights = [&terrainSystem, &positions]()
+        {
+            terrainSystem->ProcessSurfaceWeightsFromList(
+                positions,
+                [](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    ASSERT_EQ(surfacePoint.m_surfaceTags.size(), 1);
+                    EXPECT_EQ(surfacePoint.m_surfaceTags[0].m_surfaceType, SurfaceData::SurfaceTag("tag1"));
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        };
+
+        querySurfaceWeights();
+        EXPECT_EQ(surfaceEvaluationCount, 2);
+
+        querySurfaceWeights();
+        EXPECT_EQ(surfaceEvaluationCount, 2);
+
+        // Surface data changes discard the cached surface weights, but keep the cached heights.
+        terrainSystem->GetHeightFromFloats(1.0f, 1.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        const int heightEvaluationCountBeforeRefresh = heightEvaluationCount;
+        terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::SurfaceData);
+
+        querySurfaceWeights();
+        EXPECT_EQ(surfaceEvaluationCount, 4);
+
+        terrainSystem->GetHeightFromFloats(1.0f, 1.0f, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        EXPECT_EQ(heightEvaluationCount, heightEvaluationCountBeforeRefresh);
+    }
+
+    TEST(TerrainHeightCacheTest, InvalidatingSurfaceWeightsKeepsHeights)
+    {
+        Terrain::TerrainHeightCache cache;
+
+        AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights;
+        surfaceWeights.emplace_back(AZ::Crc32("tag1"), 0.25f);
+        surfaceWeights.emplace_back(AZ::Crc32("tag2"), 0.75f);
+
+        cache.SetHeight(1, 1, 1.0f, true, cache.GetGeneration());
+        cache.SetSurfaceWeights(1, 1, surfaceWeights, cache.GetGeneration());
+
+        AzFramework::SurfaceData::SurfaceTagWeightList cachedSurfaceWeights;
+        ASSERT_TRUE(cache.GetSurfaceWeights(1, 1, cachedSurfaceWeights));
+        ASSERT_EQ(cachedSurfaceWeights.size(), 2);
+        EXPECT_EQ(cachedSurfaceWeights[1].m_surfaceType, AZ::Crc32("tag2"));
+        EXPECT_FLOAT_EQ(cachedSurfaceWeights[1].m_weight, 0.75f);
+
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f);
+        cache.InvalidateSurfaceWeightsInRegion(region, 1.0f);
+
+        float height = 0.0f;
+        bool terrainExists = false;
+        EXPECT_FALSE(cache.GetSurfaceWeights(1, 1, cachedSurfaceWeights));
+        EXPECT_TRUE(cache.GetHeight(1, 1, height, terrainExists));
+
+        // Height changes discard the surface weights too, since they can depend on the heights.
+        cache.SetSurfaceWeights(1, 1, surfaceWeights, cache.GetGeneration());
+        cache.InvalidateRegion(region, 1.0f);
+        EXPECT_FALSE(cache.GetSurfaceWeights(1, 1, cachedSurfaceWeights));
+        EXPECT_FALSE(cache.GetHeight(1, 1, height, terrainExists));
+    }
+
+    TEST(TerrainHeightCacheTest, ParallelLookupsAndStoresReturnStoredHeights)
+    {
+        // Several threads fill and read overlapping tiles while a small tile limit keeps evicting them.
+        // Every height that's found has to be the one that was stored for its grid point.
+        constexpr int32_t TileSize = Terrain::TerrainHeightCache::TileSize;
+        constexpr int32_t GridSize = TileSize * 4;
+        constexpr size_t MaxTileCount = 4;
+
+        Terrain::TerrainHeightCache cache;
+        cache.SetMaxTileCount(MaxTileCount);
+
+        auto expectedHeight = [](int32_t gridX, int32_t gridY)
+        {
+            return aznumeric_cast<float>(gridY * GridSize + gridX);
+        };
+
+        AZStd::atomic_int wrongHeightCount{ 0 };
+        auto fillAndRead = [&](int32_t threadIndex)
+        {
+            AZStd::vector<Terrain::TerrainHeightCache::GridPoint> points(GridSize);
+            AZStd::vector<float> heights(GridSize);
+            AZStd::vector<bool> terrainExists(GridSize, true);
+            AZStd::vector<bool> found(GridSize);
+
+            for (int32_t row = 0; row < GridSize; ++row)
+            {
+                // Every thread walks the rows in a different order, so that they keep running into each other's tiles.
+                const int32_t gridY = (row + threadIndex * TileSize / 2) % GridSize;
+                for (int32_t gridX = 0; gridX < GridSize; ++gridX)
+                {
+                    points[gridX] = { gridX, gridY };
+                    heights[gridX] = expectedHeight(gridX, gridY);
+                }
+                cache.SetHeights(points, heights, terrainExists, cache.GetGeneration());
+
+                cache.GetHeights(points, heights, terrainExists, found);
+                for (int32_t gridX = 0; gridX < GridSize; ++gridX)
+                {
+                    if (found[gridX] && (heights[gridX] != expectedHeight(gridX, gridY)))
+                    {
+                        ++wrongHeightCount;
+                    }
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int32_t threadIndex = 0; threadIndex < 8; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&fillAndRead, threadIndex]()
+                {
+                    fillAndRead(threadIndex);
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(wrongHeightCount, 0);
+        EXPECT_LE(cache.GetTileCount(), MaxTileCount);
+        EXPECT_GT(cache.GetHitCount(), 0);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainIsLoadedEverywhereWithoutPageStreaming)
+    {
+        // Without page streaming, all of the terrain data is resident, so every position reports that it's loaded.
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        EXPECT_FALSE(terrainSystem->GetPageStreamer().IsActive());
+        EXPECT_TRUE(terrainSystem->GetIsLoadedFromFloats(0.0f, 0.0f));
+        EXPECT_TRUE(terrainSystem->GetIsLoaded(AZ::Vector3(100000.0f, -100000.0f, 0.0f)));
+    }
+
+    namespace
+    {
+        AZStd::vector<AZ::u8> BakeTestPage(int32_t pageX, int32_t pageY, float queryResolution)
+        {
+            // Every sample gets a height that identifies its page and position, and every other row has no terrain.
+            constexpr int32_t PageSize = Terrain::TerrainPageStreamer::PageSize;
+            AZStd::vector<Terrain::TerrainPageStreamer::Sample> samples(Terrain::TerrainPageStreamer::PageSampleCount);
+            for (int32_t y = 0; y < PageSize; ++y)
+            {
+                for (int32_t x = 0; x < PageSize; ++x)
+                {
+                    Terrain::TerrainPageStreamer::Sample& sample = samples[y * PageSize + x];
+                    sample.m_height = aznumeric_cast<float>(pageX * 1000 + pageY * 100 + x);
+                    sample.m_surfaceType = AZ::Crc32("grass");
+                    sample.m_surfaceWeight = 0.5f;
+                    sample.m_terrainExists = (y % 2) == 0;
+                }
+            }
+            return Terrain::TerrainPageStreamer::BakePage(pageX, pageY, queryResolution, samples);
+        }
+    }
+
+    TEST(TerrainPageStreamerTest, StoredPagesReturnBakedSamples)
+    {
+        constexpr int32_t PageSize = Terrain::TerrainPageStreamer::PageSize;
+
+        Terrain::TerrainPageStreamer streamer;
+        streamer.Start("", 1.0f);
+        EXPECT_TRUE(streamer.StorePage(-1, 2, BakeTestPage(-1, 2, 1.0f)));
+
+        // Grid point (-PageSize + 3, 2 * PageSize) is the fourth sample of the first row of page (-1, 2).
+        Terrain::TerrainPageStreamer::Sample sample;
+        EXPECT_TRUE(streamer.GetSample(-PageSize + 3, 2 * PageSize, sample));
+        EXPECT_FLOAT_EQ(sample.m_height, -1000.0f + 200.0f + 3.0f);
+        EXPECT_EQ(sample.m_surfaceType, AZ::Crc32("grass"));
+        EXPECT_NEAR(sample.m_surfaceWeight, 0.5f, 1.0f / 255.0f);
+        EXPECT_TRUE(sample.m_terrainExists);
+
+        EXPECT_TRUE(streamer.GetSample(-PageSize + 3, 2 * PageSize + 1, sample));
+        EXPECT_FALSE(sample.m_terrainExists);
+
+        // The neighboring pages haven't been stored, so they aren't loaded.
+        EXPECT_TRUE(streamer.IsLoaded(-1, 2 * PageSize));
+        EXPECT_FALSE(streamer.IsLoaded(0, 2 * PageSize));
+        EXPECT_FALSE(streamer.GetSample(0, 2 * PageSize, sample));
+
+        EXPECT_TRUE(streamer.TakeChangedRegion().IsValid());
+        EXPECT_FALSE(streamer.TakeChangedRegion().IsValid());
+    }
+
+    TEST(TerrainPageStreamerTest, ChangedRegionIncludesNeighboringBorderCells)
+    {
+        constexpr int32_t PageSize = Terrain::TerrainPageStreamer::PageSize;
+        constexpr float QueryResolution = 0.5f;
+        constexpr float PageWorldSize = PageSize * QueryResolution;
+
+        Terrain::TerrainPageStreamer streamer;
+        streamer.Start("", QueryResolution);
+        EXPECT_TRUE(streamer.StorePage(1, 1, BakeTestPage(1, 1, QueryResolution)));
+
+        // Positions in the last cell of the previous pages blend towards the first row and column of the stored page,
+        // and positions in the page's last cell blend towards the first row and column of the next pages.
+        const AZ::Aabb changedRegion = streamer.TakeChangedRegion();
+        EXPECT_TRUE(changedRegion.GetMin().IsClose(AZ::Vector3(PageWorldSize - QueryResolution, PageWorldSize - QueryResolution, 0.0f)));
+        EXPECT_TRUE(changedRegion.GetMax().IsClose(AZ::Vector3(PageWorldSize * 2.0f, PageWorldSize * 2.0f, 0.0f)));
+        EXPECT_TRUE(changedRegion.Contains(AZ::Vector3(PageWorldSize - QueryResolution * 0.5f, PageWorldSize * 1.5f, 0.0f)));
+        EXPECT_TRUE(changedRegion.Contains(AZ::Vector3(PageWorldSize * 1.5f, PageWorldSize - QueryResolution * 0.5f, 0.0f)));
+        EXPECT_FALSE(changedRegion.Contains(AZ::Vector3(PageWorldSize - QueryResolution * 1.5f, PageWorldSize * 1.5f, 0.0f)));
+    }
+
+    TEST(TerrainPageStreamerTest, PagesBakedForOtherSettingsAreRejected)
+    {
+        Terrain::TerrainPageStreamer streamer;
+        streamer.Start("", 1.0f);
+
+        EXPECT_FALSE(streamer.StorePage(0, 0, BakeTestPage(0, 0, 2.0f)));
+        EXPECT_FALSE(streamer.StorePage(0, 0, BakeTestPage(1, 0, 1.0f)));
+
+        AZStd::vector<AZ::u8> truncatedPage = BakeTestPage(0, 0, 1.0f);
+        truncatedPage.pop_back();
+        EXPECT_FALSE(streamer.StorePage(0, 0, truncatedPage));
+
+        EXPECT_EQ(streamer.GetResidentPageCount(), 0);
+    }
+
+    TEST(TerrainPageStreamerTest, LeastRecentlyStoredPagesAreEvictedOverBudget)
+    {
+        constexpr int32_t PageSize = Terrain::TerrainPageStreamer::PageSize;
+
+        Terrain::TerrainPageStreamer streamer;
+        streamer.Start("", 1.0f);
+        EXPECT_TRUE(streamer.StorePage(0, 0, BakeTestPage(0, 0, 1.0f)));
+        const size_t pageMemory = streamer.GetResidentMemory();
+
+        streamer.SetMemoryBudget(pageMemory * 2);
+        EXPECT_TRUE(streamer.StorePage(1, 0, BakeTestPage(1, 0, 1.0f)));
+        EXPECT_TRUE(streamer.StorePage(2, 0, BakeTestPage(2, 0, 1.0f)));
+
+        EXPECT_EQ(streamer.GetResidentPageCount(), 2);
+        EXPECT_LE(streamer.GetResidentMemory(), streamer.GetMemoryBudget());
+        EXPECT_FALSE(streamer.IsLoaded(0, 0));
+        EXPECT_TRUE(streamer.IsLoaded(PageSize, 0));
+        EXPECT_TRUE(streamer.IsLoaded(PageSize * 2, 0));
+
+        // Stopping drops every page.
+        streamer.Stop();
+        EXPECT_EQ(streamer.GetResidentPageCount(), 0);
+        EXPECT_EQ(streamer.GetResidentMemory(), 0);
+    }
 } // namespace UnitTest
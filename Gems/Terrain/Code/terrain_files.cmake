@@ -56,6 +56,10 @@ set(FILES
     Source/TerrainRenderer/TerrainMacroMaterialBus.h
     Source/TerrainRenderer/Vector2i.cpp
     Source/TerrainRenderer/Vector2i.h
+    Source/TerrainSystem/TerrainHeightCache.cpp
+    Source/TerrainSystem/TerrainHeightCache.h
+    Source/TerrainSystem/TerrainPageStreamer.cpp
+    Source/TerrainSystem/TerrainPageStreamer.h
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
@@ -97,6 +97,10 @@ namespace Vegetation
         virtual void OnRegisterArea() {}
         virtual void OnUnregisterArea() {}
 
+        // Tests every available claim point against the shapes of all the processed entities in one batch per shape.
+        // A point is inside if it's inside all the shapes, entities without a shape don't reject any point.
+        static void GetClaimPointsInsideShapes(const EntityIdStack& processedIds, const ClaimContext& context, AZStd::vector<bool>& outInsideShapes);
+
     private:
         void UpdateRegistration();
 
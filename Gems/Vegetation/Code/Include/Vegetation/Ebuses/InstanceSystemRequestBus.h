@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
 #include <Vegetation/Descriptor.h>
 
 namespace Vegetation
@@ -39,6 +40,12 @@ namespace Vegetation
 
         // destroy vegetation instance by id
         virtual void DestroyInstance(InstanceId instanceId) = 0;
+
+        // create several vegetation instances at once, the instances are processed together on the main thread
+        virtual void CreateInstances(AZStd::span<InstanceData> instanceData) = 0;
+
+        // destroy several vegetation instances by id, the instances are processed together on the main thread
+        virtual void DestroyInstances(AZStd::span<const InstanceId> instanceIds) = 0;
         virtual void DestroyAllInstances() = 0;
 
         virtual void Cleanup() = 0;
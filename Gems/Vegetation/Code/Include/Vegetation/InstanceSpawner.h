@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/span.h>
 #include <Vegetation/Ebuses/DescriptorNotificationBus.h>
 
 namespace Vegetation
@@ -84,6 +85,35 @@ namespace Vegetation
         //! Destroy a single instance.
         virtual void DestroyInstance(InstanceId id, InstancePtr instance) = 0;
 
+        //! Create several instances at once. Each entry in outInstances is set to the instance created for the matching
+        //! entry in instances, or to null if that instance couldn't be created.
+        virtual void CreateInstances(AZStd::span<const InstanceData* const> instances, AZStd::span<InstancePtr> outInstances)
+        {
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                outInstances[index] = CreateInstance(*instances[index]);
+            }
+        }
+
+        //! Destroy several instances at once.
+        virtual void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+        {
+            for (size_t index = 0; index < ids.size(); ++index)
+            {
+                DestroyInstance(ids[index], instances[index]);
+            }
+        }
+
+        //! Can instances be hidden and kept around for reuse instead of being destroyed?
+        virtual bool SupportsInstanceReuse() const { return false; }
+
+        //! Hide an instance that's being kept for reuse. Only called if SupportsInstanceReuse() returns true.
+        virtual void HideInstance([[maybe_unused]] InstancePtr instance) {}
+
+        //! Move a hidden instance to the location of the given instance data and show it again.
+        //! Returns false if the instance can't be reused, in which case it gets destroyed instead.
+        virtual bool ReuseInstance([[maybe_unused]] InstancePtr instance, [[maybe_unused]] const InstanceData& instanceData) { return false; }
+
         //! Check for data equivalency.  Subclasses are expected to implement this.
         bool operator==(const InstanceSpawner& rhs) const { return DataIsEquivalent(rhs); };
 
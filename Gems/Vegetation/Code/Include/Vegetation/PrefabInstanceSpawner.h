@@ -9,6 +9,7 @@
 
 #include <Vegetation/InstanceSpawner.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Math/Transform.h>
 #include <AzFramework/Entity/EntityContextBus.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
@@ -59,6 +60,17 @@ namespace Vegetation
         //! Destroy a single instance.
         void DestroyInstance(InstanceId id, InstancePtr instance) override;
 
+        //! Create several instances at once, sharing the spawnable lookups and the ticket bookkeeping between them.
+        void CreateInstances(AZStd::span<const InstanceData* const> instances, AZStd::span<InstancePtr> outInstances) override;
+
+        //! Destroy several instances at once.
+        void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances) override;
+
+        //! Spawned instances can be hidden by deactivating their entities, and reactivated at a new position.
+        bool SupportsInstanceReuse() const override;
+        void HideInstance(InstancePtr instance) override;
+        bool ReuseInstance(InstancePtr instance, const InstanceData& instanceData) override;
+
         AZStd::string GetSpawnableAssetPath() const;
         void SetSpawnableAssetPath(const AZStd::string& assetPath);
 
@@ -84,12 +96,24 @@ namespace Vegetation
         //! Despawn an instance of a spawnable asset
         void DespawnAssetInstance(AzFramework::EntitySpawnTicket* ticket);
 
+        //! Create a ticket for a new instance and queue the spawning of its entities. Returns null if the ticket is invalid.
+        InstancePtr SpawnInstance(AzFramework::SpawnableEntitiesDefinition& spawnableEntities, const InstanceData& instanceData);
+
+        //! Stop tracking the ticket of an instance and delete it, which despawns the instance's entities.
+        void ReleaseInstance(InstancePtr instance);
+
+        //! Create the world transform for the root entity of an instance.
+        static AZ::Transform GetInstanceTransform(const InstanceData& instanceData);
+
         //! Cached values so that asset isn't accessed on other threads
         bool m_assetLoadedAndSpawnable = false;
 
         //! Collection of spawned instance tickets, needed for destroying the instances.
         AZStd::unordered_set<AzFramework::EntitySpawnTicket*> m_instanceTickets;
 
+        //! Subset of the instance tickets whose entities are spawned but deactivated, waiting to be reused.
+        AZStd::unordered_set<AzFramework::EntitySpawnTicket*> m_hiddenInstanceTickets;
+
         //! asset data
         AZ::Data::Asset<AzFramework::Spawnable> m_spawnableAsset;
     };
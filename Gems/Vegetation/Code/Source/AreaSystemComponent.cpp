@@ -18,10 +18,13 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -39,6 +42,15 @@
 
 namespace Vegetation
 {
+    AZ_CVAR(AZ::u32,
+        bg_vegetationSectorBatchSize,
+        8,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The number of closest pending vegetation sectors whose surface points are generated in parallel. "
+        "The sectors of a batch are still filled one at a time. Set to 1 to create / update one sector at a time."
+    );
+
     namespace AreaSystemUtil
     {
         template <typename T>
@@ -1078,6 +1090,12 @@ namespace Vegetation
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1166,14 +1184,12 @@ namespace Vegetation
                 const auto& claimedInstanceData = claimItr->second;
                 if (claimedInstanceData.m_id != instanceData.m_id)
                 {
-                    //must force bus connect if areas are different
-                    AreaNotificationBus::Event(claimedInstanceData.m_id, &AreaNotificationBus::Events::OnAreaConnect);
-                    AreaRequestBus::Event(claimedInstanceData.m_id, &AreaRequestBus::Events::UnclaimPosition, handle);
-                    AreaNotificationBus::Event(claimedInstanceData.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
+                    //the previous area still maps the handle to its own instance, so it's released along with the rest of the batch
+                    sectorInfo.m_claimsReplacedDuringFill.emplace_back(handle, claimedInstanceData);
                 }
                 else
                 {
-                    //already connected during fill sector
+                    //the area is about to map the handle to the new instance, so the previous instance has to be released first
                     AreaRequestBus::Event(claimedInstanceData.m_id, &AreaRequestBus::Events::UnclaimPosition, handle);
                 }
             }
@@ -1267,12 +1283,10 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::ReleaseUnusedClaims(SectorInfo& sectorInfo)
+    void AreaSystemComponent::VegetationThreadTasks::ReleaseUnusedClaims(SectorInfo& sectorInfo, ClaimReleaseMap& claimsToRelease)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
-
         // Group up all the previously-claimed-but-no-longer-claimed points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPointsBeforeFill)
         {
@@ -1286,6 +1300,18 @@ namespace Vegetation
         }
         sectorInfo.m_claimedWorldPointsBeforeFill.clear();
 
+        // Points that another area took over are still claimed by their previous area as well
+        for (const auto& claimPair : sectorInfo.m_claimsReplacedDuringFill)
+        {
+            claimsToRelease[claimPair.second.m_id].insert(claimPair.first);
+        }
+        sectorInfo.m_claimsReplacedDuringFill.clear();
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::ReleaseClaims(const ClaimReleaseMap& claimsToRelease)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
         // Iterate over the claims by area id and release them
         for (const auto& claimPair : claimsToRelease)
         {
@@ -1302,7 +1328,7 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas)
+    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, ClaimReleaseMap& claimsToRelease)
     {
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now()));
@@ -1331,15 +1357,13 @@ namespace Vegetation
                 VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaStart, area.m_id, AZStd::chrono::system_clock::now()));
 
                 //each area is responsible for removing whatever points it claims from m_availablePoints, so subsequent areas will have fewer points to try to claim.
-                AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaConnect);
                 AreaRequestBus::Event(area.m_id, &AreaRequestBus::Events::ClaimPositions, EntityIdStack{}, activeContext);
-                AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
 
                 VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaEnd, area.m_id, AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
             }
         }
 
-        ReleaseUnusedClaims(sectorInfo);
+        ReleaseUnusedClaims(sectorInfo, claimsToRelease);
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
     }
@@ -1348,7 +1372,7 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        ClaimReleaseMap claimsToRelease;
 
         // group up all the points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPoints)
@@ -1360,20 +1384,7 @@ namespace Vegetation
         }
         sectorInfo.m_claimedWorldPoints.clear();
 
-        // iterate over the claims by area id and release them
-        for (const auto& claimPair : claimsToRelease)
-        {
-            const auto& areaId = claimPair.first;
-            const auto& handles = claimPair.second;
-            AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
-            AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
-        }
+        ReleaseClaims(claimsToRelease);
     }
 
     void AreaSystemComponent::VegetationThreadTasks::ClearSectors()
@@ -1488,7 +1499,7 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateNextSectors(threadData, vegTasks);
             }
         }
     }
@@ -1753,7 +1764,7 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateNextSectors(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -1778,44 +1789,87 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
+            // The closest sectors are at the end of the work list, so pull the batch from the end, closest sector first.
+            const size_t batchSize = AZ::GetClamp<size_t>(static_cast<AZ::u32>(bg_vegetationSectorBatchSize), 1, m_updateWorkList.size());
+            m_sectorBatch.clear();
+            m_sectorBatch.resize(batchSize);
+            for (SectorBatchEntry& entry : m_sectorBatch)
+            {
+                entry.m_id = m_updateWorkList.back().first;
+                entry.m_mode = m_updateWorkList.back().second;
+                m_updateWorkList.pop_back();
+            }
+
+            // Generating the surface points doesn't touch the rolling window, so it runs in parallel without the lock.
+            GenerateSectorBatchPoints(vegTasks);
 
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+                // Each sector claims its points through its own claim context and only records its own claims. Anything
+                // that touches the areas on behalf of the batch happens once, at the two sync points around the fills:
+                // the active areas are connected once for the whole batch, and the claims that the sectors gave up are
+                // released together afterwards, connecting each of their areas once.
+                // The fills themselves still run one sector at a time in priority order. Claiming positions dispatches
+                // through AreaRequestBus and the areas sample their gradients through GradientRequestBus, and both hold
+                // their bus mutex for the whole call, so parallel fills would only wait on each other.
+                for (const auto& area : threadData->m_activeAreasInBubble)
+                {
+                    AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaConnect);
+                }
 
-                switch (mode)
+                for (size_t batchIndex = 0; batchIndex < m_sectorBatch.size(); ++batchIndex)
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                    SectorBatchEntry& entry = m_sectorBatch[batchIndex];
 
-                    case UpdateMode::Fill:
+                    // Stop early if we've been interrupted, and put the unfilled sectors back on the work list so that
+                    // they're processed first the next time the thread runs.
+                    if (threadData->m_vegetationThreadState == PersistentThreadData::VegetationThreadState::InterruptRequested)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        for (size_t remainingIndex = m_sectorBatch.size(); remainingIndex > batchIndex; --remainingIndex)
+                        {
+                            const SectorBatchEntry& remainingEntry = m_sectorBatch[remainingIndex - 1];
+                            m_updateWorkList.emplace_back(remainingEntry.m_id, remainingEntry.m_mode);
+                        }
+                        break;
                     }
-                    break;
 
-                    case UpdateMode::Create:
+                    switch (entry.m_mode)
                     {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        case UpdateMode::RebuildSurfaceCacheAndFill:
+                        {
+                            auto sectorInfo = vegTasks->GetSector(entry.m_id);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                            sectorInfo->m_baseContext.m_availablePoints = AZStd::move(entry.m_pointsSector.m_baseContext.m_availablePoints);
+                            sectorInfo->m_baseContext.m_masks = entry.m_pointsSector.m_baseContext.m_masks;
+                            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, m_batchClaimsToRelease);
+                        }
+                        break;
+
+                        case UpdateMode::Fill:
+                        {
+                            auto sectorInfo = vegTasks->GetSector(entry.m_id);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, m_batchClaimsToRelease);
+                        }
+                        break;
+
+                        case UpdateMode::Create:
+                        {
+                            AZ_Assert(!vegTasks->GetSector(entry.m_id), "Sector update mode is 'Create' but sector already exists");
+                            auto sectorInfo = vegTasks->AddSector(AZStd::move(entry.m_pointsSector));
+                            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, m_batchClaimsToRelease);
+                        }
+                        break;
                     }
-                    break;
+                }
+
+                VegetationThreadTasks::ReleaseClaims(m_batchClaimsToRelease);
+                m_batchClaimsToRelease.clear();
+
+                for (const auto& area : threadData->m_activeAreasInBubble)
+                {
+                    AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
                 }
             }
 
@@ -1826,4 +1880,57 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::GenerateSectorBatchPoints(VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        auto generatePoints = [vegTasks, sectorDensity, sectorSizeInMeters, sectorPointSnapMode](SectorBatchEntry& entry)
+        {
+            entry.m_pointsSector.m_id = entry.m_id;
+            entry.m_pointsSector.m_bounds = VegetationThreadTasks::GetSectorBounds(entry.m_id, sectorSizeInMeters);
+            vegTasks->UpdateSectorPoints(entry.m_pointsSector, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        };
+
+        size_t pointsSectorCount = 0;
+        for (const SectorBatchEntry& entry : m_sectorBatch)
+        {
+            pointsSectorCount += (entry.m_mode != UpdateMode::Fill) ? 1 : 0;
+        }
+
+        // Don't bother with jobs if there's only one sector to generate, or if there's no job system to run them on
+        // (such as when the update runs synchronously during shutdown).
+        if ((pointsSectorCount <= 1) || !AZ::JobContext::GetGlobalContext())
+        {
+            for (SectorBatchEntry& entry : m_sectorBatch)
+            {
+                if (entry.m_mode != UpdateMode::Fill)
+                {
+                    generatePoints(entry);
+                }
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (SectorBatchEntry& entry : m_sectorBatch)
+        {
+            if (entry.m_mode == UpdateMode::Fill)
+            {
+                continue;
+            }
+
+            AZ::Job* job = AZ::CreateJobFunction([&generatePoints, &entry]()
+            {
+                AZ_PROFILE_SCOPE(Entity, "Vegetation::AreaSystemComponent::GenerateSectorPointsJob");
+                generatePoints(entry);
+            }, true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
 }
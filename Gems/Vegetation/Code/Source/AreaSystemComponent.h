@@ -157,6 +157,8 @@ namespace Vegetation
     private:
         using ClaimContainer = AZStd::unordered_map<ClaimHandle, InstanceData>;
         using ClaimContainerEntry = AZStd::pair<ClaimHandle, InstanceData>;
+        //! Claims to give back to their areas, grouped by area id.
+        using ClaimReleaseMap = AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>>;
 
         using SectorId = AZStd::pair<int, int>;
 
@@ -171,6 +173,9 @@ namespace Vegetation
             ClaimContainer m_claimedWorldPoints;
             //! Keeps track of previous state of sector while filling to avoid redundant instance destroy/create calls
             ClaimContainer m_claimedWorldPointsBeforeFill;
+            //! Points of the current fill that were claimed by a different area than before. The previous areas' claims
+            //! are only released once the whole batch of sectors is filled, see VegetationThreadTasks::FillSector().
+            AZStd::vector<ClaimContainerEntry> m_claimsReplacedDuringFill;
             ClaimContext m_baseContext;
 
             int GetSectorX() const { return m_id.first; }
@@ -288,8 +293,16 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose surface points have already been generated with UpdateSectorPoints() to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            //! Claims the sector's points from the active areas, which the caller has to connect with OnAreaConnect() beforehand.
+            //! The sector only records its own claims. The claims it gave up are added to claimsToRelease instead of being released
+            //! right away, so that the claims of a whole batch of sectors are released together with ReleaseClaims().
+            //! Must only run on the vegetation thread, one sector at a time.
+            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, ClaimReleaseMap& claimsToRelease);
+            //! Releases claims from their areas, connecting each area once.
+            static void ReleaseClaims(const ClaimReleaseMap& claimsToRelease);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
@@ -311,7 +324,7 @@ namespace Vegetation
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
             ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
 
-            void ReleaseUnusedClaims(SectorInfo& sectorInfo);
+            void ReleaseUnusedClaims(SectorInfo& sectorInfo, ClaimReleaseMap& claimsToRelease);
             void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
 
             //! Creates a new sector
@@ -425,7 +438,8 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateNextSectors(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void GenerateSectorBatchPoints(VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -434,6 +448,15 @@ namespace Vegetation
                 Fill
             };
 
+            // A sector taken from the update work list.  Sectors that need new surface points get them generated into
+            // m_pointsSector, which is only visible to the vegetation thread until the points are moved into the rolling window.
+            struct SectorBatchEntry
+            {
+                SectorId m_id = {};
+                UpdateMode m_mode = UpdateMode::Fill;
+                SectorInfo m_pointsSector;
+            };
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
@@ -442,6 +465,14 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // The closest sectors from m_updateWorkList that are being created / updated together, closest sector first.
+            // Their surface points are generated in parallel, then they're filled one at a time in this order so that
+            // the placed vegetation doesn't depend on the number of threads.
+            AZStd::vector<SectorBatchEntry> m_sectorBatch;
+
+            // The claims that the sectors of the current batch gave up, released once the whole batch is filled.
+            ClaimReleaseMap m_batchClaimsToRelease;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
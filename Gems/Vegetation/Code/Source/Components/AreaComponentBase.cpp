@@ -214,6 +214,41 @@ namespace Vegetation
         return m_changeIndex;
     }
 
+    void AreaComponentBase::GetClaimPointsInsideShapes(
+        const EntityIdStack& processedIds, const ClaimContext& context, AZStd::vector<bool>& outInsideShapes)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const size_t pointCount = context.m_availablePoints.size();
+        outInsideShapes.assign(pointCount, true);
+        if (pointCount == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(pointCount);
+        for (const auto& point : context.m_availablePoints)
+        {
+            positions.push_back(point.m_position);
+        }
+
+        AZStd::vector<bool> insideShape(pointCount);
+        for (const auto& id : processedIds)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                id,
+                [&positions, &insideShape, &outInsideShapes](LmbrCentral::ShapeComponentRequestsBus::Events* shape)
+                {
+                    shape->IsPointsInside(positions, insideShape);
+                    for (size_t index = 0; index < insideShape.size(); ++index)
+                    {
+                        outInsideShapes[index] = outInsideShapes[index] && insideShape[index];
+                    }
+                });
+        }
+    }
+
     void AreaComponentBase::UpdateRegistration()
     {
         // Area "valid" lifetimes can be shorter than the time in which the area components are active.
@@ -183,7 +183,7 @@ namespace Vegetation
         return true;
     }
 
-    bool BlockerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData)
+    bool BlockerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, bool insideShapes, InstanceData& instanceData)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -198,19 +198,14 @@ namespace Vegetation
         }
 #endif
 
-        // test shape bus as first pass to claim the point
-        bool isInsideShape = true;
-        for (const auto& id : processedIds)
+        // the shape test is the first pass to claim the point, it was done for all points up front by ClaimPositions
+        if (!insideShapes)
         {
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(isInsideShape, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-            if (!isInsideShape)
-            {
 #if VEG_BLOCKER_ENABLE_CACHING
-                AZStd::lock_guard<decltype(m_cacheMutex)> cacheLock(m_cacheMutex);
-                m_claimCacheMapping[point.m_handle] = false;
+            AZStd::lock_guard<decltype(m_cacheMutex)> cacheLock(m_cacheMutex);
+            m_claimCacheMapping[point.m_handle] = false;
 #endif
-                return false;
-            }
+            return false;
         }
 
         //generate details for a single vegetation instance
@@ -258,17 +253,21 @@ namespace Vegetation
         instanceData.m_id = GetEntityId();
         instanceData.m_changeIndex = GetChangeIndex();
 
+        AZStd::vector<bool> insideShapes;
+        GetClaimPointsInsideShapes(processedIds, context, insideShapes);
+
         size_t numAvailablePoints = context.m_availablePoints.size();
         for (size_t pointIndex = 0; pointIndex < numAvailablePoints; )
         {
             ClaimPoint& point = context.m_availablePoints[pointIndex];
 
-            if (ClaimPosition(processedIds, point, instanceData))
+            if (ClaimPosition(processedIds, point, insideShapes[pointIndex], instanceData))
             {
                 context.m_createdCallback(point, instanceData);
 
                 //Swap an available point from the end of the list
                 AZStd::swap(point, context.m_availablePoints.at(numAvailablePoints - 1));
+                insideShapes[pointIndex] = insideShapes[numAvailablePoints - 1];
                 --numAvailablePoints;
                 continue;
             }
@@ -93,7 +93,7 @@ namespace Vegetation
         void SetInheritBehavior(bool value) override;
 
     private:
-        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData);
+        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, bool insideShapes, InstanceData& instanceData);
         BlockerConfig m_configuration;
 
 #if VEG_BLOCKER_ENABLE_CACHING
@@ -257,17 +257,32 @@ namespace Vegetation
         return !m_selectableDescriptorCache.empty();
     }
 
-    bool SpawnerComponent::CreateInstance([[maybe_unused]] const ClaimPoint &point, InstanceData& instanceData)
+    bool SpawnerComponent::CanCreateInstance(const InstanceData& instanceData) const
+    {
+        return (instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->IsSpawnable()) || m_configuration.m_allowEmptyMeshes;
+    }
+
+    void SpawnerComponent::CreateInstances(AZStd::span<const ClaimHandle> handles, AZStd::span<InstanceData> instances)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        instanceData.m_instanceId = InvalidInstanceId;
-        if (instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->IsSpawnable())
+        if (instances.empty())
         {
-            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::CreateInstance, instanceData);
+            return;
         }
 
-        return instanceData.m_instanceId != InvalidInstanceId || m_configuration.m_allowEmptyMeshes;
+        //ids are assigned right away, the instances themselves are spawned in batches on the main thread
+        InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::CreateInstances, instances);
+
+        //only store the instance ids after all claim logic executes in case prior claims and instances get released
+        AZStd::lock_guard<decltype(m_claimInstanceMappingMutex)> claimInstanceMappingMutexLock(m_claimInstanceMappingMutex);
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            if (instances[index].m_instanceId != InvalidInstanceId)
+            {
+                m_claimInstanceMapping[handles[index]] = instances[index].m_instanceId;
+            }
+        }
     }
 
     void SpawnerComponent::ClearSelectableDescriptors()
@@ -351,7 +366,7 @@ namespace Vegetation
         return true;
     }
 
-    bool SpawnerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData)
+    bool SpawnerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, bool insideShapes, InstanceData& instanceData)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -375,16 +390,11 @@ namespace Vegetation
         }
 #endif
 
-        // test shape bus as first pass to claim the point
-        for (const auto& id : processedIds)
+        // the shape test is the first pass to claim the point, it was done for all points up front by ClaimPositions
+        if (!insideShapes)
         {
-            bool accepted = true;
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(accepted, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-            if (!accepted)
-            {
-                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
-                return false;
-            }
+            VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
+            return false;
         }
 
         //generate uvw sample coordinates
@@ -433,31 +443,39 @@ namespace Vegetation
         instanceData.m_id = GetEntityId();
         instanceData.m_changeIndex = GetChangeIndex();
 
+        AZStd::vector<bool> insideShapes;
+        GetClaimPointsInsideShapes(processedIds, context, insideShapes);
+
+        //new instances are collected and handed to the instance system together once all points are claimed
+        AZStd::vector<ClaimHandle> instanceHandles;
+        AZStd::vector<InstanceData> instancesToCreate;
+
         size_t numAvailablePoints = context.m_availablePoints.size();
         for (size_t pointIndex = 0; pointIndex < numAvailablePoints; )
         {
             ClaimPoint& point = context.m_availablePoints[pointIndex];
 
             bool accepted = false;
-            if (ClaimPosition(processedIds, point, instanceData))
+            if (ClaimPosition(processedIds, point, insideShapes[pointIndex], instanceData))
             {
                 // Check if an identical instance already exists for reuse
                 if (context.m_existedCallback(point, instanceData))
                 {
                     accepted = true;
                 }
-                else
+                else if (CanCreateInstance(instanceData))
                 {
-                    if (CreateInstance(point, instanceData))
-                    {
-                        accepted = true;
+                    accepted = true;
 
-                        //notify the caller that this claim succeeded so it can do any cleanup or registration
-                        context.m_createdCallback(point, instanceData);
+                    //notify the caller that this claim succeeded so it can do any cleanup or registration
+                    //the claim is registered right away so that filters evaluating the remaining points can see it
+                    instanceData.m_instanceId = InvalidInstanceId;
+                    context.m_createdCallback(point, instanceData);
 
-                        //only store the instance id after all claim logic executes in case prior claim and instance gets released
-                        AZStd::lock_guard<decltype(m_claimInstanceMappingMutex)> claimInstanceMappingMutexLock(m_claimInstanceMappingMutex);
-                        m_claimInstanceMapping[point.m_handle] = instanceData.m_instanceId;
+                    if (instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->IsSpawnable())
+                    {
+                        instanceHandles.push_back(point.m_handle);
+                        instancesToCreate.push_back(instanceData);
                     }
                 }
             }
@@ -466,6 +484,7 @@ namespace Vegetation
             {
                 //Swap an available point from the end of the list
                 AZStd::swap(point, context.m_availablePoints.at(numAvailablePoints - 1));
+                insideShapes[pointIndex] = insideShapes[numAvailablePoints - 1];
                 --numAvailablePoints;
 
 #if VEG_SPAWNER_ENABLE_CACHING
@@ -490,6 +509,8 @@ namespace Vegetation
         //resize to remove all used points
         context.m_availablePoints.resize(numAvailablePoints);
 
+        CreateInstances(instanceHandles, instancesToCreate);
+
         //release residual descriptors and asset references used this claim attempt
         AZStd::lock_guard<decltype(m_selectableDescriptorMutex)> selectableDescriptorLock(m_selectableDescriptorMutex);
         m_selectedDescriptors.clear();
@@ -554,11 +575,14 @@ namespace Vegetation
             AZStd::swap(claimInstanceMapping, m_claimInstanceMapping);
         }
 
+        //destroy all of the instances in one request so they're processed together
+        AZStd::vector<InstanceId> instanceIds;
+        instanceIds.reserve(claimInstanceMapping.size());
         for (const auto& claim : claimInstanceMapping)
         {
-            const auto instanceId = claim.second;
-            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstance, instanceId);
+            instanceIds.push_back(claim.second);
         }
+        InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstances, instanceIds);
 
 #if VEG_SPAWNER_ENABLE_CACHING
         //wipe the cache
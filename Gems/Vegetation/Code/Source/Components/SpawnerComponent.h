@@ -117,10 +117,11 @@ namespace Vegetation
 
     private:
         void ClearSelectableDescriptors();
-        bool CreateInstance(const ClaimPoint &point, InstanceData& instanceData);
+        bool CanCreateInstance(const InstanceData& instanceData) const;
+        void CreateInstances(AZStd::span<const ClaimHandle> handles, AZStd::span<InstanceData> instances);
         bool EvaluateFilters(EntityIdStack& processedIds, InstanceData& instanceData, const FilterStage intendedStage) const;
         bool ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr);
-        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData);
+        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, bool insideShapes, InstanceData& instanceData);
         void DestroyAllInstances();
         void CalcInstanceDebugColor(const EntityIdStack& processedIds);
 
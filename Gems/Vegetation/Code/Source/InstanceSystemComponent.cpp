@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 
 #include <Vegetation/Ebuses/AreaInfoBus.h>
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
@@ -30,6 +31,8 @@ namespace Vegetation
             static const int s_maxTaskTimePerTick = 33000; //capping at 33ms presumably to maintain 30fps
             static const int s_minTaskBatchSize = 1;
             static const int s_maxTaskBatchSize = 2000; //prevents user from reserving excessive space as batches are processed faster than they can be filled
+            static const int s_minPooledInstancesPerDescriptor = 0; //disables pooling
+            static const int s_maxPooledInstancesPerDescriptor = 100000;
         }
     };
 
@@ -41,9 +44,10 @@ namespace Vegetation
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<InstanceSystemConfig, AZ::ComponentConfig>()
-                ->Version(3)
+                ->Version(4)
                 ->Field("MaxInstanceProcessTimeMicroseconds", &InstanceSystemConfig::m_maxInstanceProcessTimeMicroseconds)
                 ->Field("MaxInstanceTaskBatchSize", &InstanceSystemConfig::m_maxInstanceTaskBatchSize)
+                ->Field("MaxPooledInstancesPerDescriptor", &InstanceSystemConfig::m_maxPooledInstancesPerDescriptor)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -58,6 +62,9 @@ namespace Vegetation
                     ->DataElement(0, &InstanceSystemConfig::m_maxInstanceTaskBatchSize, "Max Instance Task Batch Size", "Maximum number of instance management tasks that can be batch processed together")
                         ->Attribute(AZ::Edit::Attributes::Min, InstanceSystemUtil::Constants::s_minTaskBatchSize)
                         ->Attribute(AZ::Edit::Attributes::Max, InstanceSystemUtil::Constants::s_maxTaskBatchSize)
+                    ->DataElement(0, &InstanceSystemConfig::m_maxPooledInstancesPerDescriptor, "Max Pooled Instances Per Descriptor", "Maximum number of destroyed instances per descriptor that are hidden and reused by later creations instead of being destroyed. Pooled instances keep their memory, 0 disables pooling")
+                        ->Attribute(AZ::Edit::Attributes::Min, InstanceSystemUtil::Constants::s_minPooledInstancesPerDescriptor)
+                        ->Attribute(AZ::Edit::Attributes::Max, InstanceSystemUtil::Constants::s_maxPooledInstancesPerDescriptor)
                     ;
             }
         }
@@ -69,6 +76,7 @@ namespace Vegetation
                 ->Constructor()
                 ->Property("maxInstanceProcessTimeMicroseconds", BehaviorValueProperty(&InstanceSystemConfig::m_maxInstanceProcessTimeMicroseconds))
                 ->Property("maxInstanceTaskBatchSize", BehaviorValueProperty(&InstanceSystemConfig::m_maxInstanceTaskBatchSize))
+                ->Property("maxPooledInstancesPerDescriptor", BehaviorValueProperty(&InstanceSystemConfig::m_maxPooledInstancesPerDescriptor))
                 ;
         }
     }
@@ -252,6 +260,10 @@ namespace Vegetation
         for (auto descItr = m_uniqueDescriptorsToDelete.begin(); descItr != m_uniqueDescriptorsToDelete.end(); )
         {
             DescriptorPtr descriptorPtr = descItr->first;
+
+            //pooled instances can never be reused once their descriptor is released, and the pool holds a reference to it
+            DestroyPooledInstances(descriptorPtr);
+
             const auto remaining = descriptorPtr.use_count();
             if (remaining == 2) //one for the container and one for the local
             {
@@ -264,60 +276,74 @@ namespace Vegetation
 
     void InstanceSystemComponent::CreateInstance(InstanceData& instanceData)
     {
-        AZ_PROFILE_FUNCTION(Entity);
+        CreateInstances(AZStd::span<InstanceData>(&instanceData, 1));
+    }
 
-        if (!IsDescriptorValid(instanceData.m_descriptorPtr))
-        {
-            //Descriptor and mesh must be valid and registered with the system to proceed but it's not an error
-            //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
-            //this should result in a composition change and refresh
-            instanceData.m_instanceId = InvalidInstanceId;
-            return;
-        }
+    void InstanceSystemComponent::DestroyInstance(InstanceId instanceId)
+    {
+        DestroyInstances(AZStd::span<const InstanceId>(&instanceId, 1));
+    }
+
+    void InstanceSystemComponent::CreateInstances(AZStd::span<InstanceData> instanceData)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-        //generate new instance id, from pool if entries exist
-        instanceData.m_instanceId = CreateInstanceId();
-        if (instanceData.m_instanceId == InvalidInstanceId)
+        for (InstanceData& instance : instanceData)
         {
-            return;
-        }
+            if (!IsDescriptorValid(instance.m_descriptorPtr))
+            {
+                //Descriptor and mesh must be valid and registered with the system to proceed but it's not an error
+                //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
+                //this should result in a composition change and refresh
+                instance.m_instanceId = InvalidInstanceId;
+                continue;
+            }
 
-        // Doing this here risks a slighly inaccurate count if the Create*Node functions fail, but I need this to happen on the vegetation thread so the events are recorded in order.
-        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
+            //generate new instance id, from pool if entries exist
+            instance.m_instanceId = CreateInstanceId();
+            if (instance.m_instanceId == InvalidInstanceId)
+            {
+                continue;
+            }
 
-        //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
+            // Doing this here risks a slighly inaccurate count if the Create*Node functions fail, but I need this to happen on the vegetation thread so the events are recorded in order.
+            VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instance.m_instanceId, instance.m_position, instance.m_id));
+        }
 
-        m_createTaskCount++;
+        //queue render node related tasks to process on the main thread, instances without an id are skipped
+        AddCreateTasks(instanceData);
     }
 
-    void InstanceSystemComponent::DestroyInstance(InstanceId instanceId)
+    void InstanceSystemComponent::DestroyInstances(AZStd::span<const InstanceId> instanceIds)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        if (instanceId == InvalidInstanceId)
+        AZStd::vector<InstanceId> idsToDestroy;
+        idsToDestroy.reserve(instanceIds.size());
+        for (InstanceId instanceId : instanceIds)
         {
-            return;
-        }
+            if (instanceId == InvalidInstanceId)
+            {
+                continue;
+            }
 
-        // do this here so we retain a correct ordering of events based on the vegetation thread.
-        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
+            // do this here so we retain a correct ordering of events based on the vegetation thread.
+            VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
+            idsToDestroy.push_back(instanceId);
+        }
 
-        //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
+        if (idsToDestroy.empty())
+        {
+            return;
+        }
 
+        {
             AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
+            m_instanceDeletionSet.insert(idsToDestroy.begin(), idsToDestroy.end());
+        }
 
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        m_instanceDeletionSet.insert(instanceId);
-        m_destroyTaskCount++;
+        //queue render node related tasks to process on the main thread
+        AddDestroyTasks(idsToDestroy);
     }
 
     void InstanceSystemComponent::DestroyAllInstances()
@@ -330,6 +356,9 @@ namespace Vegetation
         // clear all instances
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+
+            //group the instances by descriptor so that each descriptor destroys all of its instances in one call
+            AZStd::map<DescriptorPtr, AZStd::pair<AZStd::vector<InstanceId>, AZStd::vector<InstancePtr>>> instancesToDestroy;
             for (auto instancePair : m_instanceMap)
             {
                 InstanceId instanceId = instancePair.first;
@@ -337,12 +366,21 @@ namespace Vegetation
                 InstancePtr opaqueInstanceData = instancePair.second.second;
                 if (opaqueInstanceData)
                 {
-                    descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+                    auto& descriptorInstances = instancesToDestroy[descriptor];
+                    descriptorInstances.first.push_back(instanceId);
+                    descriptorInstances.second.push_back(opaqueInstanceData);
                 }
                 ReleaseInstanceId(instanceId);
             }
+
+            for (const auto& descriptorInstances : instancesToDestroy)
+            {
+                descriptorInstances.first->DestroyInstances(descriptorInstances.second.first, descriptorInstances.second.second);
+            }
             m_instanceMap.clear();
             m_instanceCount = 0;
+
+            DestroyAllPooledInstances();
         }
 
         {
@@ -434,80 +472,259 @@ namespace Vegetation
         m_instanceIdPool.insert(instanceId);
     }
 
-    bool InstanceSystemComponent::IsInstanceSkippable(const InstanceData& instanceData) const
+    void InstanceSystemComponent::CreateInstanceNodes(const AZStd::vector<InstanceData>& instances)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        //if the instance was queued for deletion before its creation task executed then skip it
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
-    }
-
-    void InstanceSystemComponent::CreateInstanceNode(const InstanceData& instanceData)
-    {
-        AZ_PROFILE_FUNCTION(Entity);
+        AZStd::vector<const InstanceData*> instancesToCreate;
+        instancesToCreate.reserve(instances.size());
 
-        if (IsInstanceSkippable(instanceData))
         {
-            return;
+            //if an instance was queued for deletion before its creation task executed then skip it
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            for (const InstanceData& instanceData : instances)
+            {
+                if (m_instanceDeletionSet.find(instanceData.m_instanceId) == m_instanceDeletionSet.end())
+                {
+                    instancesToCreate.push_back(&instanceData);
+                }
+            }
         }
 
-        // Only support valid, registered descriptors with loaded assets
-        if (!instanceData.m_descriptorPtr || !instanceData.m_descriptorPtr->IsLoaded())
         {
-            //descriptor and mesh must be valid but it's not an error
+            //descriptors must be registered with the system and have loaded assets to create an instance, but it's not an error
             //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
             //this should result in a composition change and refresh
+            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+            AZStd::erase_if(instancesToCreate, [this](const InstanceData* instanceData)
+            {
+                return !instanceData->m_descriptorPtr || !instanceData->m_descriptorPtr->IsLoaded() ||
+                    m_uniqueDescriptors.find(instanceData->m_descriptorPtr) == m_uniqueDescriptors.end();
+            });
+        }
+
+        if (instancesToCreate.empty())
+        {
             return;
         }
 
+        //group the instances by descriptor so that each descriptor spawns all of its instances in one call
+        AZStd::stable_sort(instancesToCreate.begin(), instancesToCreate.end(), [](const InstanceData* lhs, const InstanceData* rhs)
         {
-            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+            return lhs->m_descriptorPtr < rhs->m_descriptorPtr;
+        });
 
-            auto descItr = m_uniqueDescriptors.find(instanceData.m_descriptorPtr);
-            if (descItr == m_uniqueDescriptors.end())
+        AZStd::vector<InstancePtr> createdInstances(instancesToCreate.size(), nullptr);
+        AZStd::vector<const InstanceData*> instancesToSpawn;
+        AZStd::vector<InstancePtr> spawnedInstances;
+
+        for (size_t groupStart = 0; groupStart < instancesToCreate.size();)
+        {
+            const DescriptorPtr& descriptor = instancesToCreate[groupStart]->m_descriptorPtr;
+            size_t groupEnd = groupStart + 1;
+            while (groupEnd < instancesToCreate.size() && instancesToCreate[groupEnd]->m_descriptorPtr == descriptor)
             {
-                //descriptor must be registered with the system to create an instance.
-                //it could have been removed or re-added while editing or deleting entities that control the registration
-                return;
+                ++groupEnd;
+            }
+
+            //recycle hidden instances from the pool first, and only spawn the remainder
+            instancesToSpawn.clear();
+            for (size_t index = groupStart; index < groupEnd; ++index)
+            {
+                InstancePtr pooledInstance = TakePooledInstance(descriptor);
+                while (pooledInstance)
+                {
+                    if (descriptor->ReuseInstance(pooledInstance, *instancesToCreate[index]))
+                    {
+                        createdInstances[index] = pooledInstance;
+                        break;
+                    }
+
+                    //the pooled instance can't be reused, so get rid of it and try the next one
+                    descriptor->DestroyInstance(InvalidInstanceId, pooledInstance);
+                    pooledInstance = TakePooledInstance(descriptor);
+                }
+
+                if (!pooledInstance)
+                {
+                    instancesToSpawn.push_back(instancesToCreate[index]);
+                }
+            }
+
+            if (!instancesToSpawn.empty())
+            {
+                spawnedInstances.assign(instancesToSpawn.size(), nullptr);
+                descriptor->CreateInstances(instancesToSpawn, spawnedInstances);
+
+                size_t spawnedIndex = 0;
+                for (size_t index = groupStart; index < groupEnd; ++index)
+                {
+                    if (!createdInstances[index])
+                    {
+                        createdInstances[index] = spawnedInstances[spawnedIndex++];
+                    }
+                }
+            }
+
+            groupStart = groupEnd;
+        }
+
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        for (size_t index = 0; index < instancesToCreate.size(); ++index)
+        {
+            if (createdInstances[index])
+            {
+                const InstanceData& instanceData = *instancesToCreate[index];
+                AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
+                m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, createdInstances[index]);
             }
         }
+        m_instanceCount = static_cast<int>(m_instanceMap.size());
+    }
+
+    void InstanceSystemComponent::ReleaseInstanceNodes(const AZStd::vector<InstanceId>& instanceIds)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-        InstancePtr opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+        struct ReleasedInstance
+        {
+            InstanceId m_instanceId;
+            DescriptorPtr m_descriptor;
+            InstancePtr m_instance;
+        };
+        AZStd::vector<ReleasedInstance> releasedInstances;
+        releasedInstances.reserve(instanceIds.size());
 
-        if (opaqueInstanceData)
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
+            for (InstanceId instanceId : instanceIds)
+            {
+                auto instanceItr = m_instanceMap.find(instanceId);
+                if (instanceItr != m_instanceMap.end())
+                {
+                    if (instanceItr->second.second)
+                    {
+                        releasedInstances.push_back({ instanceId, instanceItr->second.first, instanceItr->second.second });
+                    }
+                    m_instanceMap.erase(instanceItr);
+                }
+            }
             m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
+
+        //group the instances by descriptor so that each descriptor destroys all of its instances in one call
+        AZStd::stable_sort(releasedInstances.begin(), releasedInstances.end(), [](const ReleasedInstance& lhs, const ReleasedInstance& rhs)
+        {
+            return lhs.m_descriptor < rhs.m_descriptor;
+        });
+
+        AZStd::vector<InstanceId> idsToDestroy;
+        AZStd::vector<InstancePtr> instancesToDestroy;
+        const size_t maxPoolSize = static_cast<size_t>(AZStd::max(m_configuration.m_maxPooledInstancesPerDescriptor, 0));
+
+        for (size_t groupStart = 0; groupStart < releasedInstances.size();)
+        {
+            const DescriptorPtr& descriptor = releasedInstances[groupStart].m_descriptor;
+            size_t groupEnd = groupStart + 1;
+            while (groupEnd < releasedInstances.size() && releasedInstances[groupEnd].m_descriptor == descriptor)
+            {
+                ++groupEnd;
+            }
+
+            idsToDestroy.clear();
+            instancesToDestroy.clear();
+
+            //hide instances and keep them for reuse while there's room in the pool, destroy the rest
+            if (maxPoolSize > 0 && descriptor->SupportsInstanceReuse())
+            {
+                AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+                AZStd::vector<InstancePtr>& pool = m_instancePools[descriptor];
+                for (size_t index = groupStart; index < groupEnd; ++index)
+                {
+                    if (pool.size() < maxPoolSize)
+                    {
+                        descriptor->HideInstance(releasedInstances[index].m_instance);
+                        pool.push_back(releasedInstances[index].m_instance);
+                    }
+                    else
+                    {
+                        idsToDestroy.push_back(releasedInstances[index].m_instanceId);
+                        instancesToDestroy.push_back(releasedInstances[index].m_instance);
+                    }
+                }
+            }
+            else
+            {
+                for (size_t index = groupStart; index < groupEnd; ++index)
+                {
+                    idsToDestroy.push_back(releasedInstances[index].m_instanceId);
+                    instancesToDestroy.push_back(releasedInstances[index].m_instance);
+                }
+            }
+
+            if (!idsToDestroy.empty())
+            {
+                descriptor->DestroyInstances(idsToDestroy, instancesToDestroy);
+            }
+
+            groupStart = groupEnd;
+        }
+
+        {
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            for (InstanceId instanceId : instanceIds)
+            {
+                m_instanceDeletionSet.erase(instanceId);
+            }
+        }
+
+        {
+            //add released ids to the free list for recycling
+            AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+            m_instanceIdPool.insert(instanceIds.begin(), instanceIds.end());
+        }
     }
 
-    void InstanceSystemComponent::ReleaseInstanceNode(InstanceId instanceId)
+    InstancePtr InstanceSystemComponent::TakePooledInstance(const DescriptorPtr& descriptor)
     {
-        AZ_PROFILE_FUNCTION(Entity);
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        auto poolItr = m_instancePools.find(descriptor);
+        if (poolItr == m_instancePools.end() || poolItr->second.empty())
+        {
+            return nullptr;
+        }
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
+        InstancePtr instance = poolItr->second.back();
+        poolItr->second.pop_back();
+        return instance;
+    }
 
+    void InstanceSystemComponent::DestroyPooledInstances(const DescriptorPtr& descriptor)
+    {
+        AZStd::vector<InstancePtr> pooledInstances;
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
+            auto poolItr = m_instancePools.find(descriptor);
+            if (poolItr == m_instancePools.end())
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
+                return;
             }
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            pooledInstances = AZStd::move(poolItr->second);
+            m_instancePools.erase(poolItr);
         }
 
-        if (opaqueInstanceData)
+        //pooled instances no longer have an instance id
+        AZStd::vector<InstanceId> instanceIds(pooledInstances.size(), InvalidInstanceId);
+        descriptor->DestroyInstances(instanceIds, pooledInstances);
+    }
+
+    void InstanceSystemComponent::DestroyAllPooledInstances()
+    {
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        while (!m_instancePools.empty())
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            DestroyPooledInstances(m_instancePools.begin()->first);
         }
-        ReleaseInstanceId(instanceId);
     }
 
     bool InstanceSystemComponent::HasTasks() const
@@ -516,17 +733,49 @@ namespace Vegetation
         return !m_mainThreadTaskQueue.empty();
     }
 
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddCreateTasks(AZStd::span<const InstanceData> instances)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        const size_t maxBatchSize = static_cast<size_t>(m_configuration.m_maxInstanceTaskBatchSize);
+
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
+        for (const InstanceData& instanceData : instances)
         {
-            m_mainThreadTaskQueue.push_back();
-            m_mainThreadTaskQueue.back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
+            if (instanceData.m_instanceId == InvalidInstanceId)
+            {
+                continue;
+            }
+
+            if (m_mainThreadTaskQueue.empty() || !m_mainThreadTaskQueue.back().m_instancesToDestroy.empty() ||
+                m_mainThreadTaskQueue.back().m_instancesToCreate.size() >= maxBatchSize)
+            {
+                m_mainThreadTaskQueue.push_back();
+                m_mainThreadTaskQueue.back().m_instancesToCreate.reserve(maxBatchSize);
+            }
+            m_mainThreadTaskQueue.back().m_instancesToCreate.emplace_back(instanceData);
+            m_createTaskCount++;
+        }
+    }
+
+    void InstanceSystemComponent::AddDestroyTasks(AZStd::span<const InstanceId> instanceIds)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const size_t maxBatchSize = static_cast<size_t>(m_configuration.m_maxInstanceTaskBatchSize);
+
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        for (InstanceId instanceId : instanceIds)
+        {
+            if (m_mainThreadTaskQueue.empty() || !m_mainThreadTaskQueue.back().m_instancesToCreate.empty() ||
+                m_mainThreadTaskQueue.back().m_instancesToDestroy.size() >= maxBatchSize)
+            {
+                m_mainThreadTaskQueue.push_back();
+                m_mainThreadTaskQueue.back().m_instancesToDestroy.reserve(maxBatchSize);
+            }
+            m_mainThreadTaskQueue.back().m_instancesToDestroy.emplace_back(instanceId);
+            m_destroyTaskCount++;
         }
-        m_mainThreadTaskQueue.back().emplace_back(task);
     }
 
     void InstanceSystemComponent::ClearTasks()
@@ -566,9 +815,16 @@ namespace Vegetation
         auto removedTasksPtr = AZStd::make_shared<TaskList>();
         while (GetTasks(*removedTasksPtr))
         {
-            for (const auto& task : (*removedTasksPtr).back())
+            const TaskBatch& taskBatch = removedTasksPtr->back();
+            if (!taskBatch.m_instancesToCreate.empty())
+            {
+                CreateInstanceNodes(taskBatch.m_instancesToCreate);
+                m_createTaskCount -= static_cast<int>(taskBatch.m_instancesToCreate.size());
+            }
+            if (!taskBatch.m_instancesToDestroy.empty())
             {
-                task();
+                ReleaseInstanceNodes(taskBatch.m_instancesToDestroy);
+                m_destroyTaskCount -= static_cast<int>(taskBatch.m_instancesToDestroy.size());
             }
 
             currentTime = AZStd::chrono::system_clock::now();
@@ -579,7 +835,7 @@ namespace Vegetation
         }
 
         //offloading garbage collection to job to save time deallocating tasks on main thread
-        auto garbageCollectionJob = AZ::CreateJobFunction([]() mutable {}, true);
+        auto garbageCollectionJob = AZ::CreateJobFunction([removedTasksPtr]() mutable { removedTasksPtr.reset(); }, true);
         garbageCollectionJob->Start();
     }
 
@@ -52,6 +52,10 @@ namespace Vegetation
 
         // maximum number of instance management tasks that can be batch processed together
         int m_maxInstanceTaskBatchSize = 100;
+
+        // maximum number of destroyed instances per descriptor that are hidden and kept for reuse instead of being destroyed,
+        // for instance spawners that support it. Pooled instances stay alive, so the default keeps the pools small; 0 disables pooling.
+        int m_maxPooledInstancesPerDescriptor = 128;
     };
 
     /**
@@ -95,6 +99,8 @@ namespace Vegetation
 
         void CreateInstance(InstanceData& instanceData) override;
         void DestroyInstance(InstanceId instanceId) override;
+        void CreateInstances(AZStd::span<InstanceData> instanceData) override;
+        void DestroyInstances(AZStd::span<const InstanceId> instanceIds) override;
         void DestroyAllInstances() override;
         void Cleanup() override;
 
@@ -123,28 +129,40 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
-        bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateInstanceNode(const InstanceData& instanceData);
-
-        void ReleaseInstanceNode(InstanceId instanceId);
+        void CreateInstanceNodes(const AZStd::vector<InstanceData>& instances);
+        void ReleaseInstanceNodes(const AZStd::vector<InstanceId>& instanceIds);
 
         mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
 
+        ////////////////////////////////////////////////////////////////
+        // hidden instances kept for reuse, per descriptor, guarded by m_instanceMapMutex
+        InstancePtr TakePooledInstance(const DescriptorPtr& descriptor);
+        void DestroyPooledInstances(const DescriptorPtr& descriptor);
+        void DestroyAllPooledInstances();
+
+        AZStd::map<DescriptorPtr, AZStd::vector<InstancePtr>> m_instancePools;
+
         mutable AZStd::recursive_mutex m_instanceDeletionSetMutex;
         AZStd::unordered_set<InstanceId> m_instanceDeletionSet;
 
         ////////////////////////////////////////////////////////////////
         // Task management
-        using Task = AZStd::function<void(void)>;
-        using TaskBatch = AZStd::vector<Task>;
+        // Instances to create or destroy, processed together on the main thread. A batch never holds both creations and
+        // destructions, so that they are processed in the order they were requested.
+        struct TaskBatch
+        {
+            AZStd::vector<InstanceData> m_instancesToCreate;
+            AZStd::vector<InstanceId> m_instancesToDestroy;
+        };
         using TaskList = AZStd::list<TaskBatch>;
         TaskList m_mainThreadTaskQueue;
         mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
         bool HasTasks() const;
-        void AddTask(const Task& task);
+        void AddCreateTasks(AZStd::span<const InstanceData> instances);
+        void AddDestroyTasks(AZStd::span<const InstanceId> instanceIds);
         void ClearTasks();
         bool GetTasks(TaskList& removedTasks);
         void ExecuteTasks();
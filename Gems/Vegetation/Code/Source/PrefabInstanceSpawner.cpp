@@ -14,6 +14,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <Vegetation/AreaComponentBase.h>
 #include <Vegetation/InstanceData.h>
@@ -117,6 +118,8 @@ namespace Vegetation
                 DespawnAssetInstance(ticket);
             }
         }
+        // Hidden instances have been despawned as well, so they can no longer be reused.
+        m_hiddenInstanceTickets.clear();
         ResetSpawnableAsset();
         NotifyOnAssetsUnloaded();
     }
@@ -316,13 +319,28 @@ namespace Vegetation
     }
 
     InstancePtr PrefabInstanceSpawner::CreateInstance(const InstanceData& instanceData)
+    {
+        return SpawnInstance(*AzFramework::SpawnableEntitiesInterface::Get(), instanceData);
+    }
+
+    void PrefabInstanceSpawner::CreateInstances(AZStd::span<const InstanceData* const> instances, AZStd::span<InstancePtr> outInstances)
+    {
+        AzFramework::SpawnableEntitiesDefinition& spawnableEntities = *AzFramework::SpawnableEntitiesInterface::Get();
+
+        m_instanceTickets.reserve(m_instanceTickets.size() + instances.size());
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            outInstances[index] = SpawnInstance(spawnableEntities, *instances[index]);
+        }
+    }
+
+    InstancePtr PrefabInstanceSpawner::SpawnInstance(
+        AzFramework::SpawnableEntitiesDefinition& spawnableEntities, const InstanceData& instanceData)
     {
         InstancePtr opaqueInstanceData = nullptr;
 
         // Create a Transform that represents our instance.
-        AZ::Transform world = AZ::Transform::CreateFromQuaternionAndTranslation(
-            instanceData.m_alignment * instanceData.m_rotation, instanceData.m_position);
-        world.MultiplyByUniformScale(instanceData.m_scale);
+        const AZ::Transform world = GetInstanceTransform(instanceData);
 
         // Create a callback for SpawnAllEntities that will set the transform of the root entity to the correct position / rotation / scale
         // for our spawned instance.
@@ -350,7 +368,7 @@ namespace Vegetation
 
             AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
             optionalArgs.m_preInsertionCallback = AZStd::move(preSpawnCB);
-            AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(*ticket, AZStd::move(optionalArgs));
+            spawnableEntities.SpawnAllEntities(*ticket, AZStd::move(optionalArgs));
 
             opaqueInstanceData = ticket;
         }
@@ -376,22 +394,124 @@ namespace Vegetation
     {
         if (instance)
         {
+            // The call to DespawnAssetInstance is technically redundant right now, because when ReleaseInstance deletes the ticket
+            // pointer it will automatically despawn everything anyways. However, it's nice to have a single explicit call to despawn,
+            // in case we ever need a place to add logging, or have a callback when despawning is complete, etc.
             auto ticket = reinterpret_cast<AzFramework::EntitySpawnTicket*>(instance);
-
-            // If the spawnable asset instantiated successfully, we should have a record of it.
-            auto foundInstance = m_instanceTickets.find(ticket);
-            AZ_Assert(foundInstance != m_instanceTickets.end(), "Couldn't find CreateInstance entry for the EntitySpawnTicket.");
-            if (foundInstance != m_instanceTickets.end())
+            if (m_instanceTickets.find(ticket) != m_instanceTickets.end())
             {
-                // The call to DespawnAssetInstance above is technically redundant right now, because when we delete the ticket pointer
-                // below it will automatically despawn everything anyways. However, it's nice to have a single explicit call to despawn,
-                // in case we ever need a place to add logging, or have a callback when despawning is complete, etc.
                 DespawnAssetInstance(ticket);
-                m_instanceTickets.erase(foundInstance);
             }
 
-            // The vegetation system has stopped tracking this instance, so it's now safe to delete the ticket pointer.
-            delete ticket;
+            ReleaseInstance(instance);
+        }
+    }
+
+    void PrefabInstanceSpawner::DestroyInstances([[maybe_unused]] AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+    {
+        // Deleting a ticket despawns its entities, so a batch skips the separate despawn request for each instance
+        // and only queues the destruction of the tickets.
+        for (InstancePtr instance : instances)
+        {
+            if (instance)
+            {
+                ReleaseInstance(instance);
+            }
+        }
+    }
+
+    void PrefabInstanceSpawner::ReleaseInstance(InstancePtr instance)
+    {
+        auto ticket = reinterpret_cast<AzFramework::EntitySpawnTicket*>(instance);
+
+        // If the spawnable asset instantiated successfully, we should have a record of it.
+        auto foundInstance = m_instanceTickets.find(ticket);
+        AZ_Assert(foundInstance != m_instanceTickets.end(), "Couldn't find CreateInstance entry for the EntitySpawnTicket.");
+        if (foundInstance != m_instanceTickets.end())
+        {
+            m_instanceTickets.erase(foundInstance);
+            m_hiddenInstanceTickets.erase(ticket);
+        }
+
+        // The vegetation system has stopped tracking this instance, so it's now safe to delete the ticket pointer.
+        delete ticket;
+    }
+
+    bool PrefabInstanceSpawner::SupportsInstanceReuse() const
+    {
+        return true;
+    }
+
+    void PrefabInstanceSpawner::HideInstance(InstancePtr instance)
+    {
+        auto ticket = reinterpret_cast<AzFramework::EntitySpawnTicket*>(instance);
+        if (!ticket || !ticket->IsValid() || m_instanceTickets.find(ticket) == m_instanceTickets.end())
+        {
+            return;
+        }
+
+        // Deactivating keeps the entities and their components allocated, so reusing them is much cheaper than spawning again.
+        m_hiddenInstanceTickets.emplace(ticket);
+        AzFramework::SpawnableEntitiesInterface::Get()->ListEntities(
+            *ticket,
+            []([[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView view)
+            {
+                for (const AZ::Entity* entity : view)
+                {
+                    if (entity->GetState() == AZ::Entity::State::Active)
+                    {
+                        AzFramework::GameEntityContextRequestBus::Broadcast(
+                            &AzFramework::GameEntityContextRequestBus::Events::DeactivateGameEntity, entity->GetId());
+                    }
+                }
+            });
+    }
+
+    bool PrefabInstanceSpawner::ReuseInstance(InstancePtr instance, const InstanceData& instanceData)
+    {
+        auto ticket = reinterpret_cast<AzFramework::EntitySpawnTicket*>(instance);
+
+        // Only instances that were hidden and haven't been despawned since can be reused.
+        if (!m_assetLoadedAndSpawnable || !ticket || !ticket->IsValid() || (m_hiddenInstanceTickets.erase(ticket) == 0))
+        {
+            return false;
         }
+
+        // The spawnable queues its commands per ticket, so this runs after the deactivation requested in HideInstance.
+        const AZ::Transform world = GetInstanceTransform(instanceData);
+        AzFramework::SpawnableEntitiesInterface::Get()->ListEntities(
+            *ticket,
+            [world]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView view)
+            {
+                if (view.empty())
+                {
+                    return;
+                }
+
+                AzFramework::TransformComponent* entityTransform = (*view.begin())->FindComponent<AzFramework::TransformComponent>();
+                if (entityTransform)
+                {
+                    entityTransform->SetWorldTM(world);
+                }
+
+                for (const AZ::Entity* entity : view)
+                {
+                    if (entity->GetState() == AZ::Entity::State::Init)
+                    {
+                        AzFramework::GameEntityContextRequestBus::Broadcast(
+                            &AzFramework::GameEntityContextRequestBus::Events::ActivateGameEntity, entity->GetId());
+                    }
+                }
+            });
+
+        return true;
+    }
+
+    AZ::Transform PrefabInstanceSpawner::GetInstanceTransform(const InstanceData& instanceData)
+    {
+        AZ::Transform world = AZ::Transform::CreateFromQuaternionAndTranslation(
+            instanceData.m_alignment * instanceData.m_rotation, instanceData.m_position);
+        world.MultiplyByUniformScale(instanceData.m_scale);
+        return world;
     }
 } // namespace Vegetation
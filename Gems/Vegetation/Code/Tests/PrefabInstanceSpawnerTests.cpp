@@ -318,6 +318,38 @@ namespace UnitTest
         instanceSpawner.OnReleaseUniqueDescriptor();
     }
 
+    TEST_F(PrefabInstanceSpawnerTests, CreateAndDestroyInstancesInBatch)
+    {
+        // The spawner should successfully create and destroy several instances with single calls.
+
+        Vegetation::PrefabInstanceSpawner instanceSpawner;
+
+        m_testHandler->CreateAndSetMockAsset(instanceSpawner, AZ::Uuid::CreateRandom(), "test");
+
+        instanceSpawner.OnRegisterUniqueDescriptor();
+
+        constexpr size_t numInstances = 4;
+        Vegetation::InstanceData instanceData[numInstances];
+        const Vegetation::InstanceData* instances[numInstances];
+        Vegetation::InstanceId instanceIds[numInstances];
+        for (size_t index = 0; index < numInstances; ++index)
+        {
+            instanceData[index].m_position = AZ::Vector3(aznumeric_cast<float>(index), 0.0f, 0.0f);
+            instances[index] = &instanceData[index];
+            instanceIds[index] = index;
+        }
+
+        Vegetation::InstancePtr createdInstances[numInstances] = {};
+        instanceSpawner.CreateInstances(instances, createdInstances);
+        for (Vegetation::InstancePtr instance : createdInstances)
+        {
+            EXPECT_TRUE(instance);
+        }
+        instanceSpawner.DestroyInstances(instanceIds, createdInstances);
+
+        instanceSpawner.OnReleaseUniqueDescriptor();
+    }
+
     TEST_F(PrefabInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
     {
         // Validate that the Descriptor successfully gets PrefabInstanceSpawner registered with it,
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/CameraBus.h>
+#include <AzTest/AzTest.h>
+
+#include <Tests/VegetationMocks.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    // Provides the surface points for the vegetation sectors.  The surface height comes from a synthetic gradient
+    // that's cheap enough to not need any other systems, but expensive enough to give each sector real work to do.
+    struct SyntheticSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        static float GetHeight(float x, float y)
+        {
+            float height = 0.0f;
+            float frequency = 0.01f;
+            float amplitude = 32.0f;
+            for (int octave = 0; octave < 4; ++octave)
+            {
+                height += amplitude * sinf(x * frequency) * cosf(y * frequency);
+                frequency *= 2.0f;
+                amplitude *= 0.5f;
+            }
+            return height;
+        }
+
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
+        {
+            AZStd::vector<AZ::Vector3> inPositions;
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
+                }
+            }
+
+            surfacePointListPerPosition.Clear();
+            surfacePointListPerPosition.StartListConstruction(inPositions, 1, {});
+            for (const AZ::Vector3& inPosition : inPositions)
+            {
+                const float x = inPosition.GetX();
+                const float y = inPosition.GetY();
+                const AZ::Vector3 position(x, y, GetHeight(x, y));
+                const AZ::Vector3 normal = AZ::Vector3(GetHeight(x - 0.5f, y) - GetHeight(x + 0.5f, y),
+                    GetHeight(x, y - 0.5f) - GetHeight(x, y + 0.5f), 1.0f).GetNormalized();
+                surfacePointListPerPosition.AddSurfacePoint(AZ::EntityId(), inPosition, position, normal, m_outMasks);
+            }
+            surfacePointListPerPosition.EndListConstruction();
+        }
+    };
+
+    // Acts as the active camera so that the vegetation system centers its view rectangle on m_position.
+    struct BenchmarkCamera
+        : public MockTransformBus
+        , public Camera::CameraSystemRequestBus::Handler
+    {
+        explicit BenchmarkCamera(AZ::EntityId cameraId)
+            : m_cameraId(cameraId)
+        {
+            AZ::TransformBus::Handler::BusConnect(m_cameraId);
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+        }
+
+        ~BenchmarkCamera()
+        {
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+            AZ::TransformBus::Handler::BusDisconnect();
+        }
+
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_cameraId;
+        }
+
+        AZ::Vector3 GetWorldTranslation() override
+        {
+            return m_position;
+        }
+
+        AZ::EntityId m_cameraId;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+    };
+
+    // A vegetation area that claims every point where a synthetic density gradient is above one half, and counts the
+    // number of sectors it has been asked to fill.
+    struct BenchmarkArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+        explicit BenchmarkArea(AZ::EntityId areaId)
+            : m_areaId(areaId)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_areaId);
+        }
+
+        ~BenchmarkArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        static float GetDensity(const AZ::Vector3& position)
+        {
+            return 0.5f + 0.5f * sinf(position.GetX() * 0.37f) * cosf(position.GetY() * 0.23f);
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            auto& availablePoints = context.m_availablePoints;
+            availablePoints.erase(
+                AZStd::remove_if(availablePoints.begin(), availablePoints.end(),
+                    [this, &context](const Vegetation::ClaimPoint& point)
+                    {
+                        if (GetDensity(point.m_position) < 0.5f)
+                        {
+                            return false;
+                        }
+
+                        Vegetation::InstanceData instanceData;
+                        instanceData.m_id = m_areaId;
+                        instanceData.m_position = point.m_position;
+                        instanceData.m_normal = point.m_normal;
+                        if (!context.m_existedCallback(point, instanceData))
+                        {
+                            context.m_createdCallback(point, instanceData);
+                        }
+                        return true;
+                    }),
+                availablePoints.end());
+
+            ++m_filledSectorCount;
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+        AZ::EntityId m_areaId;
+        AZStd::atomic_int m_filledSectorCount{ 0 };
+    };
+
+    class VegetationAreaSystemBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+        void InternalSetUp(const benchmark::State& state)
+        {
+            AZ::Debug::TraceMessageBus::Handler::BusConnect();
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(AZ::ComponentApplication::Descriptor());
+            m_app->AddEntity(systemEntity);
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            // Use all of the cores, so that the surface point generation for a batch of sectors can be spread out.
+            AZ::JobManagerDesc jobDesc;
+            const AZ::u32 workerThreadCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u);
+            for (AZ::u32 threadIndex = 0; threadIndex < workerThreadCount; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+
+            m_app->Destroy();
+            m_app.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            AZ::Debug::TraceMessageBus::Handler::BusDisconnect();
+        }
+
+        // Ticks the vegetation system until the area has filled the given number of sectors.
+        static void WaitForSectorFills(BenchmarkArea& area, int sectorCount)
+        {
+            while (area.m_filledSectorCount < sectorCount)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+                AZStd::this_thread::yield();
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    // Teleports the camera back and forth between two locations that are far enough apart that every sector in the
+    // N x N view rectangle needs to be created and filled again.
+    BENCHMARK_DEFINE_F(VegetationAreaSystemBenchmarkFixture, BM_FillSectorWindow)(benchmark::State& state)
+    {
+        const int viewRectangleSize = aznumeric_cast<int>(state.range(0));
+        const int sectorCount = viewRectangleSize * viewRectangleSize;
+
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand(
+            AZStd::string::format("bg_vegetationSectorBatchSize %d", aznumeric_cast<int>(state.range(1))).c_str());
+
+        SyntheticSurfaceHandler surfaceHandler;
+        BenchmarkCamera camera(AZ::EntityId(1000));
+        BenchmarkArea area(AZ::EntityId(1001));
+
+        Vegetation::AreaSystemConfig config;
+        config.m_viewRectangleSize = viewRectangleSize;
+        config.m_threadProcessingIntervalMs = 0;
+        Vegetation::AreaSystemComponent areaSystem(config);
+        areaSystem.Init();
+        areaSystem.Activate();
+
+        // The area covers both camera locations.
+        const AZ::Aabb areaBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-100000.0f), AZ::Vector3(100000.0f));
+        Vegetation::AreaSystemRequestBus::Broadcast(
+            &Vegetation::AreaSystemRequestBus::Events::RegisterArea, area.m_areaId, 0, 0, areaBounds);
+
+        // Fill the initial view rectangle outside of the timed loop.
+        WaitForSectorFills(area, sectorCount);
+
+        const float teleportDistance = aznumeric_cast<float>(viewRectangleSize * config.m_sectorSizeInMeters * 4);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            area.m_filledSectorCount = 0;
+            camera.m_position.SetX((camera.m_position.GetX() == 0.0f) ? teleportDistance : 0.0f);
+            WaitForSectorFills(area, sectorCount);
+        }
+
+        areaSystem.Deactivate();
+
+        state.SetItemsProcessed(state.iterations() * sectorCount);
+    }
+
+    BENCHMARK_REGISTER_F(VegetationAreaSystemBenchmarkFixture, BM_FillSectorWindow)
+        ->Args({ 8, 1 })
+        ->Args({ 8, 8 })
+        ->Args({ 8, 32 })
+        ->Args({ 16, 1 })
+        ->Args({ 16, 8 })
+        ->Args({ 16, 32 })
+        ->Unit(::benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif
@@ -21,6 +21,8 @@
 #include <Vegetation/EmptyInstanceSpawner.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 
 namespace UnitTest
 {
@@ -65,6 +67,43 @@ namespace UnitTest
         }
     };
 
+    // Tracks the batched spawner calls made by the instance system, and supports reusing hidden instances.
+    class MockPoolingInstanceSpawner
+        : public Vegetation::EmptyInstanceSpawner
+    {
+    public:
+        void CreateInstances(AZStd::span<const Vegetation::InstanceData* const> instances, AZStd::span<Vegetation::InstancePtr> outInstances) override
+        {
+            ++m_createBatchCount;
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                outInstances[index] = reinterpret_cast<Vegetation::InstancePtr>(++m_createdCount);
+            }
+        }
+
+        void DestroyInstances(AZStd::span<const Vegetation::InstanceId> ids, [[maybe_unused]] AZStd::span<const Vegetation::InstancePtr> instances) override
+        {
+            ++m_destroyBatchCount;
+            m_destroyedCount += ids.size();
+        }
+
+        bool SupportsInstanceReuse() const override { return true; }
+        void HideInstance([[maybe_unused]] Vegetation::InstancePtr instance) override { ++m_hiddenCount; }
+
+        bool ReuseInstance([[maybe_unused]] Vegetation::InstancePtr instance, [[maybe_unused]] const Vegetation::InstanceData& instanceData) override
+        {
+            ++m_reusedCount;
+            return true;
+        }
+
+        size_t m_createBatchCount = 0;
+        size_t m_createdCount = 0;
+        size_t m_destroyBatchCount = 0;
+        size_t m_destroyedCount = 0;
+        size_t m_hiddenCount = 0;
+        size_t m_reusedCount = 0;
+    };
+
     struct VegetationComponentOperationTests
         : public VegetationComponentTests
     {
@@ -395,6 +434,94 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    TEST_F(VegetationComponentOperationTests, InstanceSystemComponentBatchesAndPoolsInstances)
+    {
+        //the instance system offloads the cleanup of processed tasks to a job
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+        AZ::JobManagerDesc jobDesc;
+        jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        auto jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+        auto jobContext = AZStd::make_unique<AZ::JobContext>(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext.get());
+
+        Vegetation::InstanceSystemConfig instanceSystemConfig;
+        instanceSystemConfig.m_maxInstanceProcessTimeMicroseconds = 33000;
+        instanceSystemConfig.m_maxPooledInstancesPerDescriptor = 4;
+        Vegetation::InstanceSystemComponent* instanceSystemComponent = nullptr;
+        auto instanceSystemEntity = CreateEntity(instanceSystemConfig, &instanceSystemComponent, [](AZ::Entity* e)
+        {
+            e->CreateComponent<Vegetation::DebugSystemComponent>();
+        });
+
+        auto instanceSpawner = AZStd::make_shared<MockPoolingInstanceSpawner>();
+        Vegetation::Descriptor descriptor;
+        descriptor.SetInstanceSpawner(instanceSpawner);
+        Vegetation::DescriptorPtr descriptorPtr;
+        Vegetation::InstanceSystemRequestBus::BroadcastResult(descriptorPtr, &Vegetation::InstanceSystemRequestBus::Events::RegisterUniqueDescriptor, descriptor);
+        ASSERT_TRUE(descriptorPtr);
+
+        AZStd::vector<Vegetation::InstanceData> instances(8);
+        for (auto& instance : instances)
+        {
+            instance.m_descriptorPtr = descriptorPtr;
+        }
+
+        auto processTasks = []()
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+        };
+
+        auto getInstanceCount = []()
+        {
+            AZ::u32 instanceCount = 0;
+            Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+            return instanceCount;
+        };
+
+        //all of the instances are spawned with a single call
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstances, AZStd::span<Vegetation::InstanceData>(instances));
+        processTasks();
+        EXPECT_EQ(instanceSpawner->m_createBatchCount, 1);
+        EXPECT_EQ(instanceSpawner->m_createdCount, 8);
+        EXPECT_EQ(getInstanceCount(), 8);
+
+        //half of the destroyed instances fit in the pool, the rest are destroyed with a single call
+        AZStd::vector<Vegetation::InstanceId> instanceIds;
+        for (const auto& instance : instances)
+        {
+            EXPECT_NE(instance.m_instanceId, Vegetation::InvalidInstanceId);
+            instanceIds.push_back(instance.m_instanceId);
+        }
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstances, AZStd::span<const Vegetation::InstanceId>(instanceIds));
+        processTasks();
+        EXPECT_EQ(instanceSpawner->m_hiddenCount, 4);
+        EXPECT_EQ(instanceSpawner->m_destroyBatchCount, 1);
+        EXPECT_EQ(instanceSpawner->m_destroyedCount, 4);
+        EXPECT_EQ(getInstanceCount(), 0);
+
+        //recreating the instances reuses the pooled ones before spawning new ones
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstances, AZStd::span<Vegetation::InstanceData>(instances));
+        processTasks();
+        EXPECT_EQ(instanceSpawner->m_reusedCount, 4);
+        EXPECT_EQ(instanceSpawner->m_createBatchCount, 2);
+        EXPECT_EQ(instanceSpawner->m_createdCount, 12);
+        EXPECT_EQ(getInstanceCount(), 8);
+
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+        EXPECT_EQ(instanceSpawner->m_destroyedCount, 12);
+        EXPECT_EQ(getInstanceCount(), 0);
+
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::ReleaseUniqueDescriptor, descriptorPtr);
+        descriptorPtr.reset();
+        instances.clear();
+        instanceSystemEntity.reset();
+
+        AZ::JobContext::SetGlobalContext(nullptr);
+        jobContext.reset();
+        jobManager.reset();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+    }
+
     TEST_F(VegetationComponentOperationTests, AreaBlenderComponent)
     {
         auto entityBlocker = CreateEntity<Vegetation::BlockerComponent>(Vegetation::BlockerConfig(), nullptr, [](AZ::Entity* e)
@@ -150,6 +150,16 @@ namespace UnitTest
 
         void DestroyInstance([[maybe_unused]] Vegetation::InstanceId instanceId) override {}
 
+        void CreateInstances(AZStd::span<Vegetation::InstanceData> instanceData) override
+        {
+            for (auto& instance : instanceData)
+            {
+                CreateInstance(instance);
+            }
+        }
+
+        void DestroyInstances([[maybe_unused]] AZStd::span<const Vegetation::InstanceId> instanceIds) override {}
+
         void DestroyAllInstances() override {}
 
         void Cleanup() override {}
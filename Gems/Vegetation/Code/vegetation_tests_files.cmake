@@ -16,6 +16,7 @@ set(FILES
     Tests/EmptyInstanceSpawnerTests.cpp
     Tests/PrefabInstanceSpawnerTests.cpp
     Tests/VegetationAreaSystemComponentTest.cpp
+    Tests/VegetationAreaSystemBenchmarks.cpp
     Tests/VegetationTest.cpp
     Tests/VegetationTest.h
     Source/VegetationModule.cpp